@@ -121,4 +121,7 @@ namespace Obsidian::Information
 
     static_assert((MaxImageCount >= FramesInFlight), "FramesInFlight must be less or equal to the upper limit.");
 
+    // Render targets
+    inline constexpr const uint8_t MaxColourAttachments = 8; // Note: D3D12's fixed limit, Vulkan only guarantees maxColorAttachments >= 4 so it gets checked against the device
+
 }
\ No newline at end of file
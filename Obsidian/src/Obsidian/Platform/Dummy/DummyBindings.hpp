@@ -63,6 +63,7 @@ namespace Obsidian::Internal
         inline constexpr void SetItem(uint32_t slot, Image& image, const ImageSubresourceSpecification& subresources, uint32_t arrayIndex) { (void)slot; (void)image; (void)subresources; (void)arrayIndex; }
         inline constexpr void SetItem(uint32_t slot, Sampler& sampler, uint32_t arrayIndex) { (void)slot; (void)sampler; (void)arrayIndex; }
         inline constexpr void SetItem(uint32_t slot, Buffer& buffer, const BufferRange& range, uint32_t arrayIndex) { (void)slot; (void)buffer; (void)range; (void)arrayIndex; }
+        inline constexpr void SetItems(std::span<const BindingSetItem> items) { (void)items; }
     
         // Getters
         inline const BindingSetSpecification& GetSpecification() const { return m_Specification; }
@@ -27,8 +27,15 @@ namespace Obsidian::Internal
     {
     public:
         // Constructor & Destructor
-        inline constexpr DummyInputLayout(const Device& device, std::span<const VertexAttributeSpecification> attributes) { (void)device; (void)attributes; }
+        inline DummyInputLayout(const Device& device, std::span<const VertexAttributeSpecification> attributes)
+            : m_AttributesHash(HashVertexAttributes(attributes)) { (void)device; }
         constexpr ~DummyInputLayout() = default;
+
+        // Getters
+        inline constexpr size_t GetAttributesHash() const { return m_AttributesHash; }
+
+    private:
+        size_t m_AttributesHash = 0;
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
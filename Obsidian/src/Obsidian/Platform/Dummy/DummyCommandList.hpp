@@ -11,11 +11,13 @@
 
 namespace Obsidian
 {
+	class Device;
 	class Swapchain;
 	class Image;
 	class StagingImage;
 	class Buffer;
 	class Renderpass;
+	class QueryPool;
 	class CommandList;
 	class CommandListPool;
 }
@@ -35,6 +37,8 @@ namespace Obsidian::Internal
 	{
 	public:
 		// Constructor & Destructor
+		inline constexpr DummyCommandListPool(const Device& device, const CommandListPoolSpecification& specs)
+			: m_Specification(specs) { (void)device; }
 		inline constexpr DummyCommandListPool(Swapchain& swapchain, const CommandListPoolSpecification& specs)
 			: m_Specification(specs) { (void)swapchain; }
 		constexpr ~DummyCommandListPool() = default;
@@ -91,16 +95,31 @@ namespace Obsidian::Internal
 
 		inline constexpr void CopyImage(Image& dst, const ImageSliceSpecification& dstSlice, Image& src, const ImageSliceSpecification& srcSlice) { (void)dst; (void)dstSlice; (void)src; (void)srcSlice; }
 		inline constexpr void CopyImage(Image& dst, const ImageSliceSpecification& dstSlice, StagingImage& src, const ImageSliceSpecification& srcSlice) { (void)dst; (void)dstSlice; (void)src; (void)srcSlice; }
+		inline constexpr void CopyImage(StagingImage& dst, const ImageSliceSpecification& dstSlice, Image& src, const ImageSliceSpecification& srcSlice) { (void)dst; (void)dstSlice; (void)src; (void)srcSlice; }
+		inline constexpr void CopyImage(Buffer& dst, size_t dstOffset, Image& src, const ImageSliceSpecification& srcSlice) { (void)dst; (void)dstOffset; (void)src; (void)srcSlice; }
 		inline constexpr void CopyBuffer(Buffer& dst, Buffer& src, size_t size, size_t srcOffset, size_t dstOffset) { (void)dst; (void)src; (void)size; (void)srcOffset; (void)dstOffset; }
 
+		inline constexpr void GenerateMips(Image& image, const ImageSubresourceSpecification& subresources) { (void)image; (void)subresources; }
+
 		inline constexpr void Dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) const { (void)groupsX; (void)groupsY; (void)groupsZ; }
+		inline constexpr void DispatchIndirect(Buffer& argumentBuffer, size_t offset) { (void)argumentBuffer; (void)offset; }
+
+		// Query methods
+		inline constexpr void ResetQueries(QueryPool& pool, uint32_t firstQuery, uint32_t queryCount) { (void)pool; (void)firstQuery; (void)queryCount; }
+		inline constexpr void BeginQuery(QueryPool& pool, uint32_t query) { (void)pool; (void)query; }
+		inline constexpr void EndQuery(QueryPool& pool, uint32_t query) { (void)pool; (void)query; }
+		inline constexpr void BeginTimerQuery(QueryPool& pool, uint32_t timer) { (void)pool; (void)timer; }
+		inline constexpr void EndTimerQuery(QueryPool& pool, uint32_t timer) { (void)pool; (void)timer; }
 
 		// State methods
 		inline constexpr void RequireState(Image& image, const ImageSubresourceSpecification& subresources, ResourceState state) { (void)image; (void)subresources; (void)state; }
 		inline constexpr void RequireState(Buffer& buffer, ResourceState state) { (void)buffer; (void)state; }
+		inline constexpr void AliasImage(Image& image, ResourceState state) { (void)image; (void)state; }
 
 		// Draw methods
 		inline constexpr void DrawIndexed(const DrawArguments& args) const { (void)args; }
+		inline constexpr void DrawIndexedIndirect(Buffer& argumentBuffer, size_t offset, uint32_t drawCount, uint32_t stride) { (void)argumentBuffer; (void)offset; (void)drawCount; (void)stride; }
+		inline constexpr void DrawIndexedIndirectCount(Buffer& argumentBuffer, size_t offset, Buffer& countBuffer, size_t countOffset, uint32_t maxDrawCount, uint32_t stride) { (void)argumentBuffer; (void)offset; (void)countBuffer; (void)countOffset; (void)maxDrawCount; (void)stride; }
 
 		// Other methods
 		inline constexpr void PushConstants(const void* memory, size_t size, size_t srcOffset, size_t dstOffset) { (void)memory; (void)size; (void)srcOffset; (void)dstOffset; }
@@ -108,6 +127,8 @@ namespace Obsidian::Internal
 		// Getters
 		inline constexpr const CommandListSpecification& GetSpecification() const { return m_Specification; }
 
+		inline constexpr uint64_t GetSignaledValue() const { return 0; }
+
 	private:
 		CommandListSpecification m_Specification;
 	};
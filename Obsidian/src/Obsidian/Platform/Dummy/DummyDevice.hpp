@@ -3,13 +3,22 @@
 #include "Obsidian/Core/Information.hpp"
 
 #include "Obsidian/Renderer/DeviceSpec.hpp"
+#include "Obsidian/Renderer/ImageSpec.hpp"
+#include "Obsidian/Renderer/BufferSpec.hpp"
+#include "Obsidian/Renderer/CommandListSpec.hpp"
 
 #include <Nano/Nano.hpp>
 
+#include <span>
+#include <vector>
+
 namespace Obsidian
 {
     class Swapchain;
+    class CommandList;
+    class CommandListPool;
     class Image;
+    class ImageHeap;
     class StagingImage;
     class Sampler;
     class InputLayout;
@@ -20,6 +29,8 @@ namespace Obsidian
     class Renderpass;
     class Shader;
     class GraphicsPipeline;
+    class QueryPool;
+    class UploadManager;
 }
 
 namespace Obsidian::Internal
@@ -41,12 +52,24 @@ namespace Obsidian::Internal
         // Methods
         inline constexpr void Wait() const {}
 
+        inline constexpr void Submit(std::span<CommandList*> lists, const CommandListSubmitArgs& args) const { (void)lists; (void)args; }
+
+        inline constexpr uint64_t GetSubmittedValue() const { return 0; }
+        inline constexpr uint64_t GetCompletedValue() const { return 0; }
+        inline constexpr void WaitForValue(uint64_t value) const { (void)value; }
+
         inline constexpr void MapBuffer(const Buffer& buffer, void*& memory) const { (void)buffer; memory = nullptr; }
         inline constexpr void UnmapBuffer(const Buffer& buffer) const { (void)buffer; }
+        inline constexpr void FlushBuffer(const Buffer& buffer, const BufferRange& range) const { (void)buffer; (void)range; }
+        inline constexpr void InvalidateBuffer(const Buffer& buffer, const BufferRange& range) const { (void)buffer; (void)range; }
 
         inline constexpr void WriteBuffer(const Buffer& buffer, const void* memory, size_t size, size_t srcOffset, size_t dstOffset) const { (void)buffer; (void)memory; (void)size; (void)srcOffset; (void)dstOffset; }
         inline constexpr void WriteImage(const StagingImage& image, const ImageSliceSpecification& slice, const void* memory, size_t size) const { (void)image; (void)slice; (void)memory; (void)size; }
 
+        inline std::vector<uint8_t> GetPipelineCacheData() const { return {}; }
+
+        inline constexpr ImageMemoryRequirements GetImageMemoryRequirements(const ImageSpecification& specs) const { return { static_cast<size_t>(specs.Width) * specs.Height * specs.Depth * specs.ArraySize * specs.SampleCount * FormatToFormatInfo(specs.ImageFormat).BytesPerBlock, 1, 1 }; } // Note: Rough estimate, only used to keep the aliasing logic working
+
         inline constexpr void StartTracking(const Image& image, ImageSubresourceSpecification subresources, ResourceState currentState) { (void)image; (void)subresources; (void)currentState; }
         inline constexpr void StartTracking(const StagingImage& image, ResourceState currentState) { (void)image; (void)currentState; }
         inline constexpr void StartTracking(const Buffer& buffer, ResourceState currentState) { (void)buffer; (void)currentState; }
@@ -56,8 +79,10 @@ namespace Obsidian::Internal
 
         // Destruction methods
         inline constexpr void DestroySwapchain(Swapchain& swapchain) const { (void)swapchain; }
+        inline constexpr void FreePool(CommandListPool& pool) const { (void)pool; }
 
         inline constexpr void DestroyImage(Image& image) const { (void)image; }
+        inline constexpr void DestroyImageHeap(ImageHeap& heap) const { (void)heap; }
         inline constexpr void DestroySubresourceViews(Image& image) const { (void)image; }
         inline constexpr void DestroyStagingImage(StagingImage& stagingImage) const { (void)stagingImage; }
         inline constexpr void DestroySampler(Sampler& sampler) const { (void)sampler; }
@@ -76,6 +101,10 @@ namespace Obsidian::Internal
 
         inline constexpr void DestroyGraphicsPipeline(GraphicsPipeline& pipeline) const { (void)pipeline; }
         inline constexpr void DestroyComputePipeline(ComputePipeline& pipeline) const { (void)pipeline; }
+
+        inline constexpr void DestroyQueryPool(QueryPool& pool) const { (void)pool; }
+
+        inline constexpr void DestroyUploadManager(UploadManager& manager) const { (void)manager; }
     };
 #endif
 
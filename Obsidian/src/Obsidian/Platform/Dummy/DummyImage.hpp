@@ -11,17 +11,37 @@ namespace Obsidian
 {
 	class Device;
 	class Image;
+	class ImageHeap;
 }
 
 namespace Obsidian::Internal
 {
 
 	class DummySwapchain;
+	class DummyImageHeap;
 	class DummyImage;
 	class DummyStagingImage;
 	class DummySampler;
 
 #if 1 //defined(OB_API_DUMMY)
+	////////////////////////////////////////////////////////////////////////////////////
+	// DummyImageHeap
+	////////////////////////////////////////////////////////////////////////////////////
+	class DummyImageHeap
+	{
+	public:
+		// Constructor & Destructor
+		inline constexpr DummyImageHeap(const Device& device, const ImageHeapSpecification& specs)
+			: m_Specification(specs) { (void)device; }
+		constexpr ~DummyImageHeap() = default;
+
+		// Getters
+		inline constexpr const ImageHeapSpecification& GetSpecification() const { return m_Specification; }
+
+	private:
+		ImageHeapSpecification m_Specification;
+	};
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// DummyImage
 	////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +51,8 @@ namespace Obsidian::Internal
 		// Constructors & Destructor
 		inline constexpr DummyImage(const Device& device, const ImageSpecification& specs)
 			: m_Specification(specs) { (void)device; }
+		inline constexpr DummyImage(const Device& device, const ImageSpecification& specs, const ImageHeap& heap, size_t offset)
+			: m_Specification(specs) { (void)device; (void)heap; (void)offset; }
 		constexpr ~DummyImage() = default;
 
 		// Methods
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/QueryPoolSpec.hpp"
+
+#include <Nano/Nano.hpp>
+
+#include <span>
+
+namespace Obsidian
+{
+    class Device;
+}
+
+namespace Obsidian::Internal
+{
+
+    class DummyQueryPool;
+
+#if 1 //defined(OB_API_DUMMY)
+    ////////////////////////////////////////////////////////////////////////////////////
+    // DummyQueryPool
+    ////////////////////////////////////////////////////////////////////////////////////
+    class DummyQueryPool
+    {
+    public:
+        // Constructor & Destructor
+        inline constexpr DummyQueryPool(const Device& device, const QueryPoolSpecification& specs)
+            : m_Specification(specs) { (void)device; }
+        constexpr ~DummyQueryPool() = default;
+
+        // Methods
+        inline constexpr bool GetResults(uint32_t firstQuery, uint32_t queryCount, std::span<uint64_t> results) const { (void)firstQuery; (void)queryCount; (void)results; return false; }
+
+        inline constexpr bool GetTimerResult(uint32_t timer, double& milliseconds) const { (void)timer; (void)milliseconds; return false; }
+        inline constexpr bool GetPipelineStatistics(uint32_t query, PipelineStatistics& statistics) const { (void)query; (void)statistics; return false; }
+
+        // Getters
+        inline constexpr const QueryPoolSpecification& GetSpecification() const { return m_Specification; }
+
+    private:
+        QueryPoolSpecification m_Specification;
+    };
+#endif
+
+}
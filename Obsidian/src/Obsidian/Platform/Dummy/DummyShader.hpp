@@ -6,7 +6,9 @@
 
 #include <Nano/Nano.hpp>
 
+#include <span>
 #include <vector>
+#include <future>
 
 namespace Obsidian
 {
@@ -27,15 +29,17 @@ namespace Obsidian::Internal
     {
     public:
         // Constructors & Destructor
-        inline constexpr DummyShader(const Device& device, const ShaderSpecification& specs)
-            : m_Specification(specs) { (void)device; }
+        inline DummyShader(const Device& device, const ShaderSpecification& specs)
+            : m_Specification(specs), m_CodeHash(HashShaderCode(specs)) { (void)device; }
         constexpr ~DummyShader() = default;
 
         // Getters
         inline constexpr const ShaderSpecification& GetSpecification() const { return m_Specification; }
+        inline constexpr size_t GetCodeHash() const { return m_CodeHash; }
 
     private:
         ShaderSpecification m_Specification;
+        size_t m_CodeHash = 0;
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -45,11 +49,15 @@ namespace Obsidian::Internal
     {
     public:
         // Constructors & Destructor
-        inline constexpr DummyShaderCompiler() = default;
+        inline DummyShaderCompiler(const ShaderCompilerSpecification& specs) { (void)specs; }
         constexpr ~DummyShaderCompiler() = default;
 
         // Methods
         inline std::vector<uint32_t> CompileToSPIRV(ShaderStage stage, const std::string& code, const std::string& entryPoint, ShadingLanguage language) { (void)stage; (void)code; (void)entryPoint; (void)language; return {}; }
+        inline std::vector<uint32_t> CompileToSPIRV(const ShaderCompileArgs& args) { (void)args; return {}; }
+
+        inline std::future<std::vector<uint32_t>> CompileAsync(const ShaderCompileArgs& args) { (void)args; std::promise<std::vector<uint32_t>> promise; promise.set_value({}); return promise.get_future(); }
+        inline std::vector<std::vector<uint32_t>> CompileBatch(std::span<const ShaderCompileArgs> args) { return std::vector<std::vector<uint32_t>>(args.size()); }
     };
 #endif
 
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/API.hpp"
+#include "Obsidian/Renderer/ImageSpec.hpp"
+#include "Obsidian/Renderer/ResourceSpec.hpp"
+#include "Obsidian/Renderer/UploadManagerSpec.hpp"
+
+#include <Nano/Nano.hpp>
+
+namespace Obsidian
+{
+    class Device;
+    class Image;
+    class Buffer;
+}
+
+namespace Obsidian::Internal
+{
+
+    class DummyUploadManager;
+
+#if 1 //defined(OB_API_DUMMY)
+    ////////////////////////////////////////////////////////////////////////////////////
+    // DummyUploadManager
+    ////////////////////////////////////////////////////////////////////////////////////
+    class DummyUploadManager
+    {
+    public:
+        // Constructor & Destructor
+        inline DummyUploadManager(const Device& device, const UploadManagerSpecification& specs)
+            : m_Specification(specs) { (void)device; }
+        constexpr ~DummyUploadManager() = default;
+
+        // Methods
+        inline constexpr UploadTicket UploadBuffer(Buffer& dst, const void* memory, size_t size, size_t dstOffset, ResourceState finalState) { (void)dst; (void)memory; (void)size; (void)dstOffset; (void)finalState; return {}; }
+        inline constexpr UploadTicket UploadImage(Image& dst, const ImageSliceSpecification& slice, const void* memory, size_t size, ResourceState finalState) { (void)dst; (void)slice; (void)memory; (void)size; (void)finalState; return {}; }
+
+        inline constexpr UploadTicket Flush() { return {}; }
+
+        inline constexpr bool IsComplete(const UploadTicket& ticket) const { (void)ticket; return true; }
+        inline constexpr void Wait(const UploadTicket& ticket) const { (void)ticket; }
+
+        // Getters
+        inline const UploadManagerSpecification& GetSpecification() const { return m_Specification; }
+
+    private:
+        UploadManagerSpecification m_Specification;
+    };
+#endif
+
+}
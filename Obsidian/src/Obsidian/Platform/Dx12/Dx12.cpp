@@ -148,4 +148,33 @@ namespace Obsidian::Internal
         return allocation;
     }
 
-}
\ No newline at end of file
+    D3D12_RESOURCE_ALLOCATION_INFO Dx12Allocator::GetImageAllocationInfo(const D3D12_RESOURCE_DESC& resourceDesc) const
+    {
+        return m_Device->GetResourceAllocationInfo(0, 1, &resourceDesc);
+    }
+
+    DxPtr<D3D12MA::Allocation> Dx12Allocator::AllocateImageMemory(size_t size, size_t alignment, D3D12_HEAP_FLAGS heapFlags) const
+    {
+        ALLOCATION_DESC allocDesc = {};
+        allocDesc.Flags = ALLOCATION_FLAG_NONE;
+        allocDesc.HeapType = D3D12_HEAP_TYPE_DEFAULT;
+        allocDesc.ExtraHeapFlags = heapFlags;
+        allocDesc.CustomPool = nullptr;
+        allocDesc.pPrivateData = nullptr;
+
+        D3D12_RESOURCE_ALLOCATION_INFO allocInfo = {};
+        allocInfo.SizeInBytes = static_cast<UINT64>(size);
+        allocInfo.Alignment = static_cast<UINT64>(std::max<size_t>(alignment, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT));
+
+        DxPtr<Allocation> allocation;
+        DX_VERIFY(m_Allocator->AllocateMemory(&allocDesc, &allocInfo, &allocation));
+
+        return allocation;
+    }
+
+    void Dx12Allocator::CreateAliasingImage(DxPtr<D3D12MA::Allocation> allocation, size_t offset, DxPtr<ID3D12Resource>& resource, D3D12_RESOURCE_STATES initialState, D3D12_RESOURCE_DESC resourceDesc) const
+    {
+        DX_VERIFY(m_Allocator->CreateAliasingResource(allocation.Get(), static_cast<UINT64>(offset), &resourceDesc, initialState, nullptr, IID_PPV_ARGS(&resource)));
+    }
+
+}
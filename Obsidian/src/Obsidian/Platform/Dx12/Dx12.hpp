@@ -62,6 +62,11 @@ namespace Obsidian::Internal
         DxPtr<D3D12MA::Allocation> CreateImage(DxPtr<ID3D12Resource>& resource, D3D12_RESOURCE_STATES initialState, D3D12_RESOURCE_DESC resourceDesc, D3D12_HEAP_TYPE heapType = D3D12_HEAP_TYPE_DEFAULT) const;
         DxPtr<D3D12MA::Allocation> CreateImage(DxPtr<ID3D12Resource>& resource, D3D12_RESOURCE_STATES initialState, D3D12_RESOURCE_DESC resourceDesc, D3D12MA::ALLOCATION_DESC allocationDesc) const;
 
+        // Note: Memory that images get placed in through CreateAliasingImage, the images hold a reference to the allocation.
+        D3D12_RESOURCE_ALLOCATION_INFO GetImageAllocationInfo(const D3D12_RESOURCE_DESC& resourceDesc) const;
+        DxPtr<D3D12MA::Allocation> AllocateImageMemory(size_t size, size_t alignment, D3D12_HEAP_FLAGS heapFlags) const;
+        void CreateAliasingImage(DxPtr<D3D12MA::Allocation> allocation, size_t offset, DxPtr<ID3D12Resource>& resource, D3D12_RESOURCE_STATES initialState, D3D12_RESOURCE_DESC resourceDesc) const;
+
         // Utils
         //void MapMemory(VmaAllocation allocation, void*& mapData) const;
         //void UnmapMemory(VmaAllocation allocation) const;
@@ -187,6 +187,20 @@ namespace Obsidian::Internal
                 // Sampler
                 case ResourceType::Sampler:
                 {
+                    // Note: Immutable samplers become static samplers in the root signature, one per register
+                    if (item.IsImmutableSampler())
+                    {
+                        for (uint32_t i = 0; i < item.GetArraySize(); i++)
+                        {
+                            D3D12_STATIC_SAMPLER_DESC& staticSampler = m_StaticSamplers.emplace_back(SamplerSpecificationToD3D12StaticSamplerDesc(item.ImmutableSampler.value()));
+                            staticSampler.ShaderRegister = item.Slot + i;
+                            staticSampler.RegisterSpace = registerSpace;
+                            staticSampler.ShaderVisibility = ShaderStageToD3D12ShaderVisibility(item.Visibility);
+                        }
+
+                        break;
+                    }
+
                     auto& [slot, visibility, range] = m_SamplerRanges.emplace_back();
 
                     range.Init(D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER, item.GetArraySize(), item.Slot, registerSpace);
@@ -262,6 +276,7 @@ namespace Obsidian::Internal
         const auto& item = dxLayout.GetItem(slot);
 
         OB_ASSERT((item.Type == ResourceType::Sampler), "[Dx12BindingSet] When uploading a sampler the ResourceType must be Sampler.");
+        OB_ASSERT(!item.IsImmutableSampler(), "[Dx12BindingSet] Slot {0} uses an immutable sampler, which can't be overwritten.", slot);
 
         //Dx12Sampler& dxSampler = *api_cast<Dx12Sampler*>(&sampler);
         DescriptorHeapIndex index = m_SamplerBeginIndex + dxLayout.GetSlotToHeapOffset(slot) + arrayIndex;
@@ -314,6 +329,20 @@ namespace Obsidian::Internal
         }
     }
 
+    void Dx12BindingSet::SetItems(std::span<const BindingSetItem> items)
+    {
+        // Note: Descriptors are written straight into the CPU visible heaps, so there is no driver call to batch
+        for (const BindingSetItem& item : items)
+        {
+            if (Image* const* image = std::get_if<Image*>(&item.Resource))
+                SetItem(item.Slot, **image, item.Subresources, item.ArrayIndex);
+            else if (Sampler* const* sampler = std::get_if<Sampler*>(&item.Resource))
+                SetItem(item.Slot, **sampler, item.ArrayIndex);
+            else if (Buffer* const* buffer = std::get_if<Buffer*>(&item.Resource))
+                SetItem(item.Slot, **buffer, item.Range, item.ArrayIndex);
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
@@ -79,6 +79,7 @@ namespace Obsidian::Internal
         inline const std::vector<Range>& GetSRVAndUAVAndCBVRanges() const { return m_SRVAndUAVAndCBVRanges; }
         inline const std::vector<Range>& GetSamplerRanges() const { return m_SamplerRanges; }
         inline const std::vector<DynamicRange>& GetDynamicRanges() const { return m_DynamicRanges; }
+        inline const std::vector<D3D12_STATIC_SAMPLER_DESC>& GetStaticSamplers() const { return m_StaticSamplers; }
     
     private:
         // Private methods
@@ -95,6 +96,7 @@ namespace Obsidian::Internal
         std::vector<Range> m_SRVAndUAVAndCBVRanges; // TODO: Make actual ranges instead of seperate elements a seperate range
         std::vector<Range> m_SamplerRanges;
         std::vector<DynamicRange> m_DynamicRanges; // Note: We don't need a seperate sampler one, since there is no such thing as a dynamic sampler.
+        std::vector<D3D12_STATIC_SAMPLER_DESC> m_StaticSamplers; // Note: From immutable samplers, baked into the root signature
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -111,6 +113,7 @@ namespace Obsidian::Internal
         void SetItem(uint32_t slot, Image& image, const ImageSubresourceSpecification& subresources, uint32_t arrayIndex);
         void SetItem(uint32_t slot, Sampler& sampler, uint32_t arrayIndex);
         void SetItem(uint32_t slot, Buffer& buffer, const BufferRange& range, uint32_t arrayIndex);
+        void SetItems(std::span<const BindingSetItem> items);
 
         // Getters
         inline const BindingSetSpecification& GetSpecification() const { return m_Specification; }
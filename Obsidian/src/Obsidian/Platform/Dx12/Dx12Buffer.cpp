@@ -15,7 +15,7 @@ namespace Obsidian::Internal
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
     Dx12InputLayout::Dx12InputLayout(const Device& device, std::span<const VertexAttributeSpecification> attributes)
-        : m_Attributes(attributes.begin(), attributes.end())
+        : m_Attributes(attributes.begin(), attributes.end()), m_AttributesHash(HashVertexAttributes(attributes))
     {
         (void)device;
 
@@ -169,6 +169,12 @@ namespace Obsidian::Internal
             flags, heapType
         );
 
+        if (m_Specification.IsPersistentlyMapped)
+        {
+            OB_ASSERT((heapType == D3D12_HEAP_TYPE_UPLOAD), "[Dx12Buffer] A persistently mapped buffer must have the CpuAccessMode::Write flag.");
+            DX_VERIFY(m_Resource->Map(0, nullptr, &m_MappedMemory)); // Note: Upload heaps are write-combined & coherent, they can stay mapped for the buffer's lifetime
+        }
+
         if constexpr (Information::Validation)
         {
             if (!m_Specification.DebugName.empty())
@@ -33,6 +33,9 @@ namespace Obsidian::Internal
         Dx12InputLayout(const Device& device, std::span<const VertexAttributeSpecification> attributes);
         ~Dx12InputLayout();
 
+        // Getters
+        inline size_t GetAttributesHash() const { return m_AttributesHash; }
+
         // Internal getters
         inline const std::vector<D3D12_INPUT_ELEMENT_DESC>& GetInputElements() const { return m_InputElements; }
     
@@ -47,6 +50,7 @@ namespace Obsidian::Internal
     
     private:
         std::vector<VertexAttributeSpecification> m_Attributes;
+        size_t m_AttributesHash = 0;
         std::vector<D3D12_INPUT_ELEMENT_DESC> m_InputElements = {};
 
         uint32_t m_Stride = 0;
@@ -71,6 +75,8 @@ namespace Obsidian::Internal
         inline DxPtr<ID3D12Resource> GetD3D12Resource() const { return m_Resource; }
         inline DxPtr<D3D12MA::Allocation> GetD3D12MAAllocation() const { return m_Allocation; }
 
+        inline void* GetMappedMemory() const { return m_MappedMemory; } // Note: Is nullptr when the buffer isn't persistently mapped
+
     private:
         BufferSpecification m_Specification;
         size_t m_Alignment = 0;
@@ -78,6 +84,8 @@ namespace Obsidian::Internal
         DxPtr<ID3D12Resource> m_Resource = nullptr;
         DxPtr<D3D12MA::Allocation> m_Allocation = nullptr;
 
+        void* m_MappedMemory = nullptr;
+
         friend class Dx12Device;
     };
 #endif
@@ -14,6 +14,7 @@
 #include "Obsidian/Renderer/Image.hpp"
 #include "Obsidian/Renderer/Pipeline.hpp"
 #include "Obsidian/Renderer/Bindings.hpp"
+#include "Obsidian/Renderer/QueryPool.hpp"
 
 #include "Obsidian/Platform/Dx12/Dx12Device.hpp"
 #include "Obsidian/Platform/Dx12/Dx12Buffer.hpp"
@@ -23,6 +24,7 @@
 #include "Obsidian/Platform/Dx12/Dx12Framebuffer.hpp"
 #include "Obsidian/Platform/Dx12/Dx12Pipeline.hpp"
 #include "Obsidian/Platform/Dx12/Dx12Bindings.hpp"
+#include "Obsidian/Platform/Dx12/Dx12QueryPool.hpp"
 
 namespace Obsidian::Internal
 {
@@ -52,23 +54,62 @@ namespace Obsidian::Internal
             return D3D12_COMMAND_LIST_TYPE_NONE;
         }
 
+        // Note: The parameters must stay alive until BeginRenderPass is called
+        void SetResolveEndingAccess(D3D12_RENDER_PASS_ENDING_ACCESS& access, const Image& src, const ImageSubresourceSpecification& srcSubresources, const Image& dst, const ImageSubresourceSpecification& dstSubresources, bool preserveSource, std::vector<D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS>& parameters)
+        {
+            const ImageSpecification& srcSpecs = src.GetSpecification();
+            const ImageSpecification& dstSpecs = dst.GetSpecification();
+            ImageSubresourceSpecification resSrcSubresources = ResolveImageSubresource(srcSubresources, srcSpecs, true);
+            ImageSubresourceSpecification resDstSubresources = ResolveImageSubresource(dstSubresources, dstSpecs, true);
+
+            OB_ASSERT((srcSpecs.SampleCount > 1), "[Dx12CommandList] Only multisampled colour attachments can be resolved.");
+            OB_ASSERT((dstSpecs.SampleCount == 1), "[Dx12CommandList] Resolve attachments can't be multisampled.");
+            OB_ASSERT((resSrcSubresources.NumArraySlices == resDstSubresources.NumArraySlices), "[Dx12CommandList] Resolve source and destination must have the same amount of array slices.");
+
+            parameters.clear();
+            for (uint32_t i = 0; i < resSrcSubresources.NumArraySlices; i++)
+            {
+                D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS& subresource = parameters.emplace_back();
+                subresource.SrcSubresource = CalculateSubresource(resSrcSubresources.BaseMipLevel, resSrcSubresources.BaseArraySlice + i, 0, srcSpecs.MipLevels, srcSpecs.ArraySize);
+                subresource.DstSubresource = CalculateSubresource(resDstSubresources.BaseMipLevel, resDstSubresources.BaseArraySlice + i, 0, dstSpecs.MipLevels, dstSpecs.ArraySize);
+                subresource.DstX = 0;
+                subresource.DstY = 0;
+                subresource.SrcRect = { 0, 0, static_cast<LONG>(std::max(srcSpecs.Width >> resSrcSubresources.BaseMipLevel, 1u)), static_cast<LONG>(std::max(srcSpecs.Height >> resSrcSubresources.BaseMipLevel, 1u)) };
+            }
+
+            access.Type = D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_RESOLVE;
+            access.Resolve.pSrcResource = api_cast<const Dx12Image*>(&src)->GetD3D12Resource().Get();
+            access.Resolve.pDstResource = api_cast<const Dx12Image*>(&dst)->GetD3D12Resource().Get();
+            access.Resolve.SubresourceCount = static_cast<UINT>(parameters.size());
+            access.Resolve.pSubresourceParameters = parameters.data();
+            access.Resolve.Format = FormatToFormatMapping(dstSpecs.ImageFormat).RTVFormat;
+            access.Resolve.ResolveMode = D3D12_RESOLVE_MODE_AVERAGE;
+            access.Resolve.PreserveResolveSource = (preserveSource ? TRUE : FALSE);
+        }
+
     }
 
 	////////////////////////////////////////////////////////////////////////////////////
 	// Constructor & Destructor
 	////////////////////////////////////////////////////////////////////////////////////
-	Dx12CommandListPool::Dx12CommandListPool(Swapchain& swapchain, const CommandListPoolSpecification& specs)
-		: m_Swapchain(*api_cast<Dx12Swapchain*>(&swapchain)), m_Specification(specs)
+	Dx12CommandListPool::Dx12CommandListPool(const Device& device, const CommandListPoolSpecification& specs)
+		: m_Device(*api_cast<const Dx12Device*>(&device)), m_Specification(specs)
 	{
-		DX_VERIFY(m_Swapchain.GetDx12Device().GetContext().GetD3D12Device()->CreateCommandAllocator(CommandQueueToD3D12CommandListType(specs.Queue), IID_PPV_ARGS(&m_CommandAllocator)));
+		DX_VERIFY(m_Device.GetContext().GetD3D12Device()->CreateCommandAllocator(CommandQueueToD3D12CommandListType(specs.Queue), IID_PPV_ARGS(&m_CommandAllocator)));
 
         if constexpr (Information::Validation)
         {
             if (!m_Specification.DebugName.empty())
-                m_Swapchain.GetDx12Device().GetContext().SetDebugName(m_CommandAllocator.Get(), std::string(m_Specification.DebugName));
+                m_Device.GetContext().SetDebugName(m_CommandAllocator.Get(), std::string(m_Specification.DebugName));
         }
     }
 
+	Dx12CommandListPool::Dx12CommandListPool(Swapchain& swapchain, const CommandListPoolSpecification& specs)
+		: Dx12CommandListPool(*api_cast<const Device*>(&api_cast<Dx12Swapchain*>(&swapchain)->GetDx12Device()), specs)
+	{
+		m_Swapchain = api_cast<Dx12Swapchain*>(&swapchain);
+	}
+
 	Dx12CommandListPool::~Dx12CommandListPool()
 	{
 	}
@@ -80,7 +121,7 @@ namespace Obsidian::Internal
 	{
         Dx12CommandList& dxCommandList = *api_cast<Dx12CommandList*>(&list);
 
-        m_Swapchain.GetDx12Device().GetContext().Destroy([commandList = dxCommandList.GetID3D12GraphicsCommandList(), idleEvent = dxCommandList.GetWaitIdleEvent()]() { CloseHandle(idleEvent); }); // Note: Holding a reference to the resource is enough to keep it alive (and destroy when the scope ends)
+        m_Device.GetContext().Destroy([commandList = dxCommandList.GetID3D12GraphicsCommandList(), idleEvent = dxCommandList.GetWaitIdleEvent()]() { CloseHandle(idleEvent); }); // Note: Holding a reference to the resource is enough to keep it alive (and destroy when the scope ends)
 
         dxCommandList.m_CommandList = nullptr;
 	}
@@ -96,14 +137,23 @@ namespace Obsidian::Internal
 		m_CommandAllocator->Reset();
 	}
 
+	////////////////////////////////////////////////////////////////////////////////////
+	// Internal getters
+	////////////////////////////////////////////////////////////////////////////////////
+	Dx12Swapchain& Dx12CommandListPool::GetDx12Swapchain() const
+	{
+		OB_ASSERT(m_Swapchain, "[Dx12CommandListPool] CommandListPool was not allocated from a Swapchain, so there's no Swapchain to retrieve.");
+		return *m_Swapchain;
+	}
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
     Dx12CommandList::Dx12CommandList(CommandListPool& pool, const CommandListSpecification& specs)
-        : m_Pool(*api_cast<Dx12CommandListPool*>(&pool)), m_Specification(specs)
+        : m_Pool(*api_cast<Dx12CommandListPool*>(&pool)), m_Specification(specs), m_StateTracker(m_Pool.GetDx12Device().GetTracker())
     {
         DxPtr<ID3D12CommandList> list;
-        DX_VERIFY(m_Pool.GetDx12Swapchain().GetDx12Device().GetContext().GetD3D12Device()->CreateCommandList(0, CommandQueueToD3D12CommandListType(m_Pool.GetSpecification().Queue), m_Pool.GetD3D12CommandAllocator().Get(), nullptr, IID_PPV_ARGS(&list)));
+        DX_VERIFY(m_Pool.GetDx12Device().GetContext().GetD3D12Device()->CreateCommandList(0, CommandQueueToD3D12CommandListType(m_Pool.GetSpecification().Queue), m_Pool.GetD3D12CommandAllocator().Get(), nullptr, IID_PPV_ARGS(&list)));
         
         DX_VERIFY(list->QueryInterface(IID_PPV_ARGS(&m_CommandList)));
 
@@ -114,7 +164,7 @@ namespace Obsidian::Internal
         if constexpr (Information::Validation)
         {
             if (!m_Specification.DebugName.empty())
-                m_Pool.GetDx12Swapchain().GetDx12Device().GetContext().SetDebugName(m_CommandList.Get(), std::string(m_Specification.DebugName));
+                m_Pool.GetDx12Device().GetContext().SetDebugName(m_CommandList.Get(), std::string(m_Specification.DebugName));
         }
     }
 
@@ -128,6 +178,10 @@ namespace Obsidian::Internal
     void Dx12CommandList::Open()
     {
         OB_PROFILE("Dx12CommandList::Open()");
+        m_StateTracker.Reset();
+        m_ResolvedQueries.clear();
+        m_BoundSets.fill(nullptr);
+
         DX_VERIFY(m_CommandList->Reset(m_Pool.GetD3D12CommandAllocator().Get(), nullptr));
     }
 
@@ -141,41 +195,19 @@ namespace Obsidian::Internal
 
     void Dx12CommandList::Submit(const CommandListSubmitArgs& args)
     {
-        OB_PROFILE("VulkanCommandBuffer::Submit()");
-
-        std::span<const CommandList*> waitOn;
-        std::visit([&](auto&& arg)
-        {
-            if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, std::vector<const CommandList*>>)
-                waitOn = const_cast<std::vector<const CommandList*>&>(arg); // Note: This is worst thing I have done in my life. I can never recover.
-            else if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, std::span<const CommandList*>>)
-                waitOn = arg;
-        }, args.WaitOnLists);
-
-        auto queue = m_Pool.GetDx12Swapchain().GetDx12Device().GetContext().GetD3D12CommandQueue(m_Pool.GetSpecification().Queue);
-        for (auto list : waitOn)
-        {
-            DX_VERIFY(queue->Wait(m_Pool.GetDx12Swapchain().GetD3D12Fence().Get(), m_Pool.GetDx12Swapchain().GetPreviousCommandListWaitValue(*api_cast<const Dx12CommandList*>(list))));
-        }
+        OB_PROFILE("Dx12CommandList::Submit()");
 
-        // Note: Waiting on swapchain image is not a thing that needs to be handled manually for DX12
-        
-        ID3D12CommandList* lists[] = { m_CommandList.Get() };
-        queue->ExecuteCommandLists(1, lists);
-
-        m_SignaledValue = m_Pool.GetDx12Swapchain().RetrieveCommandListWaitValue(*this);
-        DX_VERIFY(queue->Signal(m_Pool.GetDx12Swapchain().GetD3D12Fence().Get(), m_SignaledValue));
-        
-        if (args.OnFinishMakeSwapchainPresentable)
-            m_Pool.GetDx12Swapchain().SetPresentableValue(m_SignaledValue);
+        CommandList* list = api_cast<CommandList*>(this);
+        m_Pool.GetDx12Device().Submit(std::span<CommandList*>(&list, 1), args);
     }
 
     void Dx12CommandList::WaitTillComplete() const
     {
         OB_PROFILE("Dx12CommandList::WaitTillComplete()");
 
-        DxPtr<ID3D12CommandQueue> queue = m_Pool.GetDx12Swapchain().GetDx12Device().GetContext().GetD3D12CommandQueue(m_Pool.GetSpecification().Queue);
-        DxPtr<ID3D12Fence> fence = m_Pool.GetDx12Swapchain().GetD3D12Fence();
+        DxPtr<ID3D12CommandQueue> queue = m_Pool.GetDx12Device().GetContext().GetD3D12CommandQueue(m_Pool.GetSpecification().Queue);
+        DxPtr<ID3D12Fence> fence = m_Pool.GetDx12Device().GetD3D12Fence();
+        OB_ASSERT((m_SignaledValue != 0), "[Dx12CommandList] CommandList has not been submitted yet.");
 
         fence->SetEventOnCompletion(m_SignaledValue, m_WaitIdleEvent);
         WaitForSingleObject(m_WaitIdleEvent, INFINITE);
@@ -185,73 +217,13 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("Dx12CommandList::CommitBarriers()");
 
-        auto& imageBarriers = m_Pool.GetDx12Swapchain().GetDx12Device().GetTracker().GetImageBarriers(*api_cast<const CommandList*>(this));
-        auto& bufferBarriers = m_Pool.GetDx12Swapchain().GetDx12Device().GetTracker().GetBufferBarriers(*api_cast<const CommandList*>(this));
+        auto& imageBarriers = m_StateTracker.GetImageBarriers();
+        auto& bufferBarriers = m_StateTracker.GetBufferBarriers();
 
         if (imageBarriers.empty() && bufferBarriers.empty())
             return;
 
-        std::vector<D3D12_RESOURCE_BARRIER> resourceBarriers;
-        resourceBarriers.reserve(imageBarriers.size() + bufferBarriers.size());
-
-        // Image barriers
-        for (const auto& imageBarrier : imageBarriers)
-        {
-            Dx12Image& dxImage = *api_cast<Dx12Image*>(imageBarrier.ImagePtr);
-
-            D3D12_RESOURCE_BARRIER barrier = {};
-            D3D12_RESOURCE_STATES stateBefore = ResourceStateToD3D12ResourceStates(imageBarrier.StateBefore);
-            D3D12_RESOURCE_STATES stateAfter = ResourceStateToD3D12ResourceStates(imageBarrier.StateAfter);
-            
-            if (stateBefore != stateAfter)
-            {
-                barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-                barrier.Transition.StateBefore = stateBefore;
-                barrier.Transition.StateAfter = stateAfter;
-                barrier.Transition.pResource = dxImage.GetD3D12Resource().Get();
-                
-                if (imageBarrier.EntireTexture)
-                {
-                    barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-                    resourceBarriers.push_back(barrier);
-                }
-                else
-                {
-                    for (uint8_t plane = 0; plane < dxImage.GetPlaneCount(); plane++)
-                    {
-                        barrier.Transition.Subresource = CalculateSubresource(imageBarrier.ImageMipLevel, imageBarrier.ImageArraySlice, plane, dxImage.GetSpecification().MipLevels, dxImage.GetSpecification().ArraySize);
-                        resourceBarriers.push_back(barrier);
-                    }
-                }
-            }
-            else if (stateAfter & D3D12_RESOURCE_STATE_UNORDERED_ACCESS)
-            {
-                barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-                barrier.UAV.pResource = dxImage.GetD3D12Resource().Get();
-                resourceBarriers.push_back(barrier);
-            }
-        }
-
-        // Buffer barriers
-        for (const auto& bufferBarrier : bufferBarriers)
-        {
-            Dx12Buffer& dxBuffer = *api_cast<Dx12Buffer*>(bufferBarrier.BufferPtr);
-
-            D3D12_RESOURCE_BARRIER barrier = {};
-            D3D12_RESOURCE_STATES stateBefore = ResourceStateToD3D12ResourceStates(bufferBarrier.StateBefore);
-            D3D12_RESOURCE_STATES stateAfter = ResourceStateToD3D12ResourceStates(bufferBarrier.StateAfter);
-            
-            barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-            barrier.Transition.StateBefore = stateBefore;
-            barrier.Transition.StateAfter = stateAfter;
-            barrier.Transition.pResource = dxBuffer.GetD3D12Resource().Get();
-            barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-            resourceBarriers.push_back(barrier);
-        }
-
-        // Place barriers
-        if (!resourceBarriers.empty())
-            m_CommandList->ResourceBarrier(static_cast<uint32_t>(resourceBarriers.size()), resourceBarriers.data());
+        RecordBarriers(m_CommandList.Get(), imageBarriers, bufferBarriers);
 
         imageBarriers.clear();
         bufferBarriers.clear();
@@ -264,7 +236,11 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("Dx12CommandList::StartRenderpass()");
         
-        OB_ASSERT(args.Pass, "[Dx12CommandList] No Renderpass passed in.");
+        if (!args.Pass)
+        {
+            StartRendering(args);
+            return;
+        }
 
         Dx12Renderpass& renderpass = *api_cast<Dx12Renderpass*>(args.Pass);
         Framebuffer* framebuffer = args.Frame;
@@ -275,64 +251,81 @@ namespace Obsidian::Internal
         }
         Dx12Framebuffer& dxFramebuffer = *api_cast<Dx12Framebuffer*>(framebuffer);
 
-        Dx12Image* colourImage = api_cast<Dx12Image*>(dxFramebuffer.GetSpecification().ColourAttachment.ImagePtr);
-        Dx12Image* depthImage = api_cast<Dx12Image*>(dxFramebuffer.GetSpecification().DepthAttachment.ImagePtr);
+        const RenderpassSpecification& renderpassSpecs = renderpass.GetSpecification();
+        const FramebufferSpecification& framebufferSpecs = dxFramebuffer.GetSpecification();
+        Dx12Image* depthImage = api_cast<Dx12Image*>(framebufferSpecs.DepthAttachment.ImagePtr);
 
         // Make sure the attachments are in the begin state
         {
-            if (framebuffer->GetSpecification().ColourAttachment.IsValid() && (renderpass.GetSpecification().ColourImageStartState != ResourceState::Unknown))
+            for (size_t i = 0; i < framebufferSpecs.ColourAttachments.size(); i++)
             {
-                const FramebufferAttachment& attachment = framebuffer->GetSpecification().ColourAttachment;
-                RequireState(*attachment.ImagePtr, attachment.Subresources, renderpass.GetSpecification().ColourImageStartState);
+                const FramebufferAttachment& attachment = framebufferSpecs.ColourAttachments[i];
+                if (attachment.IsValid() && (renderpassSpecs.ColourAttachments[i].StartState != ResourceState::Unknown))
+                    RequireState(*attachment.ImagePtr, attachment.Subresources, renderpassSpecs.ColourAttachments[i].StartState);
             }
-            if (framebuffer->GetSpecification().DepthAttachment.IsValid() && (renderpass.GetSpecification().DepthImageStartState != ResourceState::Unknown))
+            if (framebufferSpecs.DepthAttachment.IsValid() && (renderpassSpecs.DepthAttachment.StartState != ResourceState::Unknown))
             {
-                const FramebufferAttachment& attachment = framebuffer->GetSpecification().DepthAttachment;
-                RequireState(*attachment.ImagePtr, attachment.Subresources, renderpass.GetSpecification().DepthImageStartState);
+                const FramebufferAttachment& attachment = framebufferSpecs.DepthAttachment;
+                RequireState(*attachment.ImagePtr, attachment.Subresources, renderpassSpecs.DepthAttachment.StartState);
             }
             CommitBarriers();
         }
 
-        D3D12_RENDER_PASS_RENDER_TARGET_DESC colourDesc = {};
+        std::array<D3D12_RENDER_PASS_RENDER_TARGET_DESC, Information::MaxColourAttachments> colourDescs = {};
+        std::array<std::vector<D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS>, Information::MaxColourAttachments> resolveParameters = {};
         D3D12_RENDER_PASS_DEPTH_STENCIL_DESC depthDesc = {};
 
-        if (colourImage)
+        for (size_t i = 0; i < framebufferSpecs.ColourAttachments.size(); i++)
         {
-            colourDesc.cpuDescriptor = colourImage->GetSubresourceView(dxFramebuffer.GetSpecification().ColourAttachment.Subresources, ImageSubresourceViewUsage::RTV).GetCPUHandle();
+            const FramebufferAttachment& attachment = framebufferSpecs.ColourAttachments[i];
+            const RenderpassAttachmentSpecification& attachmentSpecs = renderpassSpecs.ColourAttachments[i];
+            Dx12Image& colourImage = *api_cast<Dx12Image*>(attachment.ImagePtr);
 
-            colourDesc.BeginningAccess.Type = LoadOperationToD3D12BeginningAccess(renderpass.GetSpecification().ColourLoadOperation);
-            colourDesc.BeginningAccess.Clear.ClearValue.Format = FormatToFormatMapping(colourImage->GetSpecification().ImageFormat).RTVFormat;
+            D3D12_RENDER_PASS_RENDER_TARGET_DESC& colourDesc = colourDescs[i];
+            colourDesc.cpuDescriptor = colourImage.GetSubresourceView(attachment.Subresources, ImageSubresourceViewUsage::RTV).GetCPUHandle();
+
+            colourDesc.BeginningAccess.Type = LoadOperationToD3D12BeginningAccess(attachmentSpecs.Load);
+            colourDesc.BeginningAccess.Clear.ClearValue.Format = FormatToFormatMapping(colourImage.GetSpecification().ImageFormat).RTVFormat;
             colourDesc.BeginningAccess.Clear.ClearValue.Color[0] = args.ColourClear.r;
             colourDesc.BeginningAccess.Clear.ClearValue.Color[1] = args.ColourClear.g;
             colourDesc.BeginningAccess.Clear.ClearValue.Color[2] = args.ColourClear.b;
             colourDesc.BeginningAccess.Clear.ClearValue.Color[3] = args.ColourClear.a;
 
-            colourDesc.EndingAccess.Type = StoreOperationToD3D12EndingAccess(renderpass.GetSpecification().ColourStoreOperation);
+            colourDesc.EndingAccess.Type = StoreOperationToD3D12EndingAccess(attachmentSpecs.Store);
+
+            if (attachmentSpecs.HasResolve())
+            {
+                OB_ASSERT(framebufferSpecs.HasResolveAttachment(static_cast<uint32_t>(i)), "[Dx12CommandList] Renderpass resolves colour attachment {0}, but no resolve attachment was set.", i);
+                const FramebufferAttachment& resolveAttachment = framebufferSpecs.ResolveAttachments[i];
+
+                SetResolveEndingAccess(colourDesc.EndingAccess, *attachment.ImagePtr, attachment.Subresources, *resolveAttachment.ImagePtr, resolveAttachment.Subresources, (attachmentSpecs.Store == StoreOperation::Store), resolveParameters[i]);
+                RequireState(*resolveAttachment.ImagePtr, resolveAttachment.Subresources, ResourceState::ResolveDst);
+            }
 
             // Transition to rendering state
-            if (renderpass.GetSpecification().ColourImageStartState != renderpass.GetSpecification().ColourImageRenderingState)
-                RequireState(*api_cast<Image*>(colourImage), dxFramebuffer.GetSpecification().ColourAttachment.Subresources, renderpass.GetSpecification().ColourImageRenderingState);
+            if (attachmentSpecs.StartState != attachmentSpecs.RenderingState)
+                RequireState(*attachment.ImagePtr, attachment.Subresources, attachmentSpecs.RenderingState);
         }
         if (depthImage)
         {
-            depthDesc.cpuDescriptor = depthImage->GetSubresourceView(dxFramebuffer.GetSpecification().DepthAttachment.Subresources, ImageSubresourceViewUsage::DSV, ImageDimension::Image2D, Format::Unknown, false).GetCPUHandle();
+            depthDesc.cpuDescriptor = depthImage->GetSubresourceView(framebufferSpecs.DepthAttachment.Subresources, ImageSubresourceViewUsage::DSV, ImageDimension::Image2D, Format::Unknown, false).GetCPUHandle();
 
             // Note: We currently don't support stencil
-            depthDesc.DepthBeginningAccess.Type = LoadOperationToD3D12BeginningAccess(renderpass.GetSpecification().DepthLoadOperation);
+            depthDesc.DepthBeginningAccess.Type = LoadOperationToD3D12BeginningAccess(renderpassSpecs.DepthAttachment.Load);
             depthDesc.DepthBeginningAccess.Clear.ClearValue.Format = FormatToFormatMapping(depthImage->GetSpecification().ImageFormat).RTVFormat;
             depthDesc.DepthBeginningAccess.Clear.ClearValue.DepthStencil.Depth = args.DepthClear;
 
-            depthDesc.DepthEndingAccess.Type = StoreOperationToD3D12EndingAccess(renderpass.GetSpecification().DepthStoreOperation);
+            depthDesc.DepthEndingAccess.Type = StoreOperationToD3D12EndingAccess(renderpassSpecs.DepthAttachment.Store);
 
             // Transition to rendering state
-            if (renderpass.GetSpecification().DepthImageStartState != renderpass.GetSpecification().DepthImageRenderingState)
-                RequireState(*api_cast<Image*>(depthImage), dxFramebuffer.GetSpecification().DepthAttachment.Subresources, renderpass.GetSpecification().DepthImageRenderingState);
+            if (renderpassSpecs.DepthAttachment.StartState != renderpassSpecs.DepthAttachment.RenderingState)
+                RequireState(*api_cast<Image*>(depthImage), framebufferSpecs.DepthAttachment.Subresources, renderpassSpecs.DepthAttachment.RenderingState);
         }
         CommitBarriers();
 
         {
-            OB_PROFILE("Dx12CommandList::SetGraphicsState::BeginRenderpass"); // Note: Only 1 render target is currently supported
-            m_CommandList->BeginRenderPass((colourImage ? 1 : 0), (colourImage ? &colourDesc : nullptr), (depthImage ? &depthDesc : nullptr), D3D12_RENDER_PASS_FLAG_NONE);
+            OB_PROFILE("Dx12CommandList::SetGraphicsState::BeginRenderpass");
+            m_CommandList->BeginRenderPass(static_cast<UINT>(framebufferSpecs.ColourAttachments.size()), (!framebufferSpecs.ColourAttachments.empty() ? colourDescs.data() : nullptr), (depthImage ? &depthDesc : nullptr), D3D12_RENDER_PASS_FLAG_NONE);
         }
 
         SetViewport(args.ViewportState);
@@ -343,6 +336,12 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("Dx12CommandList::EndRenderpass()");
 
+        if (m_DynamicRendering)
+        {
+            EndRendering();
+            return;
+        }
+
         m_CommandList->EndRenderPass();
 
         // Transition to FinalState
@@ -355,17 +354,27 @@ namespace Obsidian::Internal
                 framebuffer = &dxRenderpass.GetFramebuffer(static_cast<uint8_t>(m_Pool.GetDx12Swapchain().GetAcquiredImage()));
             }
 
+            const RenderpassSpecification& renderpassSpecs = dxRenderpass.GetSpecification();
+            const FramebufferSpecification& framebufferSpecs = framebuffer->GetSpecification();
+
             // Note: On Dx12 we need to manually transition to the EndState
             {
-                if (framebuffer->GetSpecification().ColourAttachment.IsValid())
+                for (size_t i = 0; i < framebufferSpecs.ColourAttachments.size(); i++)
                 {
-                    const FramebufferAttachment& attachment = framebuffer->GetSpecification().ColourAttachment;
-                    RequireState(*attachment.ImagePtr, attachment.Subresources, dxRenderpass.GetSpecification().ColourImageEndState);
+                    const FramebufferAttachment& attachment = framebufferSpecs.ColourAttachments[i];
+                    if (attachment.IsValid())
+                        RequireState(*attachment.ImagePtr, attachment.Subresources, renderpassSpecs.ColourAttachments[i].EndState);
+
+                    if (renderpassSpecs.ColourAttachments[i].HasResolve())
+                    {
+                        const FramebufferAttachment& resolveAttachment = framebufferSpecs.ResolveAttachments[i];
+                        RequireState(*resolveAttachment.ImagePtr, resolveAttachment.Subresources, renderpassSpecs.ColourAttachments[i].ResolveEndState);
+                    }
                 }
-                if (framebuffer->GetSpecification().DepthAttachment.IsValid())
+                if (framebufferSpecs.DepthAttachment.IsValid())
                 {
-                    const FramebufferAttachment& attachment = framebuffer->GetSpecification().DepthAttachment;
-                    RequireState(*attachment.ImagePtr, attachment.Subresources, dxRenderpass.GetSpecification().DepthImageEndState);
+                    const FramebufferAttachment& attachment = framebufferSpecs.DepthAttachment;
+                    RequireState(*attachment.ImagePtr, attachment.Subresources, renderpassSpecs.DepthAttachment.EndState);
                 }
                 CommitBarriers();
             }
@@ -384,10 +393,11 @@ namespace Obsidian::Internal
         // Bind pipeline
         m_CommandList->SetPipelineState(dxPipeline.GetD3D12PipelineState().Get());
         m_CommandList->SetGraphicsRootSignature(dxPipeline.GetD3D12RootSignature().Get());
+        m_BoundSets.fill(nullptr); // Note: Setting a root signature resets all root arguments
         m_CommandList->IASetPrimitiveTopology(PrimitiveTypeToD3DPrimitiveTopology(dxPipeline.GetSpecification().Primitive, dxPipeline.GetSpecification().PatchPointCount));
 
         // Bind heaps for BindingSet(s)
-        const auto& resources = m_Pool.GetDx12Swapchain().GetDx12Device().GetResources();
+        const auto& resources = m_Pool.GetDx12Device().GetResources();
 
         auto heaps = std::to_array<ID3D12DescriptorHeap*>({ resources.GetSRVAndUAVAndCBVHeap().GetD3D12DescriptorHeap().Get(), resources.GetSamplerHeap().GetD3D12DescriptorHeap().Get() });
         m_CommandList->SetDescriptorHeaps(static_cast<UINT>(heaps.size()), heaps.data());
@@ -405,9 +415,10 @@ namespace Obsidian::Internal
         // Bind pipeline
         m_CommandList->SetPipelineState(dxPipeline.GetD3D12PipelineState().Get());
         m_CommandList->SetComputeRootSignature(dxPipeline.GetD3D12RootSignature().Get());
+        m_BoundSets.fill(nullptr); // Note: Setting a root signature resets all root arguments
 
         // Bind heaps for BindingSet(s)
-        const auto& resources = m_Pool.GetDx12Swapchain().GetDx12Device().GetResources();
+        const auto& resources = m_Pool.GetDx12Device().GetResources();
 
         auto heaps = std::to_array<ID3D12DescriptorHeap*>({ resources.GetSRVAndUAVAndCBVHeap().GetD3D12DescriptorHeap().Get(), resources.GetSamplerHeap().GetD3D12DescriptorHeap().Get() });
         m_CommandList->SetDescriptorHeaps(static_cast<UINT>(heaps.size()), heaps.data());
@@ -420,6 +431,16 @@ namespace Obsidian::Internal
         OB_ASSERT(m_CurrentGraphicsPipeline || m_CurrentComputePipeline, "[Dx12CommandList] A pipeline must be bound to bind bindingsets.");
         const Dx12BindingSet& dxSet = *api_cast<const Dx12BindingSet*>(&set);
 
+        // Note: Skips sets that are still bound since the last root signature change, dynamic offsets always rebind
+        const uint8_t registerSpace = api_cast<const Dx12BindingLayout*>(dxSet.GetDx12BindingSetPool().GetSpecification().Layout)->GetRegisterSpace();
+        if (registerSpace < m_BoundSets.size())
+        {
+            if (dynamicOffsets.empty() && (m_BoundSets[registerSpace] == &set))
+                return;
+
+            m_BoundSets[registerSpace] = (dynamicOffsets.empty() ? &set : nullptr);
+        }
+
         // Graphics pipeline
         if (m_CurrentGraphicsPipeline)
         {
@@ -444,7 +465,7 @@ namespace Obsidian::Internal
                     OB_ASSERT(false, "[Dx12CommandList] Internal error: Something went very wrong, the ranges aren't empty but there was no root parameter created for it.");
             }
 
-            const auto& resources = m_Pool.GetDx12Swapchain().GetDx12Device().GetResources();
+            const auto& resources = m_Pool.GetDx12Device().GetResources();
 
             // SRVs, UAVs & CBVs
             for (const auto& [slot, index] : srvAndUAVandCBVRootIndices)
@@ -511,7 +532,7 @@ namespace Obsidian::Internal
                     OB_ASSERT(false, "[Dx12CommandList] Internal error: Something went very wrong, the ranges aren't empty but there was no root parameter created for it.");
             }
 
-            const auto& resources = m_Pool.GetDx12Swapchain().GetDx12Device().GetResources();
+            const auto& resources = m_Pool.GetDx12Device().GetResources();
 
             // SRVs, UAVs & CBVs
             for (const auto& [slot, index] : srvAndUAVandCBVRootIndices)
@@ -677,8 +698,8 @@ namespace Obsidian::Internal
         m_CommandList->CopyTextureRegion(&dstLocation, resDstSlice.X, resDstSlice.Y, resDstSlice.Z, &srcLocation, &srcBox);
 
         // Update back to permanent state
-        m_Pool.GetDx12Swapchain().GetDx12Device().GetTracker().ResolvePermanentState(*api_cast<const CommandList*>(this), src, srcSubresourceSpec);
-        m_Pool.GetDx12Swapchain().GetDx12Device().GetTracker().ResolvePermanentState(*api_cast<const CommandList*>(this), dst, dstSubresourceSpec);
+        m_StateTracker.ResolvePermanentState(src, srcSubresourceSpec);
+        m_StateTracker.ResolvePermanentState(dst, dstSubresourceSpec);
         CommitBarriers();
     }
 
@@ -726,8 +747,115 @@ namespace Obsidian::Internal
         m_CommandList->CopyTextureRegion(&dstLocation, resDstSlice.X, resDstSlice.Y, resDstSlice.Z, &srcLocation, &srcBox);
 
         // Update back to permanent state
-        m_Pool.GetDx12Swapchain().GetDx12Device().GetTracker().ResolvePermanentState(*api_cast<const CommandList*>(this), *api_cast<Buffer*>(&dxSrc.GetDx12Buffer()));
-        m_Pool.GetDx12Swapchain().GetDx12Device().GetTracker().ResolvePermanentState(*api_cast<const CommandList*>(this), *api_cast<Image*>(&dxDst), dstSubresourceSpec);
+        m_StateTracker.ResolvePermanentState(*api_cast<Buffer*>(&dxSrc.GetDx12Buffer()));
+        m_StateTracker.ResolvePermanentState(*api_cast<Image*>(&dxDst), dstSubresourceSpec);
+        CommitBarriers();
+    }
+
+    void Dx12CommandList::CopyImage(StagingImage& dst, const ImageSliceSpecification& dstSlice, Image& src, const ImageSliceSpecification& srcSlice)
+    {
+        OB_PROFILE("Dx12CommandList::CopyImage()");
+
+        Dx12StagingImage& dxDst = *api_cast<Dx12StagingImage*>(&dst);
+        Dx12Image& dxSrc = *api_cast<Dx12Image*>(&src);
+
+        ImageSliceSpecification resDstSlice = ResolveImageSlice(dstSlice, dst.GetSpecification());
+        ImageSliceSpecification resSrcSlice = ResolveImageSlice(srcSlice, src.GetSpecification());
+
+        UINT srcSubresource = CalculateSubresource(resSrcSlice.ImageMipLevel, resSrcSlice.ImageArraySlice, 0, src.GetSpecification().MipLevels, src.GetSpecification().ArraySize);
+
+        ImageSubresourceSpecification srcSubresourceSpec = ImageSubresourceSpecification(
+            resSrcSlice.ImageMipLevel, 1,
+            resSrcSlice.ImageArraySlice, 1
+        );
+
+        RequireState(src, srcSubresourceSpec, ResourceState::CopySrc);
+        RequireState(*api_cast<Buffer*>(&dxDst.GetDx12Buffer()), ResourceState::CopyDst);
+        CommitBarriers();
+
+        auto dstRegion = dxDst.GetSliceRegion(resDstSlice.ImageMipLevel, resDstSlice.ImageArraySlice);
+
+        D3D12_TEXTURE_COPY_LOCATION dstLocation = {};
+        dstLocation.pResource = dxDst.GetDx12Buffer().GetD3D12Resource().Get();
+        dstLocation.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+        dstLocation.PlacedFootprint = dstRegion.Footprint;
+
+        D3D12_TEXTURE_COPY_LOCATION srcLocation = {};
+        srcLocation.pResource = dxSrc.GetD3D12Resource().Get();
+        srcLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+        srcLocation.SubresourceIndex = srcSubresource;
+
+        D3D12_BOX srcBox = {};
+        srcBox.left = resSrcSlice.X;
+        srcBox.top = resSrcSlice.Y;
+        srcBox.front = resSrcSlice.Z;
+        srcBox.right = resSrcSlice.X + resSrcSlice.Width;
+        srcBox.bottom = resSrcSlice.Y + resSrcSlice.Height;
+        srcBox.back = resSrcSlice.Z + resSrcSlice.Depth;
+
+        m_CommandList->CopyTextureRegion(&dstLocation, resDstSlice.X, resDstSlice.Y, resDstSlice.Z, &srcLocation, &srcBox);
+
+        // Update back to permanent state
+        m_StateTracker.ResolvePermanentState(*api_cast<Image*>(&dxSrc), srcSubresourceSpec);
+        m_StateTracker.ResolvePermanentState(*api_cast<Buffer*>(&dxDst.GetDx12Buffer()));
+        CommitBarriers();
+    }
+
+    void Dx12CommandList::CopyImage(Buffer& dst, size_t dstOffset, Image& src, const ImageSliceSpecification& srcSlice)
+    {
+        OB_PROFILE("Dx12CommandList::CopyImage()");
+
+        Dx12Buffer& dxDst = *api_cast<Dx12Buffer*>(&dst);
+        Dx12Image& dxSrc = *api_cast<Dx12Image*>(&src);
+
+        const ImageSpecification& srcSpec = src.GetSpecification();
+
+        ImageSliceSpecification resSrcSlice = ResolveImageSlice(srcSlice, srcSpec);
+        ImageBufferLayout layout = ResolveImageBufferLayout(resSrcSlice, srcSpec);
+
+        OB_ASSERT(((dstOffset % ImageBufferLayout::OffsetAlignment) == 0), "[Dx12CommandList] Buffer offset must be a multiple of ImageBufferLayout::OffsetAlignment.");
+        OB_ASSERT((dstOffset + layout.Size <= dst.GetSpecification().Size), "[Dx12CommandList] Offset + image size exceeds buffer size.");
+
+        UINT srcSubresource = CalculateSubresource(resSrcSlice.ImageMipLevel, resSrcSlice.ImageArraySlice, 0, srcSpec.MipLevels, srcSpec.ArraySize);
+
+        ImageSubresourceSpecification srcSubresourceSpec = ImageSubresourceSpecification(
+            resSrcSlice.ImageMipLevel, 1,
+            resSrcSlice.ImageArraySlice, 1
+        );
+
+        RequireState(src, srcSubresourceSpec, ResourceState::CopySrc);
+        RequireState(dst, ResourceState::CopyDst);
+        CommitBarriers();
+
+        // Note: The footprint describes the copied region only, so it gets placed at the start of the buffer region
+        D3D12_TEXTURE_COPY_LOCATION dstLocation = {};
+        dstLocation.pResource = dxDst.GetD3D12Resource().Get();
+        dstLocation.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+        dstLocation.PlacedFootprint.Offset = dstOffset;
+        dstLocation.PlacedFootprint.Footprint.Format = dxSrc.GetD3D12Resource()->GetDesc().Format;
+        dstLocation.PlacedFootprint.Footprint.Width = resSrcSlice.Width;
+        dstLocation.PlacedFootprint.Footprint.Height = resSrcSlice.Height;
+        dstLocation.PlacedFootprint.Footprint.Depth = resSrcSlice.Depth;
+        dstLocation.PlacedFootprint.Footprint.RowPitch = static_cast<UINT>(layout.RowPitch);
+
+        D3D12_TEXTURE_COPY_LOCATION srcLocation = {};
+        srcLocation.pResource = dxSrc.GetD3D12Resource().Get();
+        srcLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+        srcLocation.SubresourceIndex = srcSubresource;
+
+        D3D12_BOX srcBox = {};
+        srcBox.left = resSrcSlice.X;
+        srcBox.top = resSrcSlice.Y;
+        srcBox.front = resSrcSlice.Z;
+        srcBox.right = resSrcSlice.X + resSrcSlice.Width;
+        srcBox.bottom = resSrcSlice.Y + resSrcSlice.Height;
+        srcBox.back = resSrcSlice.Z + resSrcSlice.Depth;
+
+        m_CommandList->CopyTextureRegion(&dstLocation, 0, 0, 0, &srcLocation, &srcBox);
+
+        // Update back to permanent state
+        m_StateTracker.ResolvePermanentState(src, srcSubresourceSpec);
+        m_StateTracker.ResolvePermanentState(dst);
         CommitBarriers();
     }
 
@@ -745,23 +873,93 @@ namespace Obsidian::Internal
         m_CommandList->CopyBufferRegion(dxDst.GetD3D12Resource().Get(), dstOffset, dxSrc.GetD3D12Resource().Get(), srcOffset, size);
     }
 
+    void Dx12CommandList::GenerateMips(Image& image, const ImageSubresourceSpecification& subresources)
+    {
+        (void)image; (void)subresources;
+        OB_ASSERT(false, "[Dx12CommandList] D3D12 has no blit operation and compute pipelines aren't implemented on Dx12 yet, so mips can't be generated on the GPU. Upload every mip level instead.");
+    }
+
     void Dx12CommandList::Dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) const
     {
         OB_PROFILE("Dx12CommandList::Dispatch()");
         m_CommandList->Dispatch(groupsX, groupsY, groupsZ);
     }
 
+    void Dx12CommandList::DispatchIndirect(Buffer& argumentBuffer, size_t offset)
+    {
+        OB_PROFILE("Dx12CommandList::DispatchIndirect()");
+        OB_ASSERT((argumentBuffer.GetSpecification().IsIndirectArgument), "[Dx12CommandList] To use a buffer as an indirect argument buffer it must have been created with IsIndirectArgument equal to true.");
+        OB_ASSERT((offset % 4 == 0), "[Dx12CommandList] Offset must be aligned to 4 bytes.");
+
+        RequireState(argumentBuffer, ResourceState::IndirectArgument);
+        CommitBarriers();
+
+        DxPtr<ID3D12CommandSignature> signature = m_Pool.GetDx12Device().GetResources().GetCommandSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH, static_cast<uint32_t>(sizeof(DispatchIndirectCommand)));
+        m_CommandList->ExecuteIndirect(signature.Get(), 1, api_cast<Dx12Buffer*>(&argumentBuffer)->GetD3D12Resource().Get(), static_cast<UINT64>(offset), nullptr, 0);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Query methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void Dx12CommandList::ResetQueries(QueryPool& pool, uint32_t firstQuery, uint32_t queryCount)
+    {
+        // Note: D3D12 queries don't need to be reset before they are reused
+        (void)pool; (void)firstQuery; (void)queryCount;
+    }
+
+    void Dx12CommandList::BeginQuery(QueryPool& pool, uint32_t query)
+    {
+        OB_PROFILE("Dx12CommandList::BeginQuery()");
+        OB_ASSERT((pool.GetSpecification().Type != QueryType::Timestamp), "[Dx12CommandList] Timestamp queries must use BeginTimerQuery/EndTimerQuery.");
+        OB_ASSERT((query < pool.GetSpecification().Count), "[Dx12CommandList] Query index exceeds the QueryPool's count.");
+
+        Dx12QueryPool& dxPool = *api_cast<Dx12QueryPool*>(&pool);
+        m_CommandList->BeginQuery(dxPool.GetD3D12QueryHeap().Get(), dxPool.GetD3D12QueryType(), query);
+    }
+
+    void Dx12CommandList::EndQuery(QueryPool& pool, uint32_t query)
+    {
+        OB_PROFILE("Dx12CommandList::EndQuery()");
+        OB_ASSERT((pool.GetSpecification().Type != QueryType::Timestamp), "[Dx12CommandList] Timestamp queries must use BeginTimerQuery/EndTimerQuery.");
+        OB_ASSERT((query < pool.GetSpecification().Count), "[Dx12CommandList] Query index exceeds the QueryPool's count.");
+
+        EndAndResolveQuery(pool, query);
+    }
+
+    void Dx12CommandList::BeginTimerQuery(QueryPool& pool, uint32_t timer)
+    {
+        OB_PROFILE("Dx12CommandList::BeginTimerQuery()");
+        OB_ASSERT((pool.GetSpecification().Type == QueryType::Timestamp), "[Dx12CommandList] Timer queries can only be used with a Timestamp QueryPool.");
+        OB_ASSERT(((timer * 2) + 1 < pool.GetSpecification().Count), "[Dx12CommandList] Timer index exceeds the QueryPool's count.");
+
+        EndAndResolveQuery(pool, timer * 2);
+    }
+
+    void Dx12CommandList::EndTimerQuery(QueryPool& pool, uint32_t timer)
+    {
+        OB_PROFILE("Dx12CommandList::EndTimerQuery()");
+        OB_ASSERT((pool.GetSpecification().Type == QueryType::Timestamp), "[Dx12CommandList] Timer queries can only be used with a Timestamp QueryPool.");
+        OB_ASSERT(((timer * 2) + 1 < pool.GetSpecification().Count), "[Dx12CommandList] Timer index exceeds the QueryPool's count.");
+
+        EndAndResolveQuery(pool, (timer * 2) + 1);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // State methods
     ////////////////////////////////////////////////////////////////////////////////////
     void Dx12CommandList::RequireState(Image& image, const ImageSubresourceSpecification& subresources, ResourceState state)
     {
-        m_Pool.GetDx12Swapchain().GetDx12Device().GetTracker().RequireImageState(*api_cast<const CommandList*>(this), image, subresources, state);
+        m_StateTracker.RequireImageState(image, subresources, state);
     }
 
     void Dx12CommandList::RequireState(Buffer& buffer, ResourceState state)
     {
-        m_Pool.GetDx12Swapchain().GetDx12Device().GetTracker().RequireBufferState(*api_cast<const CommandList*>(this), buffer, state);
+        m_StateTracker.RequireBufferState(buffer, state);
+    }
+
+    void Dx12CommandList::AliasImage(Image& image, ResourceState state)
+    {
+        m_StateTracker.AliasImage(image, state);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -773,6 +971,36 @@ namespace Obsidian::Internal
         m_CommandList->DrawIndexedInstanced(args.VertexCount, args.InstanceCount, args.StartIndexLocation, args.StartVertexLocation, args.StartInstanceLocation);
     }
 
+    void Dx12CommandList::DrawIndexedIndirect(Buffer& argumentBuffer, size_t offset, uint32_t drawCount, uint32_t stride)
+    {
+        OB_PROFILE("Dx12CommandList::DrawIndexedIndirect()");
+        OB_ASSERT((argumentBuffer.GetSpecification().IsIndirectArgument), "[Dx12CommandList] To use a buffer as an indirect argument buffer it must have been created with IsIndirectArgument equal to true.");
+        OB_ASSERT((offset % 4 == 0), "[Dx12CommandList] Offset must be aligned to 4 bytes.");
+        OB_ASSERT(((stride % 4 == 0) && (stride >= sizeof(DrawIndexedIndirectCommand))), "[Dx12CommandList] Stride must be aligned to 4 bytes and at least sizeof(DrawIndexedIndirectCommand).");
+
+        RequireState(argumentBuffer, ResourceState::IndirectArgument);
+        CommitBarriers(); // Note: Dx12 doesn't have renderpass instances, so placing barriers here is allowed
+
+        DxPtr<ID3D12CommandSignature> signature = m_Pool.GetDx12Device().GetResources().GetCommandSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, stride);
+        m_CommandList->ExecuteIndirect(signature.Get(), drawCount, api_cast<Dx12Buffer*>(&argumentBuffer)->GetD3D12Resource().Get(), static_cast<UINT64>(offset), nullptr, 0);
+    }
+
+    void Dx12CommandList::DrawIndexedIndirectCount(Buffer& argumentBuffer, size_t offset, Buffer& countBuffer, size_t countOffset, uint32_t maxDrawCount, uint32_t stride)
+    {
+        OB_PROFILE("Dx12CommandList::DrawIndexedIndirectCount()");
+        OB_ASSERT((argumentBuffer.GetSpecification().IsIndirectArgument), "[Dx12CommandList] To use a buffer as an indirect argument buffer it must have been created with IsIndirectArgument equal to true.");
+        OB_ASSERT((countBuffer.GetSpecification().IsIndirectArgument), "[Dx12CommandList] To use a buffer as an indirect count buffer it must have been created with IsIndirectArgument equal to true.");
+        OB_ASSERT(((offset % 4 == 0) && (countOffset % 4 == 0)), "[Dx12CommandList] Offset and countOffset must be aligned to 4 bytes.");
+        OB_ASSERT(((stride % 4 == 0) && (stride >= sizeof(DrawIndexedIndirectCommand))), "[Dx12CommandList] Stride must be aligned to 4 bytes and at least sizeof(DrawIndexedIndirectCommand).");
+
+        RequireState(argumentBuffer, ResourceState::IndirectArgument);
+        RequireState(countBuffer, ResourceState::IndirectArgument);
+        CommitBarriers(); // Note: Dx12 doesn't have renderpass instances, so placing barriers here is allowed
+
+        DxPtr<ID3D12CommandSignature> signature = m_Pool.GetDx12Device().GetResources().GetCommandSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, stride);
+        m_CommandList->ExecuteIndirect(signature.Get(), maxDrawCount, api_cast<Dx12Buffer*>(&argumentBuffer)->GetD3D12Resource().Get(), static_cast<UINT64>(offset), api_cast<Dx12Buffer*>(&countBuffer)->GetD3D12Resource().Get(), static_cast<UINT64>(countOffset));
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Other methods
     ////////////////////////////////////////////////////////////////////////////////////
@@ -799,4 +1027,219 @@ namespace Obsidian::Internal
         }
     }
 
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void Dx12CommandList::EndAndResolveQuery(QueryPool& pool, uint32_t query)
+    {
+        Dx12QueryPool& dxPool = *api_cast<Dx12QueryPool*>(&pool);
+
+        // Note: Timestamps only have an EndQuery in D3D12
+        m_CommandList->EndQuery(dxPool.GetD3D12QueryHeap().Get(), dxPool.GetD3D12QueryType(), query);
+        m_CommandList->ResolveQueryData(dxPool.GetD3D12QueryHeap().Get(), dxPool.GetD3D12QueryType(), query, 1, dxPool.GetD3D12ReadbackResource().Get(), static_cast<UINT64>(query * dxPool.GetQueryStride()));
+
+        dxPool.m_ResolvedValues[query].store(Dx12QueryPool::PendingValue, std::memory_order_release);
+        m_ResolvedQueries.emplace_back(&dxPool, query);
+    }
+
+    void Dx12CommandList::RecordBarriers(ID3D12GraphicsCommandList10* commandList, std::span<const ImageBarrier> imageBarriers, std::span<const BufferBarrier> bufferBarriers) const
+    {
+        std::vector<D3D12_RESOURCE_BARRIER>& resourceBarriers = m_ResourceBarriers; // Note: Reuses its capacity, so recording barriers doesn't allocate once it's large enough
+        resourceBarriers.clear();
+
+        // Image barriers
+        for (const auto& imageBarrier : imageBarriers)
+        {
+            Dx12Image& dxImage = *api_cast<Dx12Image*>(imageBarrier.ImagePtr);
+
+            D3D12_RESOURCE_BARRIER barrier = {};
+            D3D12_RESOURCE_STATES stateBefore = ResourceStateToD3D12ResourceStates(imageBarrier.StateBefore);
+            D3D12_RESOURCE_STATES stateAfter = ResourceStateToD3D12ResourceStates(imageBarrier.StateAfter);
+
+            if (imageBarrier.Aliasing && (imageBarrier.EntireTexture || ((imageBarrier.ImageMipLevel == 0) && (imageBarrier.ImageArraySlice == 0)))) // Note: One aliasing barrier per resource
+            {
+                D3D12_RESOURCE_BARRIER aliasingBarrier = {};
+                aliasingBarrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+                aliasingBarrier.Aliasing.pResourceBefore = nullptr; // Note: Any placed resource that used the memory before
+                aliasingBarrier.Aliasing.pResourceAfter = dxImage.GetD3D12Resource().Get();
+                resourceBarriers.push_back(aliasingBarrier);
+            }
+            
+            if (stateBefore != stateAfter)
+            {
+                barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+                barrier.Transition.StateBefore = stateBefore;
+                barrier.Transition.StateAfter = stateAfter;
+                barrier.Transition.pResource = dxImage.GetD3D12Resource().Get();
+                
+                if (imageBarrier.EntireTexture)
+                {
+                    barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+                    resourceBarriers.push_back(barrier);
+                }
+                else
+                {
+                    for (uint8_t plane = 0; plane < dxImage.GetPlaneCount(); plane++)
+                    {
+                        barrier.Transition.Subresource = CalculateSubresource(imageBarrier.ImageMipLevel, imageBarrier.ImageArraySlice, plane, dxImage.GetSpecification().MipLevels, dxImage.GetSpecification().ArraySize);
+                        resourceBarriers.push_back(barrier);
+                    }
+                }
+            }
+            else if (stateAfter & D3D12_RESOURCE_STATE_UNORDERED_ACCESS)
+            {
+                barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+                barrier.UAV.pResource = dxImage.GetD3D12Resource().Get();
+                resourceBarriers.push_back(barrier);
+            }
+        }
+
+        // Buffer barriers
+        for (const auto& bufferBarrier : bufferBarriers)
+        {
+            Dx12Buffer& dxBuffer = *api_cast<Dx12Buffer*>(bufferBarrier.BufferPtr);
+
+            D3D12_RESOURCE_BARRIER barrier = {};
+            D3D12_RESOURCE_STATES stateBefore = ResourceStateToD3D12ResourceStates(bufferBarrier.StateBefore);
+            D3D12_RESOURCE_STATES stateAfter = ResourceStateToD3D12ResourceStates(bufferBarrier.StateAfter);
+            
+            if (stateBefore != stateAfter)
+            {
+                barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+                barrier.Transition.StateBefore = stateBefore;
+                barrier.Transition.StateAfter = stateAfter;
+                barrier.Transition.pResource = dxBuffer.GetD3D12Resource().Get();
+                barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+                resourceBarriers.push_back(barrier);
+            }
+            else if (stateAfter & D3D12_RESOURCE_STATE_UNORDERED_ACCESS)
+            {
+                barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+                barrier.UAV.pResource = dxBuffer.GetD3D12Resource().Get();
+                resourceBarriers.push_back(barrier);
+            }
+            // Note: Ownership transfers (same state, different queue) don't exist on Dx12, the fence already orders the queues
+        }
+
+        // Place barriers
+        if (!resourceBarriers.empty())
+            commandList->ResourceBarrier(static_cast<uint32_t>(resourceBarriers.size()), resourceBarriers.data());
+    }
+
+    bool Dx12CommandList::ResolveSubmissionBarriers()
+    {
+        OB_PROFILE("Dx12CommandList::ResolveSubmissionBarriers()");
+
+        // Note: Resolves the first use transitions against the global state, this happens in submission order.
+        m_Pool.GetDx12Device().GetTracker().ResolveSubmission(m_StateTracker, m_Pool.GetSpecification().Queue, m_SubmissionImageBarriers, m_SubmissionBufferBarriers);
+        return (!m_SubmissionImageBarriers.empty() || !m_SubmissionBufferBarriers.empty());
+    }
+
+    void Dx12CommandList::RecordSubmissionBarriers(ID3D12GraphicsCommandList10* commandList) const
+    {
+        OB_PROFILE("Dx12CommandList::RecordSubmissionBarriers()");
+
+        RecordBarriers(commandList, m_SubmissionImageBarriers, m_SubmissionBufferBarriers);
+        DX_VERIFY(commandList->Close());
+    }
+
+    void Dx12CommandList::StartRendering(const RenderpassStartArgs& args)
+    {
+        OB_PROFILE("Dx12CommandList::StartRendering()");
+
+        OB_ASSERT((!args.ColourAttachments.empty() || args.DepthAttachment.IsValid()), "[Dx12CommandList] No Renderpass and no attachments passed in.");
+
+        m_DynamicRendering = true;
+        m_RenderingColourAttachments = args.ColourAttachments;
+        m_RenderingDepthAttachment = args.DepthAttachment;
+
+        for (RenderingAttachment& attachment : m_RenderingColourAttachments)
+        {
+            if (attachment.RenderingState == ResourceState::Unknown)
+                attachment.RenderingState = ResourceState::RenderTarget;
+        }
+        if (m_RenderingDepthAttachment.RenderingState == ResourceState::Unknown)
+            m_RenderingDepthAttachment.RenderingState = ResourceState::DepthWrite;
+
+        std::array<D3D12_RENDER_PASS_RENDER_TARGET_DESC, Information::MaxColourAttachments> colourDescs = {};
+        std::array<std::vector<D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS>, Information::MaxColourAttachments> resolveParameters = {};
+        D3D12_RENDER_PASS_DEPTH_STENCIL_DESC depthDesc = {};
+
+        for (size_t i = 0; i < m_RenderingColourAttachments.size(); i++)
+        {
+            const RenderingAttachment& attachment = m_RenderingColourAttachments[i];
+            OB_ASSERT(attachment.IsValid(), "[Dx12CommandList] Colour attachment has no image.");
+
+            Dx12Image& colourImage = *api_cast<Dx12Image*>(attachment.ImagePtr);
+
+            D3D12_RENDER_PASS_RENDER_TARGET_DESC& colourDesc = colourDescs[i];
+            colourDesc.cpuDescriptor = colourImage.GetSubresourceView(attachment.Subresources, ImageSubresourceViewUsage::RTV).GetCPUHandle();
+
+            colourDesc.BeginningAccess.Type = LoadOperationToD3D12BeginningAccess(attachment.Load);
+            colourDesc.BeginningAccess.Clear.ClearValue.Format = FormatToFormatMapping(colourImage.GetSpecification().ImageFormat).RTVFormat;
+            colourDesc.BeginningAccess.Clear.ClearValue.Color[0] = args.ColourClear.r;
+            colourDesc.BeginningAccess.Clear.ClearValue.Color[1] = args.ColourClear.g;
+            colourDesc.BeginningAccess.Clear.ClearValue.Color[2] = args.ColourClear.b;
+            colourDesc.BeginningAccess.Clear.ClearValue.Color[3] = args.ColourClear.a;
+
+            colourDesc.EndingAccess.Type = StoreOperationToD3D12EndingAccess(attachment.Store);
+
+            if (attachment.HasResolve())
+            {
+                SetResolveEndingAccess(colourDesc.EndingAccess, *attachment.ImagePtr, attachment.Subresources, *attachment.ResolveImagePtr, attachment.ResolveSubresources, (attachment.Store == StoreOperation::Store), resolveParameters[i]);
+                RequireState(*attachment.ResolveImagePtr, attachment.ResolveSubresources, ResourceState::ResolveDst);
+            }
+
+            RequireState(*attachment.ImagePtr, attachment.Subresources, attachment.RenderingState);
+        }
+        if (m_RenderingDepthAttachment.IsValid())
+        {
+            Dx12Image& depthImage = *api_cast<Dx12Image*>(m_RenderingDepthAttachment.ImagePtr);
+            depthDesc.cpuDescriptor = depthImage.GetSubresourceView(m_RenderingDepthAttachment.Subresources, ImageSubresourceViewUsage::DSV, ImageDimension::Image2D, Format::Unknown, false).GetCPUHandle();
+
+            // Note: We currently don't support stencil
+            depthDesc.DepthBeginningAccess.Type = LoadOperationToD3D12BeginningAccess(m_RenderingDepthAttachment.Load);
+            depthDesc.DepthBeginningAccess.Clear.ClearValue.Format = FormatToFormatMapping(depthImage.GetSpecification().ImageFormat).RTVFormat;
+            depthDesc.DepthBeginningAccess.Clear.ClearValue.DepthStencil.Depth = args.DepthClear;
+
+            depthDesc.DepthEndingAccess.Type = StoreOperationToD3D12EndingAccess(m_RenderingDepthAttachment.Store);
+
+            RequireState(*m_RenderingDepthAttachment.ImagePtr, m_RenderingDepthAttachment.Subresources, m_RenderingDepthAttachment.RenderingState);
+        }
+        CommitBarriers();
+
+        {
+            OB_PROFILE("Dx12CommandList::StartRendering::BeginRenderpass");
+            m_CommandList->BeginRenderPass(static_cast<UINT>(m_RenderingColourAttachments.size()), (!m_RenderingColourAttachments.empty() ? colourDescs.data() : nullptr), (m_RenderingDepthAttachment.IsValid() ? &depthDesc : nullptr), D3D12_RENDER_PASS_FLAG_NONE);
+        }
+
+        SetViewport(args.ViewportState);
+        SetScissor(args.Scissor);
+    }
+
+    void Dx12CommandList::EndRendering()
+    {
+        OB_PROFILE("Dx12CommandList::EndRendering()");
+
+        m_CommandList->EndRenderPass();
+
+        {
+            for (const RenderingAttachment& attachment : m_RenderingColourAttachments)
+            {
+                if (attachment.EndState != ResourceState::Unknown)
+                    RequireState(*attachment.ImagePtr, attachment.Subresources, attachment.EndState);
+                if (attachment.HasResolve() && (attachment.ResolveEndState != ResourceState::Unknown))
+                    RequireState(*attachment.ResolveImagePtr, attachment.ResolveSubresources, attachment.ResolveEndState);
+            }
+            if (m_RenderingDepthAttachment.IsValid() && (m_RenderingDepthAttachment.EndState != ResourceState::Unknown))
+                RequireState(*m_RenderingDepthAttachment.ImagePtr, m_RenderingDepthAttachment.Subresources, m_RenderingDepthAttachment.EndState);
+            CommitBarriers();
+        }
+
+        m_DynamicRendering = false;
+        m_RenderingColourAttachments = {};
+        m_RenderingDepthAttachment = {};
+    }
+
 }
\ No newline at end of file
@@ -7,18 +7,25 @@
 #include "Obsidian/Renderer/ResourceSpec.hpp"
 #include "Obsidian/Renderer/SwapchainSpec.hpp"
 #include "Obsidian/Renderer/CommandListSpec.hpp"
+#include "Obsidian/Renderer/PipelineSpec.hpp"
+#include "Obsidian/Renderer/StateTracker.hpp"
 
 #include "Obsidian/Platform/Dx12/Dx12.hpp"
 
+#include <span>
+#include <array>
+#include <vector>
 #include <utility>
 
 namespace Obsidian
 {
+	class Device;
 	class Swapchain;
 	class Image;
 	class StagingImage;
 	class Buffer;
 	class Renderpass;
+	class QueryPool;
 	class CommandList;
 	class CommandListPool;
 }
@@ -26,9 +33,11 @@ namespace Obsidian
 namespace Obsidian::Internal
 {
 
+	class Dx12Device;
 	class Dx12Swapchain;
 	class Dx12CommandList;
 	class Dx12CommandListPool;
+	class Dx12QueryPool;
 
 #if defined(OB_API_DX12)
 	////////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +47,7 @@ namespace Obsidian::Internal
 	{
 	public:
 		// Constructor & Destructor
+		Dx12CommandListPool(const Device& device, const CommandListPoolSpecification& specs);
 		Dx12CommandListPool(Swapchain& swapchain, const CommandListPoolSpecification& specs);
 		~Dx12CommandListPool();
 
@@ -51,16 +61,21 @@ namespace Obsidian::Internal
 		inline const CommandListPoolSpecification& GetSpecification() const { return m_Specification; }
 
 		// Internal getters
-		inline Dx12Swapchain& GetDx12Swapchain() const { return m_Swapchain; }
+		inline const Dx12Device& GetDx12Device() const { return m_Device; }
+
+		inline bool HasSwapchain() const { return (m_Swapchain != nullptr); }
+		Dx12Swapchain& GetDx12Swapchain() const;
 
 		inline DxPtr<ID3D12CommandAllocator> GetD3D12CommandAllocator() const { return m_CommandAllocator; }
 
 	private:
-		Dx12Swapchain& m_Swapchain;
+		const Dx12Device& m_Device;
+		Dx12Swapchain* m_Swapchain = nullptr; // Note: Is nullptr when the pool was allocated from the Device
 		CommandListPoolSpecification m_Specification;
 
 		DxPtr<ID3D12CommandAllocator> m_CommandAllocator = nullptr;
 
+		friend class Dx12Device;
 		friend class Dx12Swapchain;
 	};
 
@@ -101,16 +116,31 @@ namespace Obsidian::Internal
 
 		void CopyImage(Image& dst, const ImageSliceSpecification& dstSlice, Image& src, const ImageSliceSpecification& srcSlice);
 		void CopyImage(Image& dst, const ImageSliceSpecification& dstSlice, StagingImage& src, const ImageSliceSpecification& srcSlice);
+		void CopyImage(StagingImage& dst, const ImageSliceSpecification& dstSlice, Image& src, const ImageSliceSpecification& srcSlice);
+		void CopyImage(Buffer& dst, size_t dstOffset, Image& src, const ImageSliceSpecification& srcSlice);
 		void CopyBuffer(Buffer& dst, Buffer& src, size_t size, size_t srcOffset, size_t dstOffset);
 
+		void GenerateMips(Image& image, const ImageSubresourceSpecification& subresources);
+
 		void Dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) const;
+		void DispatchIndirect(Buffer& argumentBuffer, size_t offset);
+
+		// Query methods
+		void ResetQueries(QueryPool& pool, uint32_t firstQuery, uint32_t queryCount);
+		void BeginQuery(QueryPool& pool, uint32_t query);
+		void EndQuery(QueryPool& pool, uint32_t query);
+		void BeginTimerQuery(QueryPool& pool, uint32_t timer);
+		void EndTimerQuery(QueryPool& pool, uint32_t timer);
 
 		// State methods
 		void RequireState(Image& image, const ImageSubresourceSpecification& subresources, ResourceState state);
 		void RequireState(Buffer& buffer, ResourceState state);
+		void AliasImage(Image& image, ResourceState state);
 
 		// Draw methods
 		void DrawIndexed(const DrawArguments& args) const;
+		void DrawIndexedIndirect(Buffer& argumentBuffer, size_t offset, uint32_t drawCount, uint32_t stride);
+		void DrawIndexedIndirectCount(Buffer& argumentBuffer, size_t offset, Buffer& countBuffer, size_t countOffset, uint32_t maxDrawCount, uint32_t stride);
 
 		// Other methods
 		void PushConstants(const void* memory, size_t size, size_t srcOffset, size_t dstOffset);
@@ -122,18 +152,44 @@ namespace Obsidian::Internal
 		inline DxPtr<ID3D12GraphicsCommandList10> GetID3D12GraphicsCommandList() const { return m_CommandList; }
 		inline HANDLE GetWaitIdleEvent() const { return m_WaitIdleEvent; }
 
+		inline uint64_t GetSignaledValue() const { return m_SignaledValue; } // Note: Fence value signaled when the last submission of this list completes
+
+	private:
+		// Private methods
+		void RecordBarriers(ID3D12GraphicsCommandList10* commandList, std::span<const ImageBarrier> imageBarriers, std::span<const BufferBarrier> bufferBarriers) const;
+		bool ResolveSubmissionBarriers(); // Note: Returns whether there are any first use barriers to record
+		void RecordSubmissionBarriers(ID3D12GraphicsCommandList10* commandList) const; // Note: The commandlist comes from the device, since this list's allocator may still be recording or pending
+
+		void EndAndResolveQuery(QueryPool& pool, uint32_t query);
+
+		void StartRendering(const RenderpassStartArgs& args);
+		void EndRendering();
+
 	private:
 		Dx12CommandListPool& m_Pool;
 		CommandListSpecification m_Specification;
 
 		DxPtr<ID3D12GraphicsCommandList10> m_CommandList = nullptr;
 
+		CommandListStateTracker m_StateTracker;
+		std::vector<ImageBarrier> m_SubmissionImageBarriers = { };
+		std::vector<BufferBarrier> m_SubmissionBufferBarriers = { };
+		mutable std::vector<D3D12_RESOURCE_BARRIER> m_ResourceBarriers = { };
+
 		const GraphicsPipeline* m_CurrentGraphicsPipeline = nullptr;
 		const ComputePipeline* m_CurrentComputePipeline = nullptr;
+		std::array<const BindingSet*, GraphicsPipelineSpecification::MaxBindings> m_BoundSets = { }; // Note: By register space, cleared when a root signature is set
 
 		uint64_t m_SignaledValue = 0;
 		HANDLE m_WaitIdleEvent = nullptr;
 
+		std::vector<std::pair<Dx12QueryPool*, uint32_t>> m_ResolvedQueries = { }; // Note: Get the fence value of the submission assigned when submitted
+
+		bool m_DynamicRendering = false; // Note: Whether the current renderpass was started without a Renderpass
+		Nano::Memory::StaticVector<RenderingAttachment, Information::MaxColourAttachments> m_RenderingColourAttachments = {};
+		RenderingAttachment m_RenderingDepthAttachment = {};
+
+		friend class Dx12Device;
 		friend class Dx12CommandListPool;
 	};
 #endif
@@ -142,6 +142,9 @@ namespace Obsidian::Internal
             queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COMPUTE;
             DX_VERIFY(m_Device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&m_Queues[static_cast<size_t>(CommandQueue::Compute)])));
 
+            queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+            DX_VERIFY(m_Device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&m_CopyQueue)));
+
             // Note: DX12 doesn't really have a Present queue, so we use the graphics queue
             m_Queues[static_cast<size_t>(CommandQueue::Present)] = m_Queues[static_cast<size_t>(CommandQueue::Graphics)];
 
@@ -149,6 +152,7 @@ namespace Obsidian::Internal
             {
                 SetDebugName(m_Queues[static_cast<size_t>(CommandQueue::Graphics)].Get(), "Graphics/Present Queue");
                 SetDebugName(m_Queues[static_cast<size_t>(CommandQueue::Compute)].Get(), "Compute Queue");
+                SetDebugName(m_CopyQueue.Get(), "Copy Queue");
             }
         }
 
@@ -51,6 +51,7 @@ namespace Obsidian::Internal
         inline DxPtr<ID3D12CommandQueue> GetD3D12CommandQueue(CommandQueue queue) const { OB_ASSERT((static_cast<size_t>(queue) < static_cast<size_t>(CommandQueue::Count)), "[Dx12Context] Invalid CommandQueue passed in."); return m_Queues[static_cast<size_t>(queue)]; }
 
         inline const std::array<DxPtr<ID3D12CommandQueue>, static_cast<size_t>(CommandQueue::Count)>& GetD3D12CommandQueues() const { return m_Queues; }
+        inline DxPtr<ID3D12CommandQueue> GetD3D12CopyQueue() const { return m_CopyQueue; } // Note: Used by the UploadManager
 
     private:
         DeviceDestroyCallback m_DestroyCallback;
@@ -63,6 +64,7 @@ namespace Obsidian::Internal
         DxPtr<ID3D12InfoQueue> m_MessageQueue = nullptr;
 
         std::array<DxPtr<ID3D12CommandQueue>, static_cast<size_t>(CommandQueue::Count)> m_Queues = {};
+        DxPtr<ID3D12CommandQueue> m_CopyQueue = nullptr;
     };
 #endif
 
@@ -479,37 +479,7 @@ namespace Obsidian::Internal
 	{
 		OB_ASSERT((m_Type == D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER), "[Dx12DescriptorHeap] Cannot allocate a Sampler from a non Sampler heap.");
 
-		D3D12_SAMPLER_DESC samplerDesc = {};
-
-		UINT reductionType = static_cast<UINT>(SamplerReductionTypeToD3D12FilterReductionType(specs.ReductionType));
-		if (specs.MaxAnisotropy > 1.0f)
-			samplerDesc.Filter = D3D12_ENCODE_ANISOTROPIC_FILTER(reductionType);
-		else
-			samplerDesc.Filter = D3D12_ENCODE_BASIC_FILTER(
-				FilterModeToD3D12FilterType(specs.MinFilter),
-				FilterModeToD3D12FilterType(specs.MagFilter),
-				FilterModeToD3D12FilterType(specs.MipFilter),
-				reductionType
-			);
-
-		UINT maxAnisotropy = 1u;
-		if (specs.MaxAnisotropy == SamplerSpecification::MaxMaxAnisotropyValue)
-			maxAnisotropy = 16u;
-		else
-			maxAnisotropy = std::max(static_cast<UINT>(specs.MaxAnisotropy), 1u);
-
-		samplerDesc.AddressU = SamplerAddresModeToD3D12TextureAddressMode(specs.AddressU);
-		samplerDesc.AddressV = SamplerAddresModeToD3D12TextureAddressMode(specs.AddressV);
-		samplerDesc.AddressW = SamplerAddresModeToD3D12TextureAddressMode(specs.AddressW);
-		samplerDesc.MipLODBias = specs.MipBias;
-		samplerDesc.MaxAnisotropy = maxAnisotropy;
-		samplerDesc.ComparisonFunc = ((specs.ReductionType == SamplerReductionType::Comparison) ? D3D12_COMPARISON_FUNC_LESS : D3D12_COMPARISON_FUNC_NEVER);
-		samplerDesc.BorderColor[0] = specs.BorderColour.r;
-		samplerDesc.BorderColor[1] = specs.BorderColour.g;
-		samplerDesc.BorderColor[2] = specs.BorderColour.b;
-		samplerDesc.BorderColor[3] = specs.BorderColour.a;
-		samplerDesc.MinLOD = 0.0f;
-		samplerDesc.MaxLOD = D3D12_FLOAT32_MAX;
+		D3D12_SAMPLER_DESC samplerDesc = SamplerSpecificationToD3D12SamplerDesc(specs);
 
 		// Passthrough to other func
 		CreateSampler(index, samplerDesc);
@@ -6,12 +6,16 @@
 #include "Obsidian/Utils/Profiler.hpp"
 
 #include "Obsidian/Renderer/Device.hpp"
+#include "Obsidian/Renderer/CommandList.hpp"
 
 #include "Obsidian/Platform/Dx12/Dx12Context.hpp"
 #include "Obsidian/Platform/Dx12/Dx12Image.hpp"
 #include "Obsidian/Platform/Dx12/Dx12Buffer.hpp"
 #include "Obsidian/Platform/Dx12/Dx12Swapchain.hpp"
+#include "Obsidian/Platform/Dx12/Dx12CommandList.hpp"
 #include "Obsidian/Platform/Dx12/Dx12Pipeline.hpp"
+#include "Obsidian/Platform/Dx12/Dx12QueryPool.hpp"
+#include "Obsidian/Platform/Dx12/Dx12UploadManager.hpp"
 
 namespace Obsidian::Internal
 {
@@ -22,6 +26,10 @@ namespace Obsidian::Internal
     Dx12Device::Dx12Device(const DeviceSpecification& specs)
         : m_Context(specs.MessageCallback, specs.DestroyCallback), m_Allocator(m_Context.GetD3D12Adapter().Get(), m_Context.GetD3D12Device()), m_Resources(*api_cast<const Device*>(this)), m_StateTracker(*api_cast<const Device*>(this))
     {
+        DX_VERIFY(m_Context.GetD3D12Device()->CreateFence(m_CurrentFenceValue, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_Fence)));
+
+        if constexpr (Information::Validation)
+            m_Context.SetDebugName(m_Fence.Get(), "CommandList Fence");
     }
 
     Dx12Device::~Dx12Device()
@@ -66,6 +74,107 @@ namespace Obsidian::Internal
         }
     }
 
+    void Dx12Device::Submit(std::span<CommandList*> lists, const CommandListSubmitArgs& args) const
+    {
+        OB_PROFILE("Dx12Device::Submit()");
+
+        if (lists.empty())
+            return;
+
+        std::span<const CommandList*> waitOn;
+        std::visit([&](auto&& arg)
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, std::vector<const CommandList*>>)
+                waitOn = const_cast<std::vector<const CommandList*>&>(arg);
+            else if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, std::span<const CommandList*>>)
+                waitOn = arg;
+        }, args.WaitOnLists);
+
+        // Note: Submission order defines the order in which first use barriers are resolved
+        // and the queue has to be externally synchronized anyway.
+        std::scoped_lock lock(m_SubmitMutex);
+        m_SubmitCommandLists.clear();
+
+        const CommandQueue queueType = api_cast<Dx12CommandList*>(lists[0])->m_Pool.GetSpecification().Queue;
+        Dx12Swapchain* swapchain = nullptr;
+
+        // Note: The entire batch signals a single fence value
+        const uint64_t signalValue = RetrieveNextFenceValue();
+
+        for (CommandList* list : lists)
+        {
+            Dx12CommandList& dxList = *api_cast<Dx12CommandList*>(list);
+            OB_ASSERT((dxList.m_Pool.GetSpecification().Queue == queueType), "[Dx12Device] All CommandLists in a batch must be submitted to the same queue.");
+
+            if (!swapchain && dxList.m_Pool.HasSwapchain())
+                swapchain = &dxList.m_Pool.GetDx12Swapchain();
+
+            if (dxList.ResolveSubmissionBarriers()) // Note: First use transitions have to execute before the actual commands
+            {
+                ID3D12GraphicsCommandList10* barrierList = RetrieveBarrierCommandList(queueType, signalValue);
+                dxList.RecordSubmissionBarriers(barrierList);
+                m_SubmitCommandLists.push_back(barrierList);
+            }
+
+            m_SubmitCommandLists.push_back(dxList.m_CommandList.Get());
+
+            for (const auto& [pool, query] : dxList.m_ResolvedQueries) // Note: Results become available once the fence reaches this submission
+                pool->m_ResolvedValues[query].store(signalValue, std::memory_order_release);
+        }
+
+        OB_ASSERT((!args.OnFinishMakeSwapchainPresentable || swapchain), "[Dx12Device] Can't make a swapchain presentable when none of the CommandListPools were allocated from a Swapchain.");
+
+        auto queue = m_Context.GetD3D12CommandQueue(queueType);
+        for (const CommandList* list : waitOn)
+        {
+            const Dx12CommandList& dxList = *api_cast<const Dx12CommandList*>(list);
+            OB_ASSERT((dxList.GetSignaledValue() != 0), "[Dx12Device] CommandList has not been submitted yet.");
+
+            DX_VERIFY(queue->Wait(m_Fence.Get(), dxList.GetSignaledValue()));
+        }
+        for (const UploadTicket& ticket : args.WaitOnUploads)
+        {
+            if (!ticket.IsValid())
+                continue;
+
+            const Dx12UploadManager& manager = *api_cast<const Dx12UploadManager*>(ticket.Manager);
+            OB_ASSERT((ticket.Value <= manager.GetSubmittedValue()), "[Dx12Device] Upload has not been flushed yet.");
+
+            DX_VERIFY(queue->Wait(manager.GetD3D12Fence().Get(), ticket.Value));
+        }
+
+        // Note: Waiting on swapchain image is not a thing that needs to be handled manually for DX12
+
+        queue->ExecuteCommandLists(static_cast<UINT>(m_SubmitCommandLists.size()), m_SubmitCommandLists.data());
+
+        for (CommandList* list : lists)
+            api_cast<Dx12CommandList*>(list)->m_SignaledValue = signalValue;
+
+        DX_VERIFY(queue->Signal(m_Fence.Get(), signalValue));
+
+        if (args.OnFinishMakeSwapchainPresentable)
+            swapchain->SetPresentableValue(signalValue);
+    }
+
+    uint64_t Dx12Device::GetSubmittedValue() const
+    {
+        std::scoped_lock lock(m_SubmitMutex);
+        return m_CurrentFenceValue;
+    }
+
+    uint64_t Dx12Device::GetCompletedValue() const
+    {
+        return m_Fence->GetCompletedValue();
+    }
+
+    void Dx12Device::WaitForValue(uint64_t value) const
+    {
+        OB_PROFILE("Dx12Device::WaitForValue()");
+
+        if (m_Fence->GetCompletedValue() < value)
+            DX_VERIFY(m_Fence->SetEventOnCompletion(value, nullptr)); // Note: A nullptr event blocks until the fence reaches value
+    }
+
     void Dx12Device::StartTracking(const Image& image, ImageSubresourceSpecification subresources, ResourceState currentState)
     {
         OB_PROFILE("Dx12Device::StartTracking()");
@@ -117,6 +226,13 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("Dx12Device::MapBuffer()");
         const Dx12Buffer& dxBuffer = *api_cast<const Dx12Buffer*>(&buffer);
+
+        if (dxBuffer.GetMappedMemory())
+        {
+            memory = dxBuffer.GetMappedMemory();
+            return;
+        }
+
         dxBuffer.GetD3D12Resource()->Map(0, nullptr, &memory);
     }
 
@@ -124,21 +240,40 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("Dx12Device::UnmapBuffer()");
         const Dx12Buffer& dxBuffer = *api_cast<const Dx12Buffer*>(&buffer);
+
+        if (dxBuffer.GetMappedMemory()) // Note: Persistently mapped buffers stay mapped till they're destroyed
+            return;
+
         dxBuffer.GetD3D12Resource()->Unmap(0, nullptr);
     }
 
+    void Dx12Device::FlushBuffer(const Buffer& buffer, const BufferRange& range) const
+    {
+        // Note: Upload heap memory is always coherent, so there's nothing to flush.
+        (void)buffer; (void)range;
+    }
+
+    void Dx12Device::InvalidateBuffer(const Buffer& buffer, const BufferRange& range) const
+    {
+        // Note: Readback heap memory is always coherent, so there's nothing to invalidate.
+        (void)buffer; (void)range;
+    }
+
     void Dx12Device::WriteBuffer(const Buffer& buffer, const void* memory, size_t size, size_t srcOffset, size_t dstOffset) const
     {
         OB_PROFILE("Dx12Device::WriteBuffer()");
+        const Dx12Buffer& dxBuffer = *api_cast<const Dx12Buffer*>(&buffer);
 
         OB_ASSERT((size + dstOffset <= buffer.GetSpecification().Size), "[VkDevice] Size + offset exceeds buffer size.");
 
-        void* bufferMemory;
-        MapBuffer(buffer, bufferMemory);
+        void* bufferMemory = dxBuffer.GetMappedMemory();
+        if (!bufferMemory)
+            MapBuffer(buffer, bufferMemory);
 
         std::memcpy(static_cast<uint8_t*>(bufferMemory) + dstOffset, static_cast<const uint8_t*>(memory) + srcOffset, size);
 
-        UnmapBuffer(buffer);
+        if (!dxBuffer.GetMappedMemory())
+            UnmapBuffer(buffer);
     }
 
     void Dx12Device::WriteImage(const StagingImage& image, const ImageSliceSpecification& slice, const void* memory, size_t size) const
@@ -195,6 +330,17 @@ namespace Obsidian::Internal
         UnmapBuffer(buffer);
     }
 
+    std::vector<uint8_t> Dx12Device::GetPipelineCacheData() const
+    {
+        // Note: DX12 drivers maintain their own shader cache, so there's nothing to serialize (yet).
+        return {};
+    }
+
+    ImageMemoryRequirements Dx12Device::GetImageMemoryRequirements(const ImageSpecification& specs) const
+    {
+        return Dx12Image::GetMemoryRequirements(*this, specs);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Destruction methods
     ////////////////////////////////////////////////////////////////////////////////////
@@ -220,6 +366,14 @@ namespace Obsidian::Internal
         dxSwapchain.m_Fence = nullptr;
     }
 
+    void Dx12Device::FreePool(CommandListPool& pool) const
+    {
+        Dx12CommandListPool& dxPool = *api_cast<Dx12CommandListPool*>(&pool);
+        m_Context.Destroy([allocator = dxPool.GetD3D12CommandAllocator()]() {}); // Note: Holding a reference to the resource is enough to keep it alive (and destroy when the scope ends)
+
+        dxPool.m_CommandAllocator = nullptr;
+    }
+
     void Dx12Device::DestroyImage(Image& image) const
     {
         Dx12Image& dxImage = *api_cast<Dx12Image*>(&image);
@@ -228,7 +382,15 @@ namespace Obsidian::Internal
         m_Context.Destroy([resource = dxImage.GetD3D12Resource(), allocation = dxImage.GetD3D12MAAllocation()]() {}); // Note: Holding a reference to the resource is enough to keep it alive (and destroy when the scope ends)
 
         dxImage.m_Resource = nullptr;
-        dxImage.m_Allocation = nullptr;
+        dxImage.m_Allocation = nullptr; // Note: For placed images this only drops the reference to the heap's allocation
+    }
+
+    void Dx12Device::DestroyImageHeap(ImageHeap& heap) const
+    {
+        Dx12ImageHeap& dxHeap = *api_cast<Dx12ImageHeap*>(&heap);
+
+        m_Context.Destroy([allocation = dxHeap.GetD3D12MAAllocation()]() {});
+        dxHeap.m_Allocation = nullptr;
     }
 
     void Dx12Device::DestroySubresourceViews(Image& image) const
@@ -281,6 +443,7 @@ namespace Obsidian::Internal
 
         dxBuffer.m_Resource = nullptr;
         dxBuffer.m_Allocation = nullptr;
+        dxBuffer.m_MappedMemory = nullptr; // Note: Releasing the resource unmaps it
     }
 
     void Dx12Device::DestroyFramebuffer(Framebuffer& framebuffer) const
@@ -333,4 +496,80 @@ namespace Obsidian::Internal
         dxPipeline.m_PipelineState = nullptr;
     }
 
+    void Dx12Device::DestroyQueryPool(QueryPool& pool) const
+    {
+        Dx12QueryPool& dxQueryPool = *api_cast<Dx12QueryPool*>(&pool);
+
+        dxQueryPool.m_ReadbackResource->Unmap(0, nullptr);
+        m_Context.Destroy([queryHeap = dxQueryPool.GetD3D12QueryHeap(), resource = dxQueryPool.GetD3D12ReadbackResource(), allocation = dxQueryPool.GetD3D12MAAllocation()]() {}); // Note: Holding a reference to the resource is enough to keep it alive (and destroy when the scope ends)
+
+        dxQueryPool.m_QueryHeap = nullptr;
+        dxQueryPool.m_ReadbackResource = nullptr;
+        dxQueryPool.m_ReadbackAllocation = nullptr;
+        dxQueryPool.m_ReadbackMemory = nullptr;
+    }
+
+    void Dx12Device::DestroyUploadManager(UploadManager& manager) const
+    {
+        Dx12UploadManager& dxManager = *api_cast<Dx12UploadManager*>(&manager);
+
+        // Note: Everything recorded still gets submitted and waited on, since the staging ring is owned by the manager
+        dxManager.Wait(dxManager.Flush());
+
+        dxManager.m_StagingResource->Unmap(0, nullptr);
+        m_Context.Destroy([fence = dxManager.m_Fence, resource = dxManager.m_StagingResource, allocation = dxManager.m_StagingAllocation, batches = std::move(dxManager.m_FreeBatches)]() {}); // Note: Holding a reference to the objects is enough to keep them alive (and destroy when the scope ends)
+
+        dxManager.m_Fence = nullptr;
+        dxManager.m_StagingResource = nullptr;
+        dxManager.m_StagingAllocation = nullptr;
+        dxManager.m_StagingMemory = nullptr;
+        dxManager.m_InFlightBatches.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Internal methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    uint64_t Dx12Device::RetrieveNextFenceValue() const
+    {
+        return ++m_CurrentFenceValue;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    ID3D12GraphicsCommandList10* Dx12Device::RetrieveBarrierCommandList(CommandQueue queue, uint64_t value) const
+    {
+        auto& commandLists = m_BarrierCommandLists[static_cast<size_t>(queue)];
+
+        // Note: Allocators are reused once the fence has passed their value,
+        // so the list only grows up to the amount of submissions that are in flight at once.
+        const uint64_t completedValue = m_Fence->GetCompletedValue();
+        for (BarrierCommandList& entry : commandLists)
+        {
+            if (entry.Value > completedValue)
+                continue;
+
+            DX_VERIFY(entry.Allocator->Reset());
+            DX_VERIFY(entry.CommandList->Reset(entry.Allocator.Get(), nullptr));
+
+            entry.Value = value;
+            return entry.CommandList.Get();
+        }
+
+        BarrierCommandList& entry = commandLists.emplace_back();
+        entry.Value = value;
+
+        const D3D12_COMMAND_LIST_TYPE type = m_Context.GetD3D12CommandQueue(queue)->GetDesc().Type;
+        DX_VERIFY(m_Context.GetD3D12Device()->CreateCommandAllocator(type, IID_PPV_ARGS(&entry.Allocator)));
+
+        DxPtr<ID3D12CommandList> list; // Note: Created in the recording state
+        DX_VERIFY(m_Context.GetD3D12Device()->CreateCommandList(0, type, entry.Allocator.Get(), nullptr, IID_PPV_ARGS(&list)));
+        DX_VERIFY(list->QueryInterface(IID_PPV_ARGS(&entry.CommandList)));
+
+        if constexpr (Information::Validation)
+            m_Context.SetDebugName(entry.CommandList.Get(), "Barrier CommandList");
+
+        return entry.CommandList.Get();
+    }
+
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "Obsidian/Renderer/DeviceSpec.hpp"
 #include "Obsidian/Renderer/ImageSpec.hpp"
 #include "Obsidian/Renderer/ResourceSpec.hpp"
+#include "Obsidian/Renderer/CommandListSpec.hpp"
 #include "Obsidian/Renderer/StateTracker.hpp"
 
 #include "Obsidian/Platform/Dx12/Dx12.hpp"
@@ -14,12 +15,19 @@
 
 #include <Nano/Nano.hpp>
 
+#include <span>
+#include <array>
 #include <tuple>
+#include <mutex>
+#include <vector>
 
 namespace Obsidian
 {
     class Swapchain;
+    class CommandList;
+    class CommandListPool;
     class Image;
+    class ImageHeap;
     class StagingImage;
     class Sampler;
     class InputLayout;
@@ -31,12 +39,15 @@ namespace Obsidian
     class Shader;
     class GraphicsPipeline;
     class ComputePipeline;
+    class QueryPool;
+    class UploadManager;
 }
 
 namespace Obsidian::Internal
 {
 
     class Dx12Device;
+    class Dx12CommandList;
 
 #if defined(OB_API_DX12)
     ////////////////////////////////////////////////////////////////////////////////////
@@ -54,6 +65,12 @@ namespace Obsidian::Internal
         // Methods
         void Wait() const;
 
+        void Submit(std::span<CommandList*> lists, const CommandListSubmitArgs& args) const;
+
+        uint64_t GetSubmittedValue() const;
+        uint64_t GetCompletedValue() const;
+        void WaitForValue(uint64_t value) const;
+
         void StartTracking(const Image& image, ImageSubresourceSpecification subresources, ResourceState currentState);
         void StartTracking(const StagingImage& image, ResourceState currentState);
         void StartTracking(const Buffer& buffer, ResourceState currentState);
@@ -63,14 +80,22 @@ namespace Obsidian::Internal
 
         void MapBuffer(const Buffer& buffer, void*& memory) const;
         void UnmapBuffer(const Buffer& buffer) const;
+        void FlushBuffer(const Buffer& buffer, const BufferRange& range) const;
+        void InvalidateBuffer(const Buffer& buffer, const BufferRange& range) const;
 
         void WriteBuffer(const Buffer& buffer, const void* memory, size_t size, size_t srcOffset, size_t dstOffset) const;
         void WriteImage(const StagingImage& image, const ImageSliceSpecification& slice, const void* memory, size_t size) const;
 
+        std::vector<uint8_t> GetPipelineCacheData() const;
+
+        ImageMemoryRequirements GetImageMemoryRequirements(const ImageSpecification& specs) const;
+
         // Destruction methods
         void DestroySwapchain(Swapchain& swapchain) const;
+        void FreePool(CommandListPool& pool) const;
 
         void DestroyImage(Image& image) const;
+        void DestroyImageHeap(ImageHeap& heap) const;
         void DestroySubresourceViews(Image& image) const;
         void DestroyStagingImage(StagingImage& stagingImage) const;
         void DestroySampler(Sampler& sampler) const;
@@ -90,17 +115,53 @@ namespace Obsidian::Internal
         void DestroyGraphicsPipeline(GraphicsPipeline& pipeline) const;
         void DestroyComputePipeline(ComputePipeline& pipeline) const;
 
+        void DestroyQueryPool(QueryPool& pool) const;
+
+        void DestroyUploadManager(UploadManager& manager) const;
+
+        // Internal methods
+        uint64_t RetrieveNextFenceValue() const;
+
         // Internal getters
         inline const Dx12Context& GetContext() const { return m_Context; }
         inline const Dx12Allocator& GetAllocator() const { return m_Allocator; }
         inline const Dx12Resources& GetResources() const { return m_Resources; }
         inline const StateTracker& GetTracker() const { return m_StateTracker; }
 
+        inline DxPtr<ID3D12Fence> GetD3D12Fence() const { return m_Fence; }
+        inline uint64_t GetCurrentFenceValue() const { return m_CurrentFenceValue; }
+
+    private:
+        // Private methods
+        ID3D12GraphicsCommandList10* RetrieveBarrierCommandList(CommandQueue queue, uint64_t value) const; // Note: Must be called with the submit lock held, returned in the recording state
+
+    private:
+        struct BarrierCommandList
+        {
+        public:
+            uint64_t Value = 0; // Note: Fence value of the submission that executes it
+            DxPtr<ID3D12CommandAllocator> Allocator = nullptr;
+            DxPtr<ID3D12GraphicsCommandList10> CommandList = nullptr;
+        };
+
     private:
         Dx12Context m_Context;
         Dx12Allocator m_Allocator;
         Dx12Resources m_Resources;
         StateTracker m_StateTracker;
+
+        // Note: The commandlist fence is owned by the device (instead of a swapchain), 
+        // so commandlists can be submitted and waited on without any swapchain.
+        DxPtr<ID3D12Fence> m_Fence = nullptr;
+        mutable uint64_t m_CurrentFenceValue = 0;
+
+        // Note: Reused for every submission, so submitting doesn't allocate once the capacity is reached.
+        mutable std::mutex m_SubmitMutex = {};
+        mutable std::vector<ID3D12CommandList*> m_SubmitCommandLists = { };
+
+        // Note: Holds the first use transitions, which are only known at submission. Every entry has its own allocator, so
+        // resetting one never touches an allocator that a list is still recording into or that is still pending.
+        mutable std::array<std::vector<BarrierCommandList>, static_cast<size_t>(CommandQueue::Count)> m_BarrierCommandLists = { };
     };
 #endif
 
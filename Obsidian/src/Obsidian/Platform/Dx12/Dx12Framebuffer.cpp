@@ -20,10 +20,13 @@ namespace Obsidian::Internal
         : m_Renderpass(api_cast<const Dx12Renderpass*>(&renderpass)), m_Specification(specs)
     {
         // Make sure the imageviews are available
-        if (specs.ColourAttachment.IsValid())
+        for (const FramebufferAttachment& attachment : specs.ColourAttachments)
         {
-            Dx12Image& dxImage = *api_cast<Dx12Image*>(specs.ColourAttachment.ImagePtr);
-            (void)dxImage.GetSubresourceView(specs.ColourAttachment.Subresources, ImageSubresourceViewUsage::RTV, ImageDimension::Unknown, Format::Unknown);
+            if (!attachment.IsValid())
+                continue;
+
+            Dx12Image& dxImage = *api_cast<Dx12Image*>(attachment.ImagePtr);
+            (void)dxImage.GetSubresourceView(attachment.Subresources, ImageSubresourceViewUsage::RTV, ImageDimension::Unknown, Format::Unknown);
         }
         if (specs.DepthAttachment.IsValid())
         {
@@ -5,6 +5,8 @@
 #include "Obsidian/Core/Information.hpp"
 #include "Obsidian/Utils/Profiler.hpp"
 
+#include "Obsidian/Renderer/Image.hpp"
+
 #include "Obsidian/Platform/Dx12/Dx12Device.hpp"
 #include "Obsidian/Platform/Dx12/Dx12Resources.hpp"
 
@@ -91,6 +93,29 @@ namespace Obsidian::Internal
 		return {};
 	}
 
+	////////////////////////////////////////////////////////////////////////////////////
+	// Constructor & Destructor
+	////////////////////////////////////////////////////////////////////////////////////
+	Dx12ImageHeap::Dx12ImageHeap(const Device& device, const ImageHeapSpecification& specs)
+		: m_Device(*api_cast<const Dx12Device*>(&device)), m_Specification(specs)
+	{
+		OB_ASSERT((m_Specification.Size > 0), "[Dx12ImageHeap] Invalid size passed in.");
+		OB_ASSERT(((m_Specification.MemoryTypeBits == RenderTargetMemoryBit) || (m_Specification.MemoryTypeBits == TextureMemoryBit)), "[Dx12ImageHeap] Render targets/depth stencils and other textures can't share a heap.");
+
+		D3D12_HEAP_FLAGS heapFlags = ((m_Specification.MemoryTypeBits == RenderTargetMemoryBit) ? D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES : D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES);
+		m_Allocation = m_Device.GetAllocator().AllocateImageMemory(m_Specification.Size, m_Specification.Alignment, heapFlags);
+
+		if constexpr (Information::Validation)
+		{
+			if (!m_Specification.DebugName.empty())
+				m_Device.GetContext().SetDebugName(m_Allocation->GetHeap(), m_Specification.DebugName);
+		}
+	}
+
+	Dx12ImageHeap::~Dx12ImageHeap()
+	{
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// Constructor & Destructor
 	////////////////////////////////////////////////////////////////////////////////////
@@ -105,6 +130,12 @@ namespace Obsidian::Internal
 		CreateImage();
 	}
 
+	Dx12Image::Dx12Image(const Device& device, const ImageSpecification& specs, const ImageHeap& heap, size_t offset)
+		: m_Device(*api_cast<const Dx12Device*>(&device)), m_Specification(specs), m_Placed(true)
+	{
+		CreatePlacedImage(api_cast<const Dx12ImageHeap*>(&heap)->GetD3D12MAAllocation(), offset);
+	}
+
 	Dx12Image::~Dx12Image()
 	{
 	}
@@ -114,6 +145,8 @@ namespace Obsidian::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	void Dx12Image::Resize(uint32_t width, uint32_t height)
 	{
+		OB_ASSERT(!m_Placed, "[Dx12Image] Placed images can't be resized, recreate them in a heap that fits the new size.");
+
 		m_Device.DestroyImage(*api_cast<Image*>(this));
 
 		m_Specification.Width = width;
@@ -234,6 +267,40 @@ namespace Obsidian::Internal
 		}
 	}
 
+	void Dx12Image::CreatePlacedImage(DxPtr<D3D12MA::Allocation> allocation, size_t offset)
+	{
+		OB_ASSERT(((m_Specification.Width != 0) && (m_Specification.Height != 0)), "[Dx12Image] Invalid width/height passed in.");
+		OB_ASSERT((m_Specification.ImageFormat != Format::Unknown), "[Dx12Image] Invalid format passed in.");
+
+		// Note: Placed resources start out in COMMON (or their permanent state), the first use goes through an aliasing barrier
+		m_Allocation = allocation;
+		m_Device.GetAllocator().CreateAliasingImage(m_Allocation, offset, m_Resource, ResourceStateToD3D12ResourceStates(m_Specification.PermanentState), ImageSpecificationToD3D12ResourceDesc(m_Specification));
+
+		m_PlaneCount = Dx12FormatToPlaneCount(*api_cast<const Device*>(&m_Device), (m_Specification.IsTypeless ? FormatToFormatMapping(m_Specification.ImageFormat).ResourceFormat : FormatToFormatMapping(m_Specification.ImageFormat).RTVFormat));
+
+		if constexpr (Information::Validation)
+		{
+			if (!m_Specification.DebugName.empty())
+				m_Device.GetContext().SetDebugName(m_Resource.Get(), m_Specification.DebugName);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// Static methods
+	////////////////////////////////////////////////////////////////////////////////////
+	ImageMemoryRequirements Dx12Image::GetMemoryRequirements(const Dx12Device& device, const ImageSpecification& specs)
+	{
+		D3D12_RESOURCE_DESC resourceDesc = ImageSpecificationToD3D12ResourceDesc(specs);
+		D3D12_RESOURCE_ALLOCATION_INFO allocationInfo = device.GetAllocator().GetImageAllocationInfo(resourceDesc);
+
+		ImageMemoryRequirements requirements = {};
+		requirements.Size = static_cast<size_t>(allocationInfo.SizeInBytes);
+		requirements.Alignment = static_cast<size_t>(allocationInfo.Alignment);
+		requirements.MemoryTypeBits = ((resourceDesc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) ? Dx12ImageHeap::RenderTargetMemoryBit : Dx12ImageHeap::TextureMemoryBit);
+
+		return requirements;
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// Constructor & Destructor
 	////////////////////////////////////////////////////////////////////////////////////
@@ -241,6 +308,7 @@ namespace Obsidian::Internal
 		: m_Device(*api_cast<const Dx12Device*>(&device)), m_Specification(ImageSpecification(specs).SetIsShaderResource(true)), m_SubresourceOffsets(GetSubresourceOffsets()), m_Buffer(device, BufferSpecification()
 			.SetSize(GetBufferSize())
 			.SetCPUAccess(cpuAccessMode)
+			.SetIsPersistentlyMapped(static_cast<bool>(cpuAccessMode & CpuAccessMode::Write)) // Note: Staging images get written to often, so we keep them mapped
 			.SetPermanentState(specs.PermanentState)
 			.SetDebugName(specs.DebugName)
 		)
@@ -17,12 +17,14 @@ namespace Obsidian
 {
 	class Device;
 	class Image;
+	class ImageHeap;
 }
 
 namespace Obsidian::Internal
 {
 
 	class Dx12Device;
+	class Dx12ImageHeap;
 	class Dx12Image;
 	class Dx12StagingImage;
 	class Dx12Sampler;
@@ -79,6 +81,36 @@ namespace Obsidian::Internal
 		friend class Dx12Image;
 	};
 
+	////////////////////////////////////////////////////////////////////////////////////
+	// Dx12ImageHeap
+	////////////////////////////////////////////////////////////////////////////////////
+	class Dx12ImageHeap
+	{
+	public:
+		// Note: Dx12 has no memory types, with resource heap tier 1 render targets/depth stencils and other textures
+		// can't share a heap. We expose that as two "memory types" so the shared MemoryTypeBits logic works the same as Vulkan.
+		inline constexpr static uint32_t RenderTargetMemoryBit = 1u << 0;
+		inline constexpr static uint32_t TextureMemoryBit = 1u << 1;
+	public:
+		// Constructor & Destructor
+		Dx12ImageHeap(const Device& device, const ImageHeapSpecification& specs);
+		~Dx12ImageHeap();
+
+		// Getters
+		inline const ImageHeapSpecification& GetSpecification() const { return m_Specification; }
+
+		// Internal getters
+		inline DxPtr<D3D12MA::Allocation> GetD3D12MAAllocation() const { return m_Allocation; }
+
+	private:
+		const Dx12Device& m_Device;
+		ImageHeapSpecification m_Specification;
+
+		DxPtr<D3D12MA::Allocation> m_Allocation = nullptr;
+
+		friend class Dx12Device;
+	};
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// Dx12Image
 	////////////////////////////////////////////////////////////////////////////////////
@@ -88,6 +120,7 @@ namespace Obsidian::Internal
 		// Constructors & Destructor
 		Dx12Image(const Device& device);
 		Dx12Image(const Device& device, const ImageSpecification& specs);
+		Dx12Image(const Device& device, const ImageSpecification& specs, const ImageHeap& heap, size_t offset); // Note: Placed (aliased) in the heap's memory
 		~Dx12Image();
 
 		// Methods
@@ -104,6 +137,7 @@ namespace Obsidian::Internal
 
 		inline DxPtr<ID3D12Resource> GetD3D12Resource() const { return m_Resource; }
 		inline DxPtr<D3D12MA::Allocation> GetD3D12MAAllocation() const { return m_Allocation; }
+		inline bool IsPlaced() const { return m_Placed; } // Note: Placed images share the allocation of their heap
 
 		const Dx12ImageSubresourceView& GetSubresourceView(const ImageSubresourceSpecification& specs, ImageSubresourceViewUsage usage, ImageDimension dimension = ImageDimension::Unknown, Format format = Format::Unknown, bool isReadOnly = false); // Note: For RTV & DSV
 		const Dx12ImageSubresourceView& GetSubresourceView(DescriptorHeapIndex index, const ImageSubresourceSpecification& specs, ImageSubresourceViewUsage usage, ImageDimension dimension = ImageDimension::Unknown, Format format = Format::Unknown);
@@ -111,9 +145,13 @@ namespace Obsidian::Internal
 
 		inline uint8_t GetPlaneCount() const { return m_PlaneCount; }
 
+		// Static methods
+		static ImageMemoryRequirements GetMemoryRequirements(const Dx12Device& device, const ImageSpecification& specs);
+
 	private:
 		// Private methods
 		void CreateImage();
+		void CreatePlacedImage(DxPtr<D3D12MA::Allocation> allocation, size_t offset);
 
 	private:
 		const Dx12Device& m_Device;
@@ -121,6 +159,7 @@ namespace Obsidian::Internal
 
 		DxPtr<ID3D12Resource> m_Resource = nullptr;
 		DxPtr<D3D12MA::Allocation> m_Allocation = nullptr;
+		bool m_Placed = false;
 
 		std::unordered_map<Dx12ImageSubresourceView::Key, Dx12ImageSubresourceView, Dx12ImageSubresourceView::Hash> m_ImageViews = {};
 
@@ -23,6 +23,7 @@ namespace Obsidian::Internal
         {
             std::vector<CD3DX12_ROOT_PARAMETER> parameters;
             parameters.reserve(m_Specification.BindingLayouts.size() * 5);
+            std::vector<D3D12_STATIC_SAMPLER_DESC> staticSamplers;
 
             // Create one big list of parameters for descriptors
             for (auto& layout : m_Specification.BindingLayouts)
@@ -33,6 +34,7 @@ namespace Obsidian::Internal
                 const auto& srvAndUAVAndCBVRanges = dxLayout.GetSRVAndUAVAndCBVRanges();
                 const auto& samplerRanges = dxLayout.GetSamplerRanges();
                 const auto& dynamicRanges = dxLayout.GetDynamicRanges();
+                staticSamplers.insert(staticSamplers.end(), dxLayout.GetStaticSamplers().begin(), dxLayout.GetStaticSamplers().end());
 
                 // Reserve space
                 m_RootParameterIndices[registerSpace].SRVAndUAVAndCBVIndices.reserve(srvAndUAVAndCBVRanges.size());
@@ -97,8 +99,8 @@ namespace Obsidian::Internal
             // Create root signature with these parameters
             CD3DX12_ROOT_SIGNATURE_DESC rootSigDesc = {};
             
-            if (!parameters.empty())
-                rootSigDesc.Init(static_cast<UINT>(parameters.size()), parameters.data());
+            if (!parameters.empty() || !staticSamplers.empty())
+                rootSigDesc.Init(static_cast<UINT>(parameters.size()), parameters.data(), static_cast<UINT>(staticSamplers.size()), staticSamplers.data());
             
             rootSigDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
 
@@ -111,9 +113,28 @@ namespace Obsidian::Internal
 
         // Create pipeline state
         {
-            OB_ASSERT(m_Specification.Pass, "[Dx12GraphicsPipeline] No proper renderpass was passed in.");
+            OB_ASSERT((m_Specification.Pass || !m_Specification.ColourFormats.empty() || (m_Specification.DepthFormat != Format::Unknown)), "[Dx12GraphicsPipeline] No proper renderpass or attachment formats were passed in.");
             OB_ASSERT(m_Specification.Input, "[Dx12GraphicsPipeline] No proper input layout was passed in.");
 
+            // Attachment formats, from the renderpass or (with dynamic rendering) from the specification
+            Nano::Memory::StaticVector<Format, Information::MaxColourAttachments> colourFormats = m_Specification.ColourFormats;
+            Format depthFormat = m_Specification.DepthFormat;
+            uint32_t sampleCount = m_Specification.SampleCount;
+            uint32_t sampleQuality = m_Specification.SampleQuality;
+            if (m_Specification.Pass)
+            {
+                const RenderpassSpecification& renderpassSpecs = m_Specification.Pass->GetSpecification();
+
+                colourFormats = {};
+                for (const RenderpassAttachmentSpecification& colour : renderpassSpecs.ColourAttachments)
+                    colourFormats.push_back(colour.Specification.ImageFormat);
+                depthFormat = (renderpassSpecs.DepthAttachment.IsValid() ? renderpassSpecs.DepthAttachment.Specification.ImageFormat : Format::Unknown);
+
+                const ImageSpecification& sampleSpecs = (!renderpassSpecs.ColourAttachments.empty() ? renderpassSpecs.ColourAttachments[0].Specification : renderpassSpecs.DepthAttachment.Specification);
+                sampleCount = sampleSpecs.SampleCount;
+                sampleQuality = sampleSpecs.SampleQuality;
+            }
+
             auto& blendState = m_Specification.RenderingState.Blend;
             auto& depthStencilState = m_Specification.RenderingState.DepthStencil;
             auto& rasterState = m_Specification.RenderingState.Raster;
@@ -130,16 +151,21 @@ namespace Obsidian::Internal
 
             // Blend
             desc.BlendState.AlphaToCoverageEnable = blendState.AlphaToCoverageEnable;
-            desc.BlendState.IndependentBlendEnable = true;
+            desc.BlendState.IndependentBlendEnable = blendState.IndependentBlendEnable ? TRUE : FALSE;
 
-            desc.BlendState.RenderTarget[0].BlendEnable = blendState.Target.BlendEnable ? TRUE : FALSE;
-            desc.BlendState.RenderTarget[0].SrcBlend = BlendFactorToD3D12Blend(blendState.Target.SrcBlend);
-            desc.BlendState.RenderTarget[0].DestBlend = BlendFactorToD3D12Blend(blendState.Target.DstBlend);
-            desc.BlendState.RenderTarget[0].BlendOp = BlendOperationToD3D12BlendOp(blendState.Target.BlendOp);
-            desc.BlendState.RenderTarget[0].SrcBlendAlpha = BlendFactorToD3D12Blend(blendState.Target.SrcBlendAlpha);
-            desc.BlendState.RenderTarget[0].DestBlendAlpha = BlendFactorToD3D12Blend(blendState.Target.DstBlendAlpha);
-            desc.BlendState.RenderTarget[0].BlendOpAlpha = BlendOperationToD3D12BlendOp(blendState.Target.BlendOpAlpha);
-            desc.BlendState.RenderTarget[0].RenderTargetWriteMask = static_cast<UINT8>(ColourMaskToD3D12ColourWriteEnable(blendState.Target.ColourWriteMask));
+            for (uint32_t i = 0; i < static_cast<uint32_t>(colourFormats.size()); i++)
+            {
+                const BlendState::RenderTarget& target = blendState.GetRenderTarget(i);
+
+                desc.BlendState.RenderTarget[i].BlendEnable = target.BlendEnable ? TRUE : FALSE;
+                desc.BlendState.RenderTarget[i].SrcBlend = BlendFactorToD3D12Blend(target.SrcBlend);
+                desc.BlendState.RenderTarget[i].DestBlend = BlendFactorToD3D12Blend(target.DstBlend);
+                desc.BlendState.RenderTarget[i].BlendOp = BlendOperationToD3D12BlendOp(target.BlendOp);
+                desc.BlendState.RenderTarget[i].SrcBlendAlpha = BlendFactorToD3D12Blend(target.SrcBlendAlpha);
+                desc.BlendState.RenderTarget[i].DestBlendAlpha = BlendFactorToD3D12Blend(target.DstBlendAlpha);
+                desc.BlendState.RenderTarget[i].BlendOpAlpha = BlendOperationToD3D12BlendOp(target.BlendOpAlpha);
+                desc.BlendState.RenderTarget[i].RenderTargetWriteMask = static_cast<UINT8>(ColourMaskToD3D12ColourWriteEnable(target.ColourWriteMask));
+            }
 
             // Depth stencil
             desc.DepthStencilState.DepthEnable = depthStencilState.DepthTestEnable ? TRUE : FALSE;
@@ -157,13 +183,15 @@ namespace Obsidian::Internal
             desc.DepthStencilState.BackFace.StencilPassOp = StencilOperationToD3D12StencilOp(depthStencilState.BackFaceStencil.PassOp);
             desc.DepthStencilState.BackFace.StencilFunc = ComparisonFuncToD3D12ComparisonFunc(depthStencilState.BackFaceStencil.StencilFunc);
 
-            if ((depthStencilState.DepthTestEnable || depthStencilState.StencilEnable) && (m_Specification.Pass->GetFramebuffer(0).GetSpecification().DepthAttachment.IsValid()) && (m_Specification.Pass->GetFramebuffer(0).GetSpecification().DepthAttachment.ImagePtr->GetSpecification().ImageFormat == Format::Unknown))
+            if (depthFormat != Format::Unknown)
+            {
+                desc.DSVFormat = FormatToFormatMapping(depthFormat).RTVFormat;
+            }
+            else if (depthStencilState.DepthTestEnable || depthStencilState.StencilEnable)
             {
                 desc.DepthStencilState.DepthEnable = FALSE;
                 desc.DepthStencilState.StencilEnable = FALSE;
 
-                desc.DSVFormat = FormatToFormatMapping(m_Specification.Pass->GetFramebuffer(0).GetSpecification().DepthAttachment.ImagePtr->GetSpecification().ImageFormat).RTVFormat;
-
                 dxDevice.GetContext().Warn("[Dx12GraphicsPipeline] DepthEnable or StencilEnable is true, but no depth target is set for the renderpass' framebuffer.");
             }
 
@@ -182,16 +210,17 @@ namespace Obsidian::Internal
             desc.RasterizerState.ForcedSampleCount = 0;
 
             desc.PrimitiveTopologyType = PrimitiveTypeToD3D12PrimitiveTopology(m_Specification.Primitive);
-            desc.SampleDesc.Count = m_Specification.Pass->GetFramebuffer(0).GetSpecification().ColourAttachment.ImagePtr->GetSpecification().SampleCount;
-            desc.SampleDesc.Quality = m_Specification.Pass->GetFramebuffer(0).GetSpecification().ColourAttachment.ImagePtr->GetSpecification().SampleQuality;
+            desc.SampleDesc.Count = sampleCount;
+            desc.SampleDesc.Quality = sampleQuality;
 
-            desc.RTVFormats[0] = FormatToFormatMapping(m_Specification.Pass->GetFramebuffer(0).GetSpecification().ColourAttachment.ImagePtr->GetSpecification().ImageFormat).RTVFormat;
+            for (size_t i = 0; i < colourFormats.size(); i++)
+                desc.RTVFormats[i] = FormatToFormatMapping(colourFormats[i]).RTVFormat;
 
             Dx12InputLayout& dxInputLayout = *api_cast<Dx12InputLayout*>(m_Specification.Input);
             desc.InputLayout.NumElements = static_cast<uint32_t>(dxInputLayout.GetInputElements().size());
             desc.InputLayout.pInputElementDescs = dxInputLayout.GetInputElements().data();
 
-            desc.NumRenderTargets = 1;
+            desc.NumRenderTargets = static_cast<UINT>(colourFormats.size());
             desc.SampleMask = ~0u;
 
             DX_VERIFY(dxDevice.GetContext().GetD3D12Device()->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&m_PipelineState)));
@@ -246,6 +275,7 @@ namespace Obsidian::Internal
         {
             std::vector<CD3DX12_ROOT_PARAMETER> parameters;
             parameters.reserve(m_Specification.BindingLayouts.size() * 5);
+            std::vector<D3D12_STATIC_SAMPLER_DESC> staticSamplers;
 
             // Create one big list of parameters for descriptors
             for (auto& layout : m_Specification.BindingLayouts)
@@ -256,6 +286,7 @@ namespace Obsidian::Internal
                 const auto& srvAndUAVAndCBVRanges = dxLayout.GetSRVAndUAVAndCBVRanges();
                 const auto& samplerRanges = dxLayout.GetSamplerRanges();
                 const auto& dynamicRanges = dxLayout.GetDynamicRanges();
+                staticSamplers.insert(staticSamplers.end(), dxLayout.GetStaticSamplers().begin(), dxLayout.GetStaticSamplers().end());
 
                 // Reserve space
                 m_RootParameterIndices[registerSpace].SRVAndUAVAndCBVIndices.reserve(srvAndUAVAndCBVRanges.size());
@@ -317,8 +348,8 @@ namespace Obsidian::Internal
             // Create root signature with these parameters
             CD3DX12_ROOT_SIGNATURE_DESC rootSigDesc = {};
 
-            if (!parameters.empty())
-                rootSigDesc.Init(static_cast<UINT>(parameters.size()), parameters.data());
+            if (!parameters.empty() || !staticSamplers.empty())
+                rootSigDesc.Init(static_cast<UINT>(parameters.size()), parameters.data(), static_cast<UINT>(staticSamplers.size()), staticSamplers.data());
 
             rootSigDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
 
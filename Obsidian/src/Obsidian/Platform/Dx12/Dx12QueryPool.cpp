@@ -0,0 +1,151 @@
+#include "obpch.h"
+#include "Dx12QueryPool.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+#include "Obsidian/Renderer/QueryPool.hpp"
+
+#include "Obsidian/Platform/Dx12/Dx12Device.hpp"
+#include "Obsidian/Platform/Dx12/Dx12CommandList.hpp"
+
+namespace Obsidian::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    Dx12QueryPool::Dx12QueryPool(const Device& device, const QueryPoolSpecification& specs)
+        : m_Device(*api_cast<const Dx12Device*>(&device)), m_Specification(specs), m_ResolvedValues(specs.Count)
+    {
+        OB_ASSERT((m_Specification.Count > 0), "[Dx12QueryPool] A QueryPool must contain at least 1 query.");
+        OB_ASSERT(((m_Specification.Type != QueryType::Timestamp) || (m_Specification.Count % 2 == 0)), "[Dx12QueryPool] A Timestamp QueryPool must have an even count, since every timer uses 2 queries.");
+
+        D3D12_QUERY_HEAP_DESC heapDesc = {};
+        heapDesc.Count = m_Specification.Count;
+        heapDesc.NodeMask = 0;
+        switch (m_Specification.Type)
+        {
+        case QueryType::Timestamp:              heapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP; break;
+        case QueryType::PipelineStatistics:     heapDesc.Type = D3D12_QUERY_HEAP_TYPE_PIPELINE_STATISTICS; break;
+        case QueryType::Occlusion:              heapDesc.Type = D3D12_QUERY_HEAP_TYPE_OCCLUSION; break;
+
+        default:
+            OB_ASSERT(false, "[Dx12QueryPool] Unknown QueryType.");
+            break;
+        }
+
+        DX_VERIFY(m_Device.GetContext().GetD3D12Device()->CreateQueryHeap(&heapDesc, IID_PPV_ARGS(&m_QueryHeap)));
+
+        m_ReadbackAllocation = m_Device.GetAllocator().AllocateBuffer(m_ReadbackResource, GetQueryStride() * m_Specification.Count, D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_FLAG_NONE, D3D12_HEAP_TYPE_READBACK);
+        DX_VERIFY(m_ReadbackResource->Map(0, nullptr, reinterpret_cast<void**>(&m_ReadbackMemory)));
+
+        if (m_Specification.Type == QueryType::Timestamp)
+            DX_VERIFY(m_Device.GetContext().GetD3D12CommandQueue(CommandQueue::Graphics)->GetTimestampFrequency(&m_TimestampFrequency));
+
+        if constexpr (Information::Validation)
+        {
+            if (!m_Specification.DebugName.empty())
+            {
+                m_Device.GetContext().SetDebugName(m_QueryHeap.Get(), m_Specification.DebugName);
+                m_Device.GetContext().SetDebugName(m_ReadbackResource.Get(), std::format("Readback buffer for: {0}", m_Specification.DebugName));
+            }
+        }
+    }
+
+    Dx12QueryPool::~Dx12QueryPool()
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    bool Dx12QueryPool::GetResults(uint32_t firstQuery, uint32_t queryCount, std::span<uint64_t> results) const
+    {
+        OB_PROFILE("Dx12QueryPool::GetResults()");
+
+        const size_t valuesPerQuery = ((m_Specification.Type == QueryType::PipelineStatistics) ? (sizeof(PipelineStatistics) / sizeof(uint64_t)) : 1);
+        OB_ASSERT((firstQuery + queryCount <= m_Specification.Count), "[Dx12QueryPool] Query range exceeds the QueryPool's count.");
+        OB_ASSERT((results.size() >= queryCount * valuesPerQuery), "[Dx12QueryPool] Results span is too small for the requested queries.");
+
+        // Availability
+        const uint64_t completedValue = m_Device.GetD3D12Fence()->GetCompletedValue();
+        for (uint32_t i = firstQuery; i < firstQuery + queryCount; i++)
+        {
+            const uint64_t resolvedValue = m_ResolvedValues[i].load(std::memory_order_acquire);
+            if ((resolvedValue == 0) || (resolvedValue > completedValue)) // Note: PendingValue is never reached
+                return false;
+        }
+
+        // Results
+        for (uint32_t i = 0; i < queryCount; i++)
+        {
+            const uint8_t* memory = m_ReadbackMemory + ((firstQuery + i) * GetQueryStride());
+
+            if (m_Specification.Type == QueryType::PipelineStatistics)
+            {
+                const D3D12_QUERY_DATA_PIPELINE_STATISTICS& data = *reinterpret_cast<const D3D12_QUERY_DATA_PIPELINE_STATISTICS*>(memory);
+                uint64_t* statistics = &results[i * valuesPerQuery];
+
+                statistics[0] = data.IAVertices;
+                statistics[1] = data.IAPrimitives;
+                statistics[2] = data.VSInvocations;
+                statistics[3] = data.CInvocations;
+                statistics[4] = data.CPrimitives;
+                statistics[5] = data.PSInvocations;
+                statistics[6] = data.CSInvocations;
+            }
+            else
+            {
+                results[i] = *reinterpret_cast<const uint64_t*>(memory);
+            }
+        }
+
+        return true;
+    }
+
+    bool Dx12QueryPool::GetTimerResult(uint32_t timer, double& milliseconds) const
+    {
+        OB_ASSERT((m_Specification.Type == QueryType::Timestamp), "[Dx12QueryPool] GetTimerResult can only be used on a Timestamp QueryPool.");
+
+        std::array<uint64_t, 2> timestamps = { };
+        if (!GetResults(timer * 2, 2, timestamps))
+            return false;
+
+        milliseconds = (static_cast<double>(timestamps[1] - timestamps[0]) * 1000.0) / static_cast<double>(m_TimestampFrequency);
+        return true;
+    }
+
+    bool Dx12QueryPool::GetPipelineStatistics(uint32_t query, PipelineStatistics& statistics) const
+    {
+        OB_ASSERT((m_Specification.Type == QueryType::PipelineStatistics), "[Dx12QueryPool] GetPipelineStatistics can only be used on a PipelineStatistics QueryPool.");
+
+        return GetResults(query, 1, std::span<uint64_t>(reinterpret_cast<uint64_t*>(&statistics), sizeof(PipelineStatistics) / sizeof(uint64_t)));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Internal getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    D3D12_QUERY_TYPE Dx12QueryPool::GetD3D12QueryType() const
+    {
+        switch (m_Specification.Type)
+        {
+        case QueryType::Timestamp:              return D3D12_QUERY_TYPE_TIMESTAMP;
+        case QueryType::PipelineStatistics:     return D3D12_QUERY_TYPE_PIPELINE_STATISTICS;
+        case QueryType::Occlusion:              return D3D12_QUERY_TYPE_OCCLUSION;
+
+        default:
+            OB_ASSERT(false, "[Dx12QueryPool] Unknown QueryType.");
+            break;
+        }
+
+        return D3D12_QUERY_TYPE_TIMESTAMP;
+    }
+
+    size_t Dx12QueryPool::GetQueryStride() const
+    {
+        return ((m_Specification.Type == QueryType::PipelineStatistics) ? sizeof(D3D12_QUERY_DATA_PIPELINE_STATISTICS) : sizeof(uint64_t));
+    }
+
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/API.hpp"
+#include "Obsidian/Renderer/QueryPoolSpec.hpp"
+
+#include "Obsidian/Platform/Dx12/Dx12.hpp"
+
+#include <span>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+namespace Obsidian
+{
+    class Device;
+}
+
+namespace Obsidian::Internal
+{
+
+    class Dx12Device;
+    class Dx12CommandList;
+    class Dx12QueryPool;
+
+#if defined(OB_API_DX12)
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Dx12QueryPool
+    ////////////////////////////////////////////////////////////////////////////////////
+    class Dx12QueryPool
+    {
+    public:
+        // Constructor & Destructor
+        Dx12QueryPool(const Device& device, const QueryPoolSpecification& specs);
+        ~Dx12QueryPool();
+
+        // Methods
+        bool GetResults(uint32_t firstQuery, uint32_t queryCount, std::span<uint64_t> results) const;
+
+        bool GetTimerResult(uint32_t timer, double& milliseconds) const;
+        bool GetPipelineStatistics(uint32_t query, PipelineStatistics& statistics) const;
+
+        // Getters
+        inline const QueryPoolSpecification& GetSpecification() const { return m_Specification; }
+
+        // Internal getters
+        inline DxPtr<ID3D12QueryHeap> GetD3D12QueryHeap() const { return m_QueryHeap; }
+        inline DxPtr<ID3D12Resource> GetD3D12ReadbackResource() const { return m_ReadbackResource; }
+        inline DxPtr<D3D12MA::Allocation> GetD3D12MAAllocation() const { return m_ReadbackAllocation; }
+
+        D3D12_QUERY_TYPE GetD3D12QueryType() const;
+        size_t GetQueryStride() const; // Note: Size of a single resolved query in the readback buffer
+
+    private:
+        const Dx12Device& m_Device;
+        QueryPoolSpecification m_Specification;
+
+        DxPtr<ID3D12QueryHeap> m_QueryHeap = nullptr;
+        DxPtr<ID3D12Resource> m_ReadbackResource = nullptr; // Note: Queries get resolved into this buffer when they end
+        DxPtr<D3D12MA::Allocation> m_ReadbackAllocation = nullptr;
+        uint8_t* m_ReadbackMemory = nullptr; // Note: Readback heaps can stay mapped
+
+        // Note: D3D12 has no query availability, so every query stores the fence value of the submission that last resolved it
+        // and the result is available once the fence has reached it. Recorded but not yet submitted queries hold PendingValue.
+        inline constexpr static uint64_t PendingValue = std::numeric_limits<uint64_t>::max();
+        std::vector<std::atomic<uint64_t>> m_ResolvedValues;
+
+        uint64_t m_TimestampFrequency = 1; // Note: Ticks per second
+
+        friend class Dx12Device;
+        friend class Dx12CommandList;
+    };
+#endif
+
+}
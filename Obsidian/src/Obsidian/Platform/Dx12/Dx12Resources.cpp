@@ -27,6 +27,33 @@ namespace Obsidian::Internal
 		// Note: The destructor of the Heaps will release the resources
 	}
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    DxPtr<ID3D12CommandSignature> Dx12Resources::GetCommandSignature(D3D12_INDIRECT_ARGUMENT_TYPE type, uint32_t stride) const
+    {
+        const uint64_t key = (static_cast<uint64_t>(type) << 32ull) | static_cast<uint64_t>(stride);
+
+        std::scoped_lock lock(m_CommandSignatureMutex);
+        if (auto it = m_CommandSignatures.find(key); it != m_CommandSignatures.end())
+            return it->second;
+
+        D3D12_INDIRECT_ARGUMENT_DESC argument = {};
+        argument.Type = type;
+
+        D3D12_COMMAND_SIGNATURE_DESC signatureDesc = {};
+        signatureDesc.ByteStride = stride;
+        signatureDesc.NumArgumentDescs = 1;
+        signatureDesc.pArgumentDescs = &argument;
+        signatureDesc.NodeMask = 0;
+
+        DxPtr<ID3D12CommandSignature> signature = nullptr;
+        DX_VERIFY(m_Device.GetContext().GetD3D12Device()->CreateCommandSignature(&signatureDesc, nullptr, IID_PPV_ARGS(&signature))); // Note: A root signature is only needed when the signature changes root arguments
+
+        m_CommandSignatures[key] = signature;
+        return signature;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Other
     ////////////////////////////////////////////////////////////////////////////////////
@@ -47,4 +74,64 @@ namespace Obsidian::Internal
         return planeCount;
     }
 
+    D3D12_SAMPLER_DESC SamplerSpecificationToD3D12SamplerDesc(const SamplerSpecification& specs)
+    {
+        D3D12_SAMPLER_DESC samplerDesc = {};
+
+        UINT reductionType = static_cast<UINT>(SamplerReductionTypeToD3D12FilterReductionType(specs.ReductionType));
+        if (specs.MaxAnisotropy > 1.0f)
+            samplerDesc.Filter = D3D12_ENCODE_ANISOTROPIC_FILTER(reductionType);
+        else
+            samplerDesc.Filter = D3D12_ENCODE_BASIC_FILTER(
+                FilterModeToD3D12FilterType(specs.MinFilter),
+                FilterModeToD3D12FilterType(specs.MagFilter),
+                FilterModeToD3D12FilterType(specs.MipFilter),
+                reductionType
+            );
+
+        UINT maxAnisotropy = 1u;
+        if (specs.MaxAnisotropy == SamplerSpecification::MaxMaxAnisotropyValue)
+            maxAnisotropy = 16u;
+        else
+            maxAnisotropy = std::max(static_cast<UINT>(specs.MaxAnisotropy), 1u);
+
+        samplerDesc.AddressU = SamplerAddresModeToD3D12TextureAddressMode(specs.AddressU);
+        samplerDesc.AddressV = SamplerAddresModeToD3D12TextureAddressMode(specs.AddressV);
+        samplerDesc.AddressW = SamplerAddresModeToD3D12TextureAddressMode(specs.AddressW);
+        samplerDesc.MipLODBias = specs.MipBias;
+        samplerDesc.MaxAnisotropy = maxAnisotropy;
+        samplerDesc.ComparisonFunc = ((specs.ReductionType == SamplerReductionType::Comparison) ? D3D12_COMPARISON_FUNC_LESS : D3D12_COMPARISON_FUNC_NEVER);
+        samplerDesc.BorderColor[0] = specs.BorderColour.r;
+        samplerDesc.BorderColor[1] = specs.BorderColour.g;
+        samplerDesc.BorderColor[2] = specs.BorderColour.b;
+        samplerDesc.BorderColor[3] = specs.BorderColour.a;
+        samplerDesc.MinLOD = 0.0f;
+        samplerDesc.MaxLOD = D3D12_FLOAT32_MAX;
+
+        return samplerDesc;
+    }
+
+    D3D12_STATIC_SAMPLER_DESC SamplerSpecificationToD3D12StaticSamplerDesc(const SamplerSpecification& specs)
+    {
+        D3D12_SAMPLER_DESC samplerDesc = SamplerSpecificationToD3D12SamplerDesc(specs);
+
+        D3D12_STATIC_SAMPLER_DESC staticDesc = {};
+        staticDesc.Filter = samplerDesc.Filter;
+        staticDesc.AddressU = samplerDesc.AddressU;
+        staticDesc.AddressV = samplerDesc.AddressV;
+        staticDesc.AddressW = samplerDesc.AddressW;
+        staticDesc.MipLODBias = samplerDesc.MipLODBias;
+        staticDesc.MaxAnisotropy = samplerDesc.MaxAnisotropy;
+        staticDesc.ComparisonFunc = samplerDesc.ComparisonFunc;
+        staticDesc.MinLOD = samplerDesc.MinLOD;
+        staticDesc.MaxLOD = samplerDesc.MaxLOD;
+
+        if ((specs.BorderColour.r == 0.0f) && (specs.BorderColour.g == 0.0f) && (specs.BorderColour.b == 0.0f))
+            staticDesc.BorderColor = ((specs.BorderColour.a == 0.0f) ? D3D12_STATIC_BORDER_COLOR_TRANSPARENT_BLACK : D3D12_STATIC_BORDER_COLOR_OPAQUE_BLACK);
+        else
+            staticDesc.BorderColor = D3D12_STATIC_BORDER_COLOR_OPAQUE_WHITE;
+
+        return staticDesc;
+    }
+
 }
\ No newline at end of file
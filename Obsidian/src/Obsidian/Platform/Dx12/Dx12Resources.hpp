@@ -13,7 +13,9 @@
 #include "Obsidian/Platform/Dx12/Dx12.hpp"
 #include "Obsidian/Platform/Dx12/Dx12Descriptors.hpp"
 
+#include <mutex>
 #include <vector>
+#include <unordered_map>
 
 namespace Obsidian
 {
@@ -54,7 +56,10 @@ namespace Obsidian::Internal
         { ResourceState::DepthRead,         D3D12_RESOURCE_STATE_DEPTH_READ },
         { ResourceState::CopyDst,           D3D12_RESOURCE_STATE_COPY_DEST },
         { ResourceState::CopySrc,           D3D12_RESOURCE_STATE_COPY_SOURCE },
-        { ResourceState::Present,           D3D12_RESOURCE_STATE_PRESENT }
+        { ResourceState::Present,           D3D12_RESOURCE_STATE_PRESENT },
+        { ResourceState::ResolveSrc,        D3D12_RESOURCE_STATE_RESOLVE_SOURCE },
+        { ResourceState::ResolveDst,        D3D12_RESOURCE_STATE_RESOLVE_DEST },
+        { ResourceState::HostRead,          D3D12_RESOURCE_STATE_COPY_DEST } // Note: Readback heap resources stay in COPY_DEST, the fence makes the data visible
     });
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -684,6 +689,9 @@ namespace Obsidian::Internal
         Dx12Resources(const Device& device);
         ~Dx12Resources();
 
+        // Methods
+        DxPtr<ID3D12CommandSignature> GetCommandSignature(D3D12_INDIRECT_ARGUMENT_TYPE type, uint32_t stride) const; // Note: Created on first use and cached per (type, stride)
+
         // (Internal) Getters
         inline Dx12ManagedDescriptorHeap& GetSRVAndUAVAndCBVHeap() const { return m_SRVAndUAVAndCBVHeap; }
         inline Dx12ManagedDescriptorHeap& GetSamplerHeap() const { return m_SamplerHeap; }
@@ -697,6 +705,9 @@ namespace Obsidian::Internal
         mutable Dx12ManagedDescriptorHeap m_SamplerHeap;            // Shader visible
         mutable Dx12DynamicDescriptorHeap m_DSVHeap;
         mutable Dx12DynamicDescriptorHeap m_RTVHeap;
+
+        mutable std::mutex m_CommandSignatureMutex = {};
+        mutable std::unordered_map<uint64_t, DxPtr<ID3D12CommandSignature>> m_CommandSignatures = { };
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -704,6 +715,9 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     uint8_t Dx12FormatToPlaneCount(const Device& device, DXGI_FORMAT format); // Note: 255 means format not supported.
 
+    D3D12_SAMPLER_DESC SamplerSpecificationToD3D12SamplerDesc(const SamplerSpecification& specs);
+    D3D12_STATIC_SAMPLER_DESC SamplerSpecificationToD3D12StaticSamplerDesc(const SamplerSpecification& specs); // Note: The border colour is rounded to the closest static border colour
+
     // helper function for texture subresource calculations
     // https://msdn.microsoft.com/en-us/library/windows/desktop/dn705766(v=vs.85).aspx
     inline constexpr uint32_t CalculateSubresource(uint32_t MipSlice, uint32_t ArraySlice, uint32_t PlaneSlice, uint32_t MipLevels, uint32_t ArraySize)
@@ -22,40 +22,6 @@ namespace Obsidian::Internal
 
         inline constexpr static uint32_t g_ShaderModel = 67;
 
-        ////////////////////////////////////////////////////////////////////////////////////
-        // ShaderStageToShaderCMapping
-        ////////////////////////////////////////////////////////////////////////////////////
-        struct ShaderStageToShaderCMapping
-        {
-        public:
-            ShaderStage Stage;
-
-            shaderc_shader_kind ShaderCShaderKind;
-        };
-
-        ////////////////////////////////////////////////////////////////////////////////////
-        // ShaderStageToShaderCMapping array
-        ////////////////////////////////////////////////////////////////////////////////////
-        constexpr static auto g_ShaderStageToShaderCMapping = std::to_array<ShaderStageToShaderCMapping>({
-            // Stage                                ShaderCShaderKind
-            { ShaderStage::None,                    shaderc_glsl_vertex_shader }, // Default
-            { ShaderStage::Vertex,                  shaderc_glsl_vertex_shader },
-            { ShaderStage::Fragment,                shaderc_glsl_fragment_shader },
-            { ShaderStage::Compute,                 shaderc_glsl_compute_shader },
-            { ShaderStage::Geometry,                shaderc_glsl_geometry_shader },
-            { ShaderStage::TesselationControl,      shaderc_glsl_tess_control_shader },
-            { ShaderStage::TesselationEvaluation,   shaderc_glsl_tess_evaluation_shader },
-            { ShaderStage::Task,                    shaderc_glsl_task_shader },
-            { ShaderStage::Mesh,                    shaderc_glsl_mesh_shader },
-            { ShaderStage::AllGraphics,             shaderc_glsl_vertex_shader }, // Default
-            { ShaderStage::RayGeneration,           shaderc_glsl_raygen_shader },
-            { ShaderStage::AnyHit,                  shaderc_glsl_anyhit_shader },
-            { ShaderStage::ClosestHit,              shaderc_glsl_closesthit_shader },
-            { ShaderStage::Miss,                    shaderc_glsl_miss_shader },
-            { ShaderStage::Intersection,            shaderc_glsl_intersection_shader },
-            { ShaderStage::Callable,                shaderc_glsl_callable_shader }
-        });
-
         ////////////////////////////////////////////////////////////////////////////////////
         // ShaderStageToDX12StageMapping
         ////////////////////////////////////////////////////////////////////////////////////
@@ -127,11 +93,6 @@ namespace Obsidian::Internal
         ////////////////////////////////////////////////////////////////////////////////////
         // Helper methods
         ////////////////////////////////////////////////////////////////////////////////////
-        constexpr static shaderc_shader_kind ShaderStageToShaderCKind(ShaderStage stage)
-        {
-            return g_ShaderStageToShaderCMapping[(std::to_underlying(stage) ? (std::countr_zero(std::to_underlying(stage)) + 1) : 0)].ShaderCShaderKind;
-        }
-
         constexpr static std::wstring_view ShaderStageToDX12Stage(ShaderStage stage)
         {
             return g_ShaderStageToDX12StageMapping[(std::to_underlying(stage) ? (std::countr_zero(std::to_underlying(stage)) + 1) : 0)].DX12Stage;
@@ -207,7 +168,7 @@ namespace Obsidian::Internal
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
     Dx12Shader::Dx12Shader(const Device& device, const ShaderSpecification& specs)
-        : m_Device(*api_cast<const Dx12Device*>(&device)), m_Specification(specs)
+        : m_Device(*api_cast<const Dx12Device*>(&device)), m_Specification(specs), m_CodeHash(HashShaderCode(specs))
     {
         // If native was passed in, we don't need to remap SPIRV to HLSL and recompile
         if (std::holds_alternative<std::variant<std::vector<uint8_t>, std::span<const uint8_t>>>(specs.Code))
@@ -288,7 +249,8 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructor & Destructor 
     ////////////////////////////////////////////////////////////////////////////////////
-    Dx12ShaderCompiler::Dx12ShaderCompiler()
+    Dx12ShaderCompiler::Dx12ShaderCompiler(const ShaderCompilerSpecification& specs)
+        : m_Compiler(specs)
     {
     }
 
@@ -301,31 +263,12 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     std::vector<uint32_t> Dx12ShaderCompiler::CompileToSPIRV(ShaderStage stage, const std::string& code, const std::string& entryPoint, ShadingLanguage language)
     {
-        OB_ASSERT((!code.empty()), "[Dx12ShaderCompiler] Empty string passed in as shader code.");
-
-        // Set language
-        shaderc::CompileOptions options = {};
-        options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_3);
-
-        // Note: Forces the shaders to manually set all registers/sets/bindings
-        options.SetAutoBindUniforms(false);
-        
-        if (language == ShadingLanguage::GLSL)
-            options.SetSourceLanguage(shaderc_source_language_glsl);
-        else if (language == ShadingLanguage::HLSL)
-        {
-            options.SetSourceLanguage(shaderc_source_language_hlsl);
-            options.SetTargetSpirv(shaderc_spirv_version_1_6);
-
-            options.AddMacroDefinition("HLSL");
-            options.SetHlslIoMapping(true); // Note: Needed for `register(b0, space0)` layout
-        }
-
-        shaderc::SpvCompilationResult module = m_Compiler.CompileGlslToSpv(code, ShaderStageToShaderCKind(stage), "", entryPoint.c_str(), options);
-
-        OB_ASSERT((module.GetCompilationStatus() == shaderc_compilation_status_success), "[Dx12ShaderCompiler] Error compiling shader: {0}", module.GetErrorMessage());
-
-        return std::vector<uint32_t>(module.cbegin(), module.cend());
+        return m_Compiler.Compile(ShaderCompileArgs()
+            .SetShaderStage(stage)
+            .SetCode(code)
+            .SetEntryPoint(entryPoint)
+            .SetShadingLanguage(language)
+        );
     }
 
     std::vector<uint8_t> Dx12ShaderCompiler::CompileToNative(ShaderStage stage, const std::string& code, const std::string& entryPoint, ShadingLanguage language)
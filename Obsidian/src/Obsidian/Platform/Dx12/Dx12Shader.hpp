@@ -2,12 +2,15 @@
 
 #include "Obsidian/Renderer/API.hpp"
 #include "Obsidian/Renderer/ShaderSpec.hpp"
+#include "Obsidian/Renderer/SPIRVCompiler.hpp"
 
 #include "Obsidian/Platform/Dx12/Dx12.hpp"
 
 #include <Nano/Nano.hpp>
 
-#include <shaderc/shaderc.hpp>
+#include <span>
+#include <vector>
+#include <future>
 
 namespace Obsidian
 {
@@ -34,6 +37,7 @@ namespace Obsidian::Internal
 
         // Getters
         inline const ShaderSpecification& GetSpecification() const { return m_Specification; }
+        inline size_t GetCodeHash() const { return m_CodeHash; }
 
         // Internal getters
         inline const Dx12Device& GetDx12Device() const { return m_Device; }
@@ -43,6 +47,7 @@ namespace Obsidian::Internal
     private:
         const Dx12Device& m_Device;
         ShaderSpecification m_Specification;
+        size_t m_CodeHash = 0; // Note: Computed on creation, since the viewed code may not outlive the shader
 
         std::vector<uint8_t> m_ByteCodeStorage = { };
     };
@@ -54,16 +59,20 @@ namespace Obsidian::Internal
     {
     public:
         // Constructors & Destructor
-        Dx12ShaderCompiler();
+        Dx12ShaderCompiler(const ShaderCompilerSpecification& specs);
         ~Dx12ShaderCompiler();
 
         // Methods
         std::vector<uint32_t> CompileToSPIRV(ShaderStage stage, const std::string& code, const std::string& entryPoint, ShadingLanguage language);
+        inline std::vector<uint32_t> CompileToSPIRV(const ShaderCompileArgs& args) { return m_Compiler.Compile(args); }
+
+        inline std::future<std::vector<uint32_t>> CompileAsync(const ShaderCompileArgs& args) { return m_Compiler.CompileAsync(args); }
+        inline std::vector<std::vector<uint32_t>> CompileBatch(std::span<const ShaderCompileArgs> args) { return m_Compiler.CompileBatch(args); }
 
         std::vector<uint8_t> CompileToNative(ShaderStage stage, const std::string& code, const std::string& entryPoint, ShadingLanguage language);
 
     private:
-        shaderc::Compiler m_Compiler = {};
+        SPIRVCompiler m_Compiler;
     };
 #endif
 
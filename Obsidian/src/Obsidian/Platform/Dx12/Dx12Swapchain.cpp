@@ -121,10 +121,7 @@ namespace Obsidian::Internal
 	////////////////////////////////////////////////////////////////////////////////////
 	void Dx12Swapchain::FreePool(CommandListPool& pool) const
 	{
-		Dx12CommandListPool& dxPool = *api_cast<Dx12CommandListPool*>(&pool);
-		m_Device.GetContext().Destroy([allocator = dxPool.GetD3D12CommandAllocator()]() {}); // Note: Holding a reference to the resource is enough to keep it alive (and destroy when the scope ends)
-
-		dxPool.m_CommandAllocator = nullptr;
+		m_Device.FreePool(pool);
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -216,7 +213,7 @@ namespace Obsidian::Internal
 	{
 		OB_PROFILE("Dx12Swapchain::Present()");
 
-		DX_VERIFY(m_Device.GetContext().GetD3D12CommandQueue(CommandQueue::Present)->Wait(m_Fence, m_SwapchainPresentableValues[m_CurrentFrame]));
+		DX_VERIFY(m_Device.GetContext().GetD3D12CommandQueue(CommandQueue::Present)->Wait(m_Device.GetD3D12Fence().Get(), m_SwapchainPresentableValues[m_CurrentFrame]));
 		
 		DX_VERIFY(m_Swapchain->Present(m_Specification.VSync, 0));
 
@@ -226,26 +223,10 @@ namespace Obsidian::Internal
 			m_Device.GetContext().OutputMessages();
 		}
 
-		DX_VERIFY(m_Device.GetContext().GetD3D12CommandQueue(CommandQueue::Present)->Signal(m_Fence, m_CurrentFenceValue++));
+		DX_VERIFY(m_Device.GetContext().GetD3D12CommandQueue(CommandQueue::Present)->Signal(m_Fence, ++m_CurrentFenceValue));
 
 		m_WaitFenceValuesAndEvents[m_CurrentFrame].first = m_CurrentFenceValue;
 		m_CurrentFrame = (m_CurrentFrame + 1) % Information::FramesInFlight;
 	}
 
-	////////////////////////////////////////////////////////////////////////////////////
-	// Internal getters
-	////////////////////////////////////////////////////////////////////////////////////
-	uint64_t Dx12Swapchain::GetPreviousCommandListWaitValue(const Dx12CommandList& commandList) const
-	{
-		OB_ASSERT(m_CommandListFenceValues.contains(&commandList), "[Dx12Swapchain] CommandList is not known in current Swapchain.");
-		return m_CommandListFenceValues.at(&commandList);
-	}
-
-	uint64_t Dx12Swapchain::RetrieveCommandListWaitValue(const Dx12CommandList& commandList)
-	{
-		uint64_t value = ++m_CurrentFenceValue;
-		m_CommandListFenceValues[&commandList] = value;
-		return value;
-	}
-
 }
\ No newline at end of file
@@ -63,9 +63,6 @@ namespace Obsidian::Internal
 
 		inline void SetPresentableValue(uint64_t value) { m_SwapchainPresentableValues[m_CurrentFrame] = value; }
 		
-		uint64_t GetPreviousCommandListWaitValue(const Dx12CommandList& commandList) const;
-		uint64_t RetrieveCommandListWaitValue(const Dx12CommandList& commandList);
-
 		inline uint64_t GetCurrentFenceValue() const { return m_CurrentFenceValue; }
 
 		inline DxPtr<IDXGISwapChain4> GetDXGISwapChain() const { return m_Swapchain; }
@@ -82,13 +79,12 @@ namespace Obsidian::Internal
 		// Note: DX12 gives the amount of images requested, so we can use FramesInFlight instead of MaxImages.
 		std::array<Nano::Memory::DeferredConstruct<Image, true>, Information::FramesInFlight> m_Images = { };
 
-		ID3D12Fence* m_Fence = nullptr;
+		ID3D12Fence* m_Fence = nullptr; // Note: Only used for frame pacing, commandlists signal the device's fence
 		uint64_t m_CurrentFenceValue = 0;
 
-		std::array<uint64_t, Information::FramesInFlight> m_SwapchainPresentableValues = { };
+		std::array<uint64_t, Information::FramesInFlight> m_SwapchainPresentableValues = { }; // Note: Values on the device's fence
 
 		std::array<std::pair<uint64_t, HANDLE>, Information::FramesInFlight> m_WaitFenceValuesAndEvents = { };
-		std::unordered_map<const Dx12CommandList*, uint64_t> m_CommandListFenceValues = { };
 
 		uint8_t m_CurrentFrame = 0;
 		uint8_t m_AcquiredFrame = 0;
@@ -0,0 +1,473 @@
+#include "obpch.h"
+#include "Dx12UploadManager.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+#include "Obsidian/Renderer/Image.hpp"
+#include "Obsidian/Renderer/Buffer.hpp"
+#include "Obsidian/Renderer/UploadManager.hpp"
+
+#include "Obsidian/Platform/Dx12/Dx12Device.hpp"
+#include "Obsidian/Platform/Dx12/Dx12Image.hpp"
+#include "Obsidian/Platform/Dx12/Dx12Buffer.hpp"
+#include "Obsidian/Platform/Dx12/Dx12Resources.hpp"
+
+#include <algorithm>
+
+namespace Obsidian::Internal
+{
+
+    namespace
+    {
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Helper methods
+        ////////////////////////////////////////////////////////////////////////////////////
+        void CreateCommandList(ID3D12Device* device, D3D12_COMMAND_LIST_TYPE type, ID3D12CommandAllocator* allocator, DxPtr<ID3D12GraphicsCommandList>& list)
+        {
+            DX_VERIFY(device->CreateCommandList(0, type, allocator, nullptr, IID_PPV_ARGS(&list)));
+            DX_VERIFY(list->Close()); // Note: Lists get created in the recording state, we reset them when recording a batch
+        }
+
+        void PushTransition(std::vector<D3D12_RESOURCE_BARRIER>& barriers, ID3D12Resource* resource, UINT subresource, D3D12_RESOURCE_STATES stateBefore, D3D12_RESOURCE_STATES stateAfter)
+        {
+            if (stateBefore == stateAfter)
+                return;
+
+            D3D12_RESOURCE_BARRIER barrier = {};
+            barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+            barrier.Transition.StateBefore = stateBefore;
+            barrier.Transition.StateAfter = stateAfter;
+            barrier.Transition.pResource = resource;
+            barrier.Transition.Subresource = subresource;
+            barriers.push_back(barrier);
+        }
+
+        ResourceState ResolveFinalState(ResourceState permanentState, ResourceState finalState)
+        {
+            if (permanentState != ResourceState::Unknown)
+                return permanentState;
+
+            return ((finalState != ResourceState::Unknown) ? finalState : ResourceState::CopyDst);
+        }
+
+        constexpr size_t s_BufferStagingAlignment = 16ull;
+
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    Dx12UploadManager::Dx12UploadManager(const Device& device, const UploadManagerSpecification& specs)
+        : m_Device(*api_cast<const Dx12Device*>(&device)), m_Specification(specs)
+    {
+        OB_ASSERT((m_Specification.StagingSize > 0), "[Dx12UploadManager] StagingSize must be more than 0.");
+
+        // Note: Separate from the device's fence, since it gets signaled from multiple queues
+        DX_VERIFY(m_Device.GetContext().GetD3D12Device()->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_Fence)));
+
+        // Staging ring // Note: Upload heaps are coherent, so the ring stays mapped for the manager's lifetime
+        m_StagingAllocation = m_Device.GetAllocator().AllocateBuffer(m_StagingResource, m_Specification.StagingSize, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_FLAG_NONE, D3D12_HEAP_TYPE_UPLOAD);
+        DX_VERIFY(m_StagingResource->Map(0, nullptr, reinterpret_cast<void**>(&m_StagingMemory)));
+
+        if constexpr (Information::Validation)
+        {
+            if (!m_Specification.DebugName.empty())
+            {
+                m_Device.GetContext().SetDebugName(m_Fence.Get(), std::format("Fence for: {0}", m_Specification.DebugName));
+                m_Device.GetContext().SetDebugName(m_StagingResource.Get(), std::format("Staging ring for: {0}", m_Specification.DebugName));
+            }
+        }
+    }
+
+    Dx12UploadManager::~Dx12UploadManager()
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    UploadTicket Dx12UploadManager::UploadBuffer(Buffer& dst, const void* memory, size_t size, size_t dstOffset, ResourceState finalState)
+    {
+        OB_PROFILE("Dx12UploadManager::UploadBuffer()");
+
+        const BufferSpecification& bufferSpec = dst.GetSpecification();
+        OB_ASSERT((memory != nullptr) && (size > 0), "[Dx12UploadManager] Invalid memory or size passed in.");
+        OB_ASSERT((size + dstOffset <= bufferSpec.Size), "[Dx12UploadManager] Size + offset exceeds buffer size.");
+        OB_ASSERT((bufferSpec.HasPermanentState() || m_Device.GetTracker().Contains(dst)), "[Dx12UploadManager] Uploading to an untracked buffer is not allowed, call StartTracking() on buffer.");
+
+        std::scoped_lock lock(m_Mutex);
+        RetireBatches(false);
+
+        ID3D12Resource* resource = api_cast<Dx12Buffer*>(&dst)->GetD3D12Resource().Get();
+
+        // Note: Large buffers get split up into chunks that fit inside of the staging ring
+        size_t uploaded = 0;
+        while (uploaded < size)
+        {
+            const size_t chunkSize = std::min(size - uploaded, m_Specification.StagingSize);
+            const size_t stagingOffset = AllocateStaging(chunkSize, s_BufferStagingAlignment);
+
+            std::memcpy(m_StagingMemory + stagingOffset, static_cast<const uint8_t*>(memory) + uploaded, chunkSize);
+
+            // Note: Allocating can flush the pending batch, so the buffer gets registered after allocating
+            if (!m_PendingBuffers.contains(&dst))
+            {
+                BufferUpload& upload = m_PendingBuffers[&dst];
+                upload.StateBefore = (bufferSpec.HasPermanentState() ? bufferSpec.PermanentState : m_Device.GetTracker().GetResourceState(dst));
+            }
+            m_PendingBuffers[&dst].StateAfter = ResolveFinalState(bufferSpec.PermanentState, finalState);
+
+            BufferCopy& copy = m_PendingBufferCopies.emplace_back();
+            copy.Resource = resource;
+            copy.SrcOffset = stagingOffset;
+            copy.DstOffset = dstOffset + uploaded;
+            copy.Size = chunkSize;
+
+            uploaded += chunkSize;
+        }
+
+        return PendingTicket();
+    }
+
+    UploadTicket Dx12UploadManager::UploadImage(Image& dst, const ImageSliceSpecification& slice, const void* memory, size_t size, ResourceState finalState)
+    {
+        OB_PROFILE("Dx12UploadManager::UploadImage()");
+
+        const ImageSpecification& imageSpec = dst.GetSpecification();
+        OB_ASSERT((memory != nullptr) && (size > 0), "[Dx12UploadManager] Invalid memory or size passed in.");
+        OB_ASSERT((imageSpec.HasPermanentState() || m_Device.GetTracker().Contains(dst)), "[Dx12UploadManager] Uploading to an untracked image is not allowed, call StartTracking() on image.");
+
+        const ImageSliceSpecification resSlice = ResolveImageSlice(slice, imageSpec);
+        ID3D12Resource* resource = api_cast<Dx12Image*>(&dst)->GetD3D12Resource().Get();
+
+        // Note: Dx12 requires rows to be 256 byte aligned, so the footprint is calculated for the slice's region
+        D3D12_RESOURCE_DESC desc = resource->GetDesc();
+        desc.Width = resSlice.Width;
+        desc.Height = resSlice.Height;
+        desc.DepthOrArraySize = static_cast<UINT16>((desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D) ? resSlice.Depth : 1);
+        desc.MipLevels = 1;
+        desc.Alignment = 0;
+
+        D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint = {};
+        UINT rowCount = 0;
+        UINT64 rowSize = 0;
+        UINT64 totalSize = 0;
+        m_Device.GetContext().GetD3D12Device()->GetCopyableFootprints(&desc, 0, 1, 0, &footprint, &rowCount, &rowSize, &totalSize);
+
+        OB_ASSERT((size >= static_cast<size_t>(rowSize) * rowCount * footprint.Footprint.Depth), "[Dx12UploadManager] Source memory too small.");
+        OB_ASSERT((totalSize <= m_Specification.StagingSize), "[Dx12UploadManager] Image upload doesn't fit inside of the staging ring, increase StagingSize.");
+
+        std::scoped_lock lock(m_Mutex);
+        RetireBatches(false);
+
+        const size_t stagingOffset = AllocateStaging(static_cast<size_t>(totalSize), D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+        footprint.Offset = stagingOffset;
+
+        // Note: We have to manually do every row, since dx12
+        // doesn't tightly pack the buffer like vulkan.
+        const uint8_t* src = static_cast<const uint8_t*>(memory);
+        uint8_t* dstBase = m_StagingMemory + stagingOffset;
+        for (UINT z = 0; z < footprint.Footprint.Depth; z++)
+        {
+            for (UINT y = 0; y < rowCount; y++)
+            {
+                std::memcpy(dstBase + (static_cast<size_t>(z) * rowCount + y) * footprint.Footprint.RowPitch, src, static_cast<size_t>(rowSize));
+                src += rowSize;
+            }
+        }
+
+        std::vector<ImageUpload>& uploads = m_PendingImages[&dst];
+        auto it = std::find_if(uploads.begin(), uploads.end(), [&](const ImageUpload& upload) { return ((upload.ImageMipLevel == resSlice.ImageMipLevel) && (upload.ImageArraySlice == resSlice.ImageArraySlice)); });
+        if (it == uploads.end())
+        {
+            ImageUpload& upload = uploads.emplace_back();
+            upload.ImageMipLevel = resSlice.ImageMipLevel;
+            upload.ImageArraySlice = resSlice.ImageArraySlice;
+            upload.StateBefore = (imageSpec.HasPermanentState() ? imageSpec.PermanentState : m_Device.GetTracker().GetResourceState(dst, ImageSubresourceSpecification(resSlice.ImageMipLevel, 1, resSlice.ImageArraySlice, 1)));
+
+            it = std::prev(uploads.end());
+        }
+        it->StateAfter = ResolveFinalState(imageSpec.PermanentState, finalState);
+
+        ImageCopy& copy = m_PendingImageCopies.emplace_back();
+        copy.Resource = resource;
+        copy.Subresource = CalculateSubresource(resSlice.ImageMipLevel, resSlice.ImageArraySlice, 0, imageSpec.MipLevels, imageSpec.ArraySize);
+        copy.Footprint = footprint;
+        copy.X = static_cast<UINT>(resSlice.X);
+        copy.Y = static_cast<UINT>(resSlice.Y);
+        copy.Z = static_cast<UINT>(resSlice.Z);
+
+        return PendingTicket();
+    }
+
+    UploadTicket Dx12UploadManager::Flush()
+    {
+        OB_PROFILE("Dx12UploadManager::Flush()");
+
+        std::scoped_lock lock(m_Mutex);
+        RetireBatches(false);
+
+        return FlushPending();
+    }
+
+    bool Dx12UploadManager::IsComplete(const UploadTicket& ticket) const
+    {
+        return (m_Fence->GetCompletedValue() >= ticket.Value);
+    }
+
+    void Dx12UploadManager::Wait(const UploadTicket& ticket) const
+    {
+        OB_PROFILE("Dx12UploadManager::Wait()");
+        OB_ASSERT((ticket.Value <= GetSubmittedValue()), "[Dx12UploadManager] Waiting on a ticket that hasn't been flushed, call Flush() first.");
+
+        if (m_Fence->GetCompletedValue() < ticket.Value)
+            DX_VERIFY(m_Fence->SetEventOnCompletion(ticket.Value, nullptr)); // Note: A nullptr event blocks until the fence reaches value
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Internal getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    uint64_t Dx12UploadManager::GetSubmittedValue() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_SubmittedValue;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    size_t Dx12UploadManager::AllocateStaging(size_t size, size_t alignment)
+    {
+        const size_t capacity = m_Specification.StagingSize;
+        OB_ASSERT((size <= capacity), "[Dx12UploadManager] Internal error: Staging allocation is bigger than the staging ring.");
+
+        while (true)
+        {
+            size_t position = m_StagingHead;
+            size_t offset = Nano::Memory::AlignOffset(position % capacity, alignment);
+
+            if (offset + size > capacity) // Note: Doesn't fit at the end, so we wrap around
+            {
+                position += capacity - (position % capacity);
+                offset = 0;
+            }
+            else
+            {
+                position += offset - (position % capacity);
+            }
+
+            if (position + size - m_StagingTail <= capacity)
+            {
+                m_StagingHead = position + size;
+                return offset;
+            }
+
+            // Note: The ring is full, we make room by waiting on the oldest batch (and submitting our own if nothing else is in flight)
+            if (m_InFlightBatches.empty())
+            {
+                if (!HasPendingUploads())
+                {
+                    m_StagingHead = 0;
+                    m_StagingTail = 0;
+                    continue;
+                }
+
+                FlushPending();
+            }
+
+            RetireBatches(true);
+        }
+    }
+
+    void Dx12UploadManager::RetireBatches(bool waitForOldest)
+    {
+        if (m_InFlightBatches.empty())
+            return;
+
+        if (waitForOldest && (m_Fence->GetCompletedValue() < m_InFlightBatches.front().Value))
+        {
+            OB_PROFILE("Dx12UploadManager::RetireBatches::Wait()");
+            DX_VERIFY(m_Fence->SetEventOnCompletion(m_InFlightBatches.front().Value, nullptr));
+        }
+
+        const uint64_t completedValue = m_Fence->GetCompletedValue();
+        while (!m_InFlightBatches.empty() && (m_InFlightBatches.front().Value <= completedValue))
+        {
+            m_StagingTail = m_InFlightBatches.front().StagingEnd;
+            m_FreeBatches.push_back(m_InFlightBatches.front());
+            m_InFlightBatches.pop_front();
+        }
+    }
+
+    bool Dx12UploadManager::HasPendingUploads() const
+    {
+        return (!m_PendingBufferCopies.empty() || !m_PendingImageCopies.empty());
+    }
+
+    UploadTicket Dx12UploadManager::PendingTicket() const
+    {
+        return UploadTicket{ api_cast<const UploadManager*>(this), m_SubmittedValue + s_ValuesPerBatch };
+    }
+
+    UploadTicket Dx12UploadManager::FlushPending()
+    {
+        if (!HasPendingUploads()) // Note: Everything has been submitted already, the last ticket covers it all
+            return UploadTicket{ api_cast<const UploadManager*>(this), m_SubmittedValue };
+
+        ID3D12Device* device = m_Device.GetContext().GetD3D12Device().Get();
+
+        Batch batch = {};
+        if (!m_FreeBatches.empty())
+        {
+            batch = m_FreeBatches.back();
+            m_FreeBatches.pop_back();
+        }
+        else
+        {
+            DX_VERIFY(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&batch.DirectAllocator)));
+            DX_VERIFY(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(&batch.CopyAllocator)));
+
+            CreateCommandList(device, D3D12_COMMAND_LIST_TYPE_DIRECT, batch.DirectAllocator.Get(), batch.PreCommandList);
+            CreateCommandList(device, D3D12_COMMAND_LIST_TYPE_DIRECT, batch.DirectAllocator.Get(), batch.PostCommandList);
+            CreateCommandList(device, D3D12_COMMAND_LIST_TYPE_COPY, batch.CopyAllocator.Get(), batch.CopyCommandList);
+        }
+
+        batch.Value = m_SubmittedValue + s_ValuesPerBatch;
+        batch.StagingEnd = m_StagingHead;
+
+        bool hasPre = false, hasPost = false;
+        RecordBatch(batch, hasPre, hasPost);
+
+        // Submissions // Note: Every submission waits on the previous one (or the previous batch), this keeps the fence increasing in order
+        uint64_t waitValue = m_SubmittedValue;
+        auto submit = [&](DxPtr<ID3D12CommandQueue> queue, ID3D12GraphicsCommandList* list, uint64_t signalValue)
+        {
+            if (waitValue != 0)
+                DX_VERIFY(queue->Wait(m_Fence.Get(), waitValue));
+
+            ID3D12CommandList* lists[] = { list };
+            queue->ExecuteCommandLists(1, lists);
+
+            DX_VERIFY(queue->Signal(m_Fence.Get(), signalValue));
+            waitValue = signalValue;
+        };
+
+        const Dx12Context& context = m_Device.GetContext();
+        if (hasPre)
+            submit(context.GetD3D12CommandQueue(CommandQueue::Graphics), batch.PreCommandList.Get(), batch.Value - 2);
+
+        submit(context.GetD3D12CopyQueue(), batch.CopyCommandList.Get(), (hasPost ? (batch.Value - 1) : batch.Value));
+
+        if (hasPost)
+            submit(context.GetD3D12CommandQueue(CommandQueue::Graphics), batch.PostCommandList.Get(), batch.Value);
+
+        m_SubmittedValue = batch.Value;
+
+        // Note: From the graphics queue's point of view the resources are now in their final state
+        for (const auto& [buffer, upload] : m_PendingBuffers)
+        {
+            if (!buffer->GetSpecification().HasPermanentState())
+                m_Device.GetTracker().SetBufferState(*buffer, upload.StateAfter);
+        }
+        for (const auto& [image, uploads] : m_PendingImages)
+        {
+            if (image->GetSpecification().HasPermanentState())
+                continue;
+
+            for (const ImageUpload& upload : uploads)
+                m_Device.GetTracker().SetImageState(*image, ImageSubresourceSpecification(upload.ImageMipLevel, 1, upload.ImageArraySlice, 1), upload.StateAfter);
+        }
+
+        m_PendingBuffers.clear();
+        m_PendingImages.clear();
+        m_PendingBufferCopies.clear();
+        m_PendingImageCopies.clear();
+
+        m_InFlightBatches.push_back(batch);
+        return UploadTicket{ api_cast<const UploadManager*>(this), batch.Value };
+    }
+
+    void Dx12UploadManager::RecordBatch(Batch& batch, bool& hasPre, bool& hasPost)
+    {
+        OB_PROFILE("Dx12UploadManager::RecordBatch()");
+
+        // Note: The copy queue only works with resources in the COMMON state (buffers and textures get implicitly promoted to COPY_DEST),
+        // and everything decays back to COMMON once the copy queue is done. So the graphics queue transitions
+        // into COMMON before the copy and out of COMMON into the final state after the copy.
+        std::vector<D3D12_RESOURCE_BARRIER> preBarriers, postBarriers;
+
+        for (const auto& [buffer, upload] : m_PendingBuffers)
+        {
+            ID3D12Resource* resource = api_cast<Dx12Buffer*>(buffer)->GetD3D12Resource().Get();
+
+            PushTransition(preBarriers, resource, D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES, ResourceStateToD3D12ResourceStates(upload.StateBefore), D3D12_RESOURCE_STATE_COMMON);
+            PushTransition(postBarriers, resource, D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES, D3D12_RESOURCE_STATE_COMMON, ResourceStateToD3D12ResourceStates(upload.StateAfter));
+        }
+
+        for (const auto& [image, uploads] : m_PendingImages)
+        {
+            ID3D12Resource* resource = api_cast<Dx12Image*>(image)->GetD3D12Resource().Get();
+            const ImageSpecification& imageSpec = image->GetSpecification();
+
+            for (const ImageUpload& upload : uploads)
+            {
+                const UINT subresource = CalculateSubresource(upload.ImageMipLevel, upload.ImageArraySlice, 0, imageSpec.MipLevels, imageSpec.ArraySize);
+
+                PushTransition(preBarriers, resource, subresource, ResourceStateToD3D12ResourceStates(upload.StateBefore), D3D12_RESOURCE_STATE_COMMON);
+                PushTransition(postBarriers, resource, subresource, D3D12_RESOURCE_STATE_COMMON, ResourceStateToD3D12ResourceStates(upload.StateAfter));
+            }
+        }
+
+        hasPre = !preBarriers.empty();
+        hasPost = !postBarriers.empty();
+
+        if (hasPre || hasPost)
+            DX_VERIFY(batch.DirectAllocator->Reset());
+        DX_VERIFY(batch.CopyAllocator->Reset());
+
+        // Pre
+        if (hasPre)
+        {
+            DX_VERIFY(batch.PreCommandList->Reset(batch.DirectAllocator.Get(), nullptr));
+            batch.PreCommandList->ResourceBarrier(static_cast<UINT>(preBarriers.size()), preBarriers.data());
+            DX_VERIFY(batch.PreCommandList->Close());
+        }
+
+        // Copy
+        {
+            DX_VERIFY(batch.CopyCommandList->Reset(batch.CopyAllocator.Get(), nullptr));
+
+            for (const BufferCopy& copy : m_PendingBufferCopies)
+                batch.CopyCommandList->CopyBufferRegion(copy.Resource, copy.DstOffset, m_StagingResource.Get(), copy.SrcOffset, copy.Size);
+
+            for (const ImageCopy& copy : m_PendingImageCopies)
+            {
+                D3D12_TEXTURE_COPY_LOCATION dstLocation = {};
+                dstLocation.pResource = copy.Resource;
+                dstLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+                dstLocation.SubresourceIndex = copy.Subresource;
+
+                D3D12_TEXTURE_COPY_LOCATION srcLocation = {};
+                srcLocation.pResource = m_StagingResource.Get();
+                srcLocation.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+                srcLocation.PlacedFootprint = copy.Footprint;
+
+                batch.CopyCommandList->CopyTextureRegion(&dstLocation, copy.X, copy.Y, copy.Z, &srcLocation, nullptr);
+            }
+
+            DX_VERIFY(batch.CopyCommandList->Close());
+        }
+
+        // Post
+        if (hasPost)
+        {
+            DX_VERIFY(batch.PostCommandList->Reset(batch.DirectAllocator.Get(), nullptr));
+            batch.PostCommandList->ResourceBarrier(static_cast<UINT>(postBarriers.size()), postBarriers.data());
+            DX_VERIFY(batch.PostCommandList->Close());
+        }
+    }
+
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/API.hpp"
+#include "Obsidian/Renderer/ImageSpec.hpp"
+#include "Obsidian/Renderer/ResourceSpec.hpp"
+#include "Obsidian/Renderer/UploadManagerSpec.hpp"
+
+#include "Obsidian/Platform/Dx12/Dx12.hpp"
+
+#include <Nano/Nano.hpp>
+
+#include <deque>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+
+namespace Obsidian
+{
+    class Device;
+    class Image;
+    class Buffer;
+}
+
+namespace Obsidian::Internal
+{
+
+    class Dx12Device;
+    class Dx12UploadManager;
+
+#if defined(OB_API_DX12)
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Dx12UploadManager
+    ////////////////////////////////////////////////////////////////////////////////////
+    class Dx12UploadManager
+    {
+    public:
+        // Constructor & Destructor
+        Dx12UploadManager(const Device& device, const UploadManagerSpecification& specs);
+        ~Dx12UploadManager();
+
+        // Methods
+        UploadTicket UploadBuffer(Buffer& dst, const void* memory, size_t size, size_t dstOffset, ResourceState finalState);
+        UploadTicket UploadImage(Image& dst, const ImageSliceSpecification& slice, const void* memory, size_t size, ResourceState finalState);
+
+        UploadTicket Flush();
+
+        bool IsComplete(const UploadTicket& ticket) const;
+        void Wait(const UploadTicket& ticket) const;
+
+        // Getters
+        inline const UploadManagerSpecification& GetSpecification() const { return m_Specification; }
+
+        // Internal getters
+        inline DxPtr<ID3D12Fence> GetD3D12Fence() const { return m_Fence; }
+        uint64_t GetSubmittedValue() const;
+
+    private:
+        // Note: Every batch reserves 3 fence values, one per submission: [graphics transition to COMMON] -> copy -> [graphics transition to final state].
+        // The copy queue only accepts resources in the COMMON state and everything decays back to COMMON after it.
+        inline constexpr static uint64_t s_ValuesPerBatch = 3;
+
+        struct BufferUpload
+        {
+        public:
+            ResourceState StateBefore = ResourceState::Unknown;
+            ResourceState StateAfter = ResourceState::Unknown;
+        };
+
+        struct ImageUpload
+        {
+        public:
+            MipLevel ImageMipLevel = 0;
+            ArraySlice ImageArraySlice = 0;
+
+            ResourceState StateBefore = ResourceState::Unknown;
+            ResourceState StateAfter = ResourceState::Unknown;
+        };
+
+        struct BufferCopy
+        {
+        public:
+            ID3D12Resource* Resource = nullptr;
+
+            UINT64 SrcOffset = 0;
+            UINT64 DstOffset = 0;
+            UINT64 Size = 0;
+        };
+
+        struct ImageCopy
+        {
+        public:
+            ID3D12Resource* Resource = nullptr;
+            UINT Subresource = 0;
+
+            D3D12_PLACED_SUBRESOURCE_FOOTPRINT Footprint = {};
+            UINT X = 0, Y = 0, Z = 0;
+        };
+
+        struct Batch
+        {
+        public:
+            DxPtr<ID3D12CommandAllocator> DirectAllocator = nullptr; // Note: Shared by the pre & post transition lists
+            DxPtr<ID3D12GraphicsCommandList> PreCommandList = nullptr;
+            DxPtr<ID3D12GraphicsCommandList> PostCommandList = nullptr;
+
+            DxPtr<ID3D12CommandAllocator> CopyAllocator = nullptr;
+            DxPtr<ID3D12GraphicsCommandList> CopyCommandList = nullptr;
+
+            uint64_t Value = 0;
+            size_t StagingEnd = 0; // Note: Ring position after the last staging allocation of this batch
+        };
+
+    private:
+        // Private methods
+        size_t AllocateStaging(size_t size, size_t alignment); // Note: Returns the offset into the staging buffer
+        void RetireBatches(bool waitForOldest);
+
+        bool HasPendingUploads() const;
+        UploadTicket PendingTicket() const;
+        UploadTicket FlushPending();
+
+        void RecordBatch(Batch& batch, bool& hasPre, bool& hasPost);
+
+    private:
+        const Dx12Device& m_Device;
+        UploadManagerSpecification m_Specification;
+
+        mutable std::mutex m_Mutex = {};
+
+        DxPtr<ID3D12Fence> m_Fence = nullptr;
+        uint64_t m_SubmittedValue = 0;
+
+        // Staging ring // Note: Head & Tail are ever increasing, the offset into the buffer is position % size
+        DxPtr<ID3D12Resource> m_StagingResource = nullptr;
+        DxPtr<D3D12MA::Allocation> m_StagingAllocation = nullptr;
+        uint8_t* m_StagingMemory = nullptr;
+
+        size_t m_StagingHead = 0;
+        size_t m_StagingTail = 0;
+
+        std::deque<Batch> m_InFlightBatches = { };
+        std::vector<Batch> m_FreeBatches = { };
+
+        // Pending (recorded, not yet flushed) uploads
+        std::unordered_map<Buffer*, BufferUpload> m_PendingBuffers = { };
+        std::unordered_map<Image*, std::vector<ImageUpload>> m_PendingImages = { };
+
+        std::vector<BufferCopy> m_PendingBufferCopies = { };
+        std::vector<ImageCopy> m_PendingImageCopies = { };
+
+        friend class Dx12Device;
+    };
+#endif
+
+}
@@ -63,6 +63,29 @@ namespace
         (void)pUserData; (void)size; (void)type; (void)allocationScope;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Helper methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    VkImageCreateInfo ImageCreateInfo(VkImageType type, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, uint32_t arrayLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkSampleCountFlags samples)
+    {
+        VkImageCreateInfo imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = type;
+        imageInfo.extent.width = width;
+        imageInfo.extent.height = height;
+        imageInfo.extent.depth = depth;
+        imageInfo.mipLevels = mipLevels;
+        imageInfo.arrayLayers = arrayLevels;
+        imageInfo.format = format;
+        imageInfo.tiling = tiling;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = usage;
+        imageInfo.samples = static_cast<VkSampleCountFlagBits>(samples);
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE; // Note: Ownership transfers between the graphics & (dedicated) compute family are recorded by the StateTracker on submission.
+
+        return imageInfo;
+    }
+
 }
 
 namespace Obsidian::Internal
@@ -71,8 +94,8 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
-    VulkanAllocator::VulkanAllocator(VkInstance instance, VkPhysicalDevice physicalDevice, VkDevice logicalDevice)
-        : m_Device(logicalDevice)
+    VulkanAllocator::VulkanAllocator(VkInstance instance, VkPhysicalDevice physicalDevice, VkDevice logicalDevice, bool bufferDeviceAddress)
+        : m_PhysicalDevice(physicalDevice), m_Device(logicalDevice)
     {
         s_Callbacks.pUserData = nullptr;
         s_Callbacks.pfnAllocation = &VmaAllocFn;
@@ -86,12 +109,19 @@ namespace Obsidian::Internal
         allocatorInfo.physicalDevice = physicalDevice;
         allocatorInfo.device = logicalDevice;
         allocatorInfo.pAllocationCallbacks = &s_Callbacks;
+        allocatorInfo.flags = (bufferDeviceAddress ? VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT : 0);
 
         VK_VERIFY(vmaCreateAllocator(&allocatorInfo, &m_Allocator));
     }
 
     VulkanAllocator::~VulkanAllocator()
     {
+        if (m_PipelineCache)
+        {
+            vkDestroyPipelineCache(m_Device, m_PipelineCache, &s_Callbacks);
+            m_PipelineCache = VK_NULL_HANDLE;
+        }
+
         vmaDestroyAllocator(m_Allocator);
         m_Allocator = VK_NULL_HANDLE;
     }
@@ -101,6 +131,14 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     VkPipelineCache VulkanAllocator::CreatePipelineCache(std::span<const uint8_t> data)
     {
+        OB_PROFILE("VkAllocator::CreatePipelineCache()");
+
+        if (!data.empty() && !PipelineCacheCompatible(data))
+        {
+            OB_LOG_WARN("[VkAllocator] Pipeline cache data was created by a different device or driver, starting with an empty cache.");
+            data = {};
+        }
+
         VkPipelineCacheCreateInfo cacheCreateInfo = {};
         cacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
         cacheCreateInfo.initialDataSize = data.size();
@@ -115,6 +153,23 @@ namespace Obsidian::Internal
         return m_PipelineCache;
     }
 
+    std::vector<uint8_t> VulkanAllocator::GetPipelineCacheData() const
+    {
+        OB_PROFILE("VkAllocator::GetPipelineCacheData()");
+
+        std::vector<uint8_t> data;
+        if (!m_PipelineCache)
+            return data;
+
+        size_t size = 0;
+        VK_VERIFY(vkGetPipelineCacheData(m_Device, m_PipelineCache, &size, nullptr));
+        data.resize(size);
+        VK_VERIFY(vkGetPipelineCacheData(m_Device, m_PipelineCache, &size, data.data()));
+        data.resize(size); // Note: The size can shrink between calls
+
+        return data;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Buffer
     ////////////////////////////////////////////////////////////////////////////////////
@@ -136,6 +191,29 @@ namespace Obsidian::Internal
         return allocation;
     }
 
+    VmaAllocation VulkanAllocator::AllocateMappedBuffer(VmaMemoryUsage memoryUsage, VkBuffer& buffer, size_t size, VkBufferUsageFlags usage, void*& mappedData, VkMemoryPropertyFlags requiredFlags) const
+    {
+        VkBufferCreateInfo bufferInfo = {};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = size;
+        bufferInfo.usage = usage;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE; // Change if necessary
+
+        VmaAllocationCreateInfo allocInfo = {};
+        allocInfo.usage = memoryUsage; // Note: Must be a host visible usage, like VMA_MEMORY_USAGE_CPU_TO_GPU
+        allocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        allocInfo.requiredFlags = requiredFlags;
+
+        VmaAllocation allocation = VK_NULL_HANDLE;
+        VmaAllocationInfo allocationInfo = {};
+        VK_VERIFY(vmaCreateBuffer(m_Allocator, &bufferInfo, &allocInfo, &buffer, &allocation, &allocationInfo));
+
+        OB_ASSERT((allocationInfo.pMappedData != nullptr), "[VkAllocator] Failed to persistently map buffer, memory is not host visible.");
+        mappedData = allocationInfo.pMappedData;
+
+        return allocation;
+    }
+
     void VulkanAllocator::DestroyBuffer(VkBuffer buffer, VmaAllocation allocation) const
     {
         vmaDestroyBuffer(m_Allocator, buffer, allocation);
@@ -151,20 +229,7 @@ namespace Obsidian::Internal
         OB_ASSERT(m_Allocator, "[VkAllocator] Allocator not initialized.");
         OB_ASSERT((width > 0) && (height > 0), "[VkAllocator] Invalid width or height passed in for image allocation.");
 
-        VkImageCreateInfo imageInfo = {};
-        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-        imageInfo.imageType = type;
-        imageInfo.extent.width = width;
-        imageInfo.extent.height = height;
-        imageInfo.extent.depth = depth;
-        imageInfo.mipLevels = mipLevels;
-        imageInfo.arrayLayers = arrayLevels;
-        imageInfo.format = format;
-        imageInfo.tiling = tiling;
-        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        imageInfo.usage = usage;
-        imageInfo.samples = static_cast<VkSampleCountFlagBits>(samples);
-        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE; // Note: On most modern system all queue family indices are the same for graphics & compute, so we can use exclusive sharing mode between these queue's (since they are the same). If you need to use different queue families, then you need to use concurrent sharing mode and specify the queue family indices in the pQueueFamilyIndices field.
+        VkImageCreateInfo imageInfo = ImageCreateInfo(type, width, height, depth, mipLevels, arrayLevels, format, tiling, usage, samples);
 
         VmaAllocationCreateInfo allocCreateInfo = {};
         allocCreateInfo.usage = memUsage;
@@ -187,6 +252,67 @@ namespace Obsidian::Internal
         vmaDestroyImage(m_Allocator, image, allocation);
     }
 
+    VkMemoryRequirements VulkanAllocator::GetImageMemoryRequirements(VkImageType type, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, uint32_t arrayLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkSampleCountFlags samples) const
+    {
+        OB_PROFILE("VkAllocator::GetImageMemoryRequirements()");
+
+        VkImageCreateInfo imageInfo = ImageCreateInfo(type, width, height, depth, mipLevels, arrayLevels, format, tiling, usage, samples);
+
+        VkDeviceImageMemoryRequirements requirementsInfo = {};
+        requirementsInfo.sType = VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS;
+        requirementsInfo.pCreateInfo = &imageInfo;
+
+        VkMemoryRequirements2 requirements = {};
+        requirements.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+
+#if defined(OB_PLATFORM_APPLE)
+        VkExtension::g_vkGetDeviceImageMemoryRequirementsKHR(m_Device, &requirementsInfo, &requirements);
+#else
+        vkGetDeviceImageMemoryRequirements(m_Device, &requirementsInfo, &requirements);
+#endif
+
+        return requirements.memoryRequirements;
+    }
+
+    VmaAllocation VulkanAllocator::AllocateImageMemory(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags requiredFlags) const
+    {
+        OB_PROFILE("VkAllocator::AllocateImageMemory()");
+
+        OB_ASSERT(m_Allocator, "[VkAllocator] Allocator not initialized.");
+        OB_ASSERT((requirements.size > 0), "[VkAllocator] Invalid size passed in for image memory allocation.");
+
+        VmaAllocationCreateInfo allocCreateInfo = {};
+        allocCreateInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+        allocCreateInfo.requiredFlags = requiredFlags | VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+        VmaAllocation allocation = VK_NULL_HANDLE;
+        VK_VERIFY(vmaAllocateMemory(m_Allocator, &requirements, &allocCreateInfo, &allocation, nullptr));
+
+        return allocation;
+    }
+
+    void VulkanAllocator::FreeImageMemory(VmaAllocation allocation) const
+    {
+        OB_PROFILE("VkAllocator::FreeImageMemory()");
+
+        OB_ASSERT(m_Allocator, "[VkAllocator] Allocator not initialized.");
+        OB_ASSERT((allocation != VK_NULL_HANDLE), "[VkAllocator] Invalid allocation passed in.");
+
+        vmaFreeMemory(m_Allocator, allocation);
+    }
+
+    void VulkanAllocator::CreateAliasingImage(VmaAllocation allocation, size_t offset, VkImage& image, VkImageType type, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, uint32_t arrayLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkSampleCountFlags samples) const
+    {
+        OB_PROFILE("VkAllocator::CreateAliasingImage()");
+
+        OB_ASSERT(m_Allocator, "[VkAllocator] Allocator not initialized.");
+        OB_ASSERT((allocation != VK_NULL_HANDLE), "[VkAllocator] Invalid allocation passed in.");
+        OB_ASSERT((width > 0) && (height > 0), "[VkAllocator] Invalid width or height passed in for image allocation.");
+
+        VkImageCreateInfo imageInfo = ImageCreateInfo(type, width, height, depth, mipLevels, arrayLevels, format, tiling, usage, samples);
+        VK_VERIFY(vmaCreateAliasingImage2(m_Allocator, allocation, static_cast<VkDeviceSize>(offset), &imageInfo, &image));
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Utils
     ////////////////////////////////////////////////////////////////////////////////////
@@ -236,6 +362,26 @@ namespace Obsidian::Internal
 		std::memcpy(mappedData, data, size);
     }
 
+    void VulkanAllocator::FlushMemory(VmaAllocation allocation, size_t offset, size_t size) const
+    {
+        OB_PROFILE("VkAllocator::FlushMemory()");
+
+        OB_ASSERT((allocation != VK_NULL_HANDLE), "[VkAllocator] Invalid allocation passed in.");
+
+        // Note: VMA aligns the range to nonCoherentAtomSize for us
+        VK_VERIFY(vmaFlushAllocation(m_Allocator, allocation, static_cast<VkDeviceSize>(offset), static_cast<VkDeviceSize>(size)));
+    }
+
+    void VulkanAllocator::InvalidateMemory(VmaAllocation allocation, size_t offset, size_t size) const
+    {
+        OB_PROFILE("VkAllocator::InvalidateMemory()");
+
+        OB_ASSERT((allocation != VK_NULL_HANDLE), "[VkAllocator] Invalid allocation passed in.");
+
+        // Note: VMA aligns the range to nonCoherentAtomSize for us
+        VK_VERIFY(vmaInvalidateAllocation(m_Allocator, allocation, static_cast<VkDeviceSize>(offset), static_cast<VkDeviceSize>(size)));
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Getters
     ////////////////////////////////////////////////////////////////////////////////////
@@ -247,4 +393,34 @@ namespace Obsidian::Internal
         return info.deviceMemory;
     }
 
+    bool VulkanAllocator::IsHostCoherent(VmaAllocation allocation) const
+    {
+        VkMemoryPropertyFlags flags = 0;
+        vmaGetAllocationMemoryProperties(m_Allocator, allocation, &flags);
+
+        return static_cast<bool>(flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    bool VulkanAllocator::PipelineCacheCompatible(std::span<const uint8_t> data) const
+    {
+        VkPipelineCacheHeaderVersionOne header = {};
+        if (data.size() < sizeof(VkPipelineCacheHeaderVersionOne))
+            return false;
+
+        std::memcpy(&header, data.data(), sizeof(VkPipelineCacheHeaderVersionOne));
+
+        VkPhysicalDeviceProperties properties = {};
+        vkGetPhysicalDeviceProperties(m_PhysicalDevice, &properties);
+
+        // Note: The pipelineCacheUUID changes with the driver build, so this also invalidates caches from older/newer drivers.
+        return (header.headerSize >= sizeof(VkPipelineCacheHeaderVersionOne)) &&
+               (header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE) &&
+               (header.vendorID == properties.vendorID) &&
+               (header.deviceID == properties.deviceID) &&
+               (std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0);
+    }
+
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <array>
 #include <tuple>
 #include <span>
+#include <vector>
 
 #if defined(OB_COMPILER_GCC)
     #pragma GCC diagnostic push
@@ -57,34 +58,50 @@ namespace Obsidian::Internal
     {
     public:
         // Constructor & Destructor
-        VulkanAllocator(VkInstance instance, VkPhysicalDevice physicalDevice, VkDevice logicalDevice);
+        VulkanAllocator(VkInstance instance, VkPhysicalDevice physicalDevice, VkDevice logicalDevice, bool bufferDeviceAddress = false);
         ~VulkanAllocator();
 
         // Pipeline Cache
-        VkPipelineCache CreatePipelineCache(std::span<const uint8_t> data);
+        VkPipelineCache CreatePipelineCache(std::span<const uint8_t> data); // Note: Data that doesn't match the current device/driver gets discarded
         VkPipelineCache GetPipelineCache() const;
+        std::vector<uint8_t> GetPipelineCacheData() const;
 
         // Buffers
         VmaAllocation AllocateBuffer(VmaMemoryUsage memoryUsage, VkBuffer& buffer, size_t size, VkBufferUsageFlags usage, VkMemoryPropertyFlags requiredFlags = 0) const;
+        VmaAllocation AllocateMappedBuffer(VmaMemoryUsage memoryUsage, VkBuffer& buffer, size_t size, VkBufferUsageFlags usage, void*& mappedData, VkMemoryPropertyFlags requiredFlags = 0) const; // Note: Stays mapped until it's destroyed
         void DestroyBuffer(VkBuffer buffer, VmaAllocation allocation) const;
 
         // Image
         VmaAllocation CreateImage(VmaMemoryUsage memUsage, VkImage& image, VkImageType type, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, uint32_t arrayLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkSampleCountFlags samples, VkMemoryPropertyFlags requiredFlags = 0) const;
         void DestroyImage(VkImage image, VmaAllocation allocation) const;
 
+        // Note: Memory that images get placed in through CreateAliasingImage, these images must be destroyed with vkDestroyImage before the memory is freed.
+        VkMemoryRequirements GetImageMemoryRequirements(VkImageType type, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, uint32_t arrayLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkSampleCountFlags samples) const;
+        VmaAllocation AllocateImageMemory(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags requiredFlags = 0) const;
+        void FreeImageMemory(VmaAllocation allocation) const;
+        void CreateAliasingImage(VmaAllocation allocation, size_t offset, VkImage& image, VkImageType type, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, uint32_t arrayLevels, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkSampleCountFlags samples) const;
+
         // Utils
         void MapMemory(VmaAllocation allocation, void*& mapData) const;
         void UnmapMemory(VmaAllocation allocation) const;
         void SetData(VmaAllocation allocation, void* data, size_t size) const;
         void SetMappedData(void* mappedData, void* data, size_t size) const;
+        void FlushMemory(VmaAllocation allocation, size_t offset, size_t size) const; // Note: Only necessary for memory without VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+        void InvalidateMemory(VmaAllocation allocation, size_t offset, size_t size) const; // Note: Only necessary for memory without VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
 
         // Getters
         VkDeviceMemory GetUnderlyingMemory(VmaAllocation allocation) const;
+        bool IsHostCoherent(VmaAllocation allocation) const;
 
         // Static getters
         inline static const VkAllocationCallbacks* GetCallbacks() { return &s_Callbacks; }
 
     private:
+        // Private methods
+        bool PipelineCacheCompatible(std::span<const uint8_t> data) const;
+
+    private:
+        VkPhysicalDevice m_PhysicalDevice;
         VkDevice m_Device;
 
 		VmaAllocator m_Allocator = VK_NULL_HANDLE;
@@ -106,8 +123,22 @@ namespace Obsidian::Internal
         inline PFN_vkQueueSubmit2KHR                g_vkQueueSubmit2KHR = nullptr;
         inline PFN_vkCmdCopyBuffer2KHR              g_vkCmdCopyBuffer2KHR = nullptr;
         inline PFN_vkCmdCopyImage2KHR               g_vkCmdCopyImage2KHR = nullptr;
+        inline PFN_vkCmdBlitImage2KHR               g_vkCmdBlitImage2KHR = nullptr;
         inline PFN_vkCmdCopyBufferToImage2KHR       g_vkCmdCopyBufferToImage2KHR = nullptr;
+        inline PFN_vkCmdCopyImageToBuffer2KHR       g_vkCmdCopyImageToBuffer2KHR = nullptr;
         inline PFN_vkCmdPipelineBarrier2KHR         g_vkCmdPipelineBarrier2KHR = nullptr;
+        inline PFN_vkCmdDrawIndexedIndirectCountKHR g_vkCmdDrawIndexedIndirectCountKHR = nullptr;
+        inline PFN_vkCmdWriteTimestamp2KHR          g_vkCmdWriteTimestamp2KHR = nullptr;
+        inline PFN_vkCmdBeginRenderingKHR           g_vkCmdBeginRenderingKHR = nullptr;
+        inline PFN_vkCmdEndRenderingKHR             g_vkCmdEndRenderingKHR = nullptr;
+        inline PFN_vkGetDeviceImageMemoryRequirementsKHR g_vkGetDeviceImageMemoryRequirementsKHR = nullptr;
+
+        // Note: Only loaded when descriptor buffers are in use
+        inline PFN_vkGetDescriptorSetLayoutSizeEXT          g_vkGetDescriptorSetLayoutSizeEXT = nullptr;
+        inline PFN_vkGetDescriptorSetLayoutBindingOffsetEXT g_vkGetDescriptorSetLayoutBindingOffsetEXT = nullptr;
+        inline PFN_vkGetDescriptorEXT                       g_vkGetDescriptorEXT = nullptr;
+        inline PFN_vkCmdBindDescriptorBuffersEXT            g_vkCmdBindDescriptorBuffersEXT = nullptr;
+        inline PFN_vkCmdSetDescriptorBufferOffsetsEXT       g_vkCmdSetDescriptorBufferOffsetsEXT = nullptr;
 
     }
 
@@ -8,6 +8,9 @@
 
 #include "Obsidian/Platform/Vulkan/VulkanDevice.hpp"
 
+#include <limits>
+#include <algorithm>
+
 namespace Obsidian::Internal
 {
 
@@ -37,6 +40,122 @@ namespace Obsidian::Internal
 
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    VulkanDescriptorHeap::VulkanDescriptorHeap(const VulkanContext& context, const VulkanAllocator& allocator)
+        : m_Allocator(allocator)
+    {
+        if (!context.UsesDescriptorBuffers())
+            return;
+
+        m_Properties = context.GetVulkanPhysicalDevice().GetDescriptorBufferProperties();
+        m_Properties.pNext = nullptr;
+
+        const VkDeviceSize size = std::min({ MaxSize, m_Properties.descriptorBufferAddressSpaceSize, m_Properties.resourceDescriptorBufferAddressSpaceSize, m_Properties.samplerDescriptorBufferAddressSpaceSize });
+
+        // Note: Resources & samplers share the same buffer, so there is only ever a single descriptor buffer binding
+        m_Usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+        void* mappedData = nullptr;
+        m_Allocation = m_Allocator.AllocateMappedBuffer(VMA_MEMORY_USAGE_CPU_TO_GPU, m_Buffer, static_cast<size_t>(size), m_Usage, mappedData, VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        m_MappedData = static_cast<std::byte*>(mappedData);
+
+        VkBufferDeviceAddressInfo addressInfo = {};
+        addressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+        addressInfo.buffer = m_Buffer;
+        m_Address = vkGetBufferDeviceAddress(context.GetVulkanLogicalDevice().GetVkDevice(), &addressInfo);
+
+        m_FreeRanges.emplace_back(0, size);
+
+        if constexpr (Information::Validation)
+            context.SetDebugName(m_Buffer, VK_OBJECT_TYPE_BUFFER, "Descriptor Heap");
+    }
+
+    VulkanDescriptorHeap::~VulkanDescriptorHeap()
+    {
+        if (m_Buffer != VK_NULL_HANDLE)
+            m_Allocator.DestroyBuffer(m_Buffer, m_Allocation);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    VkDeviceSize VulkanDescriptorHeap::Allocate(VkDeviceSize size)
+    {
+        const VkDeviceSize alignment = GetOffsetAlignment();
+        size = (size + alignment - 1) & ~(alignment - 1);
+
+        std::scoped_lock lock(m_Mutex);
+
+        // Note: First fit, pools are long lived so fragmentation stays low
+        for (auto it = m_FreeRanges.begin(); it != m_FreeRanges.end(); it++)
+        {
+            auto& [rangeOffset, rangeSize] = *it;
+            if (rangeSize < size)
+                continue;
+
+            const VkDeviceSize offset = rangeOffset;
+            rangeOffset += size;
+            rangeSize -= size;
+
+            if (rangeSize == 0)
+                m_FreeRanges.erase(it);
+
+            return offset;
+        }
+
+        OB_ASSERT(false, "[VkDescriptorHeap] Out of descriptor heap memory, failed to allocate {0} bytes.", size);
+        return 0;
+    }
+
+    void VulkanDescriptorHeap::Free(VkDeviceSize offset, VkDeviceSize size)
+    {
+        const VkDeviceSize alignment = GetOffsetAlignment();
+        size = (size + alignment - 1) & ~(alignment - 1);
+
+        if (size == 0)
+            return;
+
+        std::scoped_lock lock(m_Mutex);
+
+        auto it = std::ranges::lower_bound(m_FreeRanges, offset, {}, [](const auto& range) { return range.first; });
+        it = m_FreeRanges.emplace(it, offset, size);
+
+        // Note: Merge with the next & previous range
+        if ((std::next(it) != m_FreeRanges.end()) && ((it->first + it->second) == std::next(it)->first))
+        {
+            it->second += std::next(it)->second;
+            m_FreeRanges.erase(std::next(it));
+        }
+        if ((it != m_FreeRanges.begin()) && ((std::prev(it)->first + std::prev(it)->second) == it->first))
+        {
+            std::prev(it)->second += it->second;
+            m_FreeRanges.erase(it);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    size_t VulkanDescriptorHeap::GetDescriptorSize(VkDescriptorType type) const
+    {
+        switch (type)
+        {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:            return m_Properties.samplerDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:      return m_Properties.sampledImageDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:      return m_Properties.storageImageDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:     return m_Properties.uniformBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:     return m_Properties.storageBufferDescriptorSize;
+
+        default:
+            break;
+        }
+
+        OB_ASSERT(false, "[VkDescriptorHeap] Descriptor type {0} isn't supported with descriptor buffers.", static_cast<int>(type));
+        return 0;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructors & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
@@ -53,6 +172,9 @@ namespace Obsidian::Internal
             if (item.Type == ResourceType::PushConstants)
                 continue;
 
+            // Note: Dynamic offsets are applied at bind time, which descriptor buffers have no equivalent for
+            OB_ASSERT((!ResourceTypeIsDynamic(item.Type) || !api_cast<const VulkanDevice*>(&device)->GetContext().UsesDescriptorBuffers()), "[VkBindingLayout] Dynamic buffers (slot {0}) can't be used with descriptor buffers, see BindingLayoutSpecification.", item.Slot);
+
             VkDescriptorType descriptorType = ResourceTypeToVkDescriptorType(item.Type);
             uint32_t descriptorCount = item.GetArraySize();
 
@@ -66,11 +188,23 @@ namespace Obsidian::Internal
         }
 
         Finish(*api_cast<const VulkanDevice*>(&device), layoutBindings);
+
+        // Note: Descriptor buffer sets are written directly, so they don't need an update template
+        if (!layoutBindings.empty() && !api_cast<const VulkanDevice*>(&device)->GetContext().UsesDescriptorBuffers())
+            CreateUpdateTemplate(*api_cast<const VulkanDevice*>(&device), layoutBindings);
     }
 
     VulkanBindingLayout::VulkanBindingLayout(const Device& device, const BindlessLayoutSpecification& specs)
         : m_Specification(specs)
     {
+        const VulkanDevice& vulkanDevice = *api_cast<const VulkanDevice*>(&device);
+        const VulkanPhysicalDevice& physicalDevice = vulkanDevice.GetContext().GetVulkanPhysicalDevice();
+        const bool descriptorBuffer = vulkanDevice.GetContext().UsesDescriptorBuffers();
+
+        // Note: Bindless sets get written while the GPU may still use them, descriptor buffers can always be written while in use
+        if (!descriptorBuffer && !physicalDevice.SupportsUpdateUnusedWhilePending())
+            vulkanDevice.GetContext().Error("[VkBindingLayout] Bindless layouts require descriptorBindingUpdateUnusedWhilePending, which isn't supported by this device.");
+
         std::vector<VkDescriptorSetLayoutBinding> layoutBindings;
         layoutBindings.reserve(specs.Bindings.size());
         
@@ -82,6 +216,9 @@ namespace Obsidian::Internal
                 continue;
 
             VkDescriptorType descriptorType = ResourceTypeToVkDescriptorType(item.Type);
+            if (!descriptorBuffer && ((descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE) || (descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)) && !physicalDevice.SupportsStorageUpdateAfterBind())
+                vulkanDevice.GetContext().Error(std::format("[VkBindingLayout] Bindless slot {0} holds storage images/buffers, which require descriptorBinding(StorageImage/StorageBuffer)UpdateAfterBind. This device doesn't support it.", item.Slot));
+
             uint32_t descriptorCount = item.GetArraySize();
 
             VkDescriptorSetLayoutBinding descriptorSetLayoutBinding = {};
@@ -93,7 +230,7 @@ namespace Obsidian::Internal
             layoutBindings.push_back(descriptorSetLayoutBinding);
         }
 
-        Finish(*api_cast<const VulkanDevice*>(&device), layoutBindings);
+        Finish(vulkanDevice, layoutBindings);
     }
 
     VulkanBindingLayout::~VulkanBindingLayout()
@@ -148,19 +285,64 @@ namespace Obsidian::Internal
         }, m_Specification);
     }
 
+    uint32_t VulkanBindingLayout::GetTemplateIndex(uint32_t slot, uint32_t arrayIndex) const
+    {
+        for (const auto& [templateSlot, index] : m_TemplateOffsets)
+        {
+            if (templateSlot == slot)
+                return index + arrayIndex;
+        }
+
+        OB_ASSERT(false, "[VkBindingLayout] Slot {0} isn't part of the update template.", slot);
+        return std::numeric_limits<uint32_t>::max();
+    }
+
+    VkDeviceSize VulkanBindingLayout::GetBindingOffset(uint32_t slot) const
+    {
+        for (const auto& [bindingSlot, offset] : m_BindingOffsets)
+        {
+            if (bindingSlot == slot)
+                return offset;
+        }
+
+        OB_ASSERT(false, "[VkBindingLayout] Slot {0} isn't part of the descriptor buffer layout.", slot);
+        return 0;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Private methods
     ////////////////////////////////////////////////////////////////////////////////////
-    void VulkanBindingLayout::Finish(const VulkanDevice& device, const std::vector<VkDescriptorSetLayoutBinding>& layoutBindings)
+    void VulkanBindingLayout::Finish(const VulkanDevice& device, std::vector<VkDescriptorSetLayoutBinding>& layoutBindings)
     {
+        const bool descriptorBuffer = device.GetContext().UsesDescriptorBuffers();
+
+        // Note: The arrays only have to live until the layout is created, the layout keeps its own copy
+        std::vector<std::vector<VkSampler>> immutableSamplers;
+        immutableSamplers.reserve(layoutBindings.size());
+        for (VkDescriptorSetLayoutBinding& binding : layoutBindings)
+        {
+            const BindingLayoutItem& item = GetItem(binding.binding);
+            if (!item.IsImmutableSampler())
+                continue;
+
+            OB_ASSERT((item.Type == ResourceType::Sampler), "[VkBindingLayout] Slot {0} has an immutable sampler, but its ResourceType isn't Sampler.", item.Slot);
+
+            VkSampler sampler = device.GetSamplerCache().Acquire(device, item.ImmutableSampler.value());
+            m_ImmutableSamplers.emplace_back(item.Slot, sampler);
+
+            binding.pImmutableSamplers = immutableSamplers.emplace_back(binding.descriptorCount, sampler).data();
+        }
+
         VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = {};
         descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-        descriptorSetLayoutCreateInfo.flags = (IsBindless() ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT : 0);
+        descriptorSetLayoutCreateInfo.flags = (descriptorBuffer ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : (IsBindless() ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT : 0));
         descriptorSetLayoutCreateInfo.bindingCount = static_cast<uint32_t>(layoutBindings.size());
         descriptorSetLayoutCreateInfo.pBindings = layoutBindings.data();
 
-        // Note: For bindless
-        std::vector<VkDescriptorBindingFlags> bindlessFlags(layoutBindings.size(), VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT);
+        // Note: For bindless, descriptor buffers can always be written while in use. Descriptor sets need
+        // update unused while pending, since newly added indices get written while earlier submissions still run.
+        const VkDescriptorBindingFlags updateFlags = (device.GetContext().GetVulkanPhysicalDevice().SupportsUpdateUnusedWhilePending() ? (VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT) : VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT);
+        std::vector<VkDescriptorBindingFlags> bindlessFlags(layoutBindings.size(), (descriptorBuffer ? 0 : updateFlags) | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT);
         VkDescriptorSetLayoutBindingFlagsCreateInfo extendedCreateInfo = {};
         extendedCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
         extendedCreateInfo.bindingCount = static_cast<uint32_t>(bindlessFlags.size());
@@ -170,6 +352,25 @@ namespace Obsidian::Internal
         descriptorSetLayoutCreateInfo.pNext = (IsBindless() ? &extendedCreateInfo : nullptr);
 
         VK_VERIFY(vkCreateDescriptorSetLayout(device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &descriptorSetLayoutCreateInfo, VulkanAllocator::GetCallbacks(), &m_Layout));
+
+        // Note: Hashes everything the set layout was created from, handles can be reused by the driver once a layout is destroyed
+        m_ContentHash = Nano::Hash::Combine(0, std::hash<uint32_t>{}(descriptorSetLayoutCreateInfo.flags));
+        for (size_t i = 0; i < layoutBindings.size(); i++)
+        {
+            const VkDescriptorSetLayoutBinding& binding = layoutBindings[i];
+            m_ContentHash = Nano::Hash::Combine(m_ContentHash, std::hash<uint32_t>{}(binding.binding));
+            m_ContentHash = Nano::Hash::Combine(m_ContentHash, std::hash<std::underlying_type_t<VkDescriptorType>>{}(binding.descriptorType));
+            m_ContentHash = Nano::Hash::Combine(m_ContentHash, std::hash<uint32_t>{}(binding.descriptorCount));
+            m_ContentHash = Nano::Hash::Combine(m_ContentHash, std::hash<uint32_t>{}(binding.stageFlags));
+            m_ContentHash = Nano::Hash::Combine(m_ContentHash, std::hash<uint32_t>{}(IsBindless() ? bindlessFlags[i] : 0));
+
+            const BindingLayoutItem& item = GetItem(binding.binding);
+            if (item.IsImmutableSampler())
+                m_ContentHash = Nano::Hash::Combine(m_ContentHash, VulkanSamplerCache::Hash{}(item.ImmutableSampler.value()));
+        }
+
+        if (descriptorBuffer)
+            QueryDescriptorBufferLayout(device, layoutBindings);
         
         // Count number of descriptors per type
         std::unordered_map<VkDescriptorType, uint32_t> poolSizeMap;
@@ -197,6 +398,63 @@ namespace Obsidian::Internal
         }
     }
 
+    void VulkanBindingLayout::CreateUpdateTemplate(const VulkanDevice& device, const std::vector<VkDescriptorSetLayoutBinding>& layoutBindings)
+    {
+        // Note: Every descriptor of the layout gets its own VulkanDescriptorInfo, in order of the bindings
+        std::vector<VkDescriptorUpdateTemplateEntry> entries;
+        entries.reserve(layoutBindings.size());
+        m_TemplateOffsets.reserve(layoutBindings.size());
+
+        for (const VkDescriptorSetLayoutBinding& binding : layoutBindings)
+        {
+            // Note: Immutable samplers can't be written, so they're not part of the template
+            if (binding.pImmutableSamplers)
+                continue;
+
+            VkDescriptorUpdateTemplateEntry& entry = entries.emplace_back();
+            entry.dstBinding = binding.binding;
+            entry.dstArrayElement = 0;
+            entry.descriptorCount = binding.descriptorCount;
+            entry.descriptorType = binding.descriptorType;
+            entry.offset = static_cast<size_t>(m_TemplateDescriptorCount) * sizeof(VulkanDescriptorInfo);
+            entry.stride = sizeof(VulkanDescriptorInfo);
+
+            m_TemplateOffsets.emplace_back(binding.binding, m_TemplateDescriptorCount);
+            m_TemplateDescriptorCount += binding.descriptorCount;
+        }
+
+        if (entries.empty())
+            return;
+
+        VkDescriptorUpdateTemplateCreateInfo templateCreateInfo = {};
+        templateCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+        templateCreateInfo.descriptorUpdateEntryCount = static_cast<uint32_t>(entries.size());
+        templateCreateInfo.pDescriptorUpdateEntries = entries.data();
+        templateCreateInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+        templateCreateInfo.descriptorSetLayout = m_Layout;
+
+        VK_VERIFY(vkCreateDescriptorUpdateTemplate(device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &templateCreateInfo, VulkanAllocator::GetCallbacks(), &m_UpdateTemplate));
+    }
+
+    void VulkanBindingLayout::QueryDescriptorBufferLayout(const VulkanDevice& device, const std::vector<VkDescriptorSetLayoutBinding>& layoutBindings)
+    {
+        VkDevice vkDevice = device.GetContext().GetVulkanLogicalDevice().GetVkDevice();
+
+        VkDeviceSize size = 0;
+        VkExtension::g_vkGetDescriptorSetLayoutSizeEXT(vkDevice, m_Layout, &size);
+
+        const VkDeviceSize alignment = device.GetDescriptorHeap().GetOffsetAlignment();
+        m_DescriptorBufferSize = (size + alignment - 1) & ~(alignment - 1);
+
+        m_BindingOffsets.reserve(layoutBindings.size());
+        for (const VkDescriptorSetLayoutBinding& binding : layoutBindings)
+        {
+            VkDeviceSize offset = 0;
+            VkExtension::g_vkGetDescriptorSetLayoutBindingOffsetEXT(vkDevice, m_Layout, binding.binding, &offset);
+            m_BindingOffsets.emplace_back(binding.binding, offset);
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Private methods
     ////////////////////////////////////////////////////////////////////////////////////
@@ -215,8 +473,17 @@ namespace Obsidian::Internal
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
     VulkanBindingSet::VulkanBindingSet(BindingSetPool& pool, const BindingSetSpecification& specs)
-        : m_Pool(*api_cast<VulkanBindingSetPool*>(&pool)), m_Specification(specs), m_DescriptorSet(api_cast<VulkanBindingSetPool*>(&pool)->CreateDescriptorSet())
+        : m_Pool(*api_cast<VulkanBindingSetPool*>(&pool)), m_Specification(specs)
     {
+        if (m_Pool.UsesDescriptorBuffer())
+        {
+            m_DescriptorOffset = m_Pool.CreateDescriptorOffset();
+            WriteImmutableSamplers();
+        }
+        else
+        {
+            m_DescriptorSet = m_Pool.CreateDescriptorSet();
+        }
     }
 
     VulkanBindingSet::~VulkanBindingSet()
@@ -228,6 +495,12 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     void VulkanBindingSet::SetItem(uint32_t slot, Image& image, const ImageSubresourceSpecification& subresources, uint32_t arrayIndex)
     {
+        if (m_Pool.UsesDescriptorBuffer())
+        {
+            WriteDescriptor(BindingSetItem().SetSlot(slot).SetArrayIndex(arrayIndex).SetImage(image, subresources));
+            return;
+        }
+
         VulkanBindingLayout& vkLayout = *api_cast<VulkanBindingLayout*>(m_Pool.GetSpecification().Layout);
         const auto& item = vkLayout.GetItem(slot);
 
@@ -257,10 +530,17 @@ namespace Obsidian::Internal
 
     void VulkanBindingSet::SetItem(uint32_t slot, Sampler& sampler, uint32_t arrayIndex)
     {
+        if (m_Pool.UsesDescriptorBuffer())
+        {
+            WriteDescriptor(BindingSetItem().SetSlot(slot).SetArrayIndex(arrayIndex).SetSampler(sampler));
+            return;
+        }
+
         VulkanBindingLayout& vkLayout = *api_cast<VulkanBindingLayout*>(m_Pool.GetSpecification().Layout);
         const auto& item = vkLayout.GetItem(slot);
         
         OB_ASSERT((item.Type == ResourceType::Sampler), "[VkBindingSet] When uploading a sampler the ResourceType must be Sampler.");
+        OB_ASSERT(!item.IsImmutableSampler(), "[VkBindingSet] Slot {0} uses an immutable sampler, which can't be overwritten.", slot);
         
         VulkanSampler& vulkanSampler = *api_cast<VulkanSampler*>(&sampler);
 
@@ -281,6 +561,12 @@ namespace Obsidian::Internal
 
     void VulkanBindingSet::SetItem(uint32_t slot, Buffer& buffer, const BufferRange& range, uint32_t arrayIndex)
     {
+        if (m_Pool.UsesDescriptorBuffer())
+        {
+            WriteDescriptor(BindingSetItem().SetSlot(slot).SetArrayIndex(arrayIndex).SetBuffer(buffer, range));
+            return;
+        }
+
         // Note: I don't know if arrayIndex is actually usable for buffers, but for now
         // it exists, it might not translate to vulkan/glsl. Careful with this.
 
@@ -318,93 +604,203 @@ namespace Obsidian::Internal
         vkUpdateDescriptorSets(m_Pool.GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkDevice(), 1, &descriptorWrite, 0, nullptr);
     }
 
+    void VulkanBindingSet::SetItems(std::span<const BindingSetItem> items)
+    {
+        OB_PROFILE("VkBindingSet::SetItems()");
+
+        if (items.empty())
+            return;
+
+        // Note: With descriptor buffers every write is a copy into mapped memory, there is nothing to batch
+        if (m_Pool.UsesDescriptorBuffer())
+        {
+            for (const BindingSetItem& item : items)
+                WriteDescriptor(item);
+
+            return;
+        }
+
+        // Note: Sets that get fully rewritten (e.g. every frame) go through the layout's update template
+        if (WriteTemplate(items))
+            return;
+
+        VulkanBindingLayout& vkLayout = *api_cast<VulkanBindingLayout*>(m_Pool.GetSpecification().Layout);
+
+        std::vector<VulkanDescriptorInfo> infos(items.size());
+        std::vector<VkWriteDescriptorSet> descriptorWrites(items.size());
+
+        for (size_t i = 0; i < items.size(); i++)
+        {
+            const BindingLayoutItem& layoutItem = vkLayout.GetItem(items[i].Slot);
+            WriteInfo(items[i], layoutItem, infos[i]);
+
+            VkWriteDescriptorSet& descriptorWrite = descriptorWrites[i];
+            descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptorWrite.dstSet = m_DescriptorSet;
+            descriptorWrite.dstBinding = items[i].Slot;
+            descriptorWrite.dstArrayElement = items[i].ArrayIndex;
+            descriptorWrite.descriptorType = ResourceTypeToVkDescriptorType(layoutItem.Type);
+            descriptorWrite.descriptorCount = 1;
+
+            if (std::holds_alternative<Buffer*>(items[i].Resource))
+                descriptorWrite.pBufferInfo = &infos[i].Buffer;
+            else
+                descriptorWrite.pImageInfo = &infos[i].Image;
+        }
+
+        vkUpdateDescriptorSets(m_Pool.GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkDevice(), static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
-    // Private methods // Note: I am aware of the code duplications, but this is the fastest approach.
+    // Private methods
     ////////////////////////////////////////////////////////////////////////////////////
-    void VulkanBindingSet::UploadImage(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorImageInfo>& imageInfos, Image& image, const ImageSubresourceSpecification& subresources, ResourceType resourceType, uint32_t slot, uint32_t arrayIndex) const
+    void VulkanBindingSet::WriteDescriptor(const BindingSetItem& item) const
     {
+        const VulkanDevice& device = m_Pool.GetVulkanDevice();
+        const VulkanDescriptorHeap& heap = device.GetDescriptorHeap();
         VulkanBindingLayout& vkLayout = *api_cast<VulkanBindingLayout*>(m_Pool.GetSpecification().Layout);
-        const auto& item = vkLayout.GetItem(slot);
 
-        OB_ASSERT(((resourceType == ResourceType::Image) || (resourceType == ResourceType::ImageUnordered)), "[VkBindingSet] When uploading an image the ResourceType must be Image or ImageUnordered.");
-    
-        VulkanImage& vulkanImage = *api_cast<VulkanImage*>(&image);
-        ImageSubresourceSpecification resSubresources = ResolveImageSubresource(subresources, image.GetSpecification(), false);
+        const BindingLayoutItem& layoutItem = vkLayout.GetItem(item.Slot);
+        const VkDescriptorType descriptorType = ResourceTypeToVkDescriptorType(layoutItem.Type);
 
-        VkImageLayout imageLayout = g_ResourceTypeToLayoutsAndUsageMapping[static_cast<size_t>(resourceType) - static_cast<size_t>(ResourceType::Image)].VulkanImageLayout;
-        VkImageUsageFlags imageUsage = g_ResourceTypeToLayoutsAndUsageMapping[static_cast<size_t>(resourceType) - static_cast<size_t>(ResourceType::Image)].VulkanImageUsage;
+        VulkanDescriptorInfo info = {};
+        WriteInfo(item, layoutItem, info);
 
-        VkDescriptorImageInfo& imageInfo = imageInfos.emplace_back();
-        imageInfo.imageLayout = imageLayout;
-        imageInfo.imageView = vulkanImage.GetSubresourceView(resSubresources, image.GetSpecification().Dimension, image.GetSpecification().ImageFormat, imageUsage, FormatToImageSubresourceViewType(image.GetSpecification().ImageFormat)).GetVkImageView();
+        VkDescriptorAddressInfoEXT addressInfo = {};
+        addressInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+        addressInfo.format = VK_FORMAT_UNDEFINED;
 
-        VkWriteDescriptorSet& descriptorWrite = writes.emplace_back();
-        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        descriptorWrite.dstSet = m_DescriptorSet;
-        descriptorWrite.dstBinding = slot;
-        descriptorWrite.dstArrayElement = arrayIndex;
-        descriptorWrite.descriptorType = ResourceTypeToVkDescriptorType(resourceType);
-        descriptorWrite.descriptorCount = item.GetArraySize();
-        descriptorWrite.pImageInfo = &imageInfo;
+        VkDescriptorGetInfoEXT getInfo = {};
+        getInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+        getInfo.type = descriptorType;
+
+        switch (descriptorType)
+        {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+            getInfo.data.pSampler = &info.Image.sampler;
+            break;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            getInfo.data.pSampledImage = &info.Image;
+            break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            getInfo.data.pStorageImage = &info.Image;
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            addressInfo.address = api_cast<VulkanBuffer*>(std::get<Buffer*>(item.Resource))->GetVkDeviceAddress() + info.Buffer.offset;
+            addressInfo.range = info.Buffer.range;
+
+            if (descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+                getInfo.data.pUniformBuffer = &addressInfo;
+            else
+                getInfo.data.pStorageBuffer = &addressInfo;
+            break;
+
+        default:
+            OB_ASSERT(false, "[VkBindingSet] ResourceType of slot {0} can't be written to a descriptor buffer.", item.Slot);
+            return;
+        }
+
+        const size_t descriptorSize = heap.GetDescriptorSize(descriptorType);
+        std::byte* destination = heap.GetMappedData() + m_DescriptorOffset + vkLayout.GetBindingOffset(item.Slot) + (static_cast<VkDeviceSize>(item.ArrayIndex) * descriptorSize);
+
+        VkExtension::g_vkGetDescriptorEXT(device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &getInfo, descriptorSize, destination);
     }
 
-    void VulkanBindingSet::UploadSampler(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorImageInfo>& imageInfos, Sampler& sampler, ResourceType resourceType, uint32_t slot, uint32_t arrayIndex) const
+    void VulkanBindingSet::WriteImmutableSamplers() const
     {
+        const VulkanDevice& device = m_Pool.GetVulkanDevice();
+        const VulkanDescriptorHeap& heap = device.GetDescriptorHeap();
         VulkanBindingLayout& vkLayout = *api_cast<VulkanBindingLayout*>(m_Pool.GetSpecification().Layout);
-        const auto& item = vkLayout.GetItem(slot);
 
-        OB_ASSERT((resourceType == ResourceType::Sampler), "[VkBindingSet] When uploading a sampler the ResourceType must be Sampler.");
-    
-        VulkanSampler& vulkanSampler = *api_cast<VulkanSampler*>(&sampler);
+        const size_t descriptorSize = heap.GetDescriptorSize(VK_DESCRIPTOR_TYPE_SAMPLER);
+        for (const auto& [slot, sampler] : vkLayout.GetImmutableSamplers())
+        {
+            VkDescriptorGetInfoEXT getInfo = {};
+            getInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+            getInfo.type = VK_DESCRIPTOR_TYPE_SAMPLER;
+            getInfo.data.pSampler = &sampler;
+
+            std::byte* destination = heap.GetMappedData() + m_DescriptorOffset + vkLayout.GetBindingOffset(slot);
+            for (uint32_t i = 0; i < vkLayout.GetItem(slot).GetArraySize(); i++)
+                VkExtension::g_vkGetDescriptorEXT(device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &getInfo, descriptorSize, destination + (static_cast<VkDeviceSize>(i) * descriptorSize));
+        }
+    }
 
-        VkDescriptorImageInfo& imageInfo = imageInfos.emplace_back();
-        imageInfo.sampler = vulkanSampler.GetVkSampler();
+    bool VulkanBindingSet::WriteTemplate(std::span<const BindingSetItem> items) const
+    {
+        VulkanBindingLayout& vkLayout = *api_cast<VulkanBindingLayout*>(m_Pool.GetSpecification().Layout);
 
-        VkWriteDescriptorSet& descriptorWrite = writes.emplace_back();
-        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        descriptorWrite.dstSet = m_DescriptorSet;
-        descriptorWrite.dstBinding = slot;
-        descriptorWrite.dstArrayElement = arrayIndex;
-        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
-        descriptorWrite.descriptorCount = item.GetArraySize();
-        descriptorWrite.pImageInfo = &imageInfo;
+        if ((vkLayout.GetVkDescriptorUpdateTemplate() == VK_NULL_HANDLE) || (items.size() != vkLayout.GetTemplateDescriptorCount()))
+            return false;
+
+        std::vector<VulkanDescriptorInfo> infos(items.size());
+        std::vector<bool> written(items.size(), false);
+
+        for (const BindingSetItem& item : items)
+        {
+            const BindingLayoutItem& layoutItem = vkLayout.GetItem(item.Slot);
+            if (item.ArrayIndex >= (ResourceTypeIsDynamic(layoutItem.Type) ? 1u : layoutItem.GetArraySize()))
+                return false;
+
+            // Note: Writing the same descriptor twice means another one is missing, the regular path handles that
+            const uint32_t index = vkLayout.GetTemplateIndex(item.Slot, item.ArrayIndex);
+            if (written[index])
+                return false;
+
+            written[index] = true;
+            WriteInfo(item, layoutItem, infos[index]);
+        }
+
+        vkUpdateDescriptorSetWithTemplate(m_Pool.GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkDevice(), m_DescriptorSet, vkLayout.GetVkDescriptorUpdateTemplate(), infos.data());
+        return true;
     }
 
-    void VulkanBindingSet::UploadBuffer(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorBufferInfo>& bufferInfos, Buffer& buffer, const BufferRange& range, ResourceType resourceType, uint32_t slot, uint32_t arrayIndex) const
+    void VulkanBindingSet::WriteInfo(const BindingSetItem& item, const BindingLayoutItem& layoutItem, VulkanDescriptorInfo& info) const
     {
-        // Note: I don't know if arrayIndex is actually usable for buffers, but for now
-        // it exists, it might not translate to vulkan/glsl. Careful with this.
+        if (Image* const* image = std::get_if<Image*>(&item.Resource))
+        {
+            OB_ASSERT(((layoutItem.Type == ResourceType::Image) || (layoutItem.Type == ResourceType::ImageUnordered)), "[VkBindingSet] When uploading an image the ResourceType must be Image or ImageUnordered.");
 
-        VulkanBindingLayout& vkLayout = *api_cast<VulkanBindingLayout*>(m_Pool.GetSpecification().Layout);
-        const auto& item = vkLayout.GetItem(slot);
+            VulkanImage& vulkanImage = *api_cast<VulkanImage*>(*image);
+            const ImageSpecification& imageSpec = (*image)->GetSpecification();
+            ImageSubresourceSpecification resSubresources = ResolveImageSubresource(item.Subresources, imageSpec, false);
 
-        OB_ASSERT(((resourceType == ResourceType::StorageBuffer) || (resourceType == ResourceType::StorageBufferUnordered) || (resourceType == ResourceType::DynamicStorageBuffer) || (resourceType == ResourceType::DynamicStorageBufferUnordered) || (resourceType == ResourceType::UniformBuffer) || (resourceType == ResourceType::DynamicUniformBuffer)), "[VkBindingSet] When uploading a buffer the ResourceType must be StorageBuffer, StorageBufferUnordered, DynamicStorageBuffer, DynamicStorageBufferUnordered, UniformBuffer or DynamicUniformBuffer.");
+            const ResourceTypeToLayoutsAndUsageMapping& mapping = g_ResourceTypeToLayoutsAndUsageMapping[static_cast<size_t>(layoutItem.Type) - static_cast<size_t>(ResourceType::Image)];
 
-        if constexpr (Information::Validation)
+            info.Image = {};
+            info.Image.imageLayout = mapping.VulkanImageLayout;
+            info.Image.imageView = vulkanImage.GetSubresourceView(resSubresources, imageSpec.Dimension, imageSpec.ImageFormat, mapping.VulkanImageUsage, FormatToImageSubresourceViewType(imageSpec.ImageFormat)).GetVkImageView();
+        }
+        else if (Sampler* const* sampler = std::get_if<Sampler*>(&item.Resource))
         {
-            if (ResourceTypeIsDynamic(resourceType))
-            {
-                OB_ASSERT((range.Size == BufferRange::FullSize), "[VkBindingSet] Dynamic buffers require either a buffer range of FullSize.");
-                OB_ASSERT((range.Offset == 0), "[VkBindingSet] Dynamic buffers require no buffer range offset.");
-            }
+            OB_ASSERT((layoutItem.Type == ResourceType::Sampler), "[VkBindingSet] When uploading a sampler the ResourceType must be Sampler.");
+            OB_ASSERT(!layoutItem.IsImmutableSampler(), "[VkBindingSet] Slot {0} uses an immutable sampler, which can't be overwritten.", item.Slot);
+
+            info.Image = {};
+            info.Image.sampler = api_cast<VulkanSampler*>(*sampler)->GetVkSampler();
         }
+        else if (Buffer* const* buffer = std::get_if<Buffer*>(&item.Resource))
+        {
+            OB_ASSERT(((layoutItem.Type == ResourceType::StorageBuffer) || (layoutItem.Type == ResourceType::StorageBufferUnordered) || (layoutItem.Type == ResourceType::DynamicStorageBuffer) || (layoutItem.Type == ResourceType::DynamicStorageBufferUnordered) || (layoutItem.Type == ResourceType::UniformBuffer) || (layoutItem.Type == ResourceType::DynamicUniformBuffer)), "[VkBindingSet] When uploading a buffer the ResourceType must be StorageBuffer, StorageBufferUnordered, DynamicStorageBuffer, DynamicStorageBufferUnordered, UniformBuffer or DynamicUniformBuffer.");
 
-        VulkanBuffer& vulkanBuffer = *api_cast<VulkanBuffer*>(&buffer);
-        BufferRange resRange = ResolveBufferRange(range, buffer.GetSpecification());
+            if constexpr (Information::Validation)
+            {
+                if (ResourceTypeIsDynamic(layoutItem.Type))
+                {
+                    OB_ASSERT((item.Range.Size == BufferRange::FullSize), "[VkBindingSet] Dynamic buffers require either a buffer range of FullSize.");
+                    OB_ASSERT((item.Range.Offset == 0), "[VkBindingSet] Dynamic buffers require no buffer range offset.");
+                }
+            }
 
-        VkDescriptorBufferInfo& bufferInfo = bufferInfos.emplace_back();
-        bufferInfo.buffer = vulkanBuffer.GetVkBuffer();
-        bufferInfo.offset = resRange.Offset;
-        bufferInfo.range = (ResourceTypeIsDynamic(item.Type) ? buffer.GetSpecification().Stride : resRange.Size);
+            const BufferSpecification& bufferSpec = (*buffer)->GetSpecification();
+            BufferRange resRange = ResolveBufferRange(item.Range, bufferSpec);
 
-        VkWriteDescriptorSet& descriptorWrite = writes.emplace_back();
-        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        descriptorWrite.dstSet = m_DescriptorSet;
-        descriptorWrite.dstBinding = slot;
-        descriptorWrite.dstArrayElement = arrayIndex;
-        descriptorWrite.descriptorType = ResourceTypeToVkDescriptorType(resourceType);
-        descriptorWrite.descriptorCount = (ResourceTypeIsDynamic(item.Type) ? 1 : item.GetArraySize());
-        descriptorWrite.pBufferInfo = &bufferInfo;
+            info.Buffer = {};
+            info.Buffer.buffer = api_cast<VulkanBuffer*>(*buffer)->GetVkBuffer();
+            info.Buffer.offset = resRange.Offset;
+            info.Buffer.range = (ResourceTypeIsDynamic(layoutItem.Type) ? bufferSpec.Stride : resRange.Size);
+        }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -417,6 +813,15 @@ namespace Obsidian::Internal
         OB_ASSERT(m_Specification.SetAmount > 0, "[VkBindingSetPool] SetAmount must be non-zero.");
 
         VulkanBindingLayout& bindingLayout = *api_cast<VulkanBindingLayout*>(m_Specification.Layout);
+
+        // Note: With descriptor buffers there is no pool, the sets are consecutive parts of a range of the device's descriptor heap
+        if (m_Device.GetContext().UsesDescriptorBuffers())
+        {
+            m_DescriptorRangeSize = bindingLayout.GetDescriptorBufferSize() * m_Specification.SetAmount;
+            m_DescriptorOffset = m_Device.GetDescriptorHeap().Allocate(m_DescriptorRangeSize);
+            return;
+        }
+
         bindingLayout.UpdatePoolSizeInfosToMaxSets(specs.SetAmount); // Update the infos.
 
         VkDescriptorPoolCreateInfo poolInfo = {};
@@ -494,4 +899,12 @@ namespace Obsidian::Internal
         return m_DescriptorSets[m_CurrentDescriptor++];
     }
 
+    VkDeviceSize VulkanBindingSetPool::CreateDescriptorOffset()
+    {
+        OB_ASSERT((m_Specification.SetAmount > m_CurrentDescriptor), "[VkBindingSetPool] Cannot allocate more descriptor sets than the specification's count specified.");
+
+        const VulkanBindingLayout& bindingLayout = *api_cast<VulkanBindingLayout*>(m_Specification.Layout);
+        return m_DescriptorOffset + (bindingLayout.GetDescriptorBufferSize() * m_CurrentDescriptor++);
+    }
+
 }
\ No newline at end of file
@@ -11,7 +11,11 @@
 #include <Nano/Nano.hpp>
 
 #include <span>
+#include <mutex>
+#include <vector>
+#include <cstddef>
 #include <variant>
+#include <utility>
 #include <string_view>
 
 namespace Obsidian
@@ -27,11 +31,65 @@ namespace Obsidian::Internal
 {
 
     class VulkanDevice;
+    class VulkanContext;
+    class VulkanDescriptorHeap;
     class VulkanBindingLayout;
     class VulkanBindingSet;
     class VulkanBindingSetPool;
 
 #if defined(OB_API_VULKAN)
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanDescriptorInfo // Note: One element of the data passed to an update template
+    ////////////////////////////////////////////////////////////////////////////////////
+    union VulkanDescriptorInfo
+    {
+    public:
+        VkDescriptorImageInfo Image;
+        VkDescriptorBufferInfo Buffer;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanDescriptorHeap // Note: One device wide descriptor buffer (VK_EXT_descriptor_buffer),
+    // every BindingSetPool gets a range of it. Since it's a single buffer it only has to be
+    // bound once per commandbuffer and descriptors get written straight into its mapped memory.
+    ////////////////////////////////////////////////////////////////////////////////////
+    class VulkanDescriptorHeap
+    {
+    public:
+        inline constexpr static VkDeviceSize MaxSize = 64ull * 1024 * 1024;
+    public:
+        // Constructor & Destructor
+        VulkanDescriptorHeap(const VulkanContext& context, const VulkanAllocator& allocator); // Note: Only allocates when the context uses descriptor buffers
+        ~VulkanDescriptorHeap();
+
+        // Methods // Note: Thread safe
+        VkDeviceSize Allocate(VkDeviceSize size); // Note: Returns the offset into the heap
+        void Free(VkDeviceSize offset, VkDeviceSize size);
+
+        // Getters
+        inline bool IsValid() const { return (m_Buffer != VK_NULL_HANDLE); }
+
+        inline VkDeviceAddress GetVkDeviceAddress() const { return m_Address; }
+        inline VkBufferUsageFlags GetVkBufferUsage() const { return m_Usage; }
+        inline std::byte* GetMappedData() const { return m_MappedData; }
+
+        size_t GetDescriptorSize(VkDescriptorType type) const;
+        inline VkDeviceSize GetOffsetAlignment() const { return m_Properties.descriptorBufferOffsetAlignment; }
+
+    private:
+        const VulkanAllocator& m_Allocator;
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT m_Properties = {};
+
+        VkBuffer m_Buffer = VK_NULL_HANDLE;
+        VmaAllocation m_Allocation = VK_NULL_HANDLE;
+        VkBufferUsageFlags m_Usage = 0;
+        VkDeviceAddress m_Address = 0;
+        std::byte* m_MappedData = nullptr;
+
+        std::mutex m_Mutex = {};
+        std::vector<std::pair<VkDeviceSize, VkDeviceSize>> m_FreeRanges = { }; // Note: Offset & size, sorted by offset
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
     // VulkanBindingLayout
     ////////////////////////////////////////////////////////////////////////////////////
@@ -60,12 +118,26 @@ namespace Obsidian::Internal
         std::span<const BindingLayoutItem> GetBindingItems() const;
 
         inline VkDescriptorSetLayout GetVkDescriptorSetLayout() const { return m_Layout; }
+        inline size_t GetContentHash() const { return m_ContentHash; } // Note: Equal for layouts created from the same bindings, used to share pipeline layouts
 
         inline const std::vector<VkDescriptorPoolSize>& GetPoolSizeInfo() const { return m_PoolSizeInfo; }
 
+        // Note: The update template writes every descriptor of the layout at once, only created for non bindless layouts
+        inline VkDescriptorUpdateTemplate GetVkDescriptorUpdateTemplate() const { return m_UpdateTemplate; }
+        inline uint32_t GetTemplateDescriptorCount() const { return m_TemplateDescriptorCount; }
+        uint32_t GetTemplateIndex(uint32_t slot, uint32_t arrayIndex) const; // Note: Index into the VulkanDescriptorInfo array passed to the template
+
+        // Note: Only used with descriptor buffers, the size is aligned to the heap's offset alignment
+        inline VkDeviceSize GetDescriptorBufferSize() const { return m_DescriptorBufferSize; }
+        VkDeviceSize GetBindingOffset(uint32_t slot) const;
+
+        inline const std::vector<std::pair<uint32_t, VkSampler>>& GetImmutableSamplers() const { return m_ImmutableSamplers; }
+
     private:
         // Private methods
-        void Finish(const VulkanDevice& device, const std::vector<VkDescriptorSetLayoutBinding>& layoutBindings);
+        void Finish(const VulkanDevice& device, std::vector<VkDescriptorSetLayoutBinding>& layoutBindings);
+        void CreateUpdateTemplate(const VulkanDevice& device, const std::vector<VkDescriptorSetLayoutBinding>& layoutBindings);
+        void QueryDescriptorBufferLayout(const VulkanDevice& device, const std::vector<VkDescriptorSetLayoutBinding>& layoutBindings);
 
         // Private getters
         std::string_view GetDebugName() const;
@@ -74,7 +146,17 @@ namespace Obsidian::Internal
         std::variant<BindingLayoutSpecification, BindlessLayoutSpecification> m_Specification;
 
         VkDescriptorSetLayout m_Layout = VK_NULL_HANDLE;
+        size_t m_ContentHash = 0;
         std::vector<VkDescriptorPoolSize> m_PoolSizeInfo = { };
+
+        VkDescriptorUpdateTemplate m_UpdateTemplate = VK_NULL_HANDLE;
+        uint32_t m_TemplateDescriptorCount = 0;
+        std::vector<std::pair<uint32_t, uint32_t>> m_TemplateOffsets = { }; // Note: Slot & index of its first descriptor
+
+        VkDeviceSize m_DescriptorBufferSize = 0;
+        std::vector<std::pair<uint32_t, VkDeviceSize>> m_BindingOffsets = { }; // Note: Slot & byte offset within a set
+
+        std::vector<std::pair<uint32_t, VkSampler>> m_ImmutableSamplers = { }; // Note: Slot & sampler, acquired from the device's sampler cache
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -91,6 +173,7 @@ namespace Obsidian::Internal
         void SetItem(uint32_t slot, Image& image, const ImageSubresourceSpecification& subresources, uint32_t arrayIndex);
         void SetItem(uint32_t slot, Sampler& sampler, uint32_t arrayIndex);
         void SetItem(uint32_t slot, Buffer& buffer, const BufferRange& range, uint32_t arrayIndex);
+        void SetItems(std::span<const BindingSetItem> items);
 
         // Getters
         inline const BindingSetSpecification& GetSpecification() const { return m_Specification; }
@@ -100,18 +183,21 @@ namespace Obsidian::Internal
         inline const VulkanBindingSetPool& GetVulkanBindingSetPool() const { return m_Pool; }
 
         inline VkDescriptorSet GetVkDescriptorSet() const { return m_DescriptorSet; }
+        inline VkDeviceSize GetDescriptorOffset() const { return m_DescriptorOffset; } // Note: Offset into the device's VulkanDescriptorHeap, only used with descriptor buffers
 
     private:
         // Private methods
-        void UploadImage(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorImageInfo>& imageInfos, Image& image, const ImageSubresourceSpecification& subresources, ResourceType resourceType, uint32_t slot, uint32_t arrayIndex) const;
-        void UploadSampler(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorImageInfo>& imageInfos, Sampler& sampler, ResourceType resourceType, uint32_t slot, uint32_t arrayIndex) const;
-        void UploadBuffer(std::vector<VkWriteDescriptorSet>& writes, std::vector<VkDescriptorBufferInfo>& bufferInfos, Buffer& buffer, const BufferRange& range, ResourceType resourceType, uint32_t slot, uint32_t arrayIndex) const;
+        void WriteDescriptor(const BindingSetItem& item) const; // Note: Writes straight into the descriptor heap
+        void WriteImmutableSamplers() const; // Note: Descriptor buffers still need the immutable samplers written into the heap
+        bool WriteTemplate(std::span<const BindingSetItem> items) const; // Note: Returns false when the items don't cover the full layout exactly once
+        void WriteInfo(const BindingSetItem& item, const BindingLayoutItem& layoutItem, VulkanDescriptorInfo& info) const;
     
     private:
         VulkanBindingSetPool& m_Pool;
         BindingSetSpecification m_Specification;
 
         VkDescriptorSet m_DescriptorSet = VK_NULL_HANDLE;
+        VkDeviceSize m_DescriptorOffset = 0;
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -129,11 +215,16 @@ namespace Obsidian::Internal
 
         // Internal methods
         VkDescriptorSet CreateDescriptorSet();
+        VkDeviceSize CreateDescriptorOffset(); // Note: Used instead of CreateDescriptorSet with descriptor buffers
 
         // Internal getters
         inline const VulkanDevice& GetVulkanDevice() const { return m_Device; }
 
+        inline bool UsesDescriptorBuffer() const { return (m_DescriptorPool == VK_NULL_HANDLE); }
+
         inline VkDescriptorPool GetVkDescriptorPool() const { return m_DescriptorPool; }
+        inline VkDeviceSize GetDescriptorOffset() const { return m_DescriptorOffset; }
+        inline VkDeviceSize GetDescriptorRangeSize() const { return m_DescriptorRangeSize; }
 
     private:
         const VulkanDevice& m_Device;
@@ -141,6 +232,9 @@ namespace Obsidian::Internal
 
         VkDescriptorPool m_DescriptorPool = VK_NULL_HANDLE;
 
+        VkDeviceSize m_DescriptorOffset = 0; // Note: The range of the descriptor heap that holds all sets, only used with descriptor buffers
+        VkDeviceSize m_DescriptorRangeSize = 0;
+
         uint32_t m_CurrentDescriptor = 0;
         std::vector<VkDescriptorSet> m_DescriptorSets;
     };
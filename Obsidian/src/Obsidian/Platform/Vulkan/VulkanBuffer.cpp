@@ -17,7 +17,7 @@ namespace Obsidian::Internal
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
     VulkanInputLayout::VulkanInputLayout(const Device& device, std::span<const VertexAttributeSpecification> attributes)
-        : m_Attributes(attributes.begin(), attributes.end())
+        : m_Attributes(attributes.begin(), attributes.end()), m_AttributesHash(HashVertexAttributes(attributes))
     {
         (void)device;
 
@@ -153,6 +153,11 @@ namespace Obsidian::Internal
                 bufferUsage |= VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
                 m_Alignment = std::max(m_Alignment, static_cast<size_t>(FormatToFormatInfo(m_Specification.BufferFormat).BytesPerBlock));
             }
+            if (m_Specification.IsIndirectArgument)
+            {
+                bufferUsage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+                m_Alignment = std::max(m_Alignment, static_cast<size_t>(4ull));
+            }
             if (m_Specification.IsUniformBuffer && m_Specification.IsTexel)
             {
                 bufferUsage |= VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT;
@@ -185,6 +190,11 @@ namespace Obsidian::Internal
             OB_ASSERT(((m_Alignment & (m_Alignment - 1)) == 0), "[VkBuffer] Internal error: Alignment must be a power of 2.");
         }
 
+        // Note: Descriptor buffers reference buffers by their device address
+        const bool needsAddress = (vulkanDevice.GetContext().UsesDescriptorBuffers() && (bufferUsage & (VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)));
+        if (needsAddress)
+            bufferUsage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
         // Size helper
         {
             if (m_Specification.IsDynamic)
@@ -210,7 +220,27 @@ namespace Obsidian::Internal
                 m_Specification.Size = (m_Specification.Size + m_Alignment - 1) & ~(m_Alignment - 1);
         }
 
-        m_Allocation = vulkanDevice.GetAllocator().AllocateBuffer(memoryUsage, m_Buffer, m_Specification.Size, bufferUsage, 0);
+        if (m_Specification.IsPersistentlyMapped)
+        {
+            OB_ASSERT(static_cast<bool>(m_Specification.CpuAccess & CpuAccessMode::Write), "[VkBuffer] A persistently mapped buffer must have the CpuAccessMode::Write flag.");
+            m_Allocation = vulkanDevice.GetAllocator().AllocateMappedBuffer(memoryUsage, m_Buffer, m_Specification.Size, bufferUsage, m_MappedMemory, 0);
+        }
+        else
+        {
+            m_Allocation = vulkanDevice.GetAllocator().AllocateBuffer(memoryUsage, m_Buffer, m_Specification.Size, bufferUsage, 0);
+        }
+
+        if (memoryUsage != VMA_MEMORY_USAGE_GPU_ONLY)
+            m_IsHostCoherent = vulkanDevice.GetAllocator().IsHostCoherent(m_Allocation);
+
+        if (needsAddress)
+        {
+            VkBufferDeviceAddressInfo addressInfo = {};
+            addressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+            addressInfo.buffer = m_Buffer;
+
+            m_DeviceAddress = vkGetBufferDeviceAddress(vulkanDevice.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &addressInfo);
+        }
 
         if constexpr (Information::Validation)
         {
@@ -34,6 +34,9 @@ namespace Obsidian::Internal
         VulkanInputLayout(const Device& device, std::span<const VertexAttributeSpecification> attributes);
         ~VulkanInputLayout();
 
+        // Getters
+        inline size_t GetAttributesHash() const { return m_AttributesHash; }
+
         // Internal getters
         inline uint32_t GetStride() const { return m_Stride; }
         inline const std::vector<VkVertexInputBindingDescription>& GetBindingDescriptions() const { return m_BindingDescriptions; }
@@ -45,6 +48,7 @@ namespace Obsidian::Internal
 
     private:
         std::vector<VertexAttributeSpecification> m_Attributes;
+        size_t m_AttributesHash = 0;
 
         uint32_t m_Stride = 0;
 
@@ -70,6 +74,10 @@ namespace Obsidian::Internal
         // Internal getters
         inline VkBuffer GetVkBuffer() const { return m_Buffer; }
         inline VmaAllocation GetVmaAllocation() const { return m_Allocation; }
+        inline VkDeviceAddress GetVkDeviceAddress() const { return m_DeviceAddress; } // Note: Only retrieved for uniform/storage buffers when descriptor buffers are in use
+
+        inline void* GetMappedMemory() const { return m_MappedMemory; } // Note: Is nullptr when the buffer isn't persistently mapped
+        inline bool IsHostCoherent() const { return m_IsHostCoherent; }
 
     private:
         BufferSpecification m_Specification;
@@ -77,6 +85,10 @@ namespace Obsidian::Internal
 
         VkBuffer m_Buffer = VK_NULL_HANDLE;
         VmaAllocation m_Allocation = VK_NULL_HANDLE;
+        VkDeviceAddress m_DeviceAddress = 0;
+
+        void* m_MappedMemory = nullptr;
+        bool m_IsHostCoherent = true;
 
         // Note: Maybe in the future add BufferViews like ImageViews
     };
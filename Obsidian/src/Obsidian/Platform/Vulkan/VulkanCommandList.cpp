@@ -8,33 +8,42 @@
 #include "Obsidian/Renderer/CommandList.hpp"
 #include "Obsidian/Renderer/Swapchain.hpp"
 #include "Obsidian/Renderer/Pipeline.hpp"
+#include "Obsidian/Renderer/QueryPool.hpp"
 
 #include "Obsidian/Platform/Vulkan/VulkanDevice.hpp"
 #include "Obsidian/Platform/Vulkan/VulkanPipeline.hpp"
 
+#include <algorithm>
+
 namespace Obsidian::Internal
 {
 
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
-    VulkanCommandListPool::VulkanCommandListPool(Swapchain& swapchain, const CommandListPoolSpecification& specs)
-        : m_Swapchain(*api_cast<VulkanSwapchain*>(&swapchain)), m_Specification(specs)
+    VulkanCommandListPool::VulkanCommandListPool(const Device& device, const CommandListPoolSpecification& specs)
+        : m_Device(*api_cast<const VulkanDevice*>(&device)), m_Specification(specs)
     {
         VkCommandPoolCreateInfo poolInfo = {};
         poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
         poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT; // Note: Allows us to reset the command buffer and reuse it.
-        poolInfo.queueFamilyIndex = m_Swapchain.GetVulkanDevice().GetContext().GetVulkanPhysicalDevice().GetQueueFamilyIndices().QueueFamily;
+        poolInfo.queueFamilyIndex = m_Device.GetContext().GetVulkanPhysicalDevice().GetQueueFamilyIndices().GetQueueFamily(m_Specification.Queue);
         
-        VK_VERIFY(vkCreateCommandPool(m_Swapchain.GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkDevice(), &poolInfo, VulkanAllocator::GetCallbacks(), &m_CommandPool));
+        VK_VERIFY(vkCreateCommandPool(m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &poolInfo, VulkanAllocator::GetCallbacks(), &m_CommandPool));
 
         if constexpr (Information::Validation)
         {
             if (!m_Specification.DebugName.empty())
-                m_Swapchain.GetVulkanDevice().GetContext().SetDebugName(m_CommandPool, VK_OBJECT_TYPE_COMMAND_POOL, std::string(m_Specification.DebugName));
+                m_Device.GetContext().SetDebugName(m_CommandPool, VK_OBJECT_TYPE_COMMAND_POOL, std::string(m_Specification.DebugName));
         }
     }
 
+    VulkanCommandListPool::VulkanCommandListPool(Swapchain& swapchain, const CommandListPoolSpecification& specs)
+        : VulkanCommandListPool(*api_cast<const Device*>(&api_cast<VulkanSwapchain*>(&swapchain)->GetVulkanDevice()), specs)
+    {
+        m_Swapchain = api_cast<VulkanSwapchain*>(&swapchain);
+    }
+
     VulkanCommandListPool::~VulkanCommandListPool()
     {
     }
@@ -44,11 +53,11 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     void VulkanCommandListPool::FreeList(CommandList& list) const
     {
-        const VulkanContext& context = m_Swapchain.GetVulkanDevice().GetContext();
+        const VulkanContext& context = m_Device.GetContext();
 
         VkDevice device = context.GetVulkanLogicalDevice().GetVkDevice();
         VkCommandBuffer commandBuffer = (*api_cast<VulkanCommandList*>(&list)).GetVkCommandBuffer();
-        m_Swapchain.GetVulkanDevice().GetContext().Destroy([device, commandPool = m_CommandPool, commandBuffer]() mutable
+        m_Device.GetContext().Destroy([device, commandPool = m_CommandPool, commandBuffer]() mutable
         { 
             vkFreeCommandBuffers(device, commandPool, 1ul, &commandBuffer);
         });
@@ -60,13 +69,10 @@ namespace Obsidian::Internal
         commandBuffers.reserve(lists.size());
 
         for (auto list : lists)
-        {
-            VkCommandBuffer commandBuffer = (*api_cast<VulkanCommandList*>(list)).GetVkCommandBuffer();
-            commandBuffers.push_back(commandBuffer);
-        }
+            commandBuffers.push_back((*api_cast<VulkanCommandList*>(list)).GetVkCommandBuffer());
 
-        VkDevice device = m_Swapchain.GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkDevice();
-        m_Swapchain.GetVulkanDevice().GetContext().Destroy([device, commandPool = m_CommandPool, commandBuffers = std::move(commandBuffers)]() mutable
+        VkDevice device = m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice();
+        m_Device.GetContext().Destroy([device, commandPool = m_CommandPool, commandBuffers = std::move(commandBuffers)]() mutable
         {
             vkFreeCommandBuffers(device, commandPool, static_cast<uint32_t>(commandBuffers.size()), commandBuffers.data());
         });
@@ -74,14 +80,23 @@ namespace Obsidian::Internal
 
     void VulkanCommandListPool::Reset() const
     {
-        vkResetCommandPool(m_Swapchain.GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkDevice(), m_CommandPool, 0);
+        vkResetCommandPool(m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), m_CommandPool, 0);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Internal getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    VulkanSwapchain& VulkanCommandListPool::GetVulkanSwapchain() const
+    {
+        OB_ASSERT(m_Swapchain, "[VkCommandListPool] CommandListPool was not allocated from a Swapchain, so there's no Swapchain to retrieve.");
+        return *m_Swapchain;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
     VulkanCommandList::VulkanCommandList(CommandListPool& pool, const CommandListSpecification& specs)
-        : m_Pool(*api_cast<VulkanCommandListPool*>(&pool)), m_Specification(specs)
+        : m_Pool(*api_cast<VulkanCommandListPool*>(&pool)), m_Specification(specs), m_StateTracker(m_Pool.GetVulkanDevice().GetTracker())
     {
         VkCommandBufferAllocateInfo allocInfo = {};
         allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -89,12 +104,12 @@ namespace Obsidian::Internal
         allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
         allocInfo.commandBufferCount = 1;
 
-        VK_VERIFY(vkAllocateCommandBuffers(m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkDevice(), &allocInfo, &m_CommandBuffer));
+        VK_VERIFY(vkAllocateCommandBuffers(m_Pool.GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkDevice(), &allocInfo, &m_CommandBuffer));
 
         if constexpr (Information::Validation)
         {
             if (!m_Specification.DebugName.empty())
-                m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetContext().SetDebugName(m_CommandBuffer, VK_OBJECT_TYPE_COMMAND_BUFFER, std::format("CommandList \"{0}\" from: {1}", m_Specification.DebugName, m_Pool.GetSpecification().DebugName));
+                m_Pool.GetVulkanDevice().GetContext().SetDebugName(m_CommandBuffer, VK_OBJECT_TYPE_COMMAND_BUFFER, std::format("CommandList \"{0}\" from: {1}", m_Specification.DebugName, m_Pool.GetSpecification().DebugName));
         }
     }
 
@@ -109,6 +124,10 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("VulkanCommandList::Open()");
         m_WaitStage = VK_PIPELINE_STAGE_2_NONE;
+        m_StateTracker.Reset();
+        m_DescriptorHeapBound = false;
+        m_InsideRenderpass = false;
+        m_BoundSetLayouts = { };
 
         {
             OB_PROFILE("VulkanCommandList::Open::Begin");
@@ -116,11 +135,18 @@ namespace Obsidian::Internal
             beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
             VK_VERIFY(vkBeginCommandBuffer(m_CommandBuffer, &beginInfo));
         }
+
+        OB_PROFILE_GPU_COLLECT(m_Pool.GetVulkanDevice().GetTracyContext(m_Pool.GetSpecification().Queue), m_CommandBuffer); // Note: Has to be outside of a renderpass
     }
 
     void VulkanCommandList::Close()
     {
         OB_PROFILE("VulkanCommandList::Close()");
+
+#if OB_GPU_PROFILING_ENABLED
+        m_RenderpassZone.reset();
+#endif
+
         VK_VERIFY(vkEndCommandBuffer(m_CommandBuffer));
 
         m_CurrentGraphicsPipeline = nullptr;
@@ -131,86 +157,17 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("VulkanCommandBuffer::Submit()");
 
-        VulkanSwapchain& swapchain = m_Pool.GetVulkanSwapchain();
-
-        std::span<const CommandList*> waitOn;
-        std::visit([&](auto&& arg)
-        {
-            if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, std::vector<const CommandList*>>)
-                waitOn = const_cast<std::vector<const CommandList*>&>(arg); // Note: This is worst thing I have done in my life. I can never recover.
-            else if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, std::span<const CommandList*>>)
-                waitOn = arg;
-        }, args.WaitOnLists);
-
-        std::vector<VkSemaphoreSubmitInfo> waitInfos;
-        waitInfos.reserve(waitOn.size() + (args.WaitForSwapchainImage ? 1ull : 0ull));
-
-        // Wait semaphores
-        if (args.WaitForSwapchainImage)
-        {
-            VkSemaphoreSubmitInfo& info = waitInfos.emplace_back();
-            info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-            info.semaphore = swapchain.GetVkImageAvailableSemaphore(swapchain.GetCurrentFrame());
-            info.stageMask = (m_WaitStage == VK_PIPELINE_STAGE_2_NONE ? VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT : m_WaitStage);
-            info.value = 0ull;
-        }
-        for (const CommandList* list : waitOn)
-        {
-            VkSemaphoreSubmitInfo& info = waitInfos.emplace_back();
-            info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-            info.semaphore = swapchain.GetVkTimelineSemaphore();
-            info.stageMask = m_WaitStage;
-            info.value = swapchain.GetPreviousCommandListWaitValue(*api_cast<const VulkanCommandList*>(list));
-        }
-
-        // Signal semaphores
-        std::vector<VkSemaphoreSubmitInfo> signalInfos;
-        signalInfos.reserve(1ull + (args.OnFinishMakeSwapchainPresentable ? 1ull : 0ull));
-
-        VkSemaphoreSubmitInfo& timelineInfo = signalInfos.emplace_back();
-        timelineInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-        timelineInfo.semaphore = swapchain.GetVkTimelineSemaphore();
-        timelineInfo.value = swapchain.RetrieveCommandListWaitValue(*this);
-
-        if (args.OnFinishMakeSwapchainPresentable)
-        {
-            VkSemaphoreSubmitInfo& info = signalInfos.emplace_back();
-            info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-            info.semaphore = swapchain.GetVkSwapchainPresentableSemaphore(swapchain.GetAcquiredImage());
-            info.stageMask = m_WaitStage;
-            info.value = 0ull;
-        }
-
-        // Command info
-        VkCommandBufferSubmitInfo commandInfo = {};
-        commandInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
-        commandInfo.commandBuffer = m_CommandBuffer;
-
-        // Submit info
-        VkSubmitInfo2 submitInfo = {};
-        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
-
-        submitInfo.waitSemaphoreInfoCount = static_cast<uint32_t>(waitInfos.size());
-        submitInfo.pWaitSemaphoreInfos = waitInfos.data();
-
-        submitInfo.commandBufferInfoCount = 1ul;
-        submitInfo.pCommandBufferInfos = &commandInfo;
-
-        submitInfo.signalSemaphoreInfoCount = static_cast<uint32_t>(signalInfos.size());
-        submitInfo.pSignalSemaphoreInfos = signalInfos.data();
-        
-#if defined(OB_PLATFORM_APPLE)
-        VK_VERIFY(VkExtension::g_vkQueueSubmit2KHR(m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkQueue(args.Queue), 1, &submitInfo, nullptr));
-#else
-        VK_VERIFY(vkQueueSubmit2(m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkQueue(m_Pool.GetSpecification().Queue), 1, &submitInfo, nullptr));
-#endif
+        CommandList* list = api_cast<CommandList*>(this);
+        m_Pool.GetVulkanDevice().Submit(std::span<CommandList*>(&list, 1), args);
     }
 
     void VulkanCommandList::WaitTillComplete() const
     {
         OB_PROFILE("VulkanCommandList::WaitTillComplete()");
-        VkSemaphore semaphore = m_Pool.GetVulkanSwapchain().GetVkTimelineSemaphore();
-        uint64_t value = m_Pool.GetVulkanSwapchain().GetPreviousCommandListWaitValue(*this);
+        OB_ASSERT((m_SignaledValue != 0), "[VkCommandList] CommandList has not been submitted yet.");
+
+        VkSemaphore semaphore = m_Pool.GetVulkanDevice().GetVkTimelineSemaphore(GetSignaledQueue());
+        uint64_t value = m_SignaledValue;
 
         VkSemaphoreWaitInfo waitInfo = {};
         waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
@@ -218,89 +175,20 @@ namespace Obsidian::Internal
         waitInfo.pSemaphores = &semaphore;
         waitInfo.pValues = &value;
 
-        vkWaitSemaphores(m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkDevice(), &waitInfo, std::numeric_limits<uint64_t>::max());
+        vkWaitSemaphores(m_Pool.GetVulkanDevice().GetContext().GetVulkanLogicalDevice().GetVkDevice(), &waitInfo, std::numeric_limits<uint64_t>::max());
     }
 
     void VulkanCommandList::CommitBarriers()
     {
         OB_PROFILE("VulkanCommandList::CommitBarriers()");
 
-        auto& imageBarriers = m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().GetImageBarriers(*api_cast<const CommandList*>(this));
-        auto& bufferBarriers = m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().GetBufferBarriers(*api_cast<const CommandList*>(this));
+        auto& imageBarriers = m_StateTracker.GetImageBarriers();
+        auto& bufferBarriers = m_StateTracker.GetBufferBarriers();
 
         if (imageBarriers.empty() && bufferBarriers.empty())
             return;
 
-        std::vector<VkImageMemoryBarrier2> vkImageBarriers;
-        vkImageBarriers.reserve(imageBarriers.size());
-        std::vector<VkBufferMemoryBarrier2> vkBufferBarriers;
-        vkBufferBarriers.reserve(bufferBarriers.size());
-
-        for (const ImageBarrier& imageBarrier : imageBarriers)
-        {
-            const ResourceStateMapping& before = ResourceStateToMapping(imageBarrier.StateBefore);
-            const ResourceStateMapping& after = ResourceStateToMapping(imageBarrier.StateAfter);
-
-            OB_ASSERT((after.ImageLayout != VK_IMAGE_LAYOUT_UNDEFINED), "[VkCommandList] Can't transition to undefined layout.");
-
-            Image& image = *imageBarrier.ImagePtr;
-            VulkanImage& vulkanImage = *api_cast<VulkanImage*>(imageBarrier.ImagePtr);
-
-            VkImageMemoryBarrier2& barrier2 = vkImageBarriers.emplace_back();
-            barrier2.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
-            barrier2.srcStageMask = before.StageFlags;
-            barrier2.dstStageMask = after.StageFlags;
-            barrier2.srcAccessMask = before.AccessMask;
-            barrier2.dstAccessMask = after.AccessMask;
-            barrier2.oldLayout = before.ImageLayout;
-            barrier2.newLayout = after.ImageLayout;
-            barrier2.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier2.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier2.image = vulkanImage.GetVkImage();
-
-            barrier2.subresourceRange.aspectMask = VkFormatToImageAspect(FormatToVkFormat(image.GetSpecification().ImageFormat));
-            barrier2.subresourceRange.baseMipLevel = (imageBarrier.EntireTexture ? 0 : imageBarrier.ImageMipLevel);
-            barrier2.subresourceRange.levelCount = (imageBarrier.EntireTexture ? image.GetSpecification().MipLevels : 1);
-            barrier2.subresourceRange.baseArrayLayer = (imageBarrier.EntireTexture ? 0 : imageBarrier.ImageArraySlice);
-            barrier2.subresourceRange.layerCount = (imageBarrier.EntireTexture ? image.GetSpecification().ArraySize : 1);
-        }
-
-        for (const BufferBarrier& bufferBarrier : bufferBarriers)
-        {
-            const ResourceStateMapping& before = ResourceStateToMapping(bufferBarrier.StateBefore);
-            const ResourceStateMapping& after = ResourceStateToMapping(bufferBarrier.StateAfter);
-
-            Buffer& buffer = *bufferBarrier.BufferPtr;
-            VulkanBuffer& vulkanBuffer = *api_cast<VulkanBuffer*>(&buffer);
-
-            VkBufferMemoryBarrier2& barrier2 = vkBufferBarriers.emplace_back();
-            barrier2.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
-            barrier2.srcStageMask = before.StageFlags;
-            barrier2.dstStageMask = after.StageFlags;
-            barrier2.srcAccessMask = before.AccessMask;
-            barrier2.dstAccessMask = after.AccessMask;
-            barrier2.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier2.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            barrier2.buffer = vulkanBuffer.GetVkBuffer();
-            barrier2.offset = 0;
-            barrier2.size = buffer.GetSpecification().Size;
-        }
-
-        if (!vkImageBarriers.empty() || !vkBufferBarriers.empty())
-        {
-            VkDependencyInfo dependencyInfo = {};
-            dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
-            dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(vkBufferBarriers.size());
-            dependencyInfo.pBufferMemoryBarriers = vkBufferBarriers.data();
-            dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(vkImageBarriers.size());
-            dependencyInfo.pImageMemoryBarriers = vkImageBarriers.data();
-
-#if defined(OB_PLATFORM_APPLE)
-            VkExtension::g_vkCmdPipelineBarrier2KHR(m_CommandBuffer, &dependencyInfo);
-#else
-            vkCmdPipelineBarrier2(m_CommandBuffer, &dependencyInfo);
-#endif
-        }
+        RecordBarriers(m_CommandBuffer, imageBarriers, bufferBarriers);
 
         bufferBarriers.clear();
         imageBarriers.clear();
@@ -313,7 +201,12 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("VulkanCommandList::StartRenderpass()");
 
-        OB_ASSERT(args.Pass, "[VkCommandList] No Renderpass passed in.");
+        m_InsideRenderpass = true;
+        if (!args.Pass)
+        {
+            StartRendering(args);
+            return;
+        }
 
         // Renderpass
         {
@@ -329,17 +222,29 @@ namespace Obsidian::Internal
             }
             VulkanFramebuffer& vkFramebuffer = *api_cast<VulkanFramebuffer*>(framebuffer);
 
+            const RenderpassSpecification& renderpassSpecs = renderpass.GetSpecification();
+            const FramebufferSpecification& framebufferSpecs = framebuffer->GetSpecification();
+
             // Make sure the attachments are in the begin state
             {
-                if (framebuffer->GetSpecification().ColourAttachment.IsValid() && (renderpass.GetSpecification().ColourImageStartState != ResourceState::Unknown))
+                for (size_t i = 0; i < framebufferSpecs.ColourAttachments.size(); i++)
                 {
-                    const FramebufferAttachment& attachment = framebuffer->GetSpecification().ColourAttachment;
-                    RequireState(*attachment.ImagePtr, attachment.Subresources, renderpass.GetSpecification().ColourImageStartState);
+                    const FramebufferAttachment& attachment = framebufferSpecs.ColourAttachments[i];
+                    if (attachment.IsValid() && (renderpassSpecs.ColourAttachments[i].StartState != ResourceState::Unknown))
+                        RequireState(*attachment.ImagePtr, attachment.Subresources, renderpassSpecs.ColourAttachments[i].StartState);
                 }
-                if (framebuffer->GetSpecification().DepthAttachment.IsValid() && (renderpass.GetSpecification().DepthImageStartState != ResourceState::Unknown))
+                for (size_t i = 0; i < renderpassSpecs.ColourAttachments.size(); i++)
                 {
-                    const FramebufferAttachment& attachment = framebuffer->GetSpecification().DepthAttachment;
-                    RequireState(*attachment.ImagePtr, attachment.Subresources, renderpass.GetSpecification().DepthImageStartState);
+                    if (!renderpassSpecs.ColourAttachments[i].HasResolve())
+                        continue;
+
+                    const FramebufferAttachment& attachment = framebufferSpecs.ResolveAttachments[i];
+                    RequireState(*attachment.ImagePtr, attachment.Subresources, ResourceState::ResolveDst);
+                }
+                if (framebufferSpecs.DepthAttachment.IsValid() && (renderpassSpecs.DepthAttachment.StartState != ResourceState::Unknown))
+                {
+                    const FramebufferAttachment& attachment = framebufferSpecs.DepthAttachment;
+                    RequireState(*attachment.ImagePtr, attachment.Subresources, renderpassSpecs.DepthAttachment.StartState);
                 }
                 CommitBarriers();
             }
@@ -351,11 +256,16 @@ namespace Obsidian::Internal
             renderpassInfo.renderArea.offset = { 0, 0 };
             renderpassInfo.renderArea.extent = { static_cast<uint32_t>(args.ViewportState.GetWidth()), static_cast<uint32_t>(args.ViewportState.GetHeight()) };
 
-            // Clear values
-            Nano::Memory::StaticVector<VkClearValue, 2> clearValues;
-            if (vkFramebuffer.GetSpecification().ColourAttachment.IsValid())
+            // Clear values // Note: Must follow the attachment order of the renderpass (colour, resolve, depth)
+            Nano::Memory::StaticVector<VkClearValue, (Information::MaxColourAttachments * 2) + 1> clearValues;
+            for (size_t i = 0; i < framebufferSpecs.ColourAttachments.size(); i++)
                 clearValues.push_back(VkClearValue({ args.ColourClear.r, args.ColourClear.g, args.ColourClear.b, args.ColourClear.a }));
-            if (vkFramebuffer.GetSpecification().DepthAttachment.IsValid())
+            for (size_t i = 0; i < renderpassSpecs.ColourAttachments.size(); i++)
+            {
+                if (renderpassSpecs.ColourAttachments[i].HasResolve())
+                    clearValues.push_back(VkClearValue({ 0.0f, 0.0f, 0.0f, 0.0f })); // Note: Unused, resolve attachments are never cleared
+            }
+            if (framebufferSpecs.DepthAttachment.IsValid())
                 clearValues.push_back(VkClearValue({ args.DepthClear, 0 }));
 
             renderpassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
@@ -365,6 +275,13 @@ namespace Obsidian::Internal
             subpassInfo.sType = VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO;
             subpassInfo.contents = VK_SUBPASS_CONTENTS_INLINE;
 
+#if OB_GPU_PROFILING_ENABLED
+            {
+                const std::string& name = (renderpass.GetSpecification().DebugName.empty() ? std::string("Renderpass") : renderpass.GetSpecification().DebugName);
+                m_RenderpassZone.emplace(m_Pool.GetVulkanDevice().GetTracyContext(m_Pool.GetSpecification().Queue), static_cast<uint32_t>(__LINE__), __FILE__, sizeof(__FILE__) - 1, __FUNCTION__, sizeof(__FUNCTION__) - 1, name.c_str(), name.size(), m_CommandBuffer, true);
+            }
+#endif
+
             {
                 OB_PROFILE("VulkanCommandList::StartRenderpass::Begin");
                 vkCmdBeginRenderPass2(m_CommandBuffer, &renderpassInfo, &subpassInfo);
@@ -379,11 +296,22 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("VulkanCommandList::EndRenderpass()");
 
+        m_InsideRenderpass = false;
+        if (m_DynamicRendering)
+        {
+            EndRendering();
+            return;
+        }
+
         VkSubpassEndInfo endInfo = {};
         endInfo.sType = VK_STRUCTURE_TYPE_SUBPASS_END_INFO;
 
         vkCmdEndRenderPass2(m_CommandBuffer, &endInfo);
 
+#if OB_GPU_PROFILING_ENABLED
+        m_RenderpassZone.reset();
+#endif
+
         // Refresh StateTrackers internal states to reflect the end states
         {
             VulkanRenderpass& renderpass = *api_cast<VulkanRenderpass*>(args.Pass);
@@ -395,17 +323,29 @@ namespace Obsidian::Internal
                 framebuffer = &renderpass.GetFramebuffer(static_cast<uint8_t>(m_Pool.GetVulkanSwapchain().GetAcquiredImage()));
             }
 
+            const RenderpassSpecification& renderpassSpecs = renderpass.GetSpecification();
+            const FramebufferSpecification& framebufferSpecs = framebuffer->GetSpecification();
+
             // Set the internal tracking state to reflect the actual end state
             {
-                if (framebuffer->GetSpecification().ColourAttachment.IsValid())
+                for (size_t i = 0; i < framebufferSpecs.ColourAttachments.size(); i++)
+                {
+                    const FramebufferAttachment& attachment = framebufferSpecs.ColourAttachments[i];
+                    if (attachment.IsValid())
+                        m_StateTracker.SetImageState(*attachment.ImagePtr, attachment.Subresources, renderpassSpecs.ColourAttachments[i].EndState);
+                }
+                for (size_t i = 0; i < renderpassSpecs.ColourAttachments.size(); i++)
                 {
-                    const FramebufferAttachment& attachment = framebuffer->GetSpecification().ColourAttachment;
-                    m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().SetImageState(*attachment.ImagePtr, attachment.Subresources, renderpass.GetSpecification().ColourImageEndState);
+                    if (!renderpassSpecs.ColourAttachments[i].HasResolve())
+                        continue;
+
+                    const FramebufferAttachment& attachment = framebufferSpecs.ResolveAttachments[i];
+                    m_StateTracker.SetImageState(*attachment.ImagePtr, attachment.Subresources, renderpassSpecs.ColourAttachments[i].ResolveEndState);
                 }
-                if (framebuffer->GetSpecification().DepthAttachment.IsValid())
+                if (framebufferSpecs.DepthAttachment.IsValid())
                 {
-                    const FramebufferAttachment& attachment = framebuffer->GetSpecification().DepthAttachment;
-                    m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().SetImageState(*attachment.ImagePtr, attachment.Subresources, renderpass.GetSpecification().DepthImageEndState);
+                    const FramebufferAttachment& attachment = framebufferSpecs.DepthAttachment;
+                    m_StateTracker.SetImageState(*attachment.ImagePtr, attachment.Subresources, renderpassSpecs.DepthAttachment.EndState);
                 }
             }
         }
@@ -471,12 +411,22 @@ namespace Obsidian::Internal
         }
         else
         {
-            layout = api_cast<const VulkanGraphicsPipeline*>(m_CurrentComputePipeline)->GetVkPipelineLayout();
+            layout = api_cast<const VulkanComputePipeline*>(m_CurrentComputePipeline)->GetVkPipelineLayout();
             bindPoint = VK_PIPELINE_BIND_POINT_COMPUTE;
         }
 
         const VulkanBindingSet& vkSet = *api_cast<const VulkanBindingSet*>(&set);
         VulkanBindingLayout& vkLayout = *api_cast<VulkanBindingLayout*>(vkSet.GetVulkanBindingSetPool().GetSpecification().Layout);
+
+        if (TrackBoundSet(bindPoint, layout, vkLayout.GetRegisterSpace(), (dynamicOffsets.empty() ? &set : nullptr)))
+            return;
+
+        if (m_Pool.GetVulkanDevice().GetContext().UsesDescriptorBuffers())
+        {
+            SetDescriptorOffset(bindPoint, layout, vkLayout.GetRegisterSpace(), set);
+            return;
+        }
+
         VkDescriptorSet descriptorSet = vkSet.GetVkDescriptorSet();
 
         vkCmdBindDescriptorSets(m_CommandBuffer, bindPoint, layout, vkLayout.GetRegisterSpace(), 1, &descriptorSet, static_cast<uint32_t>(dynamicOffsets.size()), dynamicOffsets.data());
@@ -498,10 +448,26 @@ namespace Obsidian::Internal
         }
         else
         {
-            layout = api_cast<const VulkanGraphicsPipeline*>(m_CurrentComputePipeline)->GetVkPipelineLayout();
+            layout = api_cast<const VulkanComputePipeline*>(m_CurrentComputePipeline)->GetVkPipelineLayout();
             bindPoint = VK_PIPELINE_BIND_POINT_COMPUTE;
         }
 
+        for (size_t i = 0; i < sets.size(); i++)
+        {
+            if (sets[i])
+                TrackBoundSet(bindPoint, layout, static_cast<uint32_t>(i), (dynamicOffsets.empty() ? sets[i] : nullptr));
+        }
+
+        if (m_Pool.GetVulkanDevice().GetContext().UsesDescriptorBuffers())
+        {
+            for (size_t i = 0; i < sets.size(); i++)
+            {
+                if (sets[i])
+                    SetDescriptorOffset(bindPoint, layout, static_cast<uint32_t>(i), *sets[i]);
+            }
+            return;
+        }
+
         // Note: This corresponds to SetID               Sets               DynamicOffsets
         std::vector<std::tuple<uint32_t, std::vector<VkDescriptorSet>, std::span<const uint32_t>>> descriptorSetsSet;
         std::get<std::vector<VkDescriptorSet>>(descriptorSetsSet.emplace_back()).reserve(sets.size());
@@ -562,9 +528,10 @@ namespace Obsidian::Internal
     void VulkanCommandList::CopyImage(Image& dst, const ImageSliceSpecification& dstSlice, Image& src, const ImageSliceSpecification& srcSlice)
     {
         OB_PROFILE("VulkanCommandList::CopyImage()");
+        OB_PROFILE_GPU(m_Pool.GetVulkanDevice().GetTracyContext(m_Pool.GetSpecification().Queue), m_CommandBuffer, "CopyImage");
 
-        OB_ASSERT(m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().Contains(dst), "[VkCommandList] Using an untracked image is not allowed, call StartTracking() on dst image.");
-        OB_ASSERT(m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().Contains(src), "[VkCommandList] Using an untracked image is not allowed, call StartTracking() on src image.");
+        OB_ASSERT(m_Pool.GetVulkanDevice().GetTracker().Contains(dst), "[VkCommandList] Using an untracked image is not allowed, call StartTracking() on dst image.");
+        OB_ASSERT(m_Pool.GetVulkanDevice().GetTracker().Contains(src), "[VkCommandList] Using an untracked image is not allowed, call StartTracking() on src image.");
 
         SetWaitStage(VK_PIPELINE_STAGE_2_TRANSFER_BIT);
 
@@ -637,14 +604,15 @@ namespace Obsidian::Internal
 #endif
 
         // Update back to permanent state
-        m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().ResolvePermanentState(*api_cast<const CommandList*>(this), src, srcSubresource);
-        m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().ResolvePermanentState(*api_cast<const CommandList*>(this), dst, dstSubresource);
+        m_StateTracker.ResolvePermanentState(src, srcSubresource);
+        m_StateTracker.ResolvePermanentState(dst, dstSubresource);
         CommitBarriers();
     }
 
     void VulkanCommandList::CopyImage(Image& dst, const ImageSliceSpecification& dstSlice, StagingImage& src, const ImageSliceSpecification& srcSlice)
     {
         OB_PROFILE("VulkanCommandList::CopyImage()");
+        OB_PROFILE_GPU(m_Pool.GetVulkanDevice().GetTracyContext(m_Pool.GetSpecification().Queue), m_CommandBuffer, "CopyImage");
 
         VulkanStagingImage& srcVulkanStagingImage = *api_cast<VulkanStagingImage*>(&src);
         VulkanBuffer& srcVulkanBuffer = api_cast<VulkanStagingImage*>(&src)->GetVulkanBuffer();
@@ -697,14 +665,134 @@ namespace Obsidian::Internal
 #endif
 
         // Update back to permanent state
-        m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().ResolvePermanentState(*api_cast<const CommandList*>(this), *api_cast<Buffer*>(&srcVulkanBuffer));
-        m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().ResolvePermanentState(*api_cast<const CommandList*>(this), dst, dstSubresource);
+        m_StateTracker.ResolvePermanentState(*api_cast<Buffer*>(&srcVulkanBuffer));
+        m_StateTracker.ResolvePermanentState(dst, dstSubresource);
+        CommitBarriers();
+    }
+
+    void VulkanCommandList::CopyImage(StagingImage& dst, const ImageSliceSpecification& dstSlice, Image& src, const ImageSliceSpecification& srcSlice)
+    {
+        OB_PROFILE("VulkanCommandList::CopyImage()");
+        OB_PROFILE_GPU(m_Pool.GetVulkanDevice().GetTracyContext(m_Pool.GetSpecification().Queue), m_CommandBuffer, "CopyImage");
+
+        VulkanStagingImage& dstVulkanStagingImage = *api_cast<VulkanStagingImage*>(&dst);
+        VulkanBuffer& dstVulkanBuffer = api_cast<VulkanStagingImage*>(&dst)->GetVulkanBuffer();
+        VulkanImage& srcVulkanImage = *api_cast<VulkanImage*>(&src);
+
+        ImageSliceSpecification resSrcSlice = ResolveImageSlice(srcSlice, src.GetSpecification());
+        ImageSliceSpecification resDstSlice = ResolveImageSlice(dstSlice, dst.GetSpecification());
+
+        auto dstRegion = dstVulkanStagingImage.GetSliceRegion(resDstSlice.ImageMipLevel, resDstSlice.ImageArraySlice, resDstSlice.Z);
+
+        ImageSubresourceSpecification srcSubresource = ImageSubresourceSpecification(
+            resSrcSlice.ImageMipLevel, 1,
+            resSrcSlice.ImageArraySlice, 1
+        );
+
+        VkBufferImageCopy2 copyInfo = {};
+        copyInfo.sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2;
+        copyInfo.bufferOffset = dstRegion.Offset;
+        copyInfo.bufferRowLength = resDstSlice.Width;
+        copyInfo.bufferImageHeight = resDstSlice.Height;
+
+        copyInfo.imageSubresource.aspectMask = VkFormatToImageAspect(FormatToVkFormat(src.GetSpecification().ImageFormat));
+        copyInfo.imageSubresource.mipLevel = resSrcSlice.ImageMipLevel;
+        copyInfo.imageSubresource.baseArrayLayer = resSrcSlice.ImageArraySlice;
+        copyInfo.imageSubresource.layerCount = 1;
+
+        copyInfo.imageOffset = { resSrcSlice.X, resSrcSlice.Y, resSrcSlice.Z };
+        copyInfo.imageExtent = { resSrcSlice.Width, resSrcSlice.Height, resSrcSlice.Depth };
+
+        RequireState(src, srcSubresource, ResourceState::CopySrc);
+        RequireState(*api_cast<Buffer*>(&dstVulkanBuffer), ResourceState::CopyDst);
+        CommitBarriers();
+
+        VkCopyImageToBufferInfo2 copyImageToBufferInfo = {};
+        copyImageToBufferInfo.sType = VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2;
+        copyImageToBufferInfo.srcImage = srcVulkanImage.GetVkImage();
+        copyImageToBufferInfo.srcImageLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        copyImageToBufferInfo.dstBuffer = dstVulkanBuffer.GetVkBuffer();
+        copyImageToBufferInfo.regionCount = 1;
+        copyImageToBufferInfo.pRegions = &copyInfo;
+
+#if defined(OB_PLATFORM_APPLE)
+        VkExtension::g_vkCmdCopyImageToBuffer2KHR(m_CommandBuffer, &copyImageToBufferInfo);
+#else
+        vkCmdCopyImageToBuffer2(m_CommandBuffer, &copyImageToBufferInfo);
+#endif
+
+        // Update back to permanent state
+        m_StateTracker.ResolvePermanentState(src, srcSubresource);
+        m_StateTracker.ResolvePermanentState(*api_cast<Buffer*>(&dstVulkanBuffer));
+        CommitBarriers();
+    }
+
+    void VulkanCommandList::CopyImage(Buffer& dst, size_t dstOffset, Image& src, const ImageSliceSpecification& srcSlice)
+    {
+        OB_PROFILE("VulkanCommandList::CopyImage()");
+        OB_PROFILE_GPU(m_Pool.GetVulkanDevice().GetTracyContext(m_Pool.GetSpecification().Queue), m_CommandBuffer, "CopyImage");
+
+        VulkanBuffer& dstVulkanBuffer = *api_cast<VulkanBuffer*>(&dst);
+        VulkanImage& srcVulkanImage = *api_cast<VulkanImage*>(&src);
+
+        const ImageSpecification& srcSpec = src.GetSpecification();
+        const FormatInfo& formatInfo = FormatToFormatInfo(srcSpec.ImageFormat);
+
+        ImageSliceSpecification resSrcSlice = ResolveImageSlice(srcSlice, srcSpec);
+        ImageBufferLayout layout = ResolveImageBufferLayout(resSrcSlice, srcSpec);
+
+        OB_ASSERT(((dstOffset % ImageBufferLayout::OffsetAlignment) == 0), "[VkCommandList] Buffer offset must be a multiple of ImageBufferLayout::OffsetAlignment.");
+        OB_ASSERT(((layout.RowPitch % formatInfo.BytesPerBlock) == 0), "[VkCommandList] Row pitch is not a multiple of the format's block size, this format can't be copied into a buffer.");
+        OB_ASSERT((dstOffset + layout.Size <= dst.GetSpecification().Size), "[VkCommandList] Offset + image size exceeds buffer size.");
+
+        ImageSubresourceSpecification srcSubresource = ImageSubresourceSpecification(
+            resSrcSlice.ImageMipLevel, 1,
+            resSrcSlice.ImageArraySlice, 1
+        );
+
+        // Note: Vulkan takes the row length and image height in texels instead of bytes
+        VkBufferImageCopy2 copyInfo = {};
+        copyInfo.sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2;
+        copyInfo.bufferOffset = dstOffset;
+        copyInfo.bufferRowLength = static_cast<uint32_t>(layout.RowPitch / formatInfo.BytesPerBlock) * formatInfo.BlockSize;
+        copyInfo.bufferImageHeight = layout.RowCount * formatInfo.BlockSize;
+
+        copyInfo.imageSubresource.aspectMask = VkFormatToImageAspect(FormatToVkFormat(srcSpec.ImageFormat));
+        copyInfo.imageSubresource.mipLevel = resSrcSlice.ImageMipLevel;
+        copyInfo.imageSubresource.baseArrayLayer = resSrcSlice.ImageArraySlice;
+        copyInfo.imageSubresource.layerCount = 1;
+
+        copyInfo.imageOffset = { resSrcSlice.X, resSrcSlice.Y, resSrcSlice.Z };
+        copyInfo.imageExtent = { resSrcSlice.Width, resSrcSlice.Height, resSrcSlice.Depth };
+
+        RequireState(src, srcSubresource, ResourceState::CopySrc);
+        RequireState(dst, ResourceState::CopyDst);
+        CommitBarriers();
+
+        VkCopyImageToBufferInfo2 copyImageToBufferInfo = {};
+        copyImageToBufferInfo.sType = VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2;
+        copyImageToBufferInfo.srcImage = srcVulkanImage.GetVkImage();
+        copyImageToBufferInfo.srcImageLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        copyImageToBufferInfo.dstBuffer = dstVulkanBuffer.GetVkBuffer();
+        copyImageToBufferInfo.regionCount = 1;
+        copyImageToBufferInfo.pRegions = &copyInfo;
+
+#if defined(OB_PLATFORM_APPLE)
+        VkExtension::g_vkCmdCopyImageToBuffer2KHR(m_CommandBuffer, &copyImageToBufferInfo);
+#else
+        vkCmdCopyImageToBuffer2(m_CommandBuffer, &copyImageToBufferInfo);
+#endif
+
+        // Update back to permanent state
+        m_StateTracker.ResolvePermanentState(src, srcSubresource);
+        m_StateTracker.ResolvePermanentState(dst);
         CommitBarriers();
     }
 
     void VulkanCommandList::CopyBuffer(Buffer& dst, Buffer& src, size_t size, size_t srcOffset, size_t dstOffset)
     {
         OB_PROFILE("VulkanCommandList::CopyBuffer()");
+        OB_PROFILE_GPU(m_Pool.GetVulkanDevice().GetTracyContext(m_Pool.GetSpecification().Queue), m_CommandBuffer, "CopyBuffer");
 
         // Enforce permanent state
         //ResolvePermanentState(src);
@@ -737,28 +825,153 @@ namespace Obsidian::Internal
 #endif
 
         // Update back to permanent state
-        m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().ResolvePermanentState(*api_cast<const CommandList*>(this), src);
-        m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().ResolvePermanentState(*api_cast<const CommandList*>(this), dst);
+        m_StateTracker.ResolvePermanentState(src);
+        m_StateTracker.ResolvePermanentState(dst);
+        CommitBarriers();
+    }
+
+    void VulkanCommandList::GenerateMips(Image& image, const ImageSubresourceSpecification& subresources)
+    {
+        OB_PROFILE("VulkanCommandList::GenerateMips()");
+        OB_PROFILE_GPU(m_Pool.GetVulkanDevice().GetTracyContext(m_Pool.GetSpecification().Queue), m_CommandBuffer, "GenerateMips");
+
+        OB_ASSERT(m_Pool.GetVulkanDevice().GetTracker().Contains(image), "[VkCommandList] Using an untracked image is not allowed, call StartTracking() on image.");
+
+        const ImageSpecification& imageSpec = image.GetSpecification();
+        OB_ASSERT((imageSpec.SampleCount == 1), "[VkCommandList] Can't generate mips for a multisampled image.");
+
+        SetWaitStage(VK_PIPELINE_STAGE_2_TRANSFER_BIT);
+
+        VulkanImage& vulkanImage = *api_cast<VulkanImage*>(&image);
+        ImageSubresourceSpecification resSubresources = ResolveImageSubresource(subresources, imageSpec, false);
+
+        VkImageAspectFlags aspectFlags = GuessSubresourceImageAspectFlags(FormatToVkFormat(imageSpec.ImageFormat), ImageSubresourceViewType::AllAspects);
+        const bool is3D = (imageSpec.Dimension == ImageDimension::Image3D);
+
+        // Note: Every level gets blitted from the previous level, so only the src & dst mips get transitioned
+        for (MipLevel mip = resSubresources.BaseMipLevel + 1; mip < resSubresources.BaseMipLevel + resSubresources.NumMipLevels; mip++)
+        {
+            RequireState(image, ImageSubresourceSpecification(mip - 1, 1, resSubresources.BaseArraySlice, resSubresources.NumArraySlices), ResourceState::CopySrc);
+            RequireState(image, ImageSubresourceSpecification(mip, 1, resSubresources.BaseArraySlice, resSubresources.NumArraySlices), ResourceState::CopyDst);
+            CommitBarriers();
+
+            VkImageBlit2 region = {};
+            region.sType = VK_STRUCTURE_TYPE_IMAGE_BLIT_2;
+            region.srcSubresource.aspectMask = aspectFlags;
+            region.srcSubresource.mipLevel = mip - 1;
+            region.srcSubresource.baseArrayLayer = resSubresources.BaseArraySlice;
+            region.srcSubresource.layerCount = resSubresources.NumArraySlices;
+            region.srcOffsets[1] = { static_cast<int32_t>(std::max(imageSpec.Width >> (mip - 1), 1u)), static_cast<int32_t>(std::max(imageSpec.Height >> (mip - 1), 1u)), (is3D ? static_cast<int32_t>(std::max(imageSpec.Depth >> (mip - 1), 1u)) : 1) };
+
+            region.dstSubresource.aspectMask = aspectFlags;
+            region.dstSubresource.mipLevel = mip;
+            region.dstSubresource.baseArrayLayer = resSubresources.BaseArraySlice;
+            region.dstSubresource.layerCount = resSubresources.NumArraySlices;
+            region.dstOffsets[1] = { static_cast<int32_t>(std::max(imageSpec.Width >> mip, 1u)), static_cast<int32_t>(std::max(imageSpec.Height >> mip, 1u)), (is3D ? static_cast<int32_t>(std::max(imageSpec.Depth >> mip, 1u)) : 1) };
+
+            VkBlitImageInfo2 blitInfo = {};
+            blitInfo.sType = VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2;
+            blitInfo.srcImage = vulkanImage.GetVkImage();
+            blitInfo.srcImageLayout = ResourceStateToImageLayout(ResourceState::CopySrc);
+            blitInfo.dstImage = vulkanImage.GetVkImage();
+            blitInfo.dstImageLayout = ResourceStateToImageLayout(ResourceState::CopyDst);
+            blitInfo.regionCount = 1;
+            blitInfo.pRegions = &region;
+            blitInfo.filter = VK_FILTER_LINEAR;
+
+#if defined(OB_PLATFORM_APPLE)
+            VkExtension::g_vkCmdBlitImage2KHR(m_CommandBuffer, &blitInfo);
+#else
+            vkCmdBlitImage2(m_CommandBuffer, &blitInfo);
+#endif
+        }
+
+        // Update back to permanent state // Note: Resolved per subresource, since every mip can be in a different state
+        for (MipLevel mip = resSubresources.BaseMipLevel; mip < resSubresources.BaseMipLevel + resSubresources.NumMipLevels; mip++)
+        {
+            for (ArraySlice slice = resSubresources.BaseArraySlice; slice < resSubresources.BaseArraySlice + resSubresources.NumArraySlices; slice++)
+                m_StateTracker.ResolvePermanentState(image, ImageSubresourceSpecification(mip, 1, slice, 1));
+        }
         CommitBarriers();
     }
 
     void VulkanCommandList::Dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) const
     {
         OB_PROFILE("VulkanCommandList::Dispatch()");
+        OB_PROFILE_GPU(m_Pool.GetVulkanDevice().GetTracyContext(m_Pool.GetSpecification().Queue), m_CommandBuffer, "Dispatch");
         vkCmdDispatch(m_CommandBuffer, groupsX, groupsY, groupsZ);
     }
 
+    void VulkanCommandList::DispatchIndirect(Buffer& argumentBuffer, size_t offset)
+    {
+        OB_PROFILE("VulkanCommandList::DispatchIndirect()");
+        OB_PROFILE_GPU(m_Pool.GetVulkanDevice().GetTracyContext(m_Pool.GetSpecification().Queue), m_CommandBuffer, "DispatchIndirect");
+        OB_ASSERT((argumentBuffer.GetSpecification().IsIndirectArgument), "[VkCommandList] To use a buffer as an indirect argument buffer it must have been created with IsIndirectArgument equal to true.");
+        OB_ASSERT((offset % 4 == 0), "[VkCommandList] Offset must be aligned to 4 bytes.");
+
+        RequireState(argumentBuffer, ResourceState::IndirectArgument);
+        CommitBarriers();
+
+        vkCmdDispatchIndirect(m_CommandBuffer, api_cast<VulkanBuffer*>(&argumentBuffer)->GetVkBuffer(), static_cast<VkDeviceSize>(offset));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Query methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanCommandList::ResetQueries(QueryPool& pool, uint32_t firstQuery, uint32_t queryCount)
+    {
+        OB_PROFILE("VulkanCommandList::ResetQueries()");
+        OB_ASSERT((firstQuery + queryCount <= pool.GetSpecification().Count), "[VkCommandList] Query range exceeds the QueryPool's count.");
+
+        vkCmdResetQueryPool(m_CommandBuffer, api_cast<VulkanQueryPool*>(&pool)->GetVkQueryPool(), firstQuery, queryCount);
+    }
+
+    void VulkanCommandList::BeginQuery(QueryPool& pool, uint32_t query)
+    {
+        OB_PROFILE("VulkanCommandList::BeginQuery()");
+        OB_ASSERT((pool.GetSpecification().Type != QueryType::Timestamp), "[VkCommandList] Timestamp queries must use BeginTimerQuery/EndTimerQuery.");
+        OB_ASSERT((query < pool.GetSpecification().Count), "[VkCommandList] Query index exceeds the QueryPool's count.");
+
+        vkCmdBeginQuery(m_CommandBuffer, api_cast<VulkanQueryPool*>(&pool)->GetVkQueryPool(), query, 0);
+    }
+
+    void VulkanCommandList::EndQuery(QueryPool& pool, uint32_t query)
+    {
+        OB_PROFILE("VulkanCommandList::EndQuery()");
+        OB_ASSERT((pool.GetSpecification().Type != QueryType::Timestamp), "[VkCommandList] Timestamp queries must use BeginTimerQuery/EndTimerQuery.");
+        OB_ASSERT((query < pool.GetSpecification().Count), "[VkCommandList] Query index exceeds the QueryPool's count.");
+
+        vkCmdEndQuery(m_CommandBuffer, api_cast<VulkanQueryPool*>(&pool)->GetVkQueryPool(), query);
+    }
+
+    void VulkanCommandList::BeginTimerQuery(QueryPool& pool, uint32_t timer)
+    {
+        OB_PROFILE("VulkanCommandList::BeginTimerQuery()");
+        WriteTimestamp(pool, timer * 2, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT);
+    }
+
+    void VulkanCommandList::EndTimerQuery(QueryPool& pool, uint32_t timer)
+    {
+        OB_PROFILE("VulkanCommandList::EndTimerQuery()");
+        WriteTimestamp(pool, (timer * 2) + 1, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT); // Note: Written once all previous commands have finished
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // State methods
     ////////////////////////////////////////////////////////////////////////////////////
     void VulkanCommandList::RequireState(Image& image, const ImageSubresourceSpecification& subresources, ResourceState state)
     {
-        m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().RequireImageState(*api_cast<const CommandList*>(this), image, subresources, state);
+        m_StateTracker.RequireImageState(image, subresources, state);
     }
 
     void VulkanCommandList::RequireState(Buffer& buffer, ResourceState state)
     {
-        m_Pool.GetVulkanSwapchain().GetVulkanDevice().GetTracker().RequireBufferState(*api_cast<const CommandList*>(this), buffer, state);
+        m_StateTracker.RequireBufferState(buffer, state);
+    }
+
+    void VulkanCommandList::AliasImage(Image& image, ResourceState state)
+    {
+        m_StateTracker.AliasImage(image, state);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -770,6 +983,37 @@ namespace Obsidian::Internal
         vkCmdDrawIndexed(m_CommandBuffer, args.VertexCount, args.InstanceCount, args.StartIndexLocation, args.StartVertexLocation, args.StartInstanceLocation);
     }
 
+    void VulkanCommandList::DrawIndexedIndirect(Buffer& argumentBuffer, size_t offset, uint32_t drawCount, uint32_t stride)
+    {
+        OB_PROFILE("VulkanCommandList::DrawIndexedIndirect()");
+        OB_ASSERT((argumentBuffer.GetSpecification().IsIndirectArgument), "[VkCommandList] To use a buffer as an indirect argument buffer it must have been created with IsIndirectArgument equal to true.");
+        OB_ASSERT((offset % 4 == 0), "[VkCommandList] Offset must be aligned to 4 bytes.");
+        OB_ASSERT(((stride % 4 == 0) && (stride >= sizeof(DrawIndexedIndirectCommand))), "[VkCommandList] Stride must be aligned to 4 bytes and at least sizeof(DrawIndexedIndirectCommand).");
+
+        if (!PrepareIndirectArguments(argumentBuffer, nullptr))
+            return;
+
+        vkCmdDrawIndexedIndirect(m_CommandBuffer, api_cast<VulkanBuffer*>(&argumentBuffer)->GetVkBuffer(), static_cast<VkDeviceSize>(offset), drawCount, stride);
+    }
+
+    void VulkanCommandList::DrawIndexedIndirectCount(Buffer& argumentBuffer, size_t offset, Buffer& countBuffer, size_t countOffset, uint32_t maxDrawCount, uint32_t stride)
+    {
+        OB_PROFILE("VulkanCommandList::DrawIndexedIndirectCount()");
+        OB_ASSERT((argumentBuffer.GetSpecification().IsIndirectArgument), "[VkCommandList] To use a buffer as an indirect argument buffer it must have been created with IsIndirectArgument equal to true.");
+        OB_ASSERT((countBuffer.GetSpecification().IsIndirectArgument), "[VkCommandList] To use a buffer as an indirect count buffer it must have been created with IsIndirectArgument equal to true.");
+        OB_ASSERT(((offset % 4 == 0) && (countOffset % 4 == 0)), "[VkCommandList] Offset and countOffset must be aligned to 4 bytes.");
+        OB_ASSERT(((stride % 4 == 0) && (stride >= sizeof(DrawIndexedIndirectCommand))), "[VkCommandList] Stride must be aligned to 4 bytes and at least sizeof(DrawIndexedIndirectCommand).");
+
+        if (!PrepareIndirectArguments(argumentBuffer, &countBuffer))
+            return;
+
+#if defined(OB_PLATFORM_APPLE)
+        VkExtension::g_vkCmdDrawIndexedIndirectCountKHR(m_CommandBuffer, api_cast<VulkanBuffer*>(&argumentBuffer)->GetVkBuffer(), static_cast<VkDeviceSize>(offset), api_cast<VulkanBuffer*>(&countBuffer)->GetVkBuffer(), static_cast<VkDeviceSize>(countOffset), maxDrawCount, stride);
+#else
+        vkCmdDrawIndexedIndirectCount(m_CommandBuffer, api_cast<VulkanBuffer*>(&argumentBuffer)->GetVkBuffer(), static_cast<VkDeviceSize>(offset), api_cast<VulkanBuffer*>(&countBuffer)->GetVkBuffer(), static_cast<VkDeviceSize>(countOffset), maxDrawCount, stride);
+#endif
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Other methods
     ////////////////////////////////////////////////////////////////////////////////////
@@ -797,6 +1041,230 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Private methods
     ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanCommandList::RecordBarriers(VkCommandBuffer commandBuffer, std::span<const ImageBarrier> imageBarriers, std::span<const BufferBarrier> bufferBarriers, CommandQueue releaseQueue) const
+    {
+        const bool release = (releaseQueue != CommandQueue::Count);
+        const QueueFamilyIndices& indices = m_Pool.GetVulkanDevice().GetContext().GetVulkanPhysicalDevice().GetQueueFamilyIndices();
+
+        // Note: An ownership transfer between families is split into a release (executed on the previous queue)
+        // and an acquire (executed here). The release only waits on previous work and the acquire only blocks following work.
+        auto resolveFamilies = [&](CommandQueue queueBefore, CommandQueue queueAfter, uint32_t& srcFamily, uint32_t& dstFamily) -> bool
+        {
+            srcFamily = VK_QUEUE_FAMILY_IGNORED;
+            dstFamily = VK_QUEUE_FAMILY_IGNORED;
+            if ((queueBefore == CommandQueue::Count) || (indices.GetQueueFamily(queueBefore) == indices.GetQueueFamily(queueAfter)))
+                return false;
+
+            srcFamily = indices.GetQueueFamily(queueBefore);
+            dstFamily = indices.GetQueueFamily(queueAfter);
+            return true;
+        };
+
+        // Note: Reuses their capacity, so recording barriers doesn't allocate once they're large enough
+        std::vector<VkImageMemoryBarrier2>& vkImageBarriers = m_VkImageBarriers;
+        vkImageBarriers.clear();
+        std::vector<VkBufferMemoryBarrier2>& vkBufferBarriers = m_VkBufferBarriers;
+        vkBufferBarriers.clear();
+
+        for (const ImageBarrier& imageBarrier : imageBarriers)
+        {
+            uint32_t srcFamily, dstFamily;
+            bool transfer = resolveFamilies(imageBarrier.QueueBefore, imageBarrier.QueueAfter, srcFamily, dstFamily);
+            if (release && (!transfer || (imageBarrier.QueueBefore != releaseQueue)))
+                continue;
+
+            const ResourceStateMapping& before = ResourceStateToMapping(imageBarrier.StateBefore);
+            const ResourceStateMapping& after = ResourceStateToMapping(imageBarrier.StateAfter);
+
+            OB_ASSERT((after.ImageLayout != VK_IMAGE_LAYOUT_UNDEFINED), "[VkCommandList] Can't transition to undefined layout.");
+
+            Image& image = *imageBarrier.ImagePtr;
+            VulkanImage& vulkanImage = *api_cast<VulkanImage*>(imageBarrier.ImagePtr);
+
+            VkImageMemoryBarrier2& barrier2 = vkImageBarriers.emplace_back();
+            barrier2.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+            barrier2.srcStageMask = ((transfer && !release) ? VK_PIPELINE_STAGE_2_NONE : before.StageFlags);
+            barrier2.dstStageMask = ((transfer && release) ? VK_PIPELINE_STAGE_2_NONE : after.StageFlags);
+            barrier2.srcAccessMask = ((transfer && !release) ? VK_ACCESS_2_NONE : before.AccessMask);
+            barrier2.dstAccessMask = ((transfer && release) ? VK_ACCESS_2_NONE : after.AccessMask);
+            barrier2.oldLayout = before.ImageLayout;
+            barrier2.newLayout = after.ImageLayout;
+            barrier2.srcQueueFamilyIndex = srcFamily;
+            barrier2.dstQueueFamilyIndex = dstFamily;
+            barrier2.image = vulkanImage.GetVkImage();
+
+            if (imageBarrier.Aliasing) // Note: We don't know which aliased image used the memory last, so wait on all prior writes and discard the contents
+            {
+                barrier2.srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+                barrier2.srcAccessMask = VK_ACCESS_2_MEMORY_WRITE_BIT;
+                barrier2.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            }
+
+            barrier2.subresourceRange.aspectMask = VkFormatToImageAspect(FormatToVkFormat(image.GetSpecification().ImageFormat));
+            barrier2.subresourceRange.baseMipLevel = (imageBarrier.EntireTexture ? 0 : imageBarrier.ImageMipLevel);
+            barrier2.subresourceRange.levelCount = (imageBarrier.EntireTexture ? image.GetSpecification().MipLevels : 1);
+            barrier2.subresourceRange.baseArrayLayer = (imageBarrier.EntireTexture ? 0 : imageBarrier.ImageArraySlice);
+            barrier2.subresourceRange.layerCount = (imageBarrier.EntireTexture ? image.GetSpecification().ArraySize : 1);
+        }
+
+        for (const BufferBarrier& bufferBarrier : bufferBarriers)
+        {
+            uint32_t srcFamily, dstFamily;
+            bool transfer = resolveFamilies(bufferBarrier.QueueBefore, bufferBarrier.QueueAfter, srcFamily, dstFamily);
+            if (release && (!transfer || (bufferBarrier.QueueBefore != releaseQueue)))
+                continue;
+
+            const ResourceStateMapping& before = ResourceStateToMapping(bufferBarrier.StateBefore);
+            const ResourceStateMapping& after = ResourceStateToMapping(bufferBarrier.StateAfter);
+
+            Buffer& buffer = *bufferBarrier.BufferPtr;
+            VulkanBuffer& vulkanBuffer = *api_cast<VulkanBuffer*>(&buffer);
+
+            VkBufferMemoryBarrier2& barrier2 = vkBufferBarriers.emplace_back();
+            barrier2.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+            barrier2.srcStageMask = ((transfer && !release) ? VK_PIPELINE_STAGE_2_NONE : before.StageFlags);
+            barrier2.dstStageMask = ((transfer && release) ? VK_PIPELINE_STAGE_2_NONE : after.StageFlags);
+            barrier2.srcAccessMask = ((transfer && !release) ? VK_ACCESS_2_NONE : before.AccessMask);
+            barrier2.dstAccessMask = ((transfer && release) ? VK_ACCESS_2_NONE : after.AccessMask);
+            barrier2.srcQueueFamilyIndex = srcFamily;
+            barrier2.dstQueueFamilyIndex = dstFamily;
+            barrier2.buffer = vulkanBuffer.GetVkBuffer();
+            barrier2.offset = 0;
+            barrier2.size = buffer.GetSpecification().Size;
+        }
+
+        if (!vkImageBarriers.empty() || !vkBufferBarriers.empty())
+        {
+            VkDependencyInfo dependencyInfo = {};
+            dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+            dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(vkBufferBarriers.size());
+            dependencyInfo.pBufferMemoryBarriers = vkBufferBarriers.data();
+            dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(vkImageBarriers.size());
+            dependencyInfo.pImageMemoryBarriers = vkImageBarriers.data();
+
+#if defined(OB_PLATFORM_APPLE)
+            VkExtension::g_vkCmdPipelineBarrier2KHR(commandBuffer, &dependencyInfo);
+#else
+            vkCmdPipelineBarrier2(commandBuffer, &dependencyInfo);
+#endif
+        }
+    }
+
+    bool VulkanCommandList::ResolveSubmissionBarriers()
+    {
+        OB_PROFILE("VulkanCommandList::ResolveSubmissionBarriers()");
+
+        // Note: Resolves the first use transitions against the global state, this happens in submission order.
+        m_Pool.GetVulkanDevice().GetTracker().ResolveSubmission(m_StateTracker, m_Pool.GetSpecification().Queue, m_SubmissionImageBarriers, m_SubmissionBufferBarriers);
+        return (!m_SubmissionImageBarriers.empty() || !m_SubmissionBufferBarriers.empty());
+    }
+
+    void VulkanCommandList::RecordSubmissionBarriers(VkCommandBuffer commandBuffer) const
+    {
+        OB_PROFILE("VulkanCommandList::RecordSubmissionBarriers()");
+
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        VK_VERIFY(vkBeginCommandBuffer(commandBuffer, &beginInfo));
+
+        RecordBarriers(commandBuffer, m_SubmissionImageBarriers, m_SubmissionBufferBarriers);
+
+        VK_VERIFY(vkEndCommandBuffer(commandBuffer));
+    }
+
+    void VulkanCommandList::RecordReleaseBarriers(VkCommandBuffer commandBuffer, CommandQueue queue) const
+    {
+        RecordBarriers(commandBuffer, m_SubmissionImageBarriers, m_SubmissionBufferBarriers, queue);
+    }
+
+    bool VulkanCommandList::TrackBoundSet(VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t setID, const BindingSet* set)
+    {
+        const size_t point = ((bindPoint == VK_PIPELINE_BIND_POINT_COMPUTE) ? 1 : 0);
+        std::array<const BindingSet*, GraphicsPipelineSpecification::MaxBindings>& boundSets = m_BoundSets[point];
+
+        // Note: Sets stay bound across pipelines that share a layout, a different layout may disturb them
+        if (m_BoundSetLayouts[point] != layout)
+        {
+            m_BoundSetLayouts[point] = layout;
+            boundSets.fill(nullptr);
+        }
+
+        if (setID >= boundSets.size())
+            return false;
+
+        const bool bound = (set && (boundSets[setID] == set));
+        boundSets[setID] = set;
+        return bound;
+    }
+
+    bool VulkanCommandList::PrepareIndirectArguments(Buffer& argumentBuffer, Buffer* countBuffer)
+    {
+        RequireState(argumentBuffer, ResourceState::IndirectArgument);
+        if (countBuffer)
+            RequireState(*countBuffer, ResourceState::IndirectArgument);
+
+        if (!m_InsideRenderpass)
+        {
+            CommitBarriers();
+            return true;
+        }
+
+        // Note: Barriers of other buffers can stay pending till after the renderpass, only the arguments have to be transitioned before the draw
+        const bool argumentsPending = std::ranges::any_of(m_StateTracker.GetBufferBarriers(), [&](const BufferBarrier& barrier) { return ((barrier.BufferPtr == &argumentBuffer) || (barrier.BufferPtr == countBuffer)); });
+        if (argumentsPending) // Note: Checked in every build, drawing without the transition would read the arguments unsynchronized
+        {
+            m_Pool.GetVulkanDevice().GetContext().Error("[VkCommandList] Barriers can't be placed inside a renderpass, call RequireState(buffer, ResourceState::IndirectArgument) before StartRenderpass. Skipping the draw.");
+            return false;
+        }
+
+        return true;
+    }
+
+    void VulkanCommandList::WriteTimestamp(QueryPool& pool, uint32_t query, VkPipelineStageFlags2 stage) const
+    {
+        OB_ASSERT((pool.GetSpecification().Type == QueryType::Timestamp), "[VkCommandList] Timer queries can only be used with a Timestamp QueryPool.");
+        OB_ASSERT((query < pool.GetSpecification().Count), "[VkCommandList] Timer index exceeds the QueryPool's count.");
+
+        VulkanQueryPool& vkPool = *api_cast<VulkanQueryPool*>(&pool);
+        const CommandQueue queue = m_Pool.GetSpecification().Queue;
+        OB_ASSERT((vkPool.m_TimestampMasks[static_cast<size_t>(queue)] != 0), "[VkCommandList] The queue family of this commandlist doesn't support timestamps (timestampValidBits is 0).");
+
+        vkPool.m_QueryQueues[query].store(queue, std::memory_order_relaxed); // Note: Results are masked with the valid bits of the family that wrote them
+
+#if defined(OB_PLATFORM_APPLE)
+        VkExtension::g_vkCmdWriteTimestamp2KHR(m_CommandBuffer, stage, vkPool.GetVkQueryPool(), query);
+#else
+        vkCmdWriteTimestamp2(m_CommandBuffer, stage, vkPool.GetVkQueryPool(), query);
+#endif
+    }
+
+    void VulkanCommandList::BindDescriptorHeap()
+    {
+        if (m_DescriptorHeapBound)
+            return;
+
+        const VulkanDescriptorHeap& heap = m_Pool.GetVulkanDevice().GetDescriptorHeap();
+
+        VkDescriptorBufferBindingInfoEXT bindingInfo = {};
+        bindingInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+        bindingInfo.address = heap.GetVkDeviceAddress();
+        bindingInfo.usage = heap.GetVkBufferUsage();
+
+        VkExtension::g_vkCmdBindDescriptorBuffersEXT(m_CommandBuffer, 1, &bindingInfo);
+        m_DescriptorHeapBound = true;
+    }
+
+    void VulkanCommandList::SetDescriptorOffset(VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t setID, const BindingSet& set)
+    {
+        BindDescriptorHeap();
+
+        // Note: Every set lives in the same (and only) descriptor buffer binding
+        const uint32_t bufferIndex = 0;
+        const VkDeviceSize offset = api_cast<const VulkanBindingSet*>(&set)->GetDescriptorOffset();
+        VkExtension::g_vkCmdSetDescriptorBufferOffsetsEXT(m_CommandBuffer, bindPoint, layout, setID, 1, &bufferIndex, &offset);
+    }
+
     void VulkanCommandList::SetWaitStage(VkPipelineStageFlags2 waitStage)
     {
         VkPipelineStageFlags2 firstStage = GetFirstPipelineStage(waitStage);
@@ -804,4 +1272,139 @@ namespace Obsidian::Internal
             m_WaitStage = firstStage;
     }
 
+    void VulkanCommandList::StartRendering(const RenderpassStartArgs& args)
+    {
+        OB_PROFILE("VulkanCommandList::StartRendering()");
+
+        OB_ASSERT((!args.ColourAttachments.empty() || args.DepthAttachment.IsValid()), "[VkCommandList] No Renderpass and no attachments passed in.");
+
+        m_DynamicRendering = true;
+        m_RenderingColourAttachments = args.ColourAttachments;
+        m_RenderingDepthAttachment = args.DepthAttachment;
+
+        for (RenderingAttachment& attachment : m_RenderingColourAttachments)
+        {
+            if (attachment.RenderingState == ResourceState::Unknown)
+                attachment.RenderingState = ResourceState::RenderTarget;
+        }
+        if (m_RenderingDepthAttachment.RenderingState == ResourceState::Unknown)
+            m_RenderingDepthAttachment.RenderingState = ResourceState::DepthWrite;
+
+        uint32_t layers = 1;
+
+        const auto createAttachmentInfo = [&](const RenderingAttachment& attachment, VkClearValue clearValue) -> VkRenderingAttachmentInfo
+        {
+            VulkanImage& vulkanImage = *api_cast<VulkanImage*>(attachment.ImagePtr);
+            const ImageSpecification& imageSpec = attachment.ImagePtr->GetSpecification();
+            ImageSubresourceSpecification resSubresources = ResolveImageSubresource(attachment.Subresources, imageSpec, true);
+
+            layers = resSubresources.NumArraySlices;
+
+            RequireState(*attachment.ImagePtr, attachment.Subresources, attachment.RenderingState);
+
+            VkRenderingAttachmentInfo info = {};
+            info.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
+            info.imageView = vulkanImage.GetSubresourceView(resSubresources, imageSpec.Dimension, imageSpec.ImageFormat, 0, ImageSubresourceViewType::AllAspects).GetVkImageView();
+            info.imageLayout = ResourceStateToImageLayout(attachment.RenderingState);
+            info.resolveMode = VK_RESOLVE_MODE_NONE;
+
+            if (attachment.HasResolve())
+            {
+                VulkanImage& vulkanResolveImage = *api_cast<VulkanImage*>(attachment.ResolveImagePtr);
+                const ImageSpecification& resolveImageSpec = attachment.ResolveImagePtr->GetSpecification();
+                ImageSubresourceSpecification resResolveSubresources = ResolveImageSubresource(attachment.ResolveSubresources, resolveImageSpec, true);
+
+                OB_ASSERT((imageSpec.SampleCount > 1), "[VkCommandList] Only multisampled colour attachments can be resolved.");
+                OB_ASSERT((resolveImageSpec.SampleCount == 1), "[VkCommandList] Resolve attachments can't be multisampled.");
+
+                RequireState(*attachment.ResolveImagePtr, attachment.ResolveSubresources, ResourceState::ResolveDst);
+
+                info.resolveMode = VK_RESOLVE_MODE_AVERAGE_BIT;
+                info.resolveImageView = vulkanResolveImage.GetSubresourceView(resResolveSubresources, resolveImageSpec.Dimension, resolveImageSpec.ImageFormat, 0, ImageSubresourceViewType::AllAspects).GetVkImageView();
+                info.resolveImageLayout = ResourceStateToImageLayout(ResourceState::ResolveDst);
+            }
+
+            info.loadOp = LoadOperationToVkLoadOperation(attachment.Load);
+            info.storeOp = StoreOperationToVkStoreOperation(attachment.Store);
+            info.clearValue = clearValue;
+            return info;
+        };
+
+        Nano::Memory::StaticVector<VkRenderingAttachmentInfo, Information::MaxColourAttachments> colourInfos;
+        VkRenderingAttachmentInfo depthInfo = {};
+
+        for (const RenderingAttachment& attachment : m_RenderingColourAttachments)
+        {
+            OB_ASSERT(attachment.IsValid(), "[VkCommandList] Colour attachment has no image.");
+            colourInfos.push_back(createAttachmentInfo(attachment, VkClearValue({ args.ColourClear.r, args.ColourClear.g, args.ColourClear.b, args.ColourClear.a })));
+        }
+        if (m_RenderingDepthAttachment.IsValid())
+            depthInfo = createAttachmentInfo(m_RenderingDepthAttachment, VkClearValue({ args.DepthClear, 0 }));
+
+        CommitBarriers();
+
+        VkRenderingInfo renderingInfo = {};
+        renderingInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
+        renderingInfo.renderArea.offset = { 0, 0 };
+        renderingInfo.renderArea.extent = { static_cast<uint32_t>(args.ViewportState.GetWidth()), static_cast<uint32_t>(args.ViewportState.GetHeight()) };
+        renderingInfo.layerCount = layers;
+        renderingInfo.viewMask = 0;
+        renderingInfo.colorAttachmentCount = static_cast<uint32_t>(colourInfos.size());
+        renderingInfo.pColorAttachments = (!colourInfos.empty() ? colourInfos.data() : nullptr);
+        renderingInfo.pDepthAttachment = (m_RenderingDepthAttachment.IsValid() ? &depthInfo : nullptr);
+        renderingInfo.pStencilAttachment = nullptr; // Note: We currently don't support stencil
+
+#if OB_GPU_PROFILING_ENABLED
+        {
+            const std::string name = "Rendering";
+            m_RenderpassZone.emplace(m_Pool.GetVulkanDevice().GetTracyContext(m_Pool.GetSpecification().Queue), static_cast<uint32_t>(__LINE__), __FILE__, sizeof(__FILE__) - 1, __FUNCTION__, sizeof(__FUNCTION__) - 1, name.c_str(), name.size(), m_CommandBuffer, true);
+        }
+#endif
+
+        {
+            OB_PROFILE("VulkanCommandList::StartRendering::Begin");
+#if defined(OB_PLATFORM_APPLE)
+            VkExtension::g_vkCmdBeginRenderingKHR(m_CommandBuffer, &renderingInfo);
+#else
+            vkCmdBeginRendering(m_CommandBuffer, &renderingInfo);
+#endif
+        }
+
+        SetViewport(args.ViewportState);
+        SetScissor(args.Scissor);
+    }
+
+    void VulkanCommandList::EndRendering()
+    {
+        OB_PROFILE("VulkanCommandList::EndRendering()");
+
+#if defined(OB_PLATFORM_APPLE)
+        VkExtension::g_vkCmdEndRenderingKHR(m_CommandBuffer);
+#else
+        vkCmdEndRendering(m_CommandBuffer);
+#endif
+
+#if OB_GPU_PROFILING_ENABLED
+        m_RenderpassZone.reset();
+#endif
+
+        // Note: Unlike VkRenderPass, dynamic rendering doesn't transition to the end state, so we do it manually
+        {
+            for (const RenderingAttachment& attachment : m_RenderingColourAttachments)
+            {
+                if (attachment.EndState != ResourceState::Unknown)
+                    RequireState(*attachment.ImagePtr, attachment.Subresources, attachment.EndState);
+                if (attachment.HasResolve() && (attachment.ResolveEndState != ResourceState::Unknown))
+                    RequireState(*attachment.ResolveImagePtr, attachment.ResolveSubresources, attachment.ResolveEndState);
+            }
+            if (m_RenderingDepthAttachment.IsValid() && (m_RenderingDepthAttachment.EndState != ResourceState::Unknown))
+                RequireState(*m_RenderingDepthAttachment.ImagePtr, m_RenderingDepthAttachment.Subresources, m_RenderingDepthAttachment.EndState);
+            CommitBarriers();
+        }
+
+        m_DynamicRendering = false;
+        m_RenderingColourAttachments = {};
+        m_RenderingDepthAttachment = {};
+    }
+
 }
\ No newline at end of file
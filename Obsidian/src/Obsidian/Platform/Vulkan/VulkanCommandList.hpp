@@ -1,22 +1,31 @@
 #pragma once
 
+#include "Obsidian/Utils/Profiler.hpp"
+
 #include "Obsidian/Renderer/API.hpp"
 #include "Obsidian/Renderer/ResourceSpec.hpp"
 #include "Obsidian/Renderer/ShaderSpec.hpp"
 #include "Obsidian/Renderer/ImageSpec.hpp"
 #include "Obsidian/Renderer/CommandListSpec.hpp"
+#include "Obsidian/Renderer/PipelineSpec.hpp"
+#include "Obsidian/Renderer/StateTracker.hpp"
 
 #include "Obsidian/Platform/Vulkan/Vulkan.hpp"
 
+#include <span>
 #include <array>
+#include <vector>
+#include <optional>
 
 namespace Obsidian
 {
+	class Device;
 	class Swapchain;
 	class Image;
 	class StagingImage;
 	class Buffer;
 	class Renderpass;
+	class QueryPool;
 	class CommandList;
 	class CommandListPool;
 }
@@ -37,6 +46,7 @@ namespace Obsidian::Internal
 	{
 	public:
 		// Constructor & Destructor
+		VulkanCommandListPool(const Device& device, const CommandListPoolSpecification& specs);
 		VulkanCommandListPool(Swapchain& swapchain, const CommandListPoolSpecification& specs);
 		~VulkanCommandListPool();
 
@@ -50,13 +60,16 @@ namespace Obsidian::Internal
 		inline const CommandListPoolSpecification& GetSpecification() const { return m_Specification; }
 
 		// Internal Getters
-		inline VulkanSwapchain& GetVulkanSwapchain() { return m_Swapchain; }
-		inline const VulkanSwapchain& GetVulkanSwapchain() const { return m_Swapchain; }
+		inline const VulkanDevice& GetVulkanDevice() const { return m_Device; }
+
+		inline bool HasSwapchain() const { return (m_Swapchain != nullptr); }
+		VulkanSwapchain& GetVulkanSwapchain() const;
 
 		inline VkCommandPool GetVkCommandPool() const { return m_CommandPool; }
 
 	private:
-		VulkanSwapchain& m_Swapchain;
+		const VulkanDevice& m_Device;
+		VulkanSwapchain* m_Swapchain = nullptr; // Note: Is nullptr when the pool was allocated from the Device
 		CommandListPoolSpecification m_Specification;
 
 		VkCommandPool m_CommandPool = VK_NULL_HANDLE;
@@ -100,16 +113,31 @@ namespace Obsidian::Internal
 
 		void CopyImage(Image& dst, const ImageSliceSpecification& dstSlice, Image& src, const ImageSliceSpecification& srcSlice);
 		void CopyImage(Image& dst, const ImageSliceSpecification& dstSlice, StagingImage& src, const ImageSliceSpecification& srcSlice);
+		void CopyImage(StagingImage& dst, const ImageSliceSpecification& dstSlice, Image& src, const ImageSliceSpecification& srcSlice);
+		void CopyImage(Buffer& dst, size_t dstOffset, Image& src, const ImageSliceSpecification& srcSlice);
 		void CopyBuffer(Buffer& dst, Buffer& src, size_t size, size_t srcOffset, size_t dstOffset);
 
+		void GenerateMips(Image& image, const ImageSubresourceSpecification& subresources);
+
 		void Dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) const;
+		void DispatchIndirect(Buffer& argumentBuffer, size_t offset);
+
+		// Query methods
+		void ResetQueries(QueryPool& pool, uint32_t firstQuery, uint32_t queryCount);
+		void BeginQuery(QueryPool& pool, uint32_t query);
+		void EndQuery(QueryPool& pool, uint32_t query);
+		void BeginTimerQuery(QueryPool& pool, uint32_t timer);
+		void EndTimerQuery(QueryPool& pool, uint32_t timer);
 
 		// State methods
 		void RequireState(Image& image, const ImageSubresourceSpecification& subresources, ResourceState state);
 		void RequireState(Buffer& buffer, ResourceState state);
+		void AliasImage(Image& image, ResourceState state);
 
 		// Draw methods
 		void DrawIndexed(const DrawArguments& args) const;
+		void DrawIndexedIndirect(Buffer& argumentBuffer, size_t offset, uint32_t drawCount, uint32_t stride);
+		void DrawIndexedIndirectCount(Buffer& argumentBuffer, size_t offset, Buffer& countBuffer, size_t countOffset, uint32_t maxDrawCount, uint32_t stride);
 
 		// Other methods
 		void PushConstants(const void* memory, size_t size, size_t srcOffset, size_t dstOffset);
@@ -120,10 +148,29 @@ namespace Obsidian::Internal
 		// Internal Getters
 		inline VkCommandBuffer GetVkCommandBuffer() const { return m_CommandBuffer; }
 
+		inline uint64_t GetSignaledValue() const { return m_SignaledValue; } // Note: Timeline value signaled when the last submission of this list completes
+		inline CommandQueue GetSignaledQueue() const { return m_Pool.GetSpecification().Queue; } // Note: Every queue has its own timeline semaphore
+
 	private:
 		// Private methods
 		void SetWaitStage(VkPipelineStageFlags2 waitStage);
 
+		void StartRendering(const RenderpassStartArgs& args);
+		void EndRendering();
+
+		void WriteTimestamp(QueryPool& pool, uint32_t query, VkPipelineStageFlags2 stage) const;
+
+		bool PrepareIndirectArguments(Buffer& argumentBuffer, Buffer* countBuffer); // Note: Returns false when the draw has to be skipped
+
+		void BindDescriptorHeap(); // Note: Binds the device's descriptor buffer once per recording
+		void SetDescriptorOffset(VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t setID, const BindingSet& set);
+		bool TrackBoundSet(VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t setID, const BindingSet* set); // Note: Returns true when set is already bound at setID with layout, nullptr always rebinds (e.g. with dynamic offsets)
+
+		void RecordBarriers(VkCommandBuffer commandBuffer, std::span<const ImageBarrier> imageBarriers, std::span<const BufferBarrier> bufferBarriers, CommandQueue releaseQueue = CommandQueue::Count) const; // Note: A releaseQueue only records the release half of the ownership transfers away from that queue
+		bool ResolveSubmissionBarriers(); // Note: Returns whether there are any first use barriers to record
+		void RecordSubmissionBarriers(VkCommandBuffer commandBuffer) const; // Note: The commandbuffer comes from the device, since the list may still be pending
+		void RecordReleaseBarriers(VkCommandBuffer commandBuffer, CommandQueue queue) const; // Note: Records the ownership releases of the submission barriers that were owned by queue
+
 	private:
 		VulkanCommandListPool& m_Pool;
 		CommandListSpecification m_Specification;
@@ -131,8 +178,32 @@ namespace Obsidian::Internal
 		VkCommandBuffer m_CommandBuffer = VK_NULL_HANDLE;
 		VkPipelineStageFlags2 m_WaitStage = VK_PIPELINE_STAGE_2_NONE;
 
+		CommandListStateTracker m_StateTracker;
+		std::vector<ImageBarrier> m_SubmissionImageBarriers = { };
+		std::vector<BufferBarrier> m_SubmissionBufferBarriers = { };
+		mutable std::vector<VkImageMemoryBarrier2> m_VkImageBarriers = { };
+		mutable std::vector<VkBufferMemoryBarrier2> m_VkBufferBarriers = { };
+
 		const GraphicsPipeline* m_CurrentGraphicsPipeline = nullptr;
 		const ComputePipeline* m_CurrentComputePipeline = nullptr;
+		bool m_DescriptorHeapBound = false;
+
+		// Note: Graphics & compute, lets rebinding the same set (e.g. a BindlessTable) be skipped until the pipeline layout changes
+		std::array<VkPipelineLayout, 2> m_BoundSetLayouts = { };
+		std::array<std::array<const BindingSet*, GraphicsPipelineSpecification::MaxBindings>, 2> m_BoundSets = { };
+
+		uint64_t m_SignaledValue = 0;
+
+		bool m_InsideRenderpass = false; // Note: Barriers can't be recorded between StartRenderpass & EndRenderpass
+		bool m_DynamicRendering = false; // Note: Whether the current renderpass was started with dynamic rendering
+		Nano::Memory::StaticVector<RenderingAttachment, Information::MaxColourAttachments> m_RenderingColourAttachments = {};
+		RenderingAttachment m_RenderingDepthAttachment = {};
+
+#if OB_GPU_PROFILING_ENABLED
+		std::optional<tracy::VkCtxScope> m_RenderpassZone = {}; // Note: Spans StartRenderpass till EndRenderpass
+#endif
+
+		friend class VulkanDevice;
 	};
 #endif
 
@@ -53,8 +53,26 @@ namespace
         g_vkQueueSubmit2KHR = reinterpret_cast<decltype(g_vkQueueSubmit2KHR)>(vkGetInstanceProcAddr(instance, "vkQueueSubmit2KHR"));
         g_vkCmdCopyBuffer2KHR = reinterpret_cast<decltype(g_vkCmdCopyBuffer2KHR)>(vkGetInstanceProcAddr(instance, "vkCmdCopyBuffer2KHR"));
         g_vkCmdCopyImage2KHR = reinterpret_cast<decltype(g_vkCmdCopyImage2KHR)>(vkGetInstanceProcAddr(instance, "vkCmdCopyImage2KHR"));
+        g_vkCmdBlitImage2KHR = reinterpret_cast<decltype(g_vkCmdBlitImage2KHR)>(vkGetInstanceProcAddr(instance, "vkCmdBlitImage2KHR"));
         g_vkCmdCopyBufferToImage2KHR = reinterpret_cast<decltype(g_vkCmdCopyBufferToImage2KHR)>(vkGetInstanceProcAddr(instance, "vkCmdCopyBufferToImage2KHR"));
+        g_vkCmdCopyImageToBuffer2KHR = reinterpret_cast<decltype(g_vkCmdCopyImageToBuffer2KHR)>(vkGetInstanceProcAddr(instance, "vkCmdCopyImageToBuffer2KHR"));
         g_vkCmdPipelineBarrier2KHR = reinterpret_cast<decltype(g_vkCmdPipelineBarrier2KHR)>(vkGetInstanceProcAddr(instance, "vkCmdPipelineBarrier2KHR"));
+        g_vkCmdDrawIndexedIndirectCountKHR = reinterpret_cast<decltype(g_vkCmdDrawIndexedIndirectCountKHR)>(vkGetInstanceProcAddr(instance, "vkCmdDrawIndexedIndirectCountKHR"));
+        g_vkCmdWriteTimestamp2KHR = reinterpret_cast<decltype(g_vkCmdWriteTimestamp2KHR)>(vkGetInstanceProcAddr(instance, "vkCmdWriteTimestamp2KHR"));
+        g_vkCmdBeginRenderingKHR = reinterpret_cast<decltype(g_vkCmdBeginRenderingKHR)>(vkGetInstanceProcAddr(instance, "vkCmdBeginRenderingKHR"));
+        g_vkCmdEndRenderingKHR = reinterpret_cast<decltype(g_vkCmdEndRenderingKHR)>(vkGetInstanceProcAddr(instance, "vkCmdEndRenderingKHR"));
+        g_vkGetDeviceImageMemoryRequirementsKHR = reinterpret_cast<decltype(g_vkGetDeviceImageMemoryRequirementsKHR)>(vkGetInstanceProcAddr(instance, "vkGetDeviceImageMemoryRequirementsKHR"));
+    }
+
+    static void LoadDescriptorBufferFunctionPointers(VkDevice device)
+    {
+        using namespace Obsidian::Internal::VkExtension;
+
+        g_vkGetDescriptorSetLayoutSizeEXT = reinterpret_cast<decltype(g_vkGetDescriptorSetLayoutSizeEXT)>(vkGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutSizeEXT"));
+        g_vkGetDescriptorSetLayoutBindingOffsetEXT = reinterpret_cast<decltype(g_vkGetDescriptorSetLayoutBindingOffsetEXT)>(vkGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutBindingOffsetEXT"));
+        g_vkGetDescriptorEXT = reinterpret_cast<decltype(g_vkGetDescriptorEXT)>(vkGetDeviceProcAddr(device, "vkGetDescriptorEXT"));
+        g_vkCmdBindDescriptorBuffersEXT = reinterpret_cast<decltype(g_vkCmdBindDescriptorBuffersEXT)>(vkGetDeviceProcAddr(device, "vkCmdBindDescriptorBuffersEXT"));
+        g_vkCmdSetDescriptorBufferOffsetsEXT = reinterpret_cast<decltype(g_vkCmdSetDescriptorBufferOffsetsEXT)>(vkGetDeviceProcAddr(device, "vkCmdSetDescriptorBufferOffsetsEXT"));
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -127,10 +145,9 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Init & Destroy
     ////////////////////////////////////////////////////////////////////////////////////
-    VulkanContext::VulkanContext(void* window, DeviceMessageCallback messageCallback, DeviceDestroyCallback destroyCallback, std::span<const char*> extensions)
-        : m_DestroyCallback(destroyCallback)
+    VulkanContext::VulkanContext(void* window, DeviceMessageCallback messageCallback, DeviceDestroyCallback destroyCallback, std::span<const char*> extensions, bool descriptorBuffers)
+        : m_DestroyCallback(destroyCallback), m_Headless(window == nullptr)
     {
-        OB_ASSERT(window, "[VulkanContext] No window was attached.");
         OB_ASSERT(destroyCallback, "[VulkanContext] No destroy callback was passed in.");
 
         if constexpr (Information::Validation)
@@ -144,7 +161,7 @@ namespace Obsidian::Internal
         }
 
         InitInstance();
-        InitDevices(window, extensions);
+        InitDevices(window, extensions, descriptorBuffers);
     }
 
     VulkanContext::~VulkanContext()
@@ -230,7 +247,13 @@ namespace Obsidian::Internal
                 OB_LOG_WARN("[VulkanContext] Requested validation layers, but no support found.");
         }
 
-        std::vector<const char*> instanceExtensions = { VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_SURFACE_TYPE_NAME };
+        std::vector<const char*> instanceExtensions = { };
+        if (!m_Headless)
+        {
+            instanceExtensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+            instanceExtensions.push_back(VK_KHR_SURFACE_TYPE_NAME);
+        }
+
         if constexpr (Information::Validation)
         {
             if (validationSupport)
@@ -316,20 +339,35 @@ namespace Obsidian::Internal
         }
     }
 
-    void VulkanContext::InitDevices(void* window, std::span<const char*> extensions)
+    void VulkanContext::InitDevices(void* window, std::span<const char*> extensions, bool descriptorBuffers)
     {
+        // Note: A headless device has no surface, the physical device then gets selected without present support.
         VkSurfaceKHR surface = VK_NULL_HANDLE;
 
         #if defined(OB_PLATFORM_DESKTOP)
-            VK_VERIFY(glfwCreateWindowSurface(m_Instance, static_cast<GLFWwindow*>(window), nullptr, &surface));
+            if (!m_Headless)
+                VK_VERIFY(glfwCreateWindowSurface(m_Instance, static_cast<GLFWwindow*>(window), nullptr, &surface));
         #endif
         
         std::set<const char*> extensionSet(extensions.begin(), extensions.end());
         extensionSet.insert(DeviceExtensions.begin(), DeviceExtensions.end());
+        if (!m_Headless)
+            extensionSet.insert(PresentDeviceExtensions.begin(), PresentDeviceExtensions.end());
         std::vector<const char*> fullExtensions(extensionSet.begin(), extensionSet.end());
 
         m_PhysicalDevice.Construct(m_Instance, surface, std::span<const char*>(fullExtensions));
-        m_LogicalDevice.Construct(m_PhysicalDevice, std::span<const char*>(fullExtensions));
+
+        // Note: Descriptor buffers are optional, so they don't influence the physical device selection
+        m_DescriptorBuffers = (descriptorBuffers && m_PhysicalDevice.Get().SupportsDescriptorBuffers());
+        if (m_DescriptorBuffers)
+            fullExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+        else if (descriptorBuffers)
+            Warn("[VulkanContext] Descriptor buffers were requested, but VK_EXT_descriptor_buffer isn't supported. Falling back to descriptor pools.");
+
+        m_LogicalDevice.Construct(m_PhysicalDevice, std::span<const char*>(fullExtensions), m_DescriptorBuffers);
+
+        if (m_DescriptorBuffers)
+            LoadDescriptorBufferFunctionPointers(m_LogicalDevice.Get().GetVkDevice());
 
         if constexpr (Information::Validation)
         {
@@ -367,9 +405,13 @@ namespace Obsidian::Internal
                     SetDebugName(m_LogicalDevice.Get().GetVkQueue(CommandQueue::Present), VK_OBJECT_TYPE_QUEUE, "Present Queue");
                 }
             }
+
+            if (indices.HasDedicatedTransfer())
+                SetDebugName(m_LogicalDevice.Get().GetVkTransferQueue(), VK_OBJECT_TYPE_QUEUE, "Transfer Queue");
         }
 
-        vkDestroySurfaceKHR(m_Instance, surface, nullptr);
+        if (surface)
+            vkDestroySurfaceKHR(m_Instance, surface, nullptr);
     }
 
 }
\ No newline at end of file
@@ -35,18 +35,22 @@ namespace Obsidian::Internal
             #endif
         });
         inline constexpr static auto DeviceExtensions = std::to_array<const char*>({
-            VK_KHR_SWAPCHAIN_EXTENSION_NAME,
-
             #if defined(OB_PLATFORM_MACOS)
             "VK_KHR_portability_subset",
             #endif
 
             "VK_KHR_synchronization2",
-            "VK_KHR_copy_commands2"
+            "VK_KHR_copy_commands2",
+            "VK_KHR_draw_indirect_count",
+            "VK_KHR_dynamic_rendering",
+            "VK_KHR_maintenance4"
+        });
+        inline constexpr static auto PresentDeviceExtensions = std::to_array<const char*>({ // Note: Only enabled when the device is not headless
+            VK_KHR_SWAPCHAIN_EXTENSION_NAME
         });
     public:
         // Constructors & Destructor
-        VulkanContext(void* window, DeviceMessageCallback messageCallback, DeviceDestroyCallback destroyCallback, std::span<const char*> extensions);
+        VulkanContext(void* window, DeviceMessageCallback messageCallback, DeviceDestroyCallback destroyCallback, std::span<const char*> extensions, bool descriptorBuffers = false); // Note: descriptorBuffers only gets used when the device supports it
         ~VulkanContext();
 
         // Internal methods
@@ -66,10 +70,13 @@ namespace Obsidian::Internal
         inline VkInstance GetVkInstance() const { return m_Instance; }
         inline VkDebugUtilsMessengerEXT GetVkDebugger() const { return m_DebugMessenger; }
 
+        inline bool IsHeadless() const { return m_Headless; }
+        inline bool UsesDescriptorBuffers() const { return m_DescriptorBuffers; } // Note: When true BindingSets live in the device's VulkanDescriptorHeap instead of descriptor pools
+
     private:
         // Private methods
         void InitInstance();
-        void InitDevices(void* window, std::span<const char*> extensions);
+        void InitDevices(void* window, std::span<const char*> extensions, bool descriptorBuffers);
 
     private:
         VkInstance m_Instance = VK_NULL_HANDLE;
@@ -79,6 +86,8 @@ namespace Obsidian::Internal
         Nano::Memory::DeferredConstruct<VulkanLogicalDevice, true> m_LogicalDevice = {};
 
         DeviceDestroyCallback m_DestroyCallback = nullptr;
+        bool m_Headless = false;
+        bool m_DescriptorBuffers = false;
     };
 #endif
 
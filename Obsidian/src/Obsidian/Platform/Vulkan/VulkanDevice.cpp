@@ -7,26 +7,123 @@
 #include "Obsidian/Renderer/Device.hpp"
 #include "Obsidian/Renderer/Bindings.hpp"
 #include "Obsidian/Renderer/Swapchain.hpp"
+#include "Obsidian/Renderer/CommandList.hpp"
 #include "Obsidian/Renderer/Image.hpp"
 #include "Obsidian/Renderer/Buffer.hpp"
 #include "Obsidian/Renderer/Framebuffer.hpp"
 #include "Obsidian/Renderer/Renderpass.hpp"
 #include "Obsidian/Renderer/Shader.hpp"
 #include "Obsidian/Renderer/Pipeline.hpp"
+#include "Obsidian/Renderer/QueryPool.hpp"
+#include "Obsidian/Renderer/UploadManager.hpp"
 
 namespace Obsidian::Internal
 {
 
+    namespace
+    {
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Helper methods
+        ////////////////////////////////////////////////////////////////////////////////////
+        void QueueSubmit(VkQueue queue, const VkSubmitInfo2& submitInfo)
+        {
+#if defined(OB_PLATFORM_APPLE)
+            VK_VERIFY(VkExtension::g_vkQueueSubmit2KHR(queue, 1, &submitInfo, nullptr));
+#else
+            VK_VERIFY(vkQueueSubmit2(queue, 1, &submitInfo, nullptr));
+#endif
+        }
+
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
     VulkanDevice::VulkanDevice(const DeviceSpecification& specs)
-        : m_Context(specs.NativeWindow, specs.MessageCallback, specs.DestroyCallback, specs.Extensions), m_Allocator(m_Context.GetVkInstance(), m_Context.GetVulkanPhysicalDevice().GetVkPhysicalDevice(), m_Context.GetVulkanLogicalDevice().GetVkDevice()), m_StateTracker(*api_cast<const Device*>(this))
+        : m_Context(specs.NativeWindow, specs.MessageCallback, specs.DestroyCallback, specs.Extensions, specs.DescriptorBuffers), m_Allocator(m_Context.GetVkInstance(), m_Context.GetVulkanPhysicalDevice().GetVkPhysicalDevice(), m_Context.GetVulkanLogicalDevice().GetVkDevice(), m_Context.UsesDescriptorBuffers()), m_StateTracker(*api_cast<const Device*>(this)), m_DescriptorHeap(m_Context, m_Allocator)
     {
+        m_Allocator.CreatePipelineCache(specs.PipelineCacheData);
+
+        // Timeline semaphores & submit pools
+        {
+            constexpr const std::array<std::string_view, static_cast<size_t>(CommandQueue::Count)> queueNames = { "Graphics", "Compute", "Present" };
+
+            VkSemaphoreTypeCreateInfo timelineInfo = {};
+            timelineInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+            timelineInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+            timelineInfo.initialValue = 0;
+
+            VkSemaphoreCreateInfo semaphoreInfo = {};
+            semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            semaphoreInfo.pNext = &timelineInfo;
+
+            VkCommandPoolCreateInfo poolInfo = {};
+            poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+            for (size_t i = 0; i < static_cast<size_t>(CommandQueue::Count); i++)
+            {
+                VK_VERIFY(vkCreateSemaphore(m_Context.GetVulkanLogicalDevice().GetVkDevice(), &semaphoreInfo, VulkanAllocator::GetCallbacks(), &m_TimelineSemaphores[i]));
+
+                poolInfo.queueFamilyIndex = m_Context.GetVulkanPhysicalDevice().GetQueueFamilyIndices().GetQueueFamily(static_cast<CommandQueue>(i));
+                VK_VERIFY(vkCreateCommandPool(m_Context.GetVulkanLogicalDevice().GetVkDevice(), &poolInfo, VulkanAllocator::GetCallbacks(), &m_SubmitPools[i]));
+
+                if constexpr (Information::Validation)
+                {
+                    m_Context.SetDebugName(m_TimelineSemaphores[i], VK_OBJECT_TYPE_SEMAPHORE, std::format("{0} Timeline Semaphore", queueNames[i]));
+                    m_Context.SetDebugName(m_SubmitPools[i], VK_OBJECT_TYPE_COMMAND_POOL, std::format("{0} Submit Pool", queueNames[i]));
+                }
+            }
+        }
+
+#if OB_GPU_PROFILING_ENABLED
+        // Tracy GPU contexts // Note: Every queue gets its own context, since a context's timestamps are calibrated against a single queue.
+        // Tracy needs a commandbuffer for the initial calibration, so we create a temporary one.
+        {
+            constexpr const std::array<std::string_view, static_cast<size_t>(CommandQueue::Count)> contextNames = { "Obsidian GPU (Graphics)", "Obsidian GPU (Compute)", "Obsidian GPU (Present)" };
+            VkDevice device = m_Context.GetVulkanLogicalDevice().GetVkDevice();
+
+            for (size_t i = 0; i < static_cast<size_t>(CommandQueue::Count); i++)
+            {
+                VkCommandPoolCreateInfo poolInfo = {};
+                poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+                poolInfo.queueFamilyIndex = m_Context.GetVulkanPhysicalDevice().GetQueueFamilyIndices().GetQueueFamily(static_cast<CommandQueue>(i));
+
+                VkCommandPool commandPool = VK_NULL_HANDLE;
+                VK_VERIFY(vkCreateCommandPool(device, &poolInfo, VulkanAllocator::GetCallbacks(), &commandPool));
+
+                VkCommandBufferAllocateInfo allocInfo = {};
+                allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+                allocInfo.commandPool = commandPool;
+                allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+                allocInfo.commandBufferCount = 1;
+
+                VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+                VK_VERIFY(vkAllocateCommandBuffers(device, &allocInfo, &commandBuffer));
+
+                m_TracyContexts[i] = TracyVkContext(m_Context.GetVulkanPhysicalDevice().GetVkPhysicalDevice(), device, m_Context.GetVulkanLogicalDevice().GetVkQueue(static_cast<CommandQueue>(i)), commandBuffer);
+                TracyVkContextName(m_TracyContexts[i], contextNames[i].data(), static_cast<uint16_t>(contextNames[i].size()));
+
+                vkDestroyCommandPool(device, commandPool, VulkanAllocator::GetCallbacks());
+            }
+        }
+#endif
     }
 
     VulkanDevice::~VulkanDevice()
     {
+#if OB_GPU_PROFILING_ENABLED
+        for (TracyVkCtx context : m_TracyContexts)
+            TracyVkDestroy(context);
+#endif
+
+        // Note: The device must be idle at this point, so we can destroy the timelines directly.
+        for (size_t i = 0; i < static_cast<size_t>(CommandQueue::Count); i++)
+        {
+            vkDestroyCommandPool(m_Context.GetVulkanLogicalDevice().GetVkDevice(), m_SubmitPools[i], VulkanAllocator::GetCallbacks());
+            vkDestroySemaphore(m_Context.GetVulkanLogicalDevice().GetVkDevice(), m_TimelineSemaphores[i], VulkanAllocator::GetCallbacks());
+        }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -37,6 +134,325 @@ namespace Obsidian::Internal
         m_Context.GetVulkanLogicalDevice().Wait();
     }
 
+    void VulkanDevice::Submit(std::span<CommandList*> lists, const CommandListSubmitArgs& args) const
+    {
+        OB_PROFILE("VulkanDevice::Submit()");
+
+        if (lists.empty())
+            return;
+
+        std::span<const CommandList*> waitOn;
+        std::visit([&](auto&& arg)
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, std::vector<const CommandList*>>)
+                waitOn = const_cast<std::vector<const CommandList*>&>(arg);
+            else if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, std::span<const CommandList*>>)
+                waitOn = arg;
+        }, args.WaitOnLists);
+
+        // Note: Submission order defines the order in which first use barriers are resolved
+        // and the queue has to be externally synchronized anyway.
+        std::scoped_lock lock(m_SubmitMutex);
+        m_SubmitWaitInfos.clear();
+        m_SubmitCommandInfos.clear();
+        m_SubmitAcquireBuffers.clear();
+        m_SubmitAcquireImages.clear();
+
+        PruneCompletedValues();
+
+        const CommandQueue queue = api_cast<VulkanCommandList*>(lists[0])->m_Pool.GetSpecification().Queue;
+        VulkanSwapchain* swapchain = nullptr;
+        VkPipelineStageFlags2 waitStage = VK_PIPELINE_STAGE_2_NONE;
+
+        // Resolve first use barriers
+        for (CommandList* list : lists)
+        {
+            VulkanCommandList& vkList = *api_cast<VulkanCommandList*>(list);
+            OB_ASSERT((vkList.m_Pool.GetSpecification().Queue == queue), "[VkDevice] All CommandLists in a batch must be submitted to the same queue.");
+
+            if (!swapchain && vkList.m_Pool.HasSwapchain())
+                swapchain = &vkList.m_Pool.GetVulkanSwapchain();
+
+            waitStage |= vkList.m_WaitStage;
+            vkList.ResolveSubmissionBarriers();
+        }
+
+        OB_ASSERT((!(args.WaitForSwapchainImage || args.OnFinishMakeSwapchainPresentable) || swapchain), "[VkDevice] Can't wait for or present to a swapchain when none of the CommandListPools were allocated from a Swapchain.");
+        waitStage = ((waitStage == VK_PIPELINE_STAGE_2_NONE) ? VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT : waitStage);
+
+        // Ownership transfers // Note: Resources that were last used on another queue need that queue's work to be done first.
+        // Between different families the other queue also has to release the resources, which we submit right here.
+        {
+            const QueueFamilyIndices& indices = m_Context.GetVulkanPhysicalDevice().GetQueueFamilyIndices();
+
+            std::array<bool, static_cast<size_t>(CommandQueue::Count)> sourceQueues = { };
+            for (CommandList* list : lists)
+            {
+                const VulkanCommandList& vkList = *api_cast<VulkanCommandList*>(list);
+                for (const ImageBarrier& barrier : vkList.m_SubmissionImageBarriers)
+                {
+                    if (barrier.QueueBefore != CommandQueue::Count)
+                        sourceQueues[static_cast<size_t>(barrier.QueueBefore)] = true;
+                }
+                for (const BufferBarrier& barrier : vkList.m_SubmissionBufferBarriers)
+                {
+                    if (barrier.QueueBefore != CommandQueue::Count)
+                        sourceQueues[static_cast<size_t>(barrier.QueueBefore)] = true;
+                }
+            }
+
+            for (size_t i = 0; i < sourceQueues.size(); i++)
+            {
+                if (!sourceQueues[i])
+                    continue;
+
+                const CommandQueue sourceQueue = static_cast<CommandQueue>(i);
+                uint64_t waitValue = m_LastSubmittedValues[i];
+
+                if (indices.GetQueueFamily(sourceQueue) != indices.GetQueueFamily(queue))
+                {
+                    waitValue = RetrieveNextTimelineValue();
+                    VkCommandBuffer releaseCommandBuffer = RetrieveSubmitCommandBuffer(sourceQueue, waitValue);
+
+                    VkCommandBufferBeginInfo beginInfo = {};
+                    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+                    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+                    VK_VERIFY(vkBeginCommandBuffer(releaseCommandBuffer, &beginInfo));
+
+                    for (CommandList* list : lists)
+                        api_cast<VulkanCommandList*>(list)->RecordReleaseBarriers(releaseCommandBuffer, sourceQueue);
+
+                    VK_VERIFY(vkEndCommandBuffer(releaseCommandBuffer));
+
+                    VkCommandBufferSubmitInfo releaseInfo = {};
+                    releaseInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+                    releaseInfo.commandBuffer = releaseCommandBuffer;
+
+                    VkSemaphoreSubmitInfo releaseSignalInfo = {};
+                    releaseSignalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+                    releaseSignalInfo.semaphore = m_TimelineSemaphores[i];
+                    releaseSignalInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+                    releaseSignalInfo.value = waitValue;
+
+                    VkSubmitInfo2 releaseSubmitInfo = {};
+                    releaseSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+                    releaseSubmitInfo.commandBufferInfoCount = 1;
+                    releaseSubmitInfo.pCommandBufferInfos = &releaseInfo;
+                    releaseSubmitInfo.signalSemaphoreInfoCount = 1;
+                    releaseSubmitInfo.pSignalSemaphoreInfos = &releaseSignalInfo;
+
+                    QueueSubmit(m_Context.GetVulkanLogicalDevice().GetVkQueue(sourceQueue), releaseSubmitInfo);
+
+                    m_LastSubmittedValues[i] = waitValue;
+                    m_InFlightValues[i].push_back(waitValue);
+                }
+
+                if (waitValue == 0)
+                    continue;
+
+                VkSemaphoreSubmitInfo& info = m_SubmitWaitInfos.emplace_back();
+                info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+                info.semaphore = m_TimelineSemaphores[i];
+                info.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT; // Note: The acquire barriers are at the start of the batch
+                info.value = waitValue;
+            }
+        }
+
+        // Wait semaphores
+        if (args.WaitForSwapchainImage)
+        {
+            VkSemaphoreSubmitInfo& info = m_SubmitWaitInfos.emplace_back();
+            info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            info.semaphore = swapchain->GetVkImageAvailableSemaphore(swapchain->GetCurrentFrame());
+            info.stageMask = waitStage;
+            info.value = 0ull;
+        }
+        for (const CommandList* list : waitOn)
+        {
+            const VulkanCommandList& vkList = *api_cast<const VulkanCommandList*>(list);
+            OB_ASSERT((vkList.GetSignaledValue() != 0), "[VkDevice] CommandList has not been submitted yet.");
+
+            VkSemaphoreSubmitInfo& info = m_SubmitWaitInfos.emplace_back();
+            info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            info.semaphore = m_TimelineSemaphores[static_cast<size_t>(vkList.GetSignaledQueue())];
+            info.stageMask = waitStage;
+            info.value = vkList.GetSignaledValue();
+        }
+        for (const UploadTicket& ticket : args.WaitOnUploads)
+        {
+            if (!ticket.IsValid())
+                continue;
+
+            const VulkanUploadManager& manager = *api_cast<const VulkanUploadManager*>(ticket.Manager);
+            OB_ASSERT((ticket.Value <= manager.GetSubmittedValue()), "[VkDevice] Upload has not been flushed yet.");
+
+            // Note: With a dedicated transfer family the uploaded resources still have to be acquired, which we do at the start of this batch
+            const bool hasAcquire = manager.TakeAcquireBarriers(ticket.Value, m_SubmitAcquireBuffers, m_SubmitAcquireImages);
+            OB_ASSERT((!hasAcquire || (m_Context.GetVulkanPhysicalDevice().GetQueueFamilyIndices().GetQueueFamily(queue) == manager.GetGraphicsFamily())), "[VkDevice] Uploads can only be waited on by the queue family they were uploaded for, wait on them from a graphics family queue first.");
+
+            VkSemaphoreSubmitInfo& info = m_SubmitWaitInfos.emplace_back();
+            info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            info.semaphore = manager.GetVkTimelineSemaphore();
+            info.stageMask = (hasAcquire ? VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT : waitStage);
+            info.value = ticket.Value;
+        }
+
+        // Signal semaphores // Note: The entire batch signals a single timeline value
+        std::array<VkSemaphoreSubmitInfo, 2> signalInfos = { };
+        uint32_t signalInfoCount = 0;
+
+        const uint64_t signalValue = RetrieveNextTimelineValue();
+        for (CommandList* list : lists)
+            api_cast<VulkanCommandList*>(list)->m_SignaledValue = signalValue;
+
+        m_LastSubmittedValues[static_cast<size_t>(queue)] = signalValue;
+        m_InFlightValues[static_cast<size_t>(queue)].push_back(signalValue);
+
+        // Command infos
+        if (!m_SubmitAcquireBuffers.empty() || !m_SubmitAcquireImages.empty()) // Note: Uploads have to be acquired before anything else uses them
+        {
+            VkCommandBuffer acquireCommandBuffer = RetrieveSubmitCommandBuffer(queue, signalValue);
+
+            VkCommandBufferBeginInfo beginInfo = {};
+            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            VK_VERIFY(vkBeginCommandBuffer(acquireCommandBuffer, &beginInfo));
+
+            VkDependencyInfo dependencyInfo = {};
+            dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+            dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(m_SubmitAcquireBuffers.size());
+            dependencyInfo.pBufferMemoryBarriers = m_SubmitAcquireBuffers.data();
+            dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(m_SubmitAcquireImages.size());
+            dependencyInfo.pImageMemoryBarriers = m_SubmitAcquireImages.data();
+
+#if defined(OB_PLATFORM_APPLE)
+            VkExtension::g_vkCmdPipelineBarrier2KHR(acquireCommandBuffer, &dependencyInfo);
+#else
+            vkCmdPipelineBarrier2(acquireCommandBuffer, &dependencyInfo);
+#endif
+
+            VK_VERIFY(vkEndCommandBuffer(acquireCommandBuffer));
+
+            VkCommandBufferSubmitInfo& acquireInfo = m_SubmitCommandInfos.emplace_back();
+            acquireInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+            acquireInfo.commandBuffer = acquireCommandBuffer;
+        }
+
+        for (CommandList* list : lists)
+        {
+            const VulkanCommandList& vkList = *api_cast<VulkanCommandList*>(list);
+
+            if (!vkList.m_SubmissionImageBarriers.empty() || !vkList.m_SubmissionBufferBarriers.empty()) // Note: First use transitions have to execute before the actual commands
+            {
+                VkCommandBuffer barrierCommandBuffer = RetrieveSubmitCommandBuffer(queue, signalValue);
+                vkList.RecordSubmissionBarriers(barrierCommandBuffer);
+
+                VkCommandBufferSubmitInfo& barrierInfo = m_SubmitCommandInfos.emplace_back();
+                barrierInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+                barrierInfo.commandBuffer = barrierCommandBuffer;
+            }
+
+            VkCommandBufferSubmitInfo& commandInfo = m_SubmitCommandInfos.emplace_back();
+            commandInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+            commandInfo.commandBuffer = vkList.m_CommandBuffer;
+        }
+
+        VkSemaphoreSubmitInfo& timelineInfo = signalInfos[signalInfoCount++];
+        timelineInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+        timelineInfo.semaphore = m_TimelineSemaphores[static_cast<size_t>(queue)];
+        timelineInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        timelineInfo.value = signalValue;
+
+        if (args.OnFinishMakeSwapchainPresentable)
+        {
+            VkSemaphoreSubmitInfo& info = signalInfos[signalInfoCount++];
+            info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            info.semaphore = swapchain->GetVkSwapchainPresentableSemaphore(swapchain->GetAcquiredImage());
+            info.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            info.value = 0ull;
+        }
+
+        // Submit info
+        VkSubmitInfo2 submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+
+        submitInfo.waitSemaphoreInfoCount = static_cast<uint32_t>(m_SubmitWaitInfos.size());
+        submitInfo.pWaitSemaphoreInfos = m_SubmitWaitInfos.data();
+
+        submitInfo.commandBufferInfoCount = static_cast<uint32_t>(m_SubmitCommandInfos.size());
+        submitInfo.pCommandBufferInfos = m_SubmitCommandInfos.data();
+
+        submitInfo.signalSemaphoreInfoCount = signalInfoCount;
+        submitInfo.pSignalSemaphoreInfos = signalInfos.data();
+
+        QueueSubmit(m_Context.GetVulkanLogicalDevice().GetVkQueue(queue), submitInfo);
+    }
+
+    uint64_t VulkanDevice::GetSubmittedValue() const
+    {
+        std::scoped_lock lock(m_SubmitMutex);
+        return m_CurrentTimelineValue;
+    }
+
+    uint64_t VulkanDevice::GetLastSubmittedValue(CommandQueue queue) const
+    {
+        std::scoped_lock lock(m_SubmitMutex);
+        return m_LastSubmittedValues[static_cast<size_t>(queue)];
+    }
+
+    uint64_t VulkanDevice::GetCompletedValue() const
+    {
+        std::scoped_lock lock(m_SubmitMutex);
+        PruneCompletedValues();
+
+        // Note: Everything before the oldest unfinished value (of any queue) has completed
+        uint64_t value = m_CurrentTimelineValue;
+        for (const std::vector<uint64_t>& inFlight : m_InFlightValues)
+        {
+            if (!inFlight.empty())
+                value = std::min(value, inFlight.front() - 1);
+        }
+
+        return value;
+    }
+
+    void VulkanDevice::WaitForValue(uint64_t value) const
+    {
+        OB_PROFILE("VulkanDevice::WaitForValue()");
+
+        std::array<VkSemaphore, static_cast<size_t>(CommandQueue::Count)> semaphores = { };
+        std::array<uint64_t, static_cast<size_t>(CommandQueue::Count)> values = { };
+        uint32_t count = 0;
+
+        // Note: Every queue waits on its last submission up to (and including) value
+        {
+            std::scoped_lock lock(m_SubmitMutex);
+            PruneCompletedValues();
+
+            for (size_t i = 0; i < m_InFlightValues.size(); i++)
+            {
+                auto it = std::upper_bound(m_InFlightValues[i].begin(), m_InFlightValues[i].end(), value);
+                if (it == m_InFlightValues[i].begin())
+                    continue;
+
+                semaphores[count] = m_TimelineSemaphores[i];
+                values[count] = *std::prev(it);
+                count++;
+            }
+        }
+
+        if (count == 0)
+            return;
+
+        VkSemaphoreWaitInfo waitInfo = {};
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = count;
+        waitInfo.pSemaphores = semaphores.data();
+        waitInfo.pValues = values.data();
+
+        VK_VERIFY(vkWaitSemaphores(m_Context.GetVulkanLogicalDevice().GetVkDevice(), &waitInfo, std::numeric_limits<uint64_t>::max()));
+    }
+
     void VulkanDevice::StartTracking(const Image& image, ImageSubresourceSpecification subresources, ResourceState currentState)
     {
         OB_PROFILE("VulkanDevice::StartTracking()");
@@ -79,7 +495,14 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("VulkanDevice::MapBuffer()");
         const VulkanBuffer& vulkanBuffer = *api_cast<const VulkanBuffer*>(&buffer);
-        OB_ASSERT(static_cast<bool>(buffer.GetSpecification().CpuAccess & CpuAccessMode::Write), "[VkDevice] Can't map buffer without CpuAccessMode::Write flag.");
+        OB_ASSERT((buffer.GetSpecification().CpuAccess != CpuAccessMode::None), "[VkDevice] Can't map buffer without CpuAccessMode::Read or CpuAccessMode::Write flag.");
+
+        if (vulkanBuffer.GetMappedMemory())
+        {
+            memory = vulkanBuffer.GetMappedMemory();
+            return;
+        }
+
         m_Allocator.MapMemory(vulkanBuffer.GetVmaAllocation(), memory);
     }
 
@@ -87,21 +510,55 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("VulkanDevice::UnmapBuffer()");
         const VulkanBuffer& vulkanBuffer = *api_cast<const VulkanBuffer*>(&buffer);
+
+        if (vulkanBuffer.GetMappedMemory()) // Note: Persistently mapped buffers stay mapped till they're destroyed
+            return;
+
         m_Allocator.UnmapMemory(vulkanBuffer.GetVmaAllocation());
     }
 
+    void VulkanDevice::FlushBuffer(const Buffer& buffer, const BufferRange& range) const
+    {
+        OB_PROFILE("VulkanDevice::FlushBuffer()");
+        const VulkanBuffer& vulkanBuffer = *api_cast<const VulkanBuffer*>(&buffer);
+
+        if (vulkanBuffer.IsHostCoherent())
+            return;
+
+        OB_ASSERT((range.Size == BufferRange::FullSize) || (range.Offset + range.Size <= buffer.GetSpecification().Size), "[VkDevice] Flush range exceeds buffer size.");
+        m_Allocator.FlushMemory(vulkanBuffer.GetVmaAllocation(), range.Offset, ((range.Size == BufferRange::FullSize) ? VK_WHOLE_SIZE : range.Size));
+    }
+
+    void VulkanDevice::InvalidateBuffer(const Buffer& buffer, const BufferRange& range) const
+    {
+        OB_PROFILE("VulkanDevice::InvalidateBuffer()");
+        const VulkanBuffer& vulkanBuffer = *api_cast<const VulkanBuffer*>(&buffer);
+
+        if (vulkanBuffer.IsHostCoherent())
+            return;
+
+        OB_ASSERT((range.Size == BufferRange::FullSize) || (range.Offset + range.Size <= buffer.GetSpecification().Size), "[VkDevice] Invalidate range exceeds buffer size.");
+        m_Allocator.InvalidateMemory(vulkanBuffer.GetVmaAllocation(), range.Offset, ((range.Size == BufferRange::FullSize) ? VK_WHOLE_SIZE : range.Size));
+    }
+
     void VulkanDevice::WriteBuffer(const Buffer& buffer, const void* memory, size_t size, size_t srcOffset, size_t dstOffset) const
     {
         OB_PROFILE("VulkanDevice::WriteBuffer()");
+        const VulkanBuffer& vulkanBuffer = *api_cast<const VulkanBuffer*>(&buffer);
 
         OB_ASSERT((size + dstOffset <= buffer.GetSpecification().Size), "[VkDevice] Size + offset exceeds buffer size.");
 
-        void* bufferMemory;
-        MapBuffer(buffer, bufferMemory);
+        void* bufferMemory = vulkanBuffer.GetMappedMemory();
+        if (!bufferMemory)
+            MapBuffer(buffer, bufferMemory);
 
         std::memcpy(static_cast<uint8_t*>(bufferMemory) + dstOffset, static_cast<const uint8_t*>(memory) + srcOffset, size);
 
-        UnmapBuffer(buffer);
+        if (!vulkanBuffer.IsHostCoherent())
+            m_Allocator.FlushMemory(vulkanBuffer.GetVmaAllocation(), dstOffset, size);
+
+        if (!vulkanBuffer.GetMappedMemory())
+            UnmapBuffer(buffer);
     }
 
     void VulkanDevice::WriteImage(const StagingImage& image, const ImageSliceSpecification& slice, const void* memory, size_t size) const
@@ -113,12 +570,29 @@ namespace Obsidian::Internal
 
         VulkanStagingImage::Region region = vkImage.GetSliceRegion(slice.ImageMipLevel, slice.ImageArraySlice, 0);
 
-        void* imageMemory;
-        MapBuffer(buffer, imageMemory);
+        void* imageMemory = vkBuffer.GetMappedMemory();
+        if (!imageMemory)
+            MapBuffer(buffer, imageMemory);
 
         std::memcpy(static_cast<uint8_t*>(imageMemory) + region.Offset, static_cast<const uint8_t*>(memory), size);
 
-        UnmapBuffer(buffer);
+        if (!vkBuffer.IsHostCoherent())
+            m_Allocator.FlushMemory(vkBuffer.GetVmaAllocation(), region.Offset, size);
+
+        if (!vkBuffer.GetMappedMemory())
+            UnmapBuffer(buffer);
+    }
+
+    std::vector<uint8_t> VulkanDevice::GetPipelineCacheData() const
+    {
+        OB_PROFILE("VulkanDevice::GetPipelineCacheData()");
+        return m_Allocator.GetPipelineCacheData();
+    }
+
+    ImageMemoryRequirements VulkanDevice::GetImageMemoryRequirements(const ImageSpecification& specs) const
+    {
+        OB_PROFILE("VulkanDevice::GetImageMemoryRequirements()");
+        return VulkanImage::GetMemoryRequirements(*this, specs);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -131,7 +605,7 @@ namespace Obsidian::Internal
         for (auto& image : vulkanSwapchain.m_Images)
             DestroySubresourceViews(*api_cast<Image*>(&image.Get()));
 
-        m_Context.Destroy([instance = m_Context.GetVkInstance(), device = m_Context.GetVulkanLogicalDevice().GetVkDevice(), swapchain = vulkanSwapchain.m_Swapchain, surface = vulkanSwapchain.m_Surface, imageSemaphores = vulkanSwapchain.m_ImageAvailableSemaphores, swapchainPresentableSemaphores = vulkanSwapchain.m_SwapchainPresentableSemaphores,  timelineSemaphore = vulkanSwapchain.m_TimelineSemaphore, resizePool = vulkanSwapchain.m_ResizePool]() mutable
+        m_Context.Destroy([instance = m_Context.GetVkInstance(), device = m_Context.GetVulkanLogicalDevice().GetVkDevice(), swapchain = vulkanSwapchain.m_Swapchain, surface = vulkanSwapchain.m_Surface, imageSemaphores = vulkanSwapchain.m_ImageAvailableSemaphores, swapchainPresentableSemaphores = vulkanSwapchain.m_SwapchainPresentableSemaphores, resizePool = vulkanSwapchain.m_ResizePool]() mutable
         {
             vkDestroyCommandPool(device, resizePool, VulkanAllocator::GetCallbacks());
 
@@ -142,18 +616,37 @@ namespace Obsidian::Internal
                 vkDestroySemaphore(device, imageSemaphores[i], VulkanAllocator::GetCallbacks());
             for (size_t i = 0; i < swapchainPresentableSemaphores.size(); i++)
                 vkDestroySemaphore(device, swapchainPresentableSemaphores[i], VulkanAllocator::GetCallbacks());
-
-            vkDestroySemaphore(device, timelineSemaphore, VulkanAllocator::GetCallbacks());
         });
 
     }
 
+    void VulkanDevice::FreePool(CommandListPool& pool) const
+    {
+        VkDevice device = m_Context.GetVulkanLogicalDevice().GetVkDevice();
+        VkCommandPool commandPool = api_cast<VulkanCommandListPool*>(&pool)->GetVkCommandPool();
+        m_Context.Destroy([device, commandPool]() mutable
+        {
+            vkDestroyCommandPool(device, commandPool, VulkanAllocator::GetCallbacks());
+        });
+    }
+
     void VulkanDevice::DestroyImage(Image& image) const
     {
         DestroySubresourceViews(image);
 
         VulkanImage& vulkanImage = *api_cast<VulkanImage*>(&image);
         VkImage vkImage = vulkanImage.GetVkImage();
+
+        if (vulkanImage.IsPlaced()) // Note: The memory belongs to the heap
+        {
+            VkDevice device = m_Context.GetVulkanLogicalDevice().GetVkDevice();
+            m_Context.Destroy([device, vkImage]() mutable
+            {
+                vkDestroyImage(device, vkImage, VulkanAllocator::GetCallbacks());
+            });
+            return;
+        }
+
         VmaAllocation allocation = vulkanImage.GetVmaAllocation();
         m_Context.Destroy([vkImage, allocation, allocator = &m_Allocator]() mutable
         {
@@ -161,6 +654,15 @@ namespace Obsidian::Internal
         });
     }
 
+    void VulkanDevice::DestroyImageHeap(ImageHeap& heap) const
+    {
+        VmaAllocation allocation = api_cast<VulkanImageHeap*>(&heap)->GetVmaAllocation();
+        m_Context.Destroy([allocation, allocator = &m_Allocator]() mutable
+        {
+            allocator->FreeImageMemory(allocation);
+        });
+    }
+
     void VulkanDevice::DestroySubresourceViews(Image& image) const
     {
         VulkanImage& vkImage = *api_cast<VulkanImage*>(&image);
@@ -177,7 +679,7 @@ namespace Obsidian::Internal
                 vkDestroyImageView(device, iview, VulkanAllocator::GetCallbacks());
         });
 
-        vkImage.GetImageViews().clear();
+        vkImage.ClearImageViews();
     }
 
     void VulkanDevice::DestroyStagingImage(StagingImage& stagingImage) const
@@ -190,6 +692,9 @@ namespace Obsidian::Internal
     {
         VulkanSampler& vulkanSampler = *api_cast<VulkanSampler*>(&sampler);
 
+        if (!m_SamplerCache.Release(vulkanSampler.GetSpecification())) // Note: The VkSampler may be shared with other samplers
+            return;
+
         VkDevice device = m_Context.GetVulkanLogicalDevice().GetVkDevice();
         VkSampler vkSampler = vulkanSampler.GetVkSampler();
         m_Context.Destroy([device, vkSampler]() mutable
@@ -261,9 +766,24 @@ namespace Obsidian::Internal
 
         VkDevice device = m_Context.GetVulkanLogicalDevice().GetVkDevice();
         VkDescriptorSetLayout vkLayout = vulkanPool.GetVkDescriptorSetLayout();
-        m_Context.Destroy([device, vkLayout]() mutable
+        VkDescriptorUpdateTemplate vkUpdateTemplate = vulkanPool.GetVkDescriptorUpdateTemplate();
+
+        // Note: Immutable samplers come from the sampler cache, only the last reference destroys them
+        std::vector<VkSampler> vkSamplers;
+        for (const auto& [slot, vkSampler] : vulkanPool.GetImmutableSamplers())
         {
+            if (m_SamplerCache.Release(vulkanPool.GetItem(slot).ImmutableSampler.value()))
+                vkSamplers.push_back(vkSampler);
+        }
+
+        m_Context.Destroy([device, vkLayout, vkUpdateTemplate, vkSamplers = std::move(vkSamplers)]() mutable
+        {
+            if (vkUpdateTemplate != VK_NULL_HANDLE)
+                vkDestroyDescriptorUpdateTemplate(device, vkUpdateTemplate, VulkanAllocator::GetCallbacks());
             vkDestroyDescriptorSetLayout(device, vkLayout, VulkanAllocator::GetCallbacks());
+
+            for (VkSampler vkSampler : vkSamplers)
+                vkDestroySampler(device, vkSampler, VulkanAllocator::GetCallbacks());
         });
     }
 
@@ -271,6 +791,17 @@ namespace Obsidian::Internal
     {
         VulkanBindingSetPool& vulkanPool = *api_cast<VulkanBindingSetPool*>(&pool);
 
+        if (vulkanPool.UsesDescriptorBuffer())
+        {
+            VkDeviceSize offset = vulkanPool.GetDescriptorOffset();
+            VkDeviceSize size = vulkanPool.GetDescriptorRangeSize();
+            m_Context.Destroy([offset, size, heap = &m_DescriptorHeap]() mutable
+            {
+                heap->Free(offset, size);
+            });
+            return;
+        }
+
         VkDevice device = m_Context.GetVulkanLogicalDevice().GetVkDevice();
         VkDescriptorPool vkPool = vulkanPool.GetVkDescriptorPool();
         m_Context.Destroy([device, vkPool]() mutable
@@ -286,10 +817,12 @@ namespace Obsidian::Internal
         VkDevice device = m_Context.GetVulkanLogicalDevice().GetVkDevice();
         VkPipelineLayout vkPipelineLayout = vulkanGraphicsPipeline.GetVkPipelineLayout();
         VkPipeline vkPipeline = vulkanGraphicsPipeline.GetVkPipeline();
-        m_Context.Destroy([device, vkPipelineLayout, vkPipeline]() mutable
+        bool destroyLayout = m_PipelineLayoutCache.Release(vkPipelineLayout); // Note: The layout may be shared with other pipelines
+        m_Context.Destroy([device, vkPipelineLayout, vkPipeline, destroyLayout]() mutable
         {
             vkDestroyPipeline(device, vkPipeline, VulkanAllocator::GetCallbacks());
-            vkDestroyPipelineLayout(device, vkPipelineLayout, VulkanAllocator::GetCallbacks());
+            if (destroyLayout)
+                vkDestroyPipelineLayout(device, vkPipelineLayout, VulkanAllocator::GetCallbacks());
         });
     }
 
@@ -300,11 +833,118 @@ namespace Obsidian::Internal
         VkDevice device = m_Context.GetVulkanLogicalDevice().GetVkDevice();
         VkPipelineLayout vkPipelineLayout = vulkanComputePipeline.GetVkPipelineLayout();
         VkPipeline vkPipeline = vulkanComputePipeline.GetVkPipeline();
-        m_Context.Destroy([device, vkPipelineLayout, vkPipeline]() mutable
+        bool destroyLayout = m_PipelineLayoutCache.Release(vkPipelineLayout); // Note: The layout may be shared with other pipelines
+        m_Context.Destroy([device, vkPipelineLayout, vkPipeline, destroyLayout]() mutable
         {
             vkDestroyPipeline(device, vkPipeline, VulkanAllocator::GetCallbacks());
-            vkDestroyPipelineLayout(device, vkPipelineLayout, VulkanAllocator::GetCallbacks());
+            if (destroyLayout)
+                vkDestroyPipelineLayout(device, vkPipelineLayout, VulkanAllocator::GetCallbacks());
+        });
+    }
+
+    void VulkanDevice::DestroyQueryPool(QueryPool& pool) const
+    {
+        VulkanQueryPool& vulkanQueryPool = *api_cast<VulkanQueryPool*>(&pool);
+
+        VkDevice device = m_Context.GetVulkanLogicalDevice().GetVkDevice();
+        VkQueryPool vkQueryPool = vulkanQueryPool.GetVkQueryPool();
+        m_Context.Destroy([device, vkQueryPool]() mutable
+        {
+            vkDestroyQueryPool(device, vkQueryPool, VulkanAllocator::GetCallbacks());
         });
     }
 
+    void VulkanDevice::DestroyUploadManager(UploadManager& manager) const
+    {
+        VulkanUploadManager& vulkanManager = *api_cast<VulkanUploadManager*>(&manager);
+
+        // Note: Everything recorded still gets submitted and waited on, since the staging ring is owned by the manager
+        vulkanManager.Wait(vulkanManager.Flush());
+
+        VkDevice device = m_Context.GetVulkanLogicalDevice().GetVkDevice();
+        VkSemaphore semaphore = vulkanManager.m_TimelineSemaphore;
+        VkCommandPool transferPool = vulkanManager.m_TransferPool;
+        VkCommandPool graphicsPool = vulkanManager.m_GraphicsPool;
+        VkBuffer stagingBuffer = vulkanManager.m_StagingBuffer;
+        VmaAllocation stagingAllocation = vulkanManager.m_StagingAllocation;
+        m_Context.Destroy([device, semaphore, transferPool, graphicsPool, stagingBuffer, stagingAllocation, allocator = &m_Allocator]() mutable
+        {
+            vkDestroyCommandPool(device, transferPool, VulkanAllocator::GetCallbacks());
+            if (graphicsPool)
+                vkDestroyCommandPool(device, graphicsPool, VulkanAllocator::GetCallbacks());
+
+            vkDestroySemaphore(device, semaphore, VulkanAllocator::GetCallbacks());
+            allocator->DestroyBuffer(stagingBuffer, stagingAllocation);
+        });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Internal methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    uint64_t VulkanDevice::RetrieveNextTimelineValue() const
+    {
+        return ++m_CurrentTimelineValue;
+    }
+
+    void VulkanDevice::SubmitToQueue(VkQueue queue, const VkSubmitInfo2& submitInfo) const
+    {
+        std::scoped_lock lock(m_SubmitMutex); // Note: Queues have to be externally synchronized
+        QueueSubmit(queue, submitInfo);
+    }
+
+    VkResult VulkanDevice::PresentToQueue(VkQueue queue, const VkPresentInfoKHR& presentInfo) const
+    {
+        std::scoped_lock lock(m_SubmitMutex); // Note: Queues have to be externally synchronized
+        return vkQueuePresentKHR(queue, &presentInfo);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanDevice::PruneCompletedValues() const
+    {
+        for (size_t i = 0; i < m_InFlightValues.size(); i++)
+        {
+            if (m_InFlightValues[i].empty())
+                continue;
+
+            uint64_t completedValue = 0;
+            VK_VERIFY(vkGetSemaphoreCounterValue(m_Context.GetVulkanLogicalDevice().GetVkDevice(), m_TimelineSemaphores[i], &completedValue));
+
+            // Note: Erasing from the front keeps the capacity, so tracking values doesn't allocate once it's large enough
+            m_InFlightValues[i].erase(m_InFlightValues[i].begin(), std::upper_bound(m_InFlightValues[i].begin(), m_InFlightValues[i].end(), completedValue));
+        }
+    }
+
+    VkCommandBuffer VulkanDevice::RetrieveSubmitCommandBuffer(CommandQueue queue, uint64_t value) const
+    {
+        auto& commandBuffers = m_SubmitCommandBuffers[static_cast<size_t>(queue)];
+
+        // Note: Command buffers are reused once the queue's timeline has passed their value,
+        // so the list only grows up to the amount of submissions that are in flight at once.
+        uint64_t completedValue = 0;
+        VK_VERIFY(vkGetSemaphoreCounterValue(m_Context.GetVulkanLogicalDevice().GetVkDevice(), m_TimelineSemaphores[static_cast<size_t>(queue)], &completedValue));
+
+        for (auto& [commandBufferValue, commandBuffer] : commandBuffers)
+        {
+            if (commandBufferValue > completedValue)
+                continue;
+
+            commandBufferValue = value;
+            return commandBuffer;
+        }
+
+        VkCommandBufferAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = m_SubmitPools[static_cast<size_t>(queue)];
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VK_VERIFY(vkAllocateCommandBuffers(m_Context.GetVulkanLogicalDevice().GetVkDevice(), &allocInfo, &commandBuffer));
+
+        commandBuffers.emplace_back(value, commandBuffer);
+        return commandBuffer;
+    }
+
 }
\ No newline at end of file
@@ -1,20 +1,33 @@
 #pragma once
 
 #include "Obsidian/Core/Information.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
 
 #include "Obsidian/Renderer/API.hpp"
 #include "Obsidian/Renderer/DeviceSpec.hpp"
+#include "Obsidian/Renderer/CommandListSpec.hpp"
 #include "Obsidian/Renderer/StateTracker.hpp"
 
 #include "Obsidian/Platform/Vulkan/Vulkan.hpp"
 #include "Obsidian/Platform/Vulkan/VulkanContext.hpp"
+#include "Obsidian/Platform/Vulkan/VulkanImage.hpp"
+#include "Obsidian/Platform/Vulkan/VulkanPipeline.hpp"
+#include "Obsidian/Platform/Vulkan/VulkanBindings.hpp"
 
 #include <Nano/Nano.hpp>
 
+#include <span>
+#include <array>
+#include <mutex>
+#include <vector>
+
 namespace Obsidian
 {
     class Swapchain;
+    class CommandList;
+    class CommandListPool;
     class Image;
+    class ImageHeap;
     class StagingImage;
     class Sampler;
     class InputLayout;
@@ -26,12 +39,15 @@ namespace Obsidian
     class Shader;
     class GraphicsPipeline;
     class ComputePipeline;
+    class QueryPool;
+    class UploadManager;
 }
 
 namespace Obsidian::Internal
 {
 
     class VulkanDevice;
+    class VulkanCommandList;
 
 #if defined(OB_API_VULKAN)
     ////////////////////////////////////////////////////////////////////////////////////
@@ -47,6 +63,12 @@ namespace Obsidian::Internal
         // Methods
         void Wait() const;
 
+        void Submit(std::span<CommandList*> lists, const CommandListSubmitArgs& args) const;
+
+        uint64_t GetSubmittedValue() const;
+        uint64_t GetCompletedValue() const;
+        void WaitForValue(uint64_t value) const;
+
         void StartTracking(const Image& image, ImageSubresourceSpecification subresources, ResourceState currentState);
         void StartTracking(const StagingImage& image, ResourceState currentState);
         void StartTracking(const Buffer& buffer, ResourceState currentState);
@@ -56,14 +78,22 @@ namespace Obsidian::Internal
 
         void MapBuffer(const Buffer& buffer, void*& memory) const;
         void UnmapBuffer(const Buffer& buffer) const;
+        void FlushBuffer(const Buffer& buffer, const BufferRange& range) const;
+        void InvalidateBuffer(const Buffer& buffer, const BufferRange& range) const;
 
         void WriteBuffer(const Buffer& buffer, const void* memory, size_t size, size_t srcOffset, size_t dstOffset) const;
         void WriteImage(const StagingImage& image, const ImageSliceSpecification& slice, const void* memory, size_t size) const;
 
+        std::vector<uint8_t> GetPipelineCacheData() const;
+
+        ImageMemoryRequirements GetImageMemoryRequirements(const ImageSpecification& specs) const;
+
         // Destruction methods
         void DestroySwapchain(Swapchain& swapchain) const;
+        void FreePool(CommandListPool& pool) const;
 
         void DestroyImage(Image& image) const;
+        void DestroyImageHeap(ImageHeap& heap) const;
         void DestroySubresourceViews(Image& image) const;
         void DestroyStagingImage(StagingImage& stagingImage) const;
         void DestroySampler(Sampler& sampler) const;
@@ -83,15 +113,68 @@ namespace Obsidian::Internal
         void DestroyGraphicsPipeline(GraphicsPipeline& pipeline) const;
         void DestroyComputePipeline(ComputePipeline& pipeline) const;
 
+        void DestroyQueryPool(QueryPool& pool) const;
+
+        void DestroyUploadManager(UploadManager& manager) const;
+
+        // Internal methods
+        uint64_t RetrieveNextTimelineValue() const;
+        void SubmitToQueue(VkQueue queue, const VkSubmitInfo2& submitInfo) const; // Note: Raw submission, shares the submit lock with Submit()
+        VkResult PresentToQueue(VkQueue queue, const VkPresentInfoKHR& presentInfo) const; // Note: The present queue may be the graphics/compute queue, so it shares the submit lock
+
         // Internal Getters
         inline const VulkanContext& GetContext() const { return m_Context; }
         inline const VulkanAllocator& GetAllocator() const { return m_Allocator; }
         inline const StateTracker& GetTracker() const { return m_StateTracker; }
+        inline VulkanPipelineLayoutCache& GetPipelineLayoutCache() const { return m_PipelineLayoutCache; }
+        inline VulkanSamplerCache& GetSamplerCache() const { return m_SamplerCache; }
+        inline VulkanDescriptorHeap& GetDescriptorHeap() const { return m_DescriptorHeap; } // Note: Only valid when the context uses descriptor buffers
+
+        inline VkSemaphore GetVkTimelineSemaphore(CommandQueue queue) const { return m_TimelineSemaphores[static_cast<size_t>(queue)]; }
+        inline uint64_t GetCurrentTimelineValue() const { return m_CurrentTimelineValue; }
+        uint64_t GetLastSubmittedValue(CommandQueue queue) const;
+
+#if OB_GPU_PROFILING_ENABLED
+        inline TracyVkCtx GetTracyContext(CommandQueue queue) const { return m_TracyContexts[static_cast<size_t>(queue)]; }
+#endif
+
+    private:
+        // Private methods
+        void PruneCompletedValues() const; // Note: Must be called with the submit lock held
+        VkCommandBuffer RetrieveSubmitCommandBuffer(CommandQueue queue, uint64_t value) const; // Note: Must be called with the submit lock held, reusable once queue's timeline reaches value
 
     private:
         VulkanContext m_Context;
         VulkanAllocator m_Allocator;
         mutable StateTracker m_StateTracker;
+        mutable VulkanPipelineLayoutCache m_PipelineLayoutCache = {};
+        mutable VulkanSamplerCache m_SamplerCache = {};
+        mutable VulkanDescriptorHeap m_DescriptorHeap;
+
+        // Note: The submission timeline is owned by the device (instead of a swapchain), 
+        // so commandlists can be submitted and waited on without any swapchain (headless).
+        // Every queue signals its own semaphore, since queues finish out of order and a timeline can't go backwards.
+        // The values are shared between all queues, so a value still identifies a single submission.
+        std::array<VkSemaphore, static_cast<size_t>(CommandQueue::Count)> m_TimelineSemaphores = { };
+        mutable uint64_t m_CurrentTimelineValue = 0;
+        mutable std::array<uint64_t, static_cast<size_t>(CommandQueue::Count)> m_LastSubmittedValues = { };
+        mutable std::array<std::vector<uint64_t>, static_cast<size_t>(CommandQueue::Count)> m_InFlightValues = { }; // Note: Values that haven't been seen completed yet, ascending
+
+        // Note: Holds the commandbuffers recorded at submission, the first use transitions of lists and the release half
+        // of ownership transfers. They are only touched under the submit lock, so recording lists never shares a pool with them.
+        std::array<VkCommandPool, static_cast<size_t>(CommandQueue::Count)> m_SubmitPools = { };
+        mutable std::array<std::vector<std::pair<uint64_t, VkCommandBuffer>>, static_cast<size_t>(CommandQueue::Count)> m_SubmitCommandBuffers = { };
+
+        // Note: Reused for every submission, so submitting doesn't allocate once the capacity is reached.
+        mutable std::mutex m_SubmitMutex = {};
+        mutable std::vector<VkSemaphoreSubmitInfo> m_SubmitWaitInfos = { };
+        mutable std::vector<VkCommandBufferSubmitInfo> m_SubmitCommandInfos = { };
+        mutable std::vector<VkBufferMemoryBarrier2> m_SubmitAcquireBuffers = { }; // Note: The graphics acquire half of uploads that are waited on
+        mutable std::vector<VkImageMemoryBarrier2> m_SubmitAcquireImages = { };
+
+#if OB_GPU_PROFILING_ENABLED
+        std::array<TracyVkCtx, static_cast<size_t>(CommandQueue::Count)> m_TracyContexts = { }; // Note: Used for GPU zones, which show up next to the CPU zones in Tracy
+#endif
     };
 #endif
 
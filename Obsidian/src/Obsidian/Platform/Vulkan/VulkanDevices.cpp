@@ -19,14 +19,14 @@ namespace
         .robustBufferAccess = VK_FALSE,
         .fullDrawIndexUint32 = VK_FALSE,
         .imageCubeArray = VK_FALSE,
-        .independentBlend = VK_FALSE,
+        .independentBlend = VK_TRUE, // Note: Needed for per attachment blend states
         .geometryShader = VK_FALSE,
         .tessellationShader = VK_FALSE,
         .sampleRateShading = VK_FALSE,
         .dualSrcBlend = VK_FALSE,
         .logicOp = VK_FALSE,
-        .multiDrawIndirect = VK_FALSE,
-        .drawIndirectFirstInstance = VK_FALSE,
+        .multiDrawIndirect = VK_TRUE, // Needed for DrawIndexedIndirect(Count) with more than 1 draw
+        .drawIndirectFirstInstance = VK_TRUE, // Needed for StartInstanceLocation in indirect draws
         .depthClamp = VK_FALSE,
         .depthBiasClamp = VK_FALSE,
         .fillModeNonSolid = VK_TRUE, // Needed
@@ -40,7 +40,7 @@ namespace
         .textureCompressionASTC_LDR = VK_FALSE,
         .textureCompressionBC = VK_FALSE,
         .occlusionQueryPrecise = VK_FALSE,
-        .pipelineStatisticsQuery = VK_FALSE,
+        .pipelineStatisticsQuery = VK_FALSE, // Note: Optional, enabled by the logical device when supported (QueryType::PipelineStatistics)
         .vertexPipelineStoresAndAtomics = VK_FALSE,
         .fragmentStoresAndAtomics = VK_FALSE,
         .shaderTessellationAndGeometryPointSize = VK_FALSE,
@@ -91,7 +91,7 @@ namespace
         .shaderStorageTexelBufferArrayNonUniformIndexing = VK_FALSE,
         .descriptorBindingUniformBufferUpdateAfterBind = VK_TRUE, // Needed for bindless
         .descriptorBindingSampledImageUpdateAfterBind = VK_TRUE, // Needed for bindless
-        .descriptorBindingStorageImageUpdateAfterBind = VK_FALSE,
+        .descriptorBindingStorageImageUpdateAfterBind = VK_FALSE, // Note: Enabled when supported, see QueryOptionalFeatures()
         .descriptorBindingStorageBufferUpdateAfterBind = VK_FALSE,
         .descriptorBindingUniformTexelBufferUpdateAfterBind = VK_FALSE,
         .descriptorBindingStorageTexelBufferUpdateAfterBind = VK_FALSE,
@@ -115,6 +115,13 @@ namespace
         .synchronization2 = VK_TRUE
     };
 
+    inline constexpr static VkPhysicalDeviceDynamicRenderingFeatures s_RequestedDynamicRenderingFeatures = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES,
+        .pNext = nullptr,
+
+        .dynamicRendering = VK_TRUE
+    };
+
 }
 
 namespace Obsidian::Internal
@@ -123,9 +130,9 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Methods
     ////////////////////////////////////////////////////////////////////////////////////
-    bool QueueFamilyInfo::SupportsRequired() const
+    bool QueueFamilyInfo::SupportsRequired(bool requirePresent) const
     {
-        return ((static_cast<bool>(Flags & QueueFamilyFlags::Graphics)) && (static_cast<bool>(Flags & QueueFamilyFlags::Compute)) && (static_cast<bool>(Flags & QueueFamilyFlags::Present)));
+        return ((static_cast<bool>(Flags & QueueFamilyFlags::Graphics)) && (static_cast<bool>(Flags & QueueFamilyFlags::Compute)) && (!requirePresent || static_cast<bool>(Flags & QueueFamilyFlags::Present)));
     }
 
     bool QueueFamilyInfo::EnoughQueues() const
@@ -133,6 +140,16 @@ namespace Obsidian::Internal
         return Count >= 3;
     }
 
+    bool QueueFamilyInfo::IsDedicatedTransfer() const
+    {
+        return ((static_cast<bool>(Flags & QueueFamilyFlags::Transfer)) && (!static_cast<bool>(Flags & QueueFamilyFlags::Graphics)) && (!static_cast<bool>(Flags & QueueFamilyFlags::Compute)) && (Count > 0));
+    }
+
+    bool QueueFamilyInfo::IsDedicatedCompute() const
+    {
+        return ((static_cast<bool>(Flags & QueueFamilyFlags::Compute)) && (!static_cast<bool>(Flags & QueueFamilyFlags::Graphics)) && (Count > 0));
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Methods
     ////////////////////////////////////////////////////////////////////////////////////
@@ -143,7 +160,22 @@ namespace Obsidian::Internal
 
     bool QueueFamilyIndices::SameQueue() const 
     {
-        return ((GraphicsQueue == PresentQueue) && (PresentQueue == ComputeQueue)); 
+        return ((GraphicsQueue == PresentQueue) && (PresentQueue == ComputeQueue) && (ComputeFamily == QueueFamily)); 
+    }
+
+    bool QueueFamilyIndices::HasDedicatedCompute() const
+    {
+        return (ComputeFamily != QueueFamily);
+    }
+
+    bool QueueFamilyIndices::HasDedicatedTransfer() const
+    {
+        return (TransferFamily != QueueFamily);
+    }
+
+    uint32_t QueueFamilyIndices::GetQueueFamily(CommandQueue queue) const
+    {
+        return ((queue == CommandQueue::Compute) ? ComputeFamily : QueueFamily);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -169,16 +201,20 @@ namespace Obsidian::Internal
             info.Count = queueFamily.queueCount;
             info.Flags = static_cast<QueueFamilyFlags>(queueFamily.queueFlags);
 
-			VkBool32 presentSupport;
-			vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
-            if (presentSupport)
-                info.Flags |= QueueFamilyFlags::Present;
+            // Note: Headless devices don't have a surface to present to
+            if (surface)
+            {
+			    VkBool32 presentSupport;
+			    vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
+                if (presentSupport)
+                    info.Flags |= QueueFamilyFlags::Present;
+            }
 		}
 
         // Make choices
         for (const auto& queue : indices.Queues) // Note: We want all queues to be from the same queue family to avoid messy synchronization
         {
-            if (queue.SupportsRequired())
+            if (queue.SupportsRequired(surface != VK_NULL_HANDLE))
             {
                 if (queue.EnoughQueues())
                 {
@@ -200,6 +236,32 @@ namespace Obsidian::Internal
 
         OB_ASSERT(indices.CompletedQueues, "[VkDevice] Failed to query queues. Contact developer.");
 
+        // Note: Compute work goes through a dedicated compute family (if there is one), so it can overlap with rendering.
+        // Resources moving between the families get explicit ownership transfers.
+        indices.ComputeFamily = indices.QueueFamily;
+        for (const auto& queue : indices.Queues)
+        {
+            if (queue.IsDedicatedCompute())
+            {
+                indices.ComputeFamily = queue.Index;
+                indices.ComputeQueue = 0;
+                break;
+            }
+        }
+
+        // Note: Uploads go through a dedicated transfer family (if there is one), so they don't compete with rendering.
+        indices.TransferFamily = indices.QueueFamily;
+        indices.TransferQueue = indices.GraphicsQueue;
+        for (const auto& queue : indices.Queues)
+        {
+            if (queue.IsDedicatedTransfer())
+            {
+                indices.TransferFamily = queue.Index;
+                indices.TransferQueue = 0;
+                break;
+            }
+        }
+
 		return indices;
 	}
 
@@ -235,7 +297,6 @@ namespace Obsidian::Internal
     VulkanPhysicalDevice::VulkanPhysicalDevice(VkInstance instance, VkSurfaceKHR surface, std::span<const char*> extensions)
     {
         OB_ASSERT(instance, "[VkPhysicalDevice] No valid instance passed in.");
-        OB_ASSERT(instance, "[VkPhysicalDevice] No valid surface passed in.");
 
         uint32_t deviceCount;
         VK_VERIFY(vkEnumeratePhysicalDevices(instance, &deviceCount, nullptr));
@@ -255,6 +316,9 @@ namespace Obsidian::Internal
         }
 
         OB_ASSERT(m_PhysicalDevice, "[VkPhysicalDevice] Failed to find a GPU with support for this application's required Vulkan capabilities!");
+
+        QueryDescriptorBufferSupport();
+        QueryOptionalFeatures();
     }
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -289,16 +353,77 @@ namespace Obsidian::Internal
 	////////////////////////////////////////////////////////////////////////////////////
     // Private methods
 	////////////////////////////////////////////////////////////////////////////////////
+    void VulkanPhysicalDevice::QueryDescriptorBufferSupport()
+    {
+        auto extension = std::to_array<const char*>({ VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME });
+        if (!ExtensionsSupported(m_PhysicalDevice, extension))
+            return;
+
+        VkPhysicalDeviceBufferDeviceAddressFeatures bufferDeviceAddressFeatures = {};
+        bufferDeviceAddressFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES;
+        bufferDeviceAddressFeatures.pNext = nullptr;
+
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures = {};
+        descriptorBufferFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+        descriptorBufferFeatures.pNext = &bufferDeviceAddressFeatures;
+
+        VkPhysicalDeviceFeatures2 deviceFeatures = {};
+        deviceFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        deviceFeatures.pNext = &descriptorBufferFeatures;
+
+        vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &deviceFeatures);
+
+        m_DescriptorBuffers = (descriptorBufferFeatures.descriptorBuffer && bufferDeviceAddressFeatures.bufferDeviceAddress);
+        if (!m_DescriptorBuffers)
+            return;
+
+        m_DescriptorBufferProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        m_DescriptorBufferProperties.pNext = nullptr;
+
+        VkPhysicalDeviceProperties2 properties = {};
+        properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        properties.pNext = &m_DescriptorBufferProperties;
+
+        vkGetPhysicalDeviceProperties2(m_PhysicalDevice, &properties);
+    }
+
+    void VulkanPhysicalDevice::QueryOptionalFeatures()
+    {
+        VkPhysicalDeviceFeatures supportedFeatures = {};
+        vkGetPhysicalDeviceFeatures(m_PhysicalDevice, &supportedFeatures);
+
+        m_PipelineStatistics = supportedFeatures.pipelineStatisticsQuery;
+
+        VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures = {};
+        indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+        indexingFeatures.pNext = nullptr;
+
+        VkPhysicalDeviceFeatures2 features = {};
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features.pNext = &indexingFeatures;
+
+        vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &features);
+
+        m_StorageUpdateAfterBind = (indexingFeatures.descriptorBindingStorageImageUpdateAfterBind && indexingFeatures.descriptorBindingStorageBufferUpdateAfterBind);
+        m_UpdateUnusedWhilePending = indexingFeatures.descriptorBindingUpdateUnusedWhilePending;
+        m_NonUniformIndexing = (indexingFeatures.shaderSampledImageArrayNonUniformIndexing && indexingFeatures.shaderStorageImageArrayNonUniformIndexing && indexingFeatures.shaderStorageBufferArrayNonUniformIndexing);
+
+        VkPhysicalDeviceProperties properties = {};
+        vkGetPhysicalDeviceProperties(m_PhysicalDevice, &properties);
+
+        m_MaxColourAttachments = properties.limits.maxColorAttachments;
+    }
+
 	bool VulkanPhysicalDevice::PhysicalDeviceSuitable(VkSurfaceKHR surface, VkPhysicalDevice device, std::span<const char*> extensions)
 	{
 		m_QueueIndices = QueueFamilyIndices::Find(surface, device);
-        SwapchainSupportDetails swapchainSupportDetails = SwapchainSupportDetails::Query(surface, device);
 
 		bool extensionsSupported = ExtensionsSupported(device, extensions);
-		bool swapChainAdequate = false;
+		bool swapChainAdequate = (surface == VK_NULL_HANDLE); // Note: Headless devices don't need swapchain support
 
-		if (extensionsSupported)
+		if (extensionsSupported && surface)
 		{
+            SwapchainSupportDetails swapchainSupportDetails = SwapchainSupportDetails::Query(surface, device);
 			swapChainAdequate = !swapchainSupportDetails.Formats.empty() && !swapchainSupportDetails.PresentModes.empty();
 		}
 
@@ -310,9 +435,13 @@ namespace Obsidian::Internal
 		indexFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
 		indexFeatures.pNext = nullptr;
 
+        VkPhysicalDeviceDynamicRenderingFeatures dynamicRenderingFeatures = {};
+        dynamicRenderingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES;
+        dynamicRenderingFeatures.pNext = &indexFeatures;
+
         VkPhysicalDeviceSynchronization2Features synchronization2Features = {};
         synchronization2Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES;
-        synchronization2Features.pNext = &indexFeatures;
+        synchronization2Features.pNext = &dynamicRenderingFeatures;
 
         VkPhysicalDeviceTimelineSemaphoreFeatures timelineFeatures = {};
         timelineFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
@@ -328,7 +457,8 @@ namespace Obsidian::Internal
             FeaturesSupported(s_RequestedDeviceFeatures, supportedFeatures) && 
             FeaturesSupported(s_RequestedDescriptorIndexingFeatures, indexFeatures) &&
             FeaturesSupported(s_RequestedTimelineSemaphoreFeatures,  timelineFeatures) &&
-            FeaturesSupported(s_RequestedSynchronization2Features, synchronization2Features);
+            FeaturesSupported(s_RequestedSynchronization2Features, synchronization2Features) &&
+            FeaturesSupported(s_RequestedDynamicRenderingFeatures, dynamicRenderingFeatures);
 	}
 
 	bool VulkanPhysicalDevice::ExtensionsSupported(VkPhysicalDevice device, std::span<const char*> extensions)
@@ -471,43 +601,96 @@ namespace Obsidian::Internal
         return !failed;
     }
 
+    bool VulkanPhysicalDevice::FeaturesSupported(const VkPhysicalDeviceDynamicRenderingFeatures& requested, const VkPhysicalDeviceDynamicRenderingFeatures& found)
+    {
+        constexpr auto features = std::tuple{
+            &VkPhysicalDeviceDynamicRenderingFeatures::dynamicRendering
+        };
+
+        bool failed = false;
+        std::apply([&](auto... featurePtr) { ((failed |= (requested.*featurePtr && !(found.*featurePtr))), ...); }, features);
+
+        return !failed;
+    }
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// Constructor & Destructor
 	////////////////////////////////////////////////////////////////////////////////////
-    VulkanLogicalDevice::VulkanLogicalDevice(VulkanPhysicalDevice& physicalDevice, std::span<const char*> extensions)
+    VulkanLogicalDevice::VulkanLogicalDevice(VulkanPhysicalDevice& physicalDevice, std::span<const char*> extensions, bool descriptorBuffers)
 		: m_PhysicalDevice(physicalDevice)
 	{
 		const QueueFamilyIndices& indices = m_PhysicalDevice.GetQueueFamilyIndices();
 
-        uint32_t queueCount = (indices.SameQueue() ? 1 : 3);
+        uint32_t queueCount = std::max(indices.GraphicsQueue, indices.PresentQueue) + 1;
+        if (!indices.HasDedicatedCompute())
+            queueCount = std::max(queueCount, indices.ComputeQueue + 1);
+
         std::vector<float> queuePriorities(queueCount, 1.0f);
 
-        VkDeviceQueueCreateInfo queueCreateInfo = {};
+        std::array<VkDeviceQueueCreateInfo, 3> queueCreateInfos = { };
+        uint32_t queueCreateInfoCount = 0;
+
+        VkDeviceQueueCreateInfo& queueCreateInfo = queueCreateInfos[queueCreateInfoCount++];
 		queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
 		queueCreateInfo.queueFamilyIndex = indices.QueueFamily;
 		queueCreateInfo.queueCount = queueCount;
 		queueCreateInfo.pQueuePriorities = queuePriorities.data();
 
-		// Enable dynamic rendering features // Note: Dynamic rendering & bindless is currently disabled
-		// VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeature = {};
-		// dynamicRenderingFeature.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERIOB_FEATURES_KHR;
-		// dynamicRenderingFeature.dynamicRendering = VK_TRUE;
-        
+        if (indices.HasDedicatedCompute())
+        {
+            VkDeviceQueueCreateInfo& computeCreateInfo = queueCreateInfos[queueCreateInfoCount++];
+            computeCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            computeCreateInfo.queueFamilyIndex = indices.ComputeFamily;
+            computeCreateInfo.queueCount = 1;
+            computeCreateInfo.pQueuePriorities = queuePriorities.data();
+        }
+        if (indices.HasDedicatedTransfer())
+        {
+            VkDeviceQueueCreateInfo& transferCreateInfo = queueCreateInfos[queueCreateInfoCount++];
+            transferCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            transferCreateInfo.queueFamilyIndex = indices.TransferFamily;
+            transferCreateInfo.queueCount = 1;
+            transferCreateInfo.pQueuePriorities = queuePriorities.data();
+        }
+
+        VkPhysicalDeviceFeatures deviceFeatures = s_RequestedDeviceFeatures;
+        deviceFeatures.pipelineStatisticsQuery = (m_PhysicalDevice.SupportsPipelineStatistics() ? VK_TRUE : VK_FALSE);
+
 		VkPhysicalDeviceDescriptorIndexingFeaturesEXT indexingFeatures = s_RequestedDescriptorIndexingFeatures;
-        indexingFeatures.pNext = nullptr; //&dynamicRenderingFeature;
+        indexingFeatures.pNext = nullptr;
+        indexingFeatures.descriptorBindingStorageImageUpdateAfterBind = (m_PhysicalDevice.SupportsStorageUpdateAfterBind() ? VK_TRUE : VK_FALSE);
+        indexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = (m_PhysicalDevice.SupportsStorageUpdateAfterBind() ? VK_TRUE : VK_FALSE);
+        indexingFeatures.descriptorBindingUpdateUnusedWhilePending = (m_PhysicalDevice.SupportsUpdateUnusedWhilePending() ? VK_TRUE : VK_FALSE);
+        indexingFeatures.shaderSampledImageArrayNonUniformIndexing = (m_PhysicalDevice.SupportsNonUniformIndexing() ? VK_TRUE : VK_FALSE);
+        indexingFeatures.shaderStorageImageArrayNonUniformIndexing = (m_PhysicalDevice.SupportsNonUniformIndexing() ? VK_TRUE : VK_FALSE);
+        indexingFeatures.shaderStorageBufferArrayNonUniformIndexing = (m_PhysicalDevice.SupportsNonUniformIndexing() ? VK_TRUE : VK_FALSE);
+
+        VkPhysicalDeviceDynamicRenderingFeatures dynamicRenderingFeatures = s_RequestedDynamicRenderingFeatures;
+        dynamicRenderingFeatures.pNext = &indexingFeatures;
 
         VkPhysicalDeviceSynchronization2Features synchronization2Features = s_RequestedSynchronization2Features;
-        synchronization2Features.pNext = &indexingFeatures;
+        synchronization2Features.pNext = &dynamicRenderingFeatures;
 
         VkPhysicalDeviceTimelineSemaphoreFeatures timelineFeatures = s_RequestedTimelineSemaphoreFeatures;
         timelineFeatures.pNext = &synchronization2Features;
 
+        // Note: Only chained in when descriptor buffers are in use
+        VkPhysicalDeviceBufferDeviceAddressFeatures bufferDeviceAddressFeatures = {};
+        bufferDeviceAddressFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES;
+        bufferDeviceAddressFeatures.pNext = &timelineFeatures;
+        bufferDeviceAddressFeatures.bufferDeviceAddress = VK_TRUE;
+
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures = {};
+        descriptorBufferFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+        descriptorBufferFeatures.pNext = &bufferDeviceAddressFeatures;
+        descriptorBufferFeatures.descriptorBuffer = VK_TRUE;
+
 		VkDeviceCreateInfo createInfo = {};
 		createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        createInfo.pNext = &timelineFeatures; // Chain indexing
-		createInfo.queueCreateInfoCount = 1;
-		createInfo.pQueueCreateInfos = &queueCreateInfo;
-		createInfo.pEnabledFeatures = &s_RequestedDeviceFeatures;
+        createInfo.pNext = (descriptorBuffers ? static_cast<void*>(&descriptorBufferFeatures) : static_cast<void*>(&timelineFeatures)); // Chain indexing
+		createInfo.queueCreateInfoCount = queueCreateInfoCount;
+		createInfo.pQueueCreateInfos = queueCreateInfos.data();
+		createInfo.pEnabledFeatures = &deviceFeatures;
 		createInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
 		createInfo.ppEnabledExtensionNames = extensions.data();
 
@@ -532,11 +715,16 @@ namespace Obsidian::Internal
             queueInfo.queueIndex = indices.GraphicsQueue;
             vkGetDeviceQueue2(m_LogicalDevice, &queueInfo, &m_Queues[static_cast<size_t>(CommandQueue::Graphics)]);
 
+            queueInfo.queueIndex = indices.PresentQueue;
+            vkGetDeviceQueue2(m_LogicalDevice, &queueInfo, &m_Queues[static_cast<size_t>(CommandQueue::Present)]);
+
+            queueInfo.queueFamilyIndex = indices.ComputeFamily;
             queueInfo.queueIndex = indices.ComputeQueue;
             vkGetDeviceQueue2(m_LogicalDevice, &queueInfo, &m_Queues[static_cast<size_t>(CommandQueue::Compute)]);
 
-            queueInfo.queueIndex = indices.PresentQueue;
-            vkGetDeviceQueue2(m_LogicalDevice, &queueInfo, &m_Queues[static_cast<size_t>(CommandQueue::Present)]);
+            queueInfo.queueFamilyIndex = indices.TransferFamily;
+            queueInfo.queueIndex = indices.TransferQueue;
+            vkGetDeviceQueue2(m_LogicalDevice, &queueInfo, &m_TransferQueue);
         }
 	}
 
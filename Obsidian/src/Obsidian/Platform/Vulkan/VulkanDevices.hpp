@@ -44,18 +44,23 @@ namespace Obsidian::Internal
 
     public:
         // Methods
-        bool SupportsRequired() const; // Note: Checks for Graphics, Compute & Present
+        bool SupportsRequired(bool requirePresent) const; // Note: Checks for Graphics, Compute & Present (if requested)
         bool EnoughQueues() const; // Note: Just checks if Count >= 3 (Graphics + Compute + Present)
+        bool IsDedicatedTransfer() const; // Note: Checks for Transfer without Graphics & Compute (DMA engine)
+        bool IsDedicatedCompute() const; // Note: Checks for Compute without Graphics (async compute)
     };
 
     struct QueueFamilyIndices
     {
     public:
         uint32_t QueueFamily = 0;
+        uint32_t ComputeFamily = 0; // Note: Equal to QueueFamily when the device has no dedicated (async) compute family
+        uint32_t TransferFamily = 0; // Note: Equal to QueueFamily when the device has no dedicated transfer family
 
         uint32_t GraphicsQueue = 0;
-        uint32_t ComputeQueue = 0;
+        uint32_t ComputeQueue = 0; // Note: Index inside of ComputeFamily
         uint32_t PresentQueue = 0;
+        uint32_t TransferQueue = 0; // Note: Index inside of TransferFamily
 
         std::vector<QueueFamilyInfo> Queues = {};
 
@@ -65,9 +70,13 @@ namespace Obsidian::Internal
         // Methods
         bool IsComplete() const;
         bool SameQueue() const;
+        bool HasDedicatedCompute() const;
+        bool HasDedicatedTransfer() const;
+
+        uint32_t GetQueueFamily(CommandQueue queue) const;
 
     public:
-        static QueueFamilyIndices Find(VkSurfaceKHR surface, VkPhysicalDevice device); 
+        static QueueFamilyIndices Find(VkSurfaceKHR surface, VkPhysicalDevice device); // Note: Surface can be VK_NULL_HANDLE for headless devices
     };
 
     struct SwapchainSupportDetails
@@ -88,7 +97,7 @@ namespace Obsidian::Internal
     {
     public:
         // Constructor & Destructor
-        VulkanPhysicalDevice(VkInstance instance, VkSurfaceKHR surface, std::span<const char*> extensions);
+        VulkanPhysicalDevice(VkInstance instance, VkSurfaceKHR surface, std::span<const char*> extensions); // Note: Surface can be VK_NULL_HANDLE for headless devices
         ~VulkanPhysicalDevice() = default;
 
         // Methods
@@ -99,9 +108,20 @@ namespace Obsidian::Internal
         inline VkPhysicalDevice GetVkPhysicalDevice() const { return m_PhysicalDevice; }
 
         inline const QueueFamilyIndices& GetQueueFamilyIndices() const { return m_QueueIndices; }
+
+        inline bool SupportsDescriptorBuffers() const { return m_DescriptorBuffers; } // Note: VK_EXT_descriptor_buffer together with buffer device addresses
+        inline const VkPhysicalDeviceDescriptorBufferPropertiesEXT& GetDescriptorBufferProperties() const { return m_DescriptorBufferProperties; }
+        inline bool SupportsPipelineStatistics() const { return m_PipelineStatistics; } // Note: Needed for QueryType::PipelineStatistics, not supported by MoltenVK
+        inline bool SupportsStorageUpdateAfterBind() const { return m_StorageUpdateAfterBind; } // Note: Storage images & buffers in update after bind (bindless) bindings
+        inline bool SupportsUpdateUnusedWhilePending() const { return m_UpdateUnusedWhilePending; } // Note: Needed to write bindless descriptors while the set is in use by the GPU
+        inline bool SupportsNonUniformIndexing() const { return m_NonUniformIndexing; } // Note: Sampled images, storage images & storage buffers indexed with nonuniformEXT
+        inline uint32_t GetMaxColourAttachments() const { return m_MaxColourAttachments; } // Note: VkPhysicalDeviceLimits::maxColorAttachments, can be lower than Information::MaxColourAttachments
         
     private:
         // Private methods
+        void QueryDescriptorBufferSupport();
+        void QueryOptionalFeatures(); // Note: Features that are only enabled when the device supports them
+
         bool PhysicalDeviceSuitable(VkSurfaceKHR surface, VkPhysicalDevice device, std::span<const char*> extensions);
         bool ExtensionsSupported(VkPhysicalDevice device, std::span<const char*> extensions);
 
@@ -109,11 +129,22 @@ namespace Obsidian::Internal
         bool FeaturesSupported(const VkPhysicalDeviceDescriptorIndexingFeatures& requested, const VkPhysicalDeviceDescriptorIndexingFeatures& found);
         bool FeaturesSupported(const VkPhysicalDeviceTimelineSemaphoreFeatures& requested, const VkPhysicalDeviceTimelineSemaphoreFeatures& found);
         bool FeaturesSupported(const VkPhysicalDeviceSynchronization2Features& requested, const VkPhysicalDeviceSynchronization2Features& found);
+        bool FeaturesSupported(const VkPhysicalDeviceDynamicRenderingFeatures& requested, const VkPhysicalDeviceDynamicRenderingFeatures& found);
 
     private:
         VkPhysicalDevice m_PhysicalDevice = VK_NULL_HANDLE;
 
         QueueFamilyIndices m_QueueIndices = {};
+
+        bool m_DescriptorBuffers = false;
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT m_DescriptorBufferProperties = {};
+
+        bool m_PipelineStatistics = false;
+        bool m_StorageUpdateAfterBind = false;
+        bool m_UpdateUnusedWhilePending = false;
+        bool m_NonUniformIndexing = false;
+
+        uint32_t m_MaxColourAttachments = 4; // Note: The minimum Vulkan guarantees
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -123,7 +154,7 @@ namespace Obsidian::Internal
     {
     public:
         // Constructor & Destructor
-        VulkanLogicalDevice(VulkanPhysicalDevice& physicalDevice, std::span<const char*> extensions);
+        VulkanLogicalDevice(VulkanPhysicalDevice& physicalDevice, std::span<const char*> extensions, bool descriptorBuffers = false); // Note: descriptorBuffers requires VK_EXT_descriptor_buffer in the extensions
         ~VulkanLogicalDevice();
 
         // Methods
@@ -132,6 +163,7 @@ namespace Obsidian::Internal
         // Getters
         inline VkDevice GetVkDevice() const { return m_LogicalDevice; }
         inline VkQueue GetVkQueue(CommandQueue queue) const { return m_Queues[static_cast<size_t>(queue)]; }
+        inline VkQueue GetVkTransferQueue() const { return m_TransferQueue; } // Note: Is the graphics queue when there's no dedicated transfer family
 
         inline VulkanPhysicalDevice& GetPhysicalDevice() const { return m_PhysicalDevice; }
 
@@ -140,6 +172,7 @@ namespace Obsidian::Internal
         VkDevice m_LogicalDevice = VK_NULL_HANDLE;
 
         std::array<VkQueue, static_cast<size_t>(CommandQueue::Count)> m_Queues = { };
+        VkQueue m_TransferQueue = VK_NULL_HANDLE;
     };
 #endif
 
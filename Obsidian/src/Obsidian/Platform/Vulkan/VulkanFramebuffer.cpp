@@ -81,38 +81,26 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     void VulkanFramebuffer::Create()
     {
-        Nano::Memory::StaticVector<VkImageView, 2> attachments; // Colour & Depth
+        // Note: Follows the renderpass' attachment order, colour attachments, resolve attachments & then the depth attachment
+        Nano::Memory::StaticVector<VkImageView, (Information::MaxColourAttachments * 2) + 1> attachments;
 
         uint32_t width = 0, height = 0;
         uint32_t layers = 1;
 
-        if (m_Specification.ColourAttachment.IsValid())
+        const auto addAttachment = [&](const FramebufferAttachment& attachment)
         {
-            VulkanImage& vulkanImage = *api_cast<VulkanImage*>(m_Specification.ColourAttachment.ImagePtr);
-            const ImageSpecification& imageSpec = m_Specification.ColourAttachment.ImagePtr->GetSpecification();
-            ImageSubresourceSpecification resSubresources = ResolveImageSubresource(m_Specification.ColourAttachment.Subresources, imageSpec, false);
-
-            width = std::max(imageSpec.Width >> resSubresources.BaseMipLevel, 1u);
-            height = std::max(imageSpec.Height >> resSubresources.BaseMipLevel, 1u);
-            layers = resSubresources.NumArraySlices;
-
-            attachments.push_back(vulkanImage.GetSubresourceView(resSubresources, imageSpec.Dimension, imageSpec.ImageFormat, 0, ImageSubresourceViewType::AllAspects).GetVkImageView());
-        }
-
-        if (m_Specification.DepthAttachment.IsValid())
-        {
-            VulkanImage& vulkanImage = *api_cast<VulkanImage*>(m_Specification.DepthAttachment.ImagePtr);
-            const ImageSpecification& imageSpec = m_Specification.DepthAttachment.ImagePtr->GetSpecification();
-            ImageSubresourceSpecification resSubresources = ResolveImageSubresource(m_Specification.DepthAttachment.Subresources, imageSpec, false);
+            VulkanImage& vulkanImage = *api_cast<VulkanImage*>(attachment.ImagePtr);
+            const ImageSpecification& imageSpec = attachment.ImagePtr->GetSpecification();
+            ImageSubresourceSpecification resSubresources = ResolveImageSubresource(attachment.Subresources, imageSpec, false);
 
             // Validation checks
             if constexpr (Information::Validation)
             {
-                if (width != 0 || height != 0) // If width/height are set, make sure the colour width/height is the same as the depth width/height
+                if (width != 0 || height != 0) // If width/height are set, make sure every attachment has the same width/height
                 {
-                    OB_ASSERT((width == std::max(imageSpec.Width >> resSubresources.BaseMipLevel, 1u)), "[VkFramebuffer] Depth attachment's width doesn't match the colour attachment's width.");
-                    OB_ASSERT((height == std::max(imageSpec.Height >> resSubresources.BaseMipLevel, 1u)), "[VkFramebuffer] Depth attachment's height doesn't match the colour attachment's height.");
-                    OB_ASSERT((layers == resSubresources.NumArraySlices), "[VkFramebuffer] Depth attachment's arrayslices doesn't match the colour attachment's arrayslices.");
+                    OB_ASSERT((width == std::max(imageSpec.Width >> resSubresources.BaseMipLevel, 1u)), "[VkFramebuffer] Attachment's width doesn't match the previous attachments' width.");
+                    OB_ASSERT((height == std::max(imageSpec.Height >> resSubresources.BaseMipLevel, 1u)), "[VkFramebuffer] Attachment's height doesn't match the previous attachments' height.");
+                    OB_ASSERT((layers == resSubresources.NumArraySlices), "[VkFramebuffer] Attachment's arrayslices don't match the previous attachments' arrayslices.");
                 }
             }
 
@@ -121,8 +109,26 @@ namespace Obsidian::Internal
             layers = resSubresources.NumArraySlices;
 
             attachments.push_back(vulkanImage.GetSubresourceView(resSubresources, imageSpec.Dimension, imageSpec.ImageFormat, 0, ImageSubresourceViewType::AllAspects).GetVkImageView());
+        };
+
+        const RenderpassSpecification& renderpassSpecs = m_Renderpass->GetSpecification();
+        OB_ASSERT((m_Specification.ColourAttachments.size() == renderpassSpecs.ColourAttachments.size()), "[VkFramebuffer] Framebuffer's colour attachment count doesn't match the renderpass' colour attachment count.");
+
+        for (const FramebufferAttachment& colour : m_Specification.ColourAttachments)
+            addAttachment(colour);
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(renderpassSpecs.ColourAttachments.size()); i++)
+        {
+            if (!renderpassSpecs.ColourAttachments[i].HasResolve())
+                continue;
+
+            OB_ASSERT(m_Specification.HasResolveAttachment(i), "[VkFramebuffer] Renderpass resolves colour attachment {0}, but no resolve attachment was set.", i);
+            addAttachment(m_Specification.ResolveAttachments[i]);
         }
 
+        if (m_Specification.DepthAttachment.IsValid())
+            addAttachment(m_Specification.DepthAttachment);
+
         VkFramebufferCreateInfo framebufferInfo = {};
         framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
         framebufferInfo.renderPass = m_Renderpass->GetVkRenderPass();
@@ -24,6 +24,32 @@ namespace Obsidian::Internal
     {
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    VulkanImageHeap::VulkanImageHeap(const Device& device, const ImageHeapSpecification& specs)
+        : m_Device(*api_cast<const VulkanDevice*>(&device)), m_Specification(specs)
+    {
+        OB_ASSERT((m_Specification.Size > 0), "[VkImageHeap] Invalid size passed in.");
+
+        VkMemoryRequirements requirements = {};
+        requirements.size = static_cast<VkDeviceSize>(m_Specification.Size);
+        requirements.alignment = static_cast<VkDeviceSize>(m_Specification.Alignment);
+        requirements.memoryTypeBits = m_Specification.MemoryTypeBits;
+
+        m_Allocation = m_Device.GetAllocator().AllocateImageMemory(requirements);
+
+        if constexpr (Information::Validation)
+        {
+            if (!m_Specification.DebugName.empty())
+                m_Device.GetContext().SetDebugName(m_Device.GetAllocator().GetUnderlyingMemory(m_Allocation), VK_OBJECT_TYPE_DEVICE_MEMORY, std::string(m_Specification.DebugName));
+        }
+    }
+
+    VulkanImageHeap::~VulkanImageHeap()
+    {
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +64,12 @@ namespace Obsidian::Internal
         CreateImage();
     }
 
+    VulkanImage::VulkanImage(const Device& device, const ImageSpecification& specs, const ImageHeap& heap, size_t offset)
+        : m_Device(*api_cast<const VulkanDevice*>(&device)), m_Specification(specs), m_Placed(true)
+    {
+        CreatePlacedImage(api_cast<const VulkanImageHeap*>(&heap)->GetVmaAllocation(), offset);
+    }
+
     VulkanImage::~VulkanImage()
     {
     }
@@ -47,6 +79,8 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     void VulkanImage::Resize(uint32_t width, uint32_t height)
     {
+        OB_ASSERT(!m_Placed, "[VkImage] Placed images can't be resized, recreate them in a heap that fits the new size.");
+
         m_Device.DestroyImage(*api_cast<Image*>(this));
 
         m_Specification.Width = width;
@@ -66,19 +100,150 @@ namespace Obsidian::Internal
         if (format == Format::Unknown)
             format = m_Specification.ImageFormat;
 
+        // Note: The default views never change while the image is in use, so they can be read without a lock
+        if ((dimension == m_Specification.Dimension) && (format == m_Specification.ImageFormat))
+        {
+            for (const DefaultViewEntry& entry : m_DefaultViews)
+            {
+                if (entry.View && (entry.Usage == usage) && (entry.ViewType == viewType) && (entry.Specification == specs))
+                    return *entry.View;
+            }
+        }
+
         // Find the view in map
         auto cachekey = std::make_tuple(specs, viewType, dimension, format, usage);
-        auto it = m_ImageViews.find(cachekey);
-        if (it != m_ImageViews.end())
-            return it->second;
-
-        // Create new
-        auto viewPair = m_ImageViews.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(cachekey), 
-            std::forward_as_tuple(*api_cast<Image*>(this), specs)
+        {
+            std::shared_lock lock(m_ViewMutex);
+
+            auto it = m_ImageViews.find(cachekey);
+            if (it != m_ImageViews.end())
+                return it->second;
+        }
+
+        std::unique_lock lock(m_ViewMutex);
+        return CreateSubresourceView(cachekey);
+    }
+
+    void VulkanImage::ClearImageViews()
+    {
+        std::unique_lock lock(m_ViewMutex);
+
+        m_DefaultViews = { };
+        m_ImageViews.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Internal methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanImage::SetInternalData(const ImageSpecification& specs, VkImage image)
+    {
+        m_Specification = specs;
+        m_Image = image;
+
+        CreateDefaultViews();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void VulkanImage::CreateImage()
+    {
+        OB_ASSERT(((m_Specification.Width != 0) && (m_Specification.Height != 0)), "[VkImage] Invalid width/height passed in.");
+        OB_ASSERT((m_Specification.ImageFormat != Format::Unknown), "[VkImage] Invalid format passed in.");
+
+        // Validation checks
+        if constexpr (Information::Validation)
+        {
+            if (!((m_Specification.SampleCount >= 1) && (m_Specification.SampleCount <= 64) && (m_Specification.SampleCount & (m_Specification.SampleCount - 1)) == 0))
+            {
+                m_Device.GetContext().Error(std::format("[VkImage] Invalid samplecount passed in: {0}", m_Specification.SampleCount));
+            }
+        }
+
+        // Creation
+        m_Allocation = m_Device.GetAllocator().CreateImage(VMA_MEMORY_USAGE_AUTO, m_Image,
+            ImageDimensionToVkImageType(m_Specification.Dimension),
+            m_Specification.Width, m_Specification.Height, m_Specification.Depth,
+            m_Specification.MipLevels, m_Specification.ArraySize,
+            FormatToVkFormat(m_Specification.ImageFormat), VK_IMAGE_TILING_OPTIMAL,
+            ImageSpecificationToVkImageUsageFlags(m_Specification),
+            SampleCountToVkSampleCountFlags(m_Specification.SampleCount)
+        );
+
+        if constexpr (Information::Validation)
+        {
+            if (!m_Specification.DebugName.empty())
+            {
+                m_Device.GetContext().SetDebugName(m_Image, VK_OBJECT_TYPE_IMAGE, std::string(m_Specification.DebugName));
+                m_Device.GetContext().SetDebugName(m_Device.GetAllocator().GetUnderlyingMemory(m_Allocation), VK_OBJECT_TYPE_DEVICE_MEMORY, std::format("Memory for: {0}", m_Specification.DebugName));
+            }
+        }
+
+        CreateDefaultViews();
+    }
+
+    void VulkanImage::CreatePlacedImage(VmaAllocation allocation, size_t offset)
+    {
+        OB_ASSERT(((m_Specification.Width != 0) && (m_Specification.Height != 0)), "[VkImage] Invalid width/height passed in.");
+        OB_ASSERT((m_Specification.ImageFormat != Format::Unknown), "[VkImage] Invalid format passed in.");
+
+        // Note: The allocation stays owned by the heap, we only keep it around for GetVmaAllocation()
+        m_Allocation = allocation;
+        m_Device.GetAllocator().CreateAliasingImage(m_Allocation, offset, m_Image,
+            ImageDimensionToVkImageType(m_Specification.Dimension),
+            m_Specification.Width, m_Specification.Height, m_Specification.Depth,
+            m_Specification.MipLevels, m_Specification.ArraySize,
+            FormatToVkFormat(m_Specification.ImageFormat), VK_IMAGE_TILING_OPTIMAL,
+            ImageSpecificationToVkImageUsageFlags(m_Specification),
+            SampleCountToVkSampleCountFlags(m_Specification.SampleCount)
         );
-        auto& imageView = std::get<0>(viewPair)->second;
+
+        if constexpr (Information::Validation)
+        {
+            if (!m_Specification.DebugName.empty())
+                m_Device.GetContext().SetDebugName(m_Image, VK_OBJECT_TYPE_IMAGE, std::string(m_Specification.DebugName));
+        }
+
+        CreateDefaultViews();
+    }
+
+    void VulkanImage::CreateDefaultViews()
+    {
+        OB_PROFILE("VkImage::CreateDefaultViews()");
+
+        // Note: Uses the exact same keys as BindingSets, framebuffers & dynamic rendering look up for the full image
+        const ImageSubresourceSpecification allSubresources = ResolveImageSubresource(ImageSubresourceSpecification(), m_Specification, false);
+        const ImageSubresourceSpecification firstMip = ResolveImageSubresource(ImageSubresourceSpecification(), m_Specification, true);
+        const ImageSubresourceViewType shaderViewType = FormatToImageSubresourceViewType(m_Specification.ImageFormat);
+
+        std::unique_lock lock(m_ViewMutex);
+
+        auto createDefault = [&](DefaultView slot, const ImageSubresourceSpecification& specs, ImageSubresourceViewType viewType, VkImageUsageFlags usage)
+        {
+            DefaultViewEntry& entry = m_DefaultViews[static_cast<size_t>(slot)];
+            entry.Specification = specs;
+            entry.ViewType = viewType;
+            entry.Usage = usage;
+            entry.View = &CreateSubresourceView(std::make_tuple(specs, viewType, m_Specification.Dimension, m_Specification.ImageFormat, usage));
+        };
+
+        if (m_Specification.IsShaderResource)
+            createDefault(DefaultView::ShaderResource, allSubresources, shaderViewType, VK_IMAGE_USAGE_SAMPLED_BIT);
+        if (m_Specification.IsUnorderedAccessed)
+            createDefault(DefaultView::UnorderedAccess, allSubresources, shaderViewType, VK_IMAGE_USAGE_STORAGE_BIT);
+        if (m_Specification.IsRenderTarget)
+            createDefault(DefaultView::Attachment, firstMip, ImageSubresourceViewType::AllAspects, 0);
+    }
+
+    const VulkanImageSubresourceView& VulkanImage::CreateSubresourceView(const VulkanImageSubresourceView::Key& key)
+    {
+        const auto& [specs, viewType, dimension, format, usage] = key;
+
+        // Note: Another thread may have created the view between releasing the shared lock and acquiring this one
+        auto [it, inserted] = m_ImageViews.try_emplace(key, *api_cast<Image*>(this), specs);
+        auto& imageView = it->second;
+        if (!inserted)
+            return imageView;
 
         VkFormat vkFormat = FormatToVkFormat(format);
         VkImageAspectFlags aspectflags = GuessSubresourceImageAspectFlags(vkFormat, viewType);
@@ -128,49 +293,25 @@ namespace Obsidian::Internal
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
-    // Internal methods
-    ////////////////////////////////////////////////////////////////////////////////////
-    void VulkanImage::SetInternalData(const ImageSpecification& specs, VkImage image)
-    {
-        m_Specification = specs;
-        m_Image = image;
-    }
-
-    ////////////////////////////////////////////////////////////////////////////////////
-    // Private methods
+    // Static methods
     ////////////////////////////////////////////////////////////////////////////////////
-    void VulkanImage::CreateImage()
+    ImageMemoryRequirements VulkanImage::GetMemoryRequirements(const VulkanDevice& device, const ImageSpecification& specs)
     {
-        OB_ASSERT(((m_Specification.Width != 0) && (m_Specification.Height != 0)), "[VkImage] Invalid width/height passed in.");
-        OB_ASSERT((m_Specification.ImageFormat != Format::Unknown), "[VkImage] Invalid format passed in.");
-
-        // Validation checks
-        if constexpr (Information::Validation)
-        {
-            if (!((m_Specification.SampleCount >= 1) && (m_Specification.SampleCount <= 64) && (m_Specification.SampleCount & (m_Specification.SampleCount - 1)) == 0))
-            {
-                m_Device.GetContext().Error(std::format("[VkImage] Invalid samplecount passed in: {0}", m_Specification.SampleCount));
-            }
-        }
-
-        // Creation
-        m_Allocation = m_Device.GetAllocator().CreateImage(VMA_MEMORY_USAGE_AUTO, m_Image,
-            ImageDimensionToVkImageType(m_Specification.Dimension),
-            m_Specification.Width, m_Specification.Height, m_Specification.Depth,
-            m_Specification.MipLevels, m_Specification.ArraySize,
-            FormatToVkFormat(m_Specification.ImageFormat), VK_IMAGE_TILING_OPTIMAL,
-            ImageSpecificationToVkImageUsageFlags(m_Specification),
-            SampleCountToVkSampleCountFlags(m_Specification.SampleCount)
+        VkMemoryRequirements vkRequirements = device.GetAllocator().GetImageMemoryRequirements(
+            ImageDimensionToVkImageType(specs.Dimension),
+            specs.Width, specs.Height, specs.Depth,
+            specs.MipLevels, specs.ArraySize,
+            FormatToVkFormat(specs.ImageFormat), VK_IMAGE_TILING_OPTIMAL,
+            ImageSpecificationToVkImageUsageFlags(specs),
+            SampleCountToVkSampleCountFlags(specs.SampleCount)
         );
 
-        if constexpr (Information::Validation)
-        {
-            if (!m_Specification.DebugName.empty())
-            {
-                m_Device.GetContext().SetDebugName(m_Image, VK_OBJECT_TYPE_IMAGE, std::string(m_Specification.DebugName));
-                m_Device.GetContext().SetDebugName(m_Device.GetAllocator().GetUnderlyingMemory(m_Allocation), VK_OBJECT_TYPE_DEVICE_MEMORY, std::format("Memory for: {0}", m_Specification.DebugName));
-            }
-        }
+        ImageMemoryRequirements requirements = {};
+        requirements.Size = static_cast<size_t>(vkRequirements.size);
+        requirements.Alignment = static_cast<size_t>(vkRequirements.alignment);
+        requirements.MemoryTypeBits = vkRequirements.memoryTypeBits;
+
+        return requirements;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -180,6 +321,7 @@ namespace Obsidian::Internal
         : m_Device(*api_cast<const VulkanDevice*>(&device)), m_Specification(specs), m_SliceRegions(GetSliceRegions()), m_Buffer(device, BufferSpecification()
             .SetSize(GetBufferSize())
             .SetCPUAccess(cpuAccessMode)
+            .SetIsPersistentlyMapped(static_cast<bool>(cpuAccessMode & CpuAccessMode::Write)) // Note: Staging images get written to often, so we keep them mapped
             .SetPermanentState(specs.PermanentState)
             .SetDebugName(specs.DebugName)
         ) // Note: The buffer is automatically a TransferSrc (& TransferDst), we don't need to set anything special
@@ -278,41 +420,89 @@ namespace Obsidian::Internal
     VulkanSampler::VulkanSampler(const Device& device, const SamplerSpecification& specs)
         : m_Device(*api_cast<const VulkanDevice*>(&device)), m_Specification(specs)
     {
-        VkSamplerCreateInfo samplerInfo = {};
-        samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-        samplerInfo.magFilter = FilterModeToVkFilter(m_Specification.MagFilter);
-        samplerInfo.minFilter = FilterModeToVkFilter(m_Specification.MinFilter);
-        samplerInfo.addressModeU = SamplerAddressModeToVkSamplerAddressMode(m_Specification.AddressU);
-        samplerInfo.addressModeV = SamplerAddressModeToVkSamplerAddressMode(m_Specification.AddressV);
-        samplerInfo.addressModeW = SamplerAddressModeToVkSamplerAddressMode(m_Specification.AddressW);
+        m_Sampler = m_Device.GetSamplerCache().Acquire(m_Device, m_Specification);
+    }
+
+    VulkanSampler::~VulkanSampler()
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanSamplerCache
+    ////////////////////////////////////////////////////////////////////////////////////
+    VkSampler VulkanSamplerCache::Acquire(const VulkanDevice& device, const SamplerSpecification& specs)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        auto it = m_Samplers.find(specs);
+        if (it != m_Samplers.end())
+        {
+            it->second.References++;
+            return it->second.Sampler;
+        }
+
+        OB_PROFILE("VkSamplerCache::Acquire::Create");
 
         VkPhysicalDeviceProperties properties;
-        vkGetPhysicalDeviceProperties(m_Device.GetContext().GetVulkanPhysicalDevice().GetVkPhysicalDevice(), &properties);
+        vkGetPhysicalDeviceProperties(device.GetContext().GetVulkanPhysicalDevice().GetVkPhysicalDevice(), &properties);
+
+        OB_ASSERT((m_Samplers.size() < properties.limits.maxSamplerAllocationCount), "[VkSamplerCache] Creating more unique samplers than the device supports ({0}).", properties.limits.maxSamplerAllocationCount);
+
+        VkSamplerCreateInfo samplerInfo = {};
+        samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        samplerInfo.magFilter = FilterModeToVkFilter(specs.MagFilter);
+        samplerInfo.minFilter = FilterModeToVkFilter(specs.MinFilter);
+        samplerInfo.addressModeU = SamplerAddressModeToVkSamplerAddressMode(specs.AddressU);
+        samplerInfo.addressModeV = SamplerAddressModeToVkSamplerAddressMode(specs.AddressV);
+        samplerInfo.addressModeW = SamplerAddressModeToVkSamplerAddressMode(specs.AddressW);
 
-        samplerInfo.anisotropyEnable = ((m_Specification.MaxAnisotropy == SamplerSpecification::DisableMaxAnisotropyValue) ? VK_FALSE : VK_TRUE);
-        samplerInfo.maxAnisotropy = ((m_Specification.MaxAnisotropy == SamplerSpecification::MaxMaxAnisotropyValue) ? properties.limits.maxSamplerAnisotropy : m_Specification.MaxAnisotropy); 
+        samplerInfo.anisotropyEnable = ((specs.MaxAnisotropy == SamplerSpecification::DisableMaxAnisotropyValue) ? VK_FALSE : VK_TRUE);
+        samplerInfo.maxAnisotropy = ((specs.MaxAnisotropy == SamplerSpecification::MaxMaxAnisotropyValue) ? properties.limits.maxSamplerAnisotropy : specs.MaxAnisotropy); 
 
         samplerInfo.borderColor = Vec4ToBorderColor(specs.BorderColour);
         samplerInfo.unnormalizedCoordinates = VK_FALSE;
-        samplerInfo.compareEnable = ((m_Specification.ReductionType == SamplerReductionType::Comparison) ? VK_TRUE : VK_FALSE);
+        samplerInfo.compareEnable = ((specs.ReductionType == SamplerReductionType::Comparison) ? VK_TRUE : VK_FALSE);
         samplerInfo.compareOp = VK_COMPARE_OP_LESS;
 
-        samplerInfo.mipmapMode = ((FilterModeToVkFilter(m_Specification.MipFilter) == VK_FILTER_NEAREST) ? VK_SAMPLER_MIPMAP_MODE_NEAREST : VK_SAMPLER_MIPMAP_MODE_LINEAR);
+        samplerInfo.mipmapMode = ((FilterModeToVkFilter(specs.MipFilter) == VK_FILTER_NEAREST) ? VK_SAMPLER_MIPMAP_MODE_NEAREST : VK_SAMPLER_MIPMAP_MODE_LINEAR);
         samplerInfo.minLod = 0.0f;
         samplerInfo.maxLod = std::numeric_limits<float>::max();
-        samplerInfo.mipLodBias = m_Specification.MipBias;
+        samplerInfo.mipLodBias = specs.MipBias;
 
-        VK_VERIFY(vkCreateSampler(m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &samplerInfo, VulkanAllocator::GetCallbacks(), &m_Sampler));
+        VkSampler sampler = VK_NULL_HANDLE;
+        VK_VERIFY(vkCreateSampler(device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &samplerInfo, VulkanAllocator::GetCallbacks(), &sampler));
 
         if constexpr (Information::Validation)
         {
-            if (!m_Specification.DebugName.empty())
-                m_Device.GetContext().SetDebugName(m_Sampler, VK_OBJECT_TYPE_SAMPLER, std::string(m_Specification.DebugName));
+            if (!specs.DebugName.empty())
+                device.GetContext().SetDebugName(sampler, VK_OBJECT_TYPE_SAMPLER, std::string(specs.DebugName));
         }
+
+        m_Samplers.emplace(specs, Entry(sampler, 1));
+        return sampler;
     }
 
-    VulkanSampler::~VulkanSampler()
+    bool VulkanSamplerCache::Release(const SamplerSpecification& specs)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        auto it = m_Samplers.find(specs);
+        OB_ASSERT((it != m_Samplers.end()), "[VkSamplerCache] Released a sampler that isn't part of the cache.");
+        if (it == m_Samplers.end())
+            return false;
+
+        if (--it->second.References != 0)
+            return false;
+
+        // Note: Removed right away, a sampler created before the deferred destroy runs just gets a new VkSampler
+        m_Samplers.erase(it);
+        return true;
+    }
+
+    size_t VulkanSamplerCache::GetSamplerCount() const
     {
+        std::scoped_lock lock(m_Mutex);
+        return m_Samplers.size();
     }
 
 }
\ No newline at end of file
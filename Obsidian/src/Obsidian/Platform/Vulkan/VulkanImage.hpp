@@ -10,10 +10,16 @@
 #include "Obsidian/Platform/Vulkan/VulkanResources.hpp"
 #include "Obsidian/Platform/Vulkan/VulkanBuffer.hpp"
 
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
 namespace Obsidian
 {
 	class Device;
 	class Image;
+	class ImageHeap;
 }
 
 namespace Obsidian::Internal
@@ -21,9 +27,11 @@ namespace Obsidian::Internal
 
 	class VulkanDevice;
 	class VulkanImageSubresourceView;
+	class VulkanImageHeap;
 	class VulkanImage;
 	class VulkanStagingImage;
 	class VulkanSampler;
+	class VulkanSamplerCache;
 
 #if defined(OB_API_VULKAN)
 	////////////////////////////////////////////////////////////////////////////////////
@@ -74,15 +82,41 @@ namespace Obsidian::Internal
 		friend class VulkanImage;
 	};
 
+	////////////////////////////////////////////////////////////////////////////////////
+	// VulkanImageHeap
+	////////////////////////////////////////////////////////////////////////////////////
+	class VulkanImageHeap
+	{
+	public:
+		// Constructor & Destructor
+		VulkanImageHeap(const Device& device, const ImageHeapSpecification& specs);
+		~VulkanImageHeap();
+
+		// Getters
+		inline const ImageHeapSpecification& GetSpecification() const { return m_Specification; }
+
+		// Internal getters
+		inline VmaAllocation GetVmaAllocation() const { return m_Allocation; }
+
+	private:
+		const VulkanDevice& m_Device;
+		ImageHeapSpecification m_Specification;
+
+		VmaAllocation m_Allocation = VK_NULL_HANDLE;
+	};
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// VulkanImage
 	////////////////////////////////////////////////////////////////////////////////////
 	class VulkanImage
 	{
+	public:
+		enum class DefaultView : uint8_t { ShaderResource = 0, UnorderedAccess, Attachment, Count };
 	public:
 		// Constructors & Destructor
 		VulkanImage(const Device& device);
 		VulkanImage(const Device& device, const ImageSpecification& specs);
+		VulkanImage(const Device& device, const ImageSpecification& specs, const ImageHeap& heap, size_t offset); // Note: Placed (aliased) in the heap's memory
 		~VulkanImage();
 
 		// Methods
@@ -97,13 +131,35 @@ namespace Obsidian::Internal
 		// Internal getters
 		inline VkImage GetVkImage() const { return m_Image; }
 		inline VmaAllocation GetVmaAllocation() const { return m_Allocation; }
+		inline bool IsPlaced() const { return m_Placed; } // Note: Placed images don't own their allocation
 
+		// Note: The full SRV, full UAV & mip 0 attachment views are created with the image and found without hashing or locking,
+		// every other view goes through the cache which can be used from multiple recording threads at once.
 		const VulkanImageSubresourceView& GetSubresourceView(const ImageSubresourceSpecification& specs, ImageDimension dimension = ImageDimension::Unknown, Format format = Format::Unknown, VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT, ImageSubresourceViewType viewType = ImageSubresourceViewType::AllAspects);
 		inline std::unordered_map<VulkanImageSubresourceView::Key, VulkanImageSubresourceView, VulkanImageSubresourceView::Hash>& GetImageViews() { return m_ImageViews; }
+		void ClearImageViews(); // Note: Only clears the cache, the views must be destroyed by the caller
+
+		// Static methods
+		static ImageMemoryRequirements GetMemoryRequirements(const VulkanDevice& device, const ImageSpecification& specs);
 
 	private:
 		// Private methods
 		void CreateImage();
+		void CreatePlacedImage(VmaAllocation allocation, size_t offset);
+		void CreateDefaultViews();
+
+		const VulkanImageSubresourceView& CreateSubresourceView(const VulkanImageSubresourceView::Key& key); // Note: Must be called with m_ViewMutex locked exclusively
+
+	private:
+		struct DefaultViewEntry
+		{
+		public:
+			ImageSubresourceSpecification Specification = {};
+			ImageSubresourceViewType ViewType = ImageSubresourceViewType::AllAspects;
+			VkImageUsageFlags Usage = 0;
+
+			const VulkanImageSubresourceView* View = nullptr; // Note: Points into m_ImageViews
+		};
 
 	private:
 		const VulkanDevice& m_Device;
@@ -111,8 +167,12 @@ namespace Obsidian::Internal
 
 		VkImage m_Image = VK_NULL_HANDLE;
 		VmaAllocation m_Allocation = VK_NULL_HANDLE;
+		bool m_Placed = false;
+
+		std::array<DefaultViewEntry, static_cast<size_t>(DefaultView::Count)> m_DefaultViews = { };
 
-		std::unordered_map<VulkanImageSubresourceView::Key, VulkanImageSubresourceView, VulkanImageSubresourceView::Hash> m_ImageViews = {};
+		mutable std::shared_mutex m_ViewMutex = {};
+		std::unordered_map<VulkanImageSubresourceView::Key, VulkanImageSubresourceView, VulkanImageSubresourceView::Hash> m_ImageViews = {}; // Note: Node based, so views never move once created
 	};
 
 	////////////////////////////////////////////////////////////////////////////////////
@@ -179,6 +239,62 @@ namespace Obsidian::Internal
 
 		VkSampler m_Sampler = VK_NULL_HANDLE;
 	};
+
+	////////////////////////////////////////////////////////////////////////////////////
+	// VulkanSamplerCache // Note: Samplers with the same specification (ignoring the debug name)
+	// share a single reference counted VkSampler, which keeps us far below maxSamplerAllocationCount.
+	////////////////////////////////////////////////////////////////////////////////////
+	class VulkanSamplerCache
+	{
+	public:
+		struct Hash
+		{
+		public:
+			uint64_t operator()(const SamplerSpecification& specs) const noexcept(true)
+			{
+				uint64_t hash = 0;
+
+				hash = Nano::Hash::Combine(hash, std::hash<float>{}(specs.BorderColour.r));
+				hash = Nano::Hash::Combine(hash, std::hash<float>{}(specs.BorderColour.g));
+				hash = Nano::Hash::Combine(hash, std::hash<float>{}(specs.BorderColour.b));
+				hash = Nano::Hash::Combine(hash, std::hash<float>{}(specs.BorderColour.a));
+				hash = Nano::Hash::Combine(hash, std::hash<float>{}(specs.MaxAnisotropy));
+				hash = Nano::Hash::Combine(hash, std::hash<float>{}(specs.MipBias));
+				hash = Nano::Hash::Combine(hash, std::hash<std::underlying_type_t<FilterMode>>{}(std::to_underlying(specs.MinFilter)));
+				hash = Nano::Hash::Combine(hash, std::hash<std::underlying_type_t<FilterMode>>{}(std::to_underlying(specs.MagFilter)));
+				hash = Nano::Hash::Combine(hash, std::hash<std::underlying_type_t<FilterMode>>{}(std::to_underlying(specs.MipFilter)));
+				hash = Nano::Hash::Combine(hash, std::hash<std::underlying_type_t<SamplerAddressMode>>{}(std::to_underlying(specs.AddressU)));
+				hash = Nano::Hash::Combine(hash, std::hash<std::underlying_type_t<SamplerAddressMode>>{}(std::to_underlying(specs.AddressV)));
+				hash = Nano::Hash::Combine(hash, std::hash<std::underlying_type_t<SamplerAddressMode>>{}(std::to_underlying(specs.AddressW)));
+				hash = Nano::Hash::Combine(hash, std::hash<std::underlying_type_t<SamplerReductionType>>{}(std::to_underlying(specs.ReductionType)));
+
+				return hash;
+			}
+		};
+	public:
+		// Constructor & Destructor
+		VulkanSamplerCache() = default;
+		~VulkanSamplerCache() = default;
+
+		// Methods // Note: Thread safe
+		VkSampler Acquire(const VulkanDevice& device, const SamplerSpecification& specs); // Note: The debug name of the first specification is used
+		bool Release(const SamplerSpecification& specs); // Note: Returns true when the last reference is released, the caller is then responsible for destroying the sampler
+
+		// Getters
+		size_t GetSamplerCount() const;
+
+	private:
+		struct Entry
+		{
+		public:
+			VkSampler Sampler;
+			uint32_t References;
+		};
+
+	private:
+		mutable std::mutex m_Mutex = {};
+		std::unordered_map<SamplerSpecification, Entry, Hash> m_Samplers = { };
+	};
 #endif
 
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include "Obsidian/Renderer/Pipeline.hpp"
 #include "Obsidian/Renderer/Renderpass.hpp"
 
+#include <algorithm>
+
 namespace Obsidian::Internal
 {
 
@@ -18,17 +20,20 @@ namespace Obsidian::Internal
 		////////////////////////////////////////////////////////////////////////////////////
 		// Helper function
 		////////////////////////////////////////////////////////////////////////////////////
-		void CreatePipelineLayout(VkPipelineLayout& layout, const Nano::Memory::StaticVector<BindingLayout*, GraphicsPipelineSpecification::MaxBindings>& layouts, VkDevice device, VkShaderStageFlags& outPushConstantsStage)
+		void CreatePipelineLayout(VkPipelineLayout& layout, const Nano::Memory::StaticVector<BindingLayout*, GraphicsPipelineSpecification::MaxBindings>& layouts, VkDevice device, VulkanPipelineLayoutCache& cache, VkShaderStageFlags& outPushConstantsStage)
 		{
 			// Descriptor layouts
 			std::vector<VkDescriptorSetLayout> descriptorLayouts;
 			descriptorLayouts.reserve(GraphicsPipelineSpecification::MaxBindings);
+			std::vector<size_t> descriptorLayoutHashes;
+			descriptorLayoutHashes.reserve(GraphicsPipelineSpecification::MaxBindings);
 			std::optional<VkPushConstantRange> range;
 
 			for (auto descriptorLayout : layouts)
 			{
 				VulkanBindingLayout& vulkanLayout = *api_cast<VulkanBindingLayout*>(descriptorLayout);
 				descriptorLayouts.push_back(vulkanLayout.GetVkDescriptorSetLayout());
+				descriptorLayoutHashes.push_back(vulkanLayout.GetContentHash());
 
 				// Only iterate over all the items when we don't already have a range
 				if (!range.has_value())
@@ -53,14 +58,7 @@ namespace Obsidian::Internal
 				}
 			}
 
-			VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
-			pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-			pipelineLayoutInfo.pushConstantRangeCount = static_cast<uint32_t>(range.has_value());
-			pipelineLayoutInfo.pPushConstantRanges = (range.has_value() ? &range.value() : nullptr);
-			pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(descriptorLayouts.size());
-			pipelineLayoutInfo.pSetLayouts = descriptorLayouts.data();
-
-			VK_VERIFY(vkCreatePipelineLayout(device, &pipelineLayoutInfo, VulkanAllocator::GetCallbacks(), &layout));
+			layout = cache.Acquire(device, descriptorLayouts, descriptorLayoutHashes, range);
 		}
 
 	}
@@ -72,7 +70,7 @@ namespace Obsidian::Internal
         : m_Specification(specs)
     {
 		OB_ASSERT(specs.Input, "[VkGraphicsPipeline] No proper inputlayout specified.");
-		OB_ASSERT(specs.Pass, "[VkGraphicsPipeline] No proper renderpass specified.");
+		OB_ASSERT((specs.Pass || !specs.ColourFormats.empty() || (specs.DepthFormat != Format::Unknown)), "[VkGraphicsPipeline] No proper renderpass or attachment formats specified.");
 
 		const VulkanDevice& vulkanDevice = *api_cast<const VulkanDevice*>(&device);
 
@@ -80,9 +78,17 @@ namespace Obsidian::Internal
 		auto& depthStencilState = m_Specification.RenderingState.DepthStencil;
 		auto& rasterState = m_Specification.RenderingState.Raster;
 
-		VulkanRenderpass& vulkanRenderpass = *api_cast<VulkanRenderpass*>(m_Specification.Pass);
-		OB_ASSERT(!vulkanRenderpass.GetFramebuffers().empty(), "[VkGraphicsPipeline] Renderpass passed in with no created framebuffers.");
-		VulkanFramebuffer& vulkanFramebuffer = *api_cast<VulkanFramebuffer*>(&vulkanRenderpass.GetFramebuffer(0));
+		VulkanRenderpass* vulkanRenderpass = api_cast<VulkanRenderpass*>(m_Specification.Pass);
+		uint32_t colourAttachmentCount = static_cast<uint32_t>(m_Specification.ColourFormats.size());
+		uint32_t sampleCount = m_Specification.SampleCount;
+		if (vulkanRenderpass)
+		{
+			const RenderpassSpecification& renderpassSpecs = vulkanRenderpass->GetSpecification();
+			colourAttachmentCount = static_cast<uint32_t>(renderpassSpecs.ColourAttachments.size());
+			sampleCount = (!renderpassSpecs.ColourAttachments.empty() ? renderpassSpecs.ColourAttachments[0].Specification.SampleCount : renderpassSpecs.DepthAttachment.Specification.SampleCount);
+		}
+
+		OB_ASSERT((colourAttachmentCount <= vulkanDevice.GetContext().GetVulkanPhysicalDevice().GetMaxColourAttachments()), "[VkGraphicsPipeline] The amount of colour attachments ({0}) exceeds the device's maxColorAttachments ({1}).", colourAttachmentCount, vulkanDevice.GetContext().GetVulkanPhysicalDevice().GetMaxColourAttachments());
 
 		Nano::Memory::StaticVector<VkPipelineShaderStageCreateInfo, 5> shaderStages = { }; // Note: Update when more shaders are added
 
@@ -143,22 +149,28 @@ namespace Obsidian::Internal
 		VkPipelineMultisampleStateCreateInfo multisampling = {};
 		multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
 		multisampling.sampleShadingEnable = blendState.AlphaToCoverageEnable;
-		multisampling.rasterizationSamples = static_cast<VkSampleCountFlagBits>(SampleCountToVkSampleCountFlags(vulkanFramebuffer.GetSpecification().ColourAttachment.ImagePtr->GetSpecification().SampleCount));
-
-		VkPipelineColorBlendAttachmentState colourBlendAttachment = {}; // Note: We currently only support 1 colour attachment
-		colourBlendAttachment.blendEnable = blendState.Target.BlendEnable;
-		colourBlendAttachment.srcColorBlendFactor = BlendFactorToVkBlendFactor(blendState.Target.SrcBlend);
-		colourBlendAttachment.dstColorBlendFactor = BlendFactorToVkBlendFactor(blendState.Target.DstBlend);
-		colourBlendAttachment.colorBlendOp = BlendOperationToVkBlendOp(blendState.Target.BlendOp);
-		colourBlendAttachment.srcAlphaBlendFactor = BlendFactorToVkBlendFactor(blendState.Target.SrcBlendAlpha);
-		colourBlendAttachment.dstAlphaBlendFactor = BlendFactorToVkBlendFactor(blendState.Target.DstBlendAlpha);
-		colourBlendAttachment.alphaBlendOp = BlendOperationToVkBlendOp(blendState.Target.BlendOpAlpha);
-		colourBlendAttachment.colorWriteMask = ColourMaskToVkColorComponentFlags(blendState.Target.ColourWriteMask);
-
-		VkPipelineColorBlendStateCreateInfo colorBlending = {}; // Note: We currently only support 1 colour attachment
+		multisampling.rasterizationSamples = static_cast<VkSampleCountFlagBits>(SampleCountToVkSampleCountFlags(sampleCount));
+
+		std::array<VkPipelineColorBlendAttachmentState, Information::MaxColourAttachments> colourBlendAttachments = {}; // Note: One per colour attachment
+		for (uint32_t i = 0; i < colourAttachmentCount; i++)
+		{
+			const BlendState::RenderTarget& target = blendState.GetRenderTarget(i);
+
+			VkPipelineColorBlendAttachmentState& colourBlendAttachment = colourBlendAttachments[i];
+			colourBlendAttachment.blendEnable = target.BlendEnable;
+			colourBlendAttachment.srcColorBlendFactor = BlendFactorToVkBlendFactor(target.SrcBlend);
+			colourBlendAttachment.dstColorBlendFactor = BlendFactorToVkBlendFactor(target.DstBlend);
+			colourBlendAttachment.colorBlendOp = BlendOperationToVkBlendOp(target.BlendOp);
+			colourBlendAttachment.srcAlphaBlendFactor = BlendFactorToVkBlendFactor(target.SrcBlendAlpha);
+			colourBlendAttachment.dstAlphaBlendFactor = BlendFactorToVkBlendFactor(target.DstBlendAlpha);
+			colourBlendAttachment.alphaBlendOp = BlendOperationToVkBlendOp(target.BlendOpAlpha);
+			colourBlendAttachment.colorWriteMask = ColourMaskToVkColorComponentFlags(target.ColourWriteMask);
+		}
+
+		VkPipelineColorBlendStateCreateInfo colorBlending = {};
 		colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-		colorBlending.attachmentCount = 1;
-		colorBlending.pAttachments = &colourBlendAttachment;
+		colorBlending.attachmentCount = colourAttachmentCount;
+		colorBlending.pAttachments = colourBlendAttachments.data();
 
 		VkPipelineDepthStencilStateCreateInfo depthStencil = {};
 		depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
@@ -195,12 +207,26 @@ namespace Obsidian::Internal
 		dynamicState.pDynamicStates = dynamicStates.data();
 
 		// Pipeline layout
-		CreatePipelineLayout(m_PipelineLayout, m_Specification.BindingLayouts, vulkanDevice.GetContext().GetVulkanLogicalDevice().GetVkDevice(), m_PushConstantsStage);
+		CreatePipelineLayout(m_PipelineLayout, m_Specification.BindingLayouts, vulkanDevice.GetContext().GetVulkanLogicalDevice().GetVkDevice(), vulkanDevice.GetPipelineLayoutCache(), m_PushConstantsStage);
+
+		// Dynamic rendering
+		std::array<VkFormat, Information::MaxColourAttachments> colourFormats = {};
+		for (size_t i = 0; i < m_Specification.ColourFormats.size(); i++)
+			colourFormats[i] = FormatToVkFormat(m_Specification.ColourFormats[i]);
+
+		VkPipelineRenderingCreateInfo renderingInfo = {};
+		renderingInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO;
+		renderingInfo.viewMask = 0;
+		renderingInfo.colorAttachmentCount = static_cast<uint32_t>(m_Specification.ColourFormats.size());
+		renderingInfo.pColorAttachmentFormats = (!m_Specification.ColourFormats.empty() ? colourFormats.data() : nullptr);
+		renderingInfo.depthAttachmentFormat = FormatToVkFormat(m_Specification.DepthFormat);
+		renderingInfo.stencilAttachmentFormat = VK_FORMAT_UNDEFINED; // Note: We currently don't support stencil
 
 		// Create the actual graphics pipeline (where we actually use the shaders and other info)
 		VkGraphicsPipelineCreateInfo pipelineInfo = {};
 		pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-		pipelineInfo.pNext = nullptr; // Note: Put dynamic render info here when we need it/want to support it.
+		pipelineInfo.pNext = (vulkanRenderpass ? nullptr : &renderingInfo);
+		pipelineInfo.flags = (vulkanDevice.GetContext().UsesDescriptorBuffers() ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0);
 		pipelineInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
 		pipelineInfo.pStages = shaderStages.data();
 		pipelineInfo.pVertexInputState = &vertexInputInfo;
@@ -213,7 +239,7 @@ namespace Obsidian::Internal
 		pipelineInfo.pColorBlendState = &colorBlending;
 		pipelineInfo.pDynamicState = &dynamicState;
 		pipelineInfo.layout = m_PipelineLayout;
-		pipelineInfo.renderPass = vulkanRenderpass.GetVkRenderPass();
+		pipelineInfo.renderPass = (vulkanRenderpass ? vulkanRenderpass->GetVkRenderPass() : VK_NULL_HANDLE);
 		pipelineInfo.subpass = 0;
 		pipelineInfo.basePipelineHandle = VK_NULL_HANDLE; // Optional
 		pipelineInfo.basePipelineIndex = -1; // Optional
@@ -250,11 +276,12 @@ namespace Obsidian::Internal
 		computeShaderInfo.module = api_cast<const VulkanShader*>(specs.ComputeShader)->GetVkShaderModule();
 		computeShaderInfo.pName = specs.ComputeShader->GetSpecification().MainName.data();
 
-		CreatePipelineLayout(m_PipelineLayout, m_Specification.BindingLayouts, vulkanDevice.GetContext().GetVulkanLogicalDevice().GetVkDevice(), m_PushConstantsStage);
+		CreatePipelineLayout(m_PipelineLayout, m_Specification.BindingLayouts, vulkanDevice.GetContext().GetVulkanLogicalDevice().GetVkDevice(), vulkanDevice.GetPipelineLayoutCache(), m_PushConstantsStage);
 
 		// Create the actual compute pipeline (where we actually use the shaders and other info)
 		VkComputePipelineCreateInfo pipelineInfo = {};
 		pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+		pipelineInfo.flags = (vulkanDevice.GetContext().UsesDescriptorBuffers() ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0);
 		pipelineInfo.stage = computeShaderInfo;
 		pipelineInfo.layout = m_PipelineLayout;
 		pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
@@ -276,4 +303,76 @@ namespace Obsidian::Internal
 	{
 	}
 
+	////////////////////////////////////////////////////////////////////////////////////
+	// VulkanPipelineLayoutCache
+	////////////////////////////////////////////////////////////////////////////////////
+	VkPipelineLayout VulkanPipelineLayoutCache::Acquire(VkDevice device, std::span<const VkDescriptorSetLayout> setLayouts, std::span<const size_t> setLayoutHashes, const std::optional<VkPushConstantRange>& pushConstants)
+	{
+		OB_ASSERT((setLayouts.size() == setLayoutHashes.size()), "[VkPipelineLayoutCache] Every set layout needs a content hash.");
+
+		size_t hash = 0;
+		for (size_t setLayoutHash : setLayoutHashes)
+			hash = Nano::Hash::Combine(hash, setLayoutHash);
+		if (pushConstants.has_value())
+		{
+			hash = Nano::Hash::Combine(hash, std::hash<uint32_t>{}(pushConstants->stageFlags));
+			hash = Nano::Hash::Combine(hash, std::hash<uint32_t>{}(pushConstants->offset));
+			hash = Nano::Hash::Combine(hash, std::hash<uint32_t>{}(pushConstants->size));
+		}
+
+		std::scoped_lock lock(m_Mutex);
+
+		std::vector<Entry*>& bucket = m_Lookup[hash];
+		for (Entry* entry : bucket)
+		{
+			if (!std::ranges::equal(entry->SetLayoutHashes, setLayoutHashes) || (entry->PushConstants.has_value() != pushConstants.has_value()))
+				continue;
+			if (pushConstants.has_value() && ((entry->PushConstants->stageFlags != pushConstants->stageFlags) || (entry->PushConstants->offset != pushConstants->offset) || (entry->PushConstants->size != pushConstants->size)))
+				continue;
+
+			entry->References++;
+			return entry->Layout;
+		}
+
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipelineLayoutInfo.pushConstantRangeCount = static_cast<uint32_t>(pushConstants.has_value());
+		pipelineLayoutInfo.pPushConstantRanges = (pushConstants.has_value() ? &pushConstants.value() : nullptr);
+		pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(setLayouts.size());
+		pipelineLayoutInfo.pSetLayouts = setLayouts.data();
+
+		VkPipelineLayout layout = VK_NULL_HANDLE;
+		VK_VERIFY(vkCreatePipelineLayout(device, &pipelineLayoutInfo, VulkanAllocator::GetCallbacks(), &layout));
+
+		Entry& entry = m_Entries.emplace_back(std::vector<size_t>(setLayoutHashes.begin(), setLayoutHashes.end()), pushConstants, hash, layout, 1);
+		bucket.push_back(&entry);
+		m_Layouts[layout] = std::prev(m_Entries.end());
+
+		return layout;
+	}
+
+	bool VulkanPipelineLayoutCache::Release(VkPipelineLayout layout)
+	{
+		std::scoped_lock lock(m_Mutex);
+
+		auto it = m_Layouts.find(layout);
+		OB_ASSERT((it != m_Layouts.end()), "[VkPipelineLayoutCache] Released a pipeline layout that isn't part of the cache.");
+		if (it == m_Layouts.end())
+			return false;
+
+		std::list<Entry>::iterator entry = it->second;
+		if (--entry->References != 0)
+			return false;
+
+		// Note: Removed right away, a pipeline created before the deferred destroy runs just gets a new layout
+		std::vector<Entry*>& bucket = m_Lookup[entry->Hash];
+		std::erase(bucket, &(*entry));
+		if (bucket.empty())
+			m_Lookup.erase(entry->Hash);
+
+		m_Layouts.erase(it);
+		m_Entries.erase(entry);
+		return true;
+	}
+
 }
\ No newline at end of file
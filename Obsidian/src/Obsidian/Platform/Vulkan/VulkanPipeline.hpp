@@ -9,6 +9,13 @@
 
 #include <Nano/Nano.hpp>
 
+#include <span>
+#include <list>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+#include <optional>
+
 namespace Obsidian
 {
     class Device;
@@ -22,6 +29,43 @@ namespace Obsidian::Internal
     class VulkanComputePipeline;
 
 #if defined(OB_API_VULKAN)
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanPipelineLayoutCache // Note: Pipelines with the same descriptor set layouts & push
+    // constant range share a single reference counted VkPipelineLayout. Set layouts are compared
+    // by their contents, since a destroyed layout's handle can be reused by a different layout.
+    ////////////////////////////////////////////////////////////////////////////////////
+    class VulkanPipelineLayoutCache
+    {
+    public:
+        // Constructor & Destructor
+        VulkanPipelineLayoutCache() = default;
+        ~VulkanPipelineLayoutCache() = default;
+
+        // Methods // Note: Thread safe
+        VkPipelineLayout Acquire(VkDevice device, std::span<const VkDescriptorSetLayout> setLayouts, std::span<const size_t> setLayoutHashes, const std::optional<VkPushConstantRange>& pushConstants); // Note: The hashes come from VulkanBindingLayout::GetContentHash()
+        bool Release(VkPipelineLayout layout); // Note: Returns true when the last reference is released, the caller is then responsible for destroying the layout
+
+    private:
+        struct Entry
+        {
+        public:
+            std::vector<size_t> SetLayoutHashes;
+            std::optional<VkPushConstantRange> PushConstants;
+            size_t Hash;
+
+            VkPipelineLayout Layout;
+            uint32_t References;
+        };
+
+    private:
+        std::mutex m_Mutex = {};
+
+        // Note: std::list so the lookups can point into it, the first map is keyed by Entry::Hash
+        std::list<Entry> m_Entries = { };
+        std::unordered_map<size_t, std::vector<Entry*>> m_Lookup = { };
+        std::unordered_map<VkPipelineLayout, std::list<Entry>::iterator> m_Layouts = { };
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
     // VulkanGraphicsPipeline
     ////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,140 @@
+#include "obpch.h"
+#include "VulkanQueryPool.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+#include "Obsidian/Renderer/QueryPool.hpp"
+
+#include "Obsidian/Platform/Vulkan/VulkanDevice.hpp"
+
+namespace Obsidian::Internal
+{
+
+    namespace
+    {
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Helper methods
+        ////////////////////////////////////////////////////////////////////////////////////
+        constexpr VkQueryType QueryTypeToVkQueryType(QueryType type)
+        {
+            switch (type)
+            {
+            case QueryType::Timestamp:              return VK_QUERY_TYPE_TIMESTAMP;
+            case QueryType::PipelineStatistics:     return VK_QUERY_TYPE_PIPELINE_STATISTICS;
+            case QueryType::Occlusion:              return VK_QUERY_TYPE_OCCLUSION;
+
+            default:
+                OB_ASSERT(false, "[VkQueryPool] Unknown QueryType.");
+                break;
+            }
+
+            return VK_QUERY_TYPE_TIMESTAMP;
+        }
+
+        // Note: The order of the bits defines the order of the results, this matches the layout of PipelineStatistics
+        constexpr VkQueryPipelineStatisticFlags s_PipelineStatistics = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT | VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT | VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT | VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT | VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
+
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    VulkanQueryPool::VulkanQueryPool(const Device& device, const QueryPoolSpecification& specs)
+        : m_Device(*api_cast<const VulkanDevice*>(&device)), m_Specification(specs), m_QueryQueues(((specs.Type == QueryType::Timestamp) ? specs.Count : 0))
+    {
+        OB_ASSERT((m_Specification.Count > 0), "[VkQueryPool] A QueryPool must contain at least 1 query.");
+        OB_ASSERT(((m_Specification.Type != QueryType::Timestamp) || (m_Specification.Count % 2 == 0)), "[VkQueryPool] A Timestamp QueryPool must have an even count, since every timer uses 2 queries.");
+        OB_ASSERT(((m_Specification.Type != QueryType::PipelineStatistics) || m_Device.GetContext().GetVulkanPhysicalDevice().SupportsPipelineStatistics()), "[VkQueryPool] PipelineStatistics queries are not supported by this device.");
+
+        VkQueryPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        poolInfo.queryType = QueryTypeToVkQueryType(m_Specification.Type);
+        poolInfo.queryCount = m_Specification.Count;
+        poolInfo.pipelineStatistics = ((m_Specification.Type == QueryType::PipelineStatistics) ? s_PipelineStatistics : 0);
+
+        VK_VERIFY(vkCreateQueryPool(m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &poolInfo, VulkanAllocator::GetCallbacks(), &m_QueryPool));
+
+        if (m_Specification.Type == QueryType::Timestamp)
+        {
+            VkPhysicalDevice physicalDevice = m_Device.GetContext().GetVulkanPhysicalDevice().GetVkPhysicalDevice();
+
+            VkPhysicalDeviceProperties properties;
+            vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+            m_TimestampPeriod = static_cast<double>(properties.limits.timestampPeriod);
+
+            uint32_t queueFamilyCount = 0;
+            vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+            std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+            vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+
+            for (size_t i = 0; i < m_TimestampMasks.size(); i++)
+            {
+                uint32_t validBits = queueFamilies[m_Device.GetContext().GetVulkanPhysicalDevice().GetQueueFamilyIndices().GetQueueFamily(static_cast<CommandQueue>(i))].timestampValidBits;
+                m_TimestampMasks[i] = ((validBits >= 64) ? std::numeric_limits<uint64_t>::max() : ((1ull << validBits) - 1ull));
+            }
+        }
+
+        if constexpr (Information::Validation)
+        {
+            if (!m_Specification.DebugName.empty())
+                m_Device.GetContext().SetDebugName(m_QueryPool, VK_OBJECT_TYPE_QUERY_POOL, std::string(m_Specification.DebugName));
+        }
+    }
+
+    VulkanQueryPool::~VulkanQueryPool()
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    bool VulkanQueryPool::GetResults(uint32_t firstQuery, uint32_t queryCount, std::span<uint64_t> results) const
+    {
+        OB_PROFILE("VulkanQueryPool::GetResults()");
+
+        const size_t valuesPerQuery = ((m_Specification.Type == QueryType::PipelineStatistics) ? (sizeof(PipelineStatistics) / sizeof(uint64_t)) : 1);
+        OB_ASSERT((firstQuery + queryCount <= m_Specification.Count), "[VkQueryPool] Query range exceeds the QueryPool's count.");
+        OB_ASSERT((results.size() >= queryCount * valuesPerQuery), "[VkQueryPool] Results span is too small for the requested queries.");
+
+        // Note: No VK_QUERY_RESULT_WAIT_BIT, so this returns VK_NOT_READY instead of stalling when any query isn't available yet.
+        VkResult result = vkGetQueryPoolResults(m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), m_QueryPool, firstQuery, queryCount, queryCount * valuesPerQuery * sizeof(uint64_t), results.data(), valuesPerQuery * sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+        if (result == VK_NOT_READY)
+            return false;
+
+        VK_VERIFY(result);
+
+        if (m_Specification.Type == QueryType::Timestamp)
+        {
+            for (size_t i = 0; i < queryCount; i++)
+                results[i] &= m_TimestampMasks[static_cast<size_t>(m_QueryQueues[firstQuery + i].load(std::memory_order_relaxed))];
+        }
+
+        return true;
+    }
+
+    bool VulkanQueryPool::GetTimerResult(uint32_t timer, double& milliseconds) const
+    {
+        OB_ASSERT((m_Specification.Type == QueryType::Timestamp), "[VkQueryPool] GetTimerResult can only be used on a Timestamp QueryPool.");
+
+        std::array<uint64_t, 2> timestamps = { };
+        if (!GetResults(timer * 2, 2, timestamps))
+            return false;
+
+        const uint64_t mask = m_TimestampMasks[static_cast<size_t>(m_QueryQueues[(timer * 2) + 1].load(std::memory_order_relaxed))];
+        milliseconds = (static_cast<double>((timestamps[1] - timestamps[0]) & mask) * m_TimestampPeriod) / 1'000'000.0;
+        return true;
+    }
+
+    bool VulkanQueryPool::GetPipelineStatistics(uint32_t query, PipelineStatistics& statistics) const
+    {
+        OB_ASSERT((m_Specification.Type == QueryType::PipelineStatistics), "[VkQueryPool] GetPipelineStatistics can only be used on a PipelineStatistics QueryPool.");
+
+        return GetResults(query, 1, std::span<uint64_t>(reinterpret_cast<uint64_t*>(&statistics), sizeof(PipelineStatistics) / sizeof(uint64_t)));
+    }
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/API.hpp"
+#include "Obsidian/Renderer/QueryPoolSpec.hpp"
+#include "Obsidian/Renderer/CommandListSpec.hpp"
+
+#include "Obsidian/Platform/Vulkan/Vulkan.hpp"
+
+#include <Nano/Nano.hpp>
+
+#include <span>
+#include <array>
+#include <atomic>
+#include <vector>
+#include <limits>
+
+namespace Obsidian
+{
+    class Device;
+}
+
+namespace Obsidian::Internal
+{
+
+    class VulkanDevice;
+    class VulkanQueryPool;
+
+#if defined(OB_API_VULKAN)
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanQueryPool
+    ////////////////////////////////////////////////////////////////////////////////////
+    class VulkanQueryPool
+    {
+    public:
+        // Constructor & Destructor
+        VulkanQueryPool(const Device& device, const QueryPoolSpecification& specs);
+        ~VulkanQueryPool();
+
+        // Methods
+        bool GetResults(uint32_t firstQuery, uint32_t queryCount, std::span<uint64_t> results) const;
+
+        bool GetTimerResult(uint32_t timer, double& milliseconds) const;
+        bool GetPipelineStatistics(uint32_t query, PipelineStatistics& statistics) const;
+
+        // Getters
+        inline const QueryPoolSpecification& GetSpecification() const { return m_Specification; }
+
+        // Internal getters
+        inline VkQueryPool GetVkQueryPool() const { return m_QueryPool; }
+
+    private:
+        const VulkanDevice& m_Device;
+        QueryPoolSpecification m_Specification;
+
+        VkQueryPool m_QueryPool = VK_NULL_HANDLE;
+
+        double m_TimestampPeriod = 1.0; // Note: Nanoseconds per timestamp tick
+
+        // Note: Every queue family reports its own timestampValidBits, so every timestamp stores the queue it was written on.
+        // A mask of 0 means the queue's family doesn't support timestamps.
+        std::array<uint64_t, static_cast<size_t>(CommandQueue::Count)> m_TimestampMasks = { };
+        std::vector<std::atomic<CommandQueue>> m_QueryQueues;
+
+        friend class VulkanCommandList;
+    };
+#endif
+
+}
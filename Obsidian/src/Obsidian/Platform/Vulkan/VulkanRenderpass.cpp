@@ -23,53 +23,75 @@ namespace Obsidian::Internal
     VulkanRenderpass::VulkanRenderpass(const Device& device, const RenderpassSpecification& specs)
         : m_Device(*api_cast<const VulkanDevice*>(&device)), m_Specification(specs)
     {
-        Nano::Memory::StaticVector<VkAttachmentDescription2, 2> attachments;
-        std::optional<VkAttachmentReference2> colourReference;
+        OB_ASSERT((m_Specification.ColourAttachments.size() <= m_Device.GetContext().GetVulkanPhysicalDevice().GetMaxColourAttachments()), "[VkRenderpass] The amount of colour attachments ({0}) exceeds the device's maxColorAttachments ({1}).", m_Specification.ColourAttachments.size(), m_Device.GetContext().GetVulkanPhysicalDevice().GetMaxColourAttachments());
+
+        // Note: Attachments are ordered as colour attachments, resolve attachments & then the depth attachment, the framebuffer follows the same order
+        Nano::Memory::StaticVector<VkAttachmentDescription2, (Information::MaxColourAttachments * 2) + 1> attachments;
+        Nano::Memory::StaticVector<VkAttachmentReference2, Information::MaxColourAttachments> colourReferences;
+        Nano::Memory::StaticVector<VkAttachmentReference2, Information::MaxColourAttachments> resolveReferences;
         std::optional<VkAttachmentReference2> depthReference;
 
-        if ((m_Specification.ColourSpecification.Width != 0) || (m_Specification.ColourSpecification.Height != 0))
+        const auto addAttachment = [&](const ImageSpecification& imageSpec, LoadOperation load, StoreOperation store, ResourceState startState, ResourceState renderingState, ResourceState endState) -> VkAttachmentReference2
         {
             VkAttachmentDescription2& attachment = attachments.emplace_back();
             attachment.sType = VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2;
-            attachment.format = FormatToVkFormat(m_Specification.ColourSpecification.ImageFormat);
-            attachment.samples = static_cast<VkSampleCountFlagBits>(SampleCountToVkSampleCountFlags(m_Specification.ColourSpecification.SampleCount));
-            attachment.loadOp = LoadOperationToVkLoadOperation(m_Specification.ColourLoadOperation);
-            attachment.storeOp = StoreOperationToVkStoreOperation(m_Specification.ColourStoreOperation);
+            attachment.format = FormatToVkFormat(imageSpec.ImageFormat);
+            attachment.samples = static_cast<VkSampleCountFlagBits>(SampleCountToVkSampleCountFlags(imageSpec.SampleCount));
+            attachment.loadOp = LoadOperationToVkLoadOperation(load);
+            attachment.storeOp = StoreOperationToVkStoreOperation(store);
             attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
             attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-            attachment.initialLayout = ResourceStateToImageLayout(m_Specification.ColourImageStartState);
-            attachment.finalLayout = ResourceStateToImageLayout(m_Specification.ColourImageEndState);
+            attachment.initialLayout = ResourceStateToImageLayout(startState);
+            attachment.finalLayout = ResourceStateToImageLayout(endState);
 
-            VkAttachmentReference2& reference = colourReference.emplace();
+            VkAttachmentReference2 reference = {};
             reference.sType = VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2;
             reference.attachment = static_cast<uint32_t>((attachments.size() - 1));
-            reference.layout = ResourceStateToImageLayout(m_Specification.ColourImageRenderingState);
+            reference.layout = ResourceStateToImageLayout(renderingState);
+            return reference;
+        };
+
+        bool hasResolve = false;
+        for (const RenderpassAttachmentSpecification& colour : m_Specification.ColourAttachments)
+        {
+            OB_ASSERT(colour.IsValid(), "[VkRenderpass] Colour attachment has no proper image specification.");
+            colourReferences.push_back(addAttachment(colour.Specification, colour.Load, colour.Store, colour.StartState, colour.RenderingState, colour.EndState));
+
+            hasResolve |= colour.HasResolve();
         }
 
-        if ((m_Specification.DepthSpecification.Width != 0) || (m_Specification.DepthSpecification.Height != 0))
+        if (hasResolve)
         {
-            VkAttachmentDescription2& attachment = attachments.emplace_back();
-            attachment.sType = VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2;
-            attachment.format = FormatToVkFormat(m_Specification.DepthSpecification.ImageFormat);
-            attachment.samples = static_cast<VkSampleCountFlagBits>(SampleCountToVkSampleCountFlags(m_Specification.DepthSpecification.SampleCount));
-            attachment.loadOp = LoadOperationToVkLoadOperation(m_Specification.DepthLoadOperation);
-            attachment.storeOp = StoreOperationToVkStoreOperation(m_Specification.DepthStoreOperation);
-            attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-            attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-            attachment.initialLayout = ResourceStateToImageLayout(m_Specification.DepthImageStartState);
-            attachment.finalLayout = ResourceStateToImageLayout(m_Specification.DepthImageEndState);
+            for (const RenderpassAttachmentSpecification& colour : m_Specification.ColourAttachments)
+            {
+                if (!colour.HasResolve())
+                {
+                    VkAttachmentReference2& reference = resolveReferences.emplace_back();
+                    reference.sType = VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2;
+                    reference.attachment = VK_ATTACHMENT_UNUSED;
+                    continue;
+                }
+
+                OB_ASSERT((colour.Specification.SampleCount > 1), "[VkRenderpass] Only multisampled colour attachments can be resolved.");
+                OB_ASSERT((colour.ResolveSpecification.SampleCount == 1), "[VkRenderpass] Resolve attachments can't be multisampled.");
+
+                // Note: The resolve overwrites the whole image, so the previous contents are never loaded
+                resolveReferences.push_back(addAttachment(colour.ResolveSpecification, LoadOperation::DontCare, StoreOperation::Store, ResourceState::ResolveDst, ResourceState::ResolveDst, colour.ResolveEndState));
+            }
+        }
 
-            VkAttachmentReference2& reference = depthReference.emplace();
-            reference.sType = VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2;
-            reference.attachment = static_cast<uint32_t>((attachments.size() - 1));
-            reference.layout = ResourceStateToImageLayout(m_Specification.DepthImageRenderingState);
+        if (m_Specification.DepthAttachment.IsValid())
+        {
+            const RenderpassAttachmentSpecification& depth = m_Specification.DepthAttachment;
+            depthReference = addAttachment(depth.Specification, depth.Load, depth.Store, depth.StartState, depth.RenderingState, depth.EndState);
         }
 
         VkSubpassDescription2 subpass = {};
         subpass.sType = VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2;
         subpass.pipelineBindPoint = PipelineBindpointToVkBindpoint(m_Specification.Bindpoint);
-        subpass.colorAttachmentCount = (colourReference.has_value() ? 1 : 0);
-        subpass.pColorAttachments = (colourReference.has_value() ? &colourReference.value() : 0);
+        subpass.colorAttachmentCount = static_cast<uint32_t>(colourReferences.size());
+        subpass.pColorAttachments = (!colourReferences.empty() ? colourReferences.data() : nullptr);
+        subpass.pResolveAttachments = (!resolveReferences.empty() ? resolveReferences.data() : nullptr);
         subpass.pDepthStencilAttachment = (depthReference.has_value() ? &depthReference.value() : nullptr);
         
         VkRenderPassCreateInfo2 renderpassInfo = {};
@@ -58,7 +58,10 @@ namespace Obsidian::Internal
                                             VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,        VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT,  VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL },
         { ResourceState::CopyDst,           VK_PIPELINE_STAGE_2_TRANSFER_BIT,                   VK_ACCESS_2_TRANSFER_WRITE_BIT,                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL },
         { ResourceState::CopySrc,           VK_PIPELINE_STAGE_2_TRANSFER_BIT,                   VK_ACCESS_2_TRANSFER_READ_BIT,                  VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL },
-        { ResourceState::Present,           VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,               VK_ACCESS_2_MEMORY_READ_BIT,                    VK_IMAGE_LAYOUT_PRESENT_SRC_KHR }
+        { ResourceState::Present,           VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,               VK_ACCESS_2_MEMORY_READ_BIT,                    VK_IMAGE_LAYOUT_PRESENT_SRC_KHR },
+        { ResourceState::ResolveSrc,        VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,    VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT,          VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL }, // Note: Resolves happen as part of the renderpass on Vulkan
+        { ResourceState::ResolveDst,        VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,    VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT,         VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL },
+        { ResourceState::HostRead,          VK_PIPELINE_STAGE_2_HOST_BIT,                       VK_ACCESS_2_HOST_READ_BIT,                      VK_IMAGE_LAYOUT_GENERAL }
         //{ ResourceState::AccelStructRead,   VK_PIPELINE_STAGE_2_RAY_TRACIOB_SHADER_BIT_KHR | 
         //                                    VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,             VK_ACCESS_2_ACCELERATION_STRUCTURE_READ_BIT_KHR,VK_IMAGE_LAYOUT_UNDEFINED },
         //{ ResourceState::AccelStructWrite,  VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,VK_ACCESS_2_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,VK_IMAGE_LAYOUT_UNDEFINED },
@@ -7,63 +7,14 @@
 #include "Obsidian/Renderer/Device.hpp"
 #include "Obsidian/Renderer/Shader.hpp"
 
-#include <bit>
-
 namespace Obsidian::Internal
 {
 
-    namespace
-    {
-
-        ////////////////////////////////////////////////////////////////////////////////////
-        // ShaderStageMapping
-        ////////////////////////////////////////////////////////////////////////////////////
-        struct ShaderStageMapping
-        {
-        public:
-            ShaderStage Stage;
-
-            shaderc_shader_kind ShaderCShaderKind;
-        };
-
-        ////////////////////////////////////////////////////////////////////////////////////
-        // ShaderStageMapping array
-        ////////////////////////////////////////////////////////////////////////////////////
-        constexpr static auto g_ShaderStageMapping = std::to_array<ShaderStageMapping>({
-            // Stage                                ShaderCShaderKind
-            { ShaderStage::None,                    shaderc_glsl_vertex_shader }, // Default
-            { ShaderStage::Vertex,                  shaderc_glsl_vertex_shader },
-            { ShaderStage::Fragment,                shaderc_glsl_fragment_shader },
-            { ShaderStage::Compute,                 shaderc_glsl_compute_shader },
-            { ShaderStage::Geometry,                shaderc_glsl_geometry_shader },
-            { ShaderStage::TesselationControl,      shaderc_glsl_tess_control_shader },
-            { ShaderStage::TesselationEvaluation,   shaderc_glsl_tess_evaluation_shader },
-            { ShaderStage::Task,                    shaderc_glsl_task_shader },
-            { ShaderStage::Mesh,                    shaderc_glsl_mesh_shader },
-            { ShaderStage::AllGraphics,             shaderc_glsl_vertex_shader }, // Default
-            { ShaderStage::RayGeneration,           shaderc_glsl_raygen_shader },
-            { ShaderStage::AnyHit,                  shaderc_glsl_anyhit_shader },
-            { ShaderStage::ClosestHit,              shaderc_glsl_closesthit_shader },
-            { ShaderStage::Miss,                    shaderc_glsl_miss_shader },
-            { ShaderStage::Intersection,            shaderc_glsl_intersection_shader },
-            { ShaderStage::Callable,                shaderc_glsl_callable_shader }
-        });
-
-        ////////////////////////////////////////////////////////////////////////////////////
-        // Helper methods
-        ////////////////////////////////////////////////////////////////////////////////////
-        constexpr static shaderc_shader_kind ShaderStageToShaderCKind(ShaderStage stage)
-        {
-            return g_ShaderStageMapping[(std::to_underlying(stage) ? (std::countr_zero(std::to_underlying(stage)) + 1) : 0)].ShaderCShaderKind;
-        }
-
-    }
-
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
     VulkanShader::VulkanShader(const Device& device, const ShaderSpecification& specs)
-        : m_Device(*api_cast<const VulkanDevice*>(&device)), m_Specification(specs)
+        : m_Device(*api_cast<const VulkanDevice*>(&device)), m_Specification(specs), m_CodeHash(HashShaderCode(specs))
     {
         std::span<const uint32_t> code;
         std::visit([&](auto&& arg)
@@ -97,7 +48,8 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     // Constructor & Destructor
     ////////////////////////////////////////////////////////////////////////////////////
-    VulkanShaderCompiler::VulkanShaderCompiler()
+    VulkanShaderCompiler::VulkanShaderCompiler(const ShaderCompilerSpecification& specs)
+        : m_Compiler(specs)
     {
     }
 
@@ -110,31 +62,12 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     std::vector<uint32_t> VulkanShaderCompiler::CompileToSPIRV(ShaderStage stage, const std::string& code, const std::string& entryPoint, ShadingLanguage language)
     {
-        OB_ASSERT((!code.empty()), "[VkShaderCompiler] Empty string passed in as shader code.");
-
-        // Set language
-        shaderc::CompileOptions options = {};
-        options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_3);
-        
-        // Note: Forces the shaders to manually set all registers/sets/bindings
-        options.SetAutoBindUniforms(false);
-
-        if (language == ShadingLanguage::GLSL)      
-            options.SetSourceLanguage(shaderc_source_language_glsl);
-        else if (language == ShadingLanguage::HLSL)
-        {
-            options.SetSourceLanguage(shaderc_source_language_hlsl);
-            options.SetTargetSpirv(shaderc_spirv_version_1_6);
-
-            options.AddMacroDefinition("HLSL");
-            options.SetHlslIoMapping(true); // Note: Needed for `register(b0, space0)` layout
-        }
-
-        shaderc::SpvCompilationResult module = m_Compiler.CompileGlslToSpv(code, ShaderStageToShaderCKind(stage), "", entryPoint.c_str(), options);
-
-        OB_ASSERT((module.GetCompilationStatus() == shaderc_compilation_status_success), "[VkShaderCompiler] Error compiling shader: {0}", module.GetErrorMessage());
-
-        return std::vector<uint32_t>(module.cbegin(), module.cend());
+        return m_Compiler.Compile(ShaderCompileArgs()
+            .SetShaderStage(stage)
+            .SetCode(code)
+            .SetEntryPoint(entryPoint)
+            .SetShadingLanguage(language)
+        );
     }
 
     std::vector<uint32_t> VulkanShaderCompiler::CompileToNative(ShaderStage stage, const std::string& code, const std::string& entryPoint, ShadingLanguage language)
@@ -4,14 +4,15 @@
 
 #include "Obsidian/Renderer/API.hpp"
 #include "Obsidian/Renderer/ShaderSpec.hpp"
+#include "Obsidian/Renderer/SPIRVCompiler.hpp"
 
 #include "Obsidian/Platform/Vulkan/Vulkan.hpp"
 
 #include <Nano/Nano.hpp>
 
-#include <shaderc/shaderc.hpp>
-
+#include <span>
 #include <vector>
+#include <future>
 
 namespace Obsidian
 {
@@ -38,6 +39,7 @@ namespace Obsidian::Internal
 
         // Getters
         inline const ShaderSpecification& GetSpecification() const { return m_Specification; }
+        inline size_t GetCodeHash() const { return m_CodeHash; }
 
         // Internal getters
         inline VkShaderModule GetVkShaderModule() const { return m_Shader; }
@@ -47,6 +49,7 @@ namespace Obsidian::Internal
     private:
         const VulkanDevice& m_Device;
         ShaderSpecification m_Specification;
+        size_t m_CodeHash = 0; // Note: Computed on creation, since the viewed code may not outlive the shader
 
         VkShaderModule m_Shader = VK_NULL_HANDLE;
     };
@@ -58,16 +61,20 @@ namespace Obsidian::Internal
     {
     public:
         // Constructors & Destructor
-        VulkanShaderCompiler();
+        VulkanShaderCompiler(const ShaderCompilerSpecification& specs);
         ~VulkanShaderCompiler();
 
         // Methods
         std::vector<uint32_t> CompileToSPIRV(ShaderStage stage, const std::string& code, const std::string& entryPoint, ShadingLanguage language);
+        inline std::vector<uint32_t> CompileToSPIRV(const ShaderCompileArgs& args) { return m_Compiler.Compile(args); }
+
+        inline std::future<std::vector<uint32_t>> CompileAsync(const ShaderCompileArgs& args) { return m_Compiler.CompileAsync(args); }
+        inline std::vector<std::vector<uint32_t>> CompileBatch(std::span<const ShaderCompileArgs> args) { return m_Compiler.CompileBatch(args); }
 
         std::vector<uint32_t> CompileToNative(ShaderStage stage, const std::string& code, const std::string& entryPoint, ShadingLanguage language);
 
     private:
-        shaderc::Compiler m_Compiler = {};
+        SPIRVCompiler m_Compiler;
     };
 #endif
 
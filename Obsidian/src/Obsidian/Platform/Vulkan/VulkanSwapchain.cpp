@@ -25,6 +25,8 @@ namespace Obsidian::Internal
     VulkanSwapchain::VulkanSwapchain(const Device& device, const SwapchainSpecification& specs)
         : m_Device(*api_cast<const VulkanDevice*>(&device)), m_Specification(specs)
     {
+        OB_ASSERT(!m_Device.GetContext().IsHeadless(), "[VkSwapchain] Can't create a Swapchain on a headless Device.");
+
         #if defined(OB_PLATFORM_DESKTOP)
             VK_VERIFY(glfwCreateWindowSurface(m_Device.GetContext().GetVkInstance(), static_cast<GLFWwindow*>(m_Specification.WindowTarget->GetNativeWindow()), VulkanAllocator::GetCallbacks(), &m_Surface));
         #endif
@@ -76,21 +78,6 @@ namespace Obsidian::Internal
                         m_Device.GetContext().SetDebugName(m_SwapchainPresentableSemaphores[i], VK_OBJECT_TYPE_SEMAPHORE, std::format("Presentable Semaphore({0}) for: {1}", i, m_Specification.DebugName));
                 }
             }
-
-            VkSemaphoreTypeCreateInfo timelineInfo = {};
-            timelineInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
-            timelineInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
-            timelineInfo.initialValue = 0;
-
-            semaphoreInfo.pNext = &timelineInfo;
-
-            VK_VERIFY(vkCreateSemaphore(m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &semaphoreInfo, VulkanAllocator::GetCallbacks(), &m_TimelineSemaphore));
-        
-            if constexpr (Information::Validation)
-            {
-                if (!m_Specification.DebugName.empty())
-                    m_Device.GetContext().SetDebugName(m_TimelineSemaphore, VK_OBJECT_TYPE_SEMAPHORE, std::format("Timeline Semaphore for: {0}", m_Specification.DebugName));
-            }
         }
     }
 
@@ -103,12 +90,7 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     void VulkanSwapchain::FreePool(CommandListPool& pool) const
     {
-        VkDevice device = m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice();
-        VkCommandPool commandPool = api_cast<VulkanCommandListPool*>(&pool)->GetVkCommandPool();
-        m_Device.GetContext().Destroy([device, commandPool]() mutable
-        {
-            vkDestroyCommandPool(device, commandPool, VulkanAllocator::GetCallbacks());
-        });
+        m_Device.FreePool(pool);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -272,16 +254,8 @@ namespace Obsidian::Internal
     {
         OB_PROFILE("VkSwapchain::AcquireImage()");
 
-        // Wait for this frame's previous last value
-        {
-            VkSemaphoreWaitInfo waitInfo = {};
-            waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
-            waitInfo.semaphoreCount = 1;
-            waitInfo.pSemaphores = &m_TimelineSemaphore;
-            waitInfo.pValues = &m_WaitTimelineValues[m_CurrentFrame];
-
-            vkWaitSemaphores(m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &waitInfo, std::numeric_limits<uint64_t>::max());
-        }
+        // Wait for this frame's previous last value // Note: Covers every queue's submissions up to this value
+        m_Device.WaitForValue(m_WaitTimelineValues[m_CurrentFrame]);
 
         // Acquire image
         VkResult result = vkAcquireNextImageKHR(m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), m_Swapchain, std::numeric_limits<uint64_t>::max(), m_ImageAvailableSemaphores[m_CurrentFrame], VK_NULL_HANDLE, &m_AcquiredImage);
@@ -311,7 +285,7 @@ namespace Obsidian::Internal
         VkResult result = VK_SUCCESS;
         {
             OB_PROFILE("VkSwapchain::Present::QueuePresent");
-            result = vkQueuePresentKHR(m_Device.GetContext().GetVulkanLogicalDevice().GetVkQueue(CommandQueue::Present), &presentInfo);
+            result = m_Device.PresentToQueue(m_Device.GetContext().GetVulkanLogicalDevice().GetVkQueue(CommandQueue::Present), presentInfo);
         }
 
         if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
@@ -323,26 +297,10 @@ namespace Obsidian::Internal
             m_Device.GetContext().Error("[VkSwapchain] Failed to present Swapchain image.");
         }
 
-        m_WaitTimelineValues[m_CurrentFrame] = m_CurrentTimelineValue;
+        m_WaitTimelineValues[m_CurrentFrame] = m_Device.GetCurrentTimelineValue();
         m_CurrentFrame = (m_CurrentFrame + 1) % Information::FramesInFlight;
     }
 
-    ////////////////////////////////////////////////////////////////////////////////////
-    // Internal methods
-    ////////////////////////////////////////////////////////////////////////////////////
-    uint64_t VulkanSwapchain::GetPreviousCommandListWaitValue(const VulkanCommandList& commandList) const
-    {
-        OB_ASSERT(m_CommandListSemaphoreValues.contains(&commandList), "[VkSwapchain] CommandList is not known in current Swapchain.");
-        return m_CommandListSemaphoreValues.at(&commandList);
-    }
-
-    uint64_t VulkanSwapchain::RetrieveCommandListWaitValue(const VulkanCommandList& commandList)
-    {
-        uint64_t value = ++m_CurrentTimelineValue;
-        m_CommandListSemaphoreValues[&commandList] = value;
-        return value;
-    }
-
     ////////////////////////////////////////////////////////////////////////////////////
     // Private methods
     ////////////////////////////////////////////////////////////////////////////////////
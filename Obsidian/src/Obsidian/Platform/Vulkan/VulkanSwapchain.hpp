@@ -53,10 +53,6 @@ namespace Obsidian::Internal
 		void AcquireNextImage();
 		void Present();
 
-		// Internal methods
-		uint64_t GetPreviousCommandListWaitValue(const VulkanCommandList& commandList) const;
-		uint64_t RetrieveCommandListWaitValue(const VulkanCommandList& commandList);
-
 		// Getters
 		inline const SwapchainSpecification& GetSpecification() const { return m_Specification; }
 
@@ -71,7 +67,6 @@ namespace Obsidian::Internal
 		// Internal getters
 		inline VkSwapchainKHR GetVkSwapchain() const { return m_Swapchain; }
 		inline VkSurfaceKHR GetVkSurface() const { return m_Surface; }
-		inline VkSemaphore GetVkTimelineSemaphore() const { return m_TimelineSemaphore; }
 
 		inline VkSemaphore GetVkImageAvailableSemaphore(uint8_t frame) const { return m_ImageAvailableSemaphores[frame]; }
 		inline VkSemaphore GetVkSwapchainPresentableSemaphore(uint8_t index) const { return m_SwapchainPresentableSemaphores[index]; }
@@ -93,11 +88,7 @@ namespace Obsidian::Internal
 		std::array<VkSemaphore, Information::FramesInFlight> m_ImageAvailableSemaphores = { };
 		Nano::Memory::StaticVector<VkSemaphore, Information::MaxImageCount> m_SwapchainPresentableSemaphores = { };
 
-		VkSemaphore m_TimelineSemaphore = VK_NULL_HANDLE;
-		uint64_t m_CurrentTimelineValue = 0;
-
-		std::array<uint64_t, Information::FramesInFlight> m_WaitTimelineValues = { };
-		std::unordered_map<const VulkanCommandList*, uint64_t> m_CommandListSemaphoreValues = { };
+		std::array<uint64_t, Information::FramesInFlight> m_WaitTimelineValues = { }; // Note: Values on the device's timeline
 
 		uint8_t m_CurrentFrame = 0;
 		uint32_t m_AcquiredImage = 0;
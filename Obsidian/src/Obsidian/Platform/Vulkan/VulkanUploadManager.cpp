@@ -0,0 +1,732 @@
+#include "obpch.h"
+#include "VulkanUploadManager.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+#include "Obsidian/Renderer/Image.hpp"
+#include "Obsidian/Renderer/Buffer.hpp"
+#include "Obsidian/Renderer/UploadManager.hpp"
+
+#include "Obsidian/Platform/Vulkan/VulkanDevice.hpp"
+#include "Obsidian/Platform/Vulkan/VulkanImage.hpp"
+#include "Obsidian/Platform/Vulkan/VulkanBuffer.hpp"
+#include "Obsidian/Platform/Vulkan/VulkanResources.hpp"
+
+#include <numeric>
+#include <algorithm>
+
+namespace Obsidian::Internal
+{
+
+    namespace
+    {
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Helper methods
+        ////////////////////////////////////////////////////////////////////////////////////
+        VkCommandPool CreateCommandPool(VkDevice device, uint32_t queueFamily)
+        {
+            VkCommandPoolCreateInfo poolInfo = {};
+            poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+            poolInfo.queueFamilyIndex = queueFamily;
+
+            VkCommandPool commandPool = VK_NULL_HANDLE;
+            VK_VERIFY(vkCreateCommandPool(device, &poolInfo, VulkanAllocator::GetCallbacks(), &commandPool));
+            return commandPool;
+        }
+
+        VkCommandBuffer AllocateCommandBuffer(VkDevice device, VkCommandPool commandPool)
+        {
+            VkCommandBufferAllocateInfo allocInfo = {};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.commandPool = commandPool;
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocInfo.commandBufferCount = 1;
+
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+            VK_VERIFY(vkAllocateCommandBuffers(device, &allocInfo, &commandBuffer));
+            return commandBuffer;
+        }
+
+        void BeginCommandBuffer(VkCommandBuffer commandBuffer)
+        {
+            VkCommandBufferBeginInfo beginInfo = {};
+            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+            VK_VERIFY(vkBeginCommandBuffer(commandBuffer, &beginInfo));
+        }
+
+        void PipelineBarrier(VkCommandBuffer commandBuffer, const std::vector<VkBufferMemoryBarrier2>& bufferBarriers, const std::vector<VkImageMemoryBarrier2>& imageBarriers)
+        {
+            if (bufferBarriers.empty() && imageBarriers.empty())
+                return;
+
+            VkDependencyInfo dependencyInfo = {};
+            dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+            dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(bufferBarriers.size());
+            dependencyInfo.pBufferMemoryBarriers = bufferBarriers.data();
+            dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(imageBarriers.size());
+            dependencyInfo.pImageMemoryBarriers = imageBarriers.data();
+
+#if defined(OB_PLATFORM_APPLE)
+            VkExtension::g_vkCmdPipelineBarrier2KHR(commandBuffer, &dependencyInfo);
+#else
+            vkCmdPipelineBarrier2(commandBuffer, &dependencyInfo);
+#endif
+        }
+
+        VkBufferMemoryBarrier2 MakeBufferBarrier(VkBuffer buffer, VkPipelineStageFlags2 srcStage, VkAccessFlags2 srcAccess, VkPipelineStageFlags2 dstStage, VkAccessFlags2 dstAccess, uint32_t srcFamily, uint32_t dstFamily)
+        {
+            VkBufferMemoryBarrier2 barrier = {};
+            barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+            barrier.srcStageMask = srcStage;
+            barrier.srcAccessMask = srcAccess;
+            barrier.dstStageMask = dstStage;
+            barrier.dstAccessMask = dstAccess;
+            barrier.srcQueueFamilyIndex = srcFamily;
+            barrier.dstQueueFamilyIndex = dstFamily;
+            barrier.buffer = buffer;
+            barrier.offset = 0;
+            barrier.size = VK_WHOLE_SIZE;
+            return barrier;
+        }
+
+        VkImageMemoryBarrier2 MakeImageBarrier(VkImage image, VkImageAspectFlags aspect, MipLevel mipLevel, ArraySlice arraySlice, VkPipelineStageFlags2 srcStage, VkAccessFlags2 srcAccess, VkImageLayout oldLayout, VkPipelineStageFlags2 dstStage, VkAccessFlags2 dstAccess, VkImageLayout newLayout, uint32_t srcFamily, uint32_t dstFamily)
+        {
+            VkImageMemoryBarrier2 barrier = {};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+            barrier.srcStageMask = srcStage;
+            barrier.srcAccessMask = srcAccess;
+            barrier.dstStageMask = dstStage;
+            barrier.dstAccessMask = dstAccess;
+            barrier.oldLayout = oldLayout;
+            barrier.newLayout = newLayout;
+            barrier.srcQueueFamilyIndex = srcFamily;
+            barrier.dstQueueFamilyIndex = dstFamily;
+            barrier.image = image;
+
+            barrier.subresourceRange.aspectMask = aspect;
+            barrier.subresourceRange.baseMipLevel = mipLevel;
+            barrier.subresourceRange.levelCount = 1;
+            barrier.subresourceRange.baseArrayLayer = arraySlice;
+            barrier.subresourceRange.layerCount = 1;
+            return barrier;
+        }
+
+        ResourceState ResolveFinalState(ResourceState permanentState, ResourceState finalState)
+        {
+            if (permanentState != ResourceState::Unknown)
+                return permanentState;
+
+            return ((finalState != ResourceState::Unknown) ? finalState : ResourceState::CopyDst);
+        }
+
+        constexpr size_t s_BufferStagingAlignment = 16ull;
+
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    VulkanUploadManager::VulkanUploadManager(const Device& device, const UploadManagerSpecification& specs)
+        : m_Device(*api_cast<const VulkanDevice*>(&device)), m_Specification(specs)
+    {
+        OB_ASSERT((m_Specification.StagingSize > 0), "[VkUploadManager] StagingSize must be more than 0.");
+
+        VkDevice vkDevice = m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice();
+        const QueueFamilyIndices& indices = m_Device.GetContext().GetVulkanPhysicalDevice().GetQueueFamilyIndices();
+
+        m_DedicatedTransfer = indices.HasDedicatedTransfer();
+        m_GraphicsFamily = indices.QueueFamily;
+        m_TransferFamily = indices.TransferFamily;
+
+        // Timeline semaphore // Note: Separate from the device's timeline, since it gets signaled from multiple queues
+        {
+            VkSemaphoreTypeCreateInfo timelineInfo = {};
+            timelineInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+            timelineInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+            timelineInfo.initialValue = 0;
+
+            VkSemaphoreCreateInfo semaphoreInfo = {};
+            semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            semaphoreInfo.pNext = &timelineInfo;
+
+            VK_VERIFY(vkCreateSemaphore(vkDevice, &semaphoreInfo, VulkanAllocator::GetCallbacks(), &m_TimelineSemaphore));
+        }
+
+        // Command pools
+        {
+            m_TransferPool = CreateCommandPool(vkDevice, m_TransferFamily);
+            if (m_DedicatedTransfer)
+                m_GraphicsPool = CreateCommandPool(vkDevice, m_GraphicsFamily);
+        }
+
+        // Staging ring // Note: Persistently mapped, so uploading is just a memcpy
+        {
+            void* memory = nullptr;
+            m_StagingAllocation = m_Device.GetAllocator().AllocateMappedBuffer(VMA_MEMORY_USAGE_CPU_ONLY, m_StagingBuffer, m_Specification.StagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, memory);
+            m_StagingMemory = static_cast<uint8_t*>(memory);
+            m_StagingCoherent = m_Device.GetAllocator().IsHostCoherent(m_StagingAllocation);
+        }
+
+        if constexpr (Information::Validation)
+        {
+            if (!m_Specification.DebugName.empty())
+            {
+                m_Device.GetContext().SetDebugName(m_TimelineSemaphore, VK_OBJECT_TYPE_SEMAPHORE, std::format("Timeline for: {0}", m_Specification.DebugName));
+                m_Device.GetContext().SetDebugName(m_TransferPool, VK_OBJECT_TYPE_COMMAND_POOL, std::format("Transfer pool for: {0}", m_Specification.DebugName));
+                if (m_GraphicsPool)
+                    m_Device.GetContext().SetDebugName(m_GraphicsPool, VK_OBJECT_TYPE_COMMAND_POOL, std::format("Graphics pool for: {0}", m_Specification.DebugName));
+                m_Device.GetContext().SetDebugName(m_StagingBuffer, VK_OBJECT_TYPE_BUFFER, std::format("Staging ring for: {0}", m_Specification.DebugName));
+            }
+        }
+    }
+
+    VulkanUploadManager::~VulkanUploadManager()
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    UploadTicket VulkanUploadManager::UploadBuffer(Buffer& dst, const void* memory, size_t size, size_t dstOffset, ResourceState finalState)
+    {
+        OB_PROFILE("VulkanUploadManager::UploadBuffer()");
+
+        const BufferSpecification& bufferSpec = dst.GetSpecification();
+        OB_ASSERT((memory != nullptr) && (size > 0), "[VkUploadManager] Invalid memory or size passed in.");
+        OB_ASSERT((size + dstOffset <= bufferSpec.Size), "[VkUploadManager] Size + offset exceeds buffer size.");
+        OB_ASSERT((bufferSpec.HasPermanentState() || m_Device.GetTracker().Contains(dst)), "[VkUploadManager] Uploading to an untracked buffer is not allowed, call StartTracking() on buffer.");
+
+        std::scoped_lock lock(m_Mutex);
+        RetireBatches(false);
+
+        const VkBuffer vkBuffer = api_cast<VulkanBuffer*>(&dst)->GetVkBuffer();
+
+        // Note: Large buffers get split up into chunks that fit inside of the staging ring
+        size_t uploaded = 0;
+        while (uploaded < size)
+        {
+            const size_t chunkSize = std::min(size - uploaded, m_Specification.StagingSize);
+            const size_t stagingOffset = AllocateStaging(chunkSize, s_BufferStagingAlignment);
+
+            std::memcpy(m_StagingMemory + stagingOffset, static_cast<const uint8_t*>(memory) + uploaded, chunkSize);
+            if (!m_StagingCoherent)
+                m_Device.GetAllocator().FlushMemory(m_StagingAllocation, stagingOffset, chunkSize);
+
+            // Note: Allocating can flush the pending batch, so the buffer gets registered after allocating
+            m_PendingBuffers[&dst].StateAfter = ResolveFinalState(bufferSpec.PermanentState, finalState);
+
+            VkBufferCopy2 region = {};
+            region.sType = VK_STRUCTURE_TYPE_BUFFER_COPY_2;
+            region.srcOffset = stagingOffset;
+            region.dstOffset = dstOffset + uploaded;
+            region.size = chunkSize;
+            m_PendingBufferCopies.emplace_back(vkBuffer, region);
+
+            uploaded += chunkSize;
+        }
+
+        return PendingTicket();
+    }
+
+    UploadTicket VulkanUploadManager::UploadImage(Image& dst, const ImageSliceSpecification& slice, const void* memory, size_t size, ResourceState finalState)
+    {
+        OB_PROFILE("VulkanUploadManager::UploadImage()");
+
+        const ImageSpecification& imageSpec = dst.GetSpecification();
+        OB_ASSERT((memory != nullptr) && (size > 0), "[VkUploadManager] Invalid memory or size passed in.");
+        OB_ASSERT((imageSpec.HasPermanentState() || m_Device.GetTracker().Contains(dst)), "[VkUploadManager] Uploading to an untracked image is not allowed, call StartTracking() on image.");
+
+        const ImageSliceSpecification resSlice = ResolveImageSlice(slice, imageSpec);
+        const VkFormat format = FormatToVkFormat(imageSpec.ImageFormat);
+        const FormatInfo& formatInfo = FormatToFormatInfo(imageSpec.ImageFormat);
+
+        // Note: The copy reads the tightly packed size of the slice from the staging ring, so that is all we copy over
+        const size_t blocksWide = (resSlice.Width + formatInfo.BlockSize - 1) / formatInfo.BlockSize;
+        const size_t blocksHigh = (resSlice.Height + formatInfo.BlockSize - 1) / formatInfo.BlockSize;
+        const size_t sliceSize = blocksWide * blocksHigh * resSlice.Depth * formatInfo.BytesPerBlock;
+
+        OB_ASSERT((size >= sliceSize), "[VkUploadManager] Source memory too small, the slice requires {0} bytes.", sliceSize);
+        OB_ASSERT((sliceSize <= m_Specification.StagingSize), "[VkUploadManager] Image upload doesn't fit inside of the staging ring, increase StagingSize.");
+
+        std::scoped_lock lock(m_Mutex);
+        RetireBatches(false);
+
+        // Note: The buffer offset of a copy must be a multiple of the texel block size
+        const size_t alignment = std::lcm(s_BufferStagingAlignment, static_cast<size_t>(formatInfo.BytesPerBlock));
+        const size_t stagingOffset = AllocateStaging(sliceSize, alignment);
+
+        std::memcpy(m_StagingMemory + stagingOffset, memory, sliceSize);
+        if (!m_StagingCoherent)
+            m_Device.GetAllocator().FlushMemory(m_StagingAllocation, stagingOffset, sliceSize);
+
+        std::vector<ImageUpload>& uploads = m_PendingImages[&dst];
+        auto it = std::find_if(uploads.begin(), uploads.end(), [&](const ImageUpload& upload) { return ((upload.ImageMipLevel == resSlice.ImageMipLevel) && (upload.ImageArraySlice == resSlice.ImageArraySlice)); });
+        if (it == uploads.end())
+        {
+            ImageUpload& upload = uploads.emplace_back();
+            upload.ImageMipLevel = resSlice.ImageMipLevel;
+            upload.ImageArraySlice = resSlice.ImageArraySlice;
+
+            it = std::prev(uploads.end());
+        }
+        it->StateAfter = ResolveFinalState(imageSpec.PermanentState, finalState);
+
+        VkBufferImageCopy2 region = {};
+        region.sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2;
+        region.bufferOffset = stagingOffset;
+        region.bufferRowLength = 0; // Note: Tightly packed
+        region.bufferImageHeight = 0;
+
+        region.imageSubresource.aspectMask = VkFormatToImageAspect(format);
+        region.imageSubresource.mipLevel = resSlice.ImageMipLevel;
+        region.imageSubresource.baseArrayLayer = resSlice.ImageArraySlice;
+        region.imageSubresource.layerCount = 1;
+
+        region.imageOffset = { resSlice.X, resSlice.Y, resSlice.Z };
+        region.imageExtent = { resSlice.Width, resSlice.Height, resSlice.Depth };
+
+        m_PendingImageCopies.emplace_back(api_cast<VulkanImage*>(&dst)->GetVkImage(), region);
+
+        return PendingTicket();
+    }
+
+    UploadTicket VulkanUploadManager::Flush()
+    {
+        OB_PROFILE("VulkanUploadManager::Flush()");
+
+        std::scoped_lock lock(m_Mutex);
+        RetireBatches(false);
+
+        return FlushPending();
+    }
+
+    bool VulkanUploadManager::IsComplete(const UploadTicket& ticket) const
+    {
+        uint64_t value = 0;
+        VK_VERIFY(vkGetSemaphoreCounterValue(m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), m_TimelineSemaphore, &value));
+        return (value >= ticket.Value);
+    }
+
+    void VulkanUploadManager::Wait(const UploadTicket& ticket) const
+    {
+        OB_PROFILE("VulkanUploadManager::Wait()");
+        OB_ASSERT((ticket.Value <= GetSubmittedValue()), "[VkUploadManager] Waiting on a ticket that hasn't been flushed, call Flush() first.");
+
+        VkSemaphoreWaitInfo waitInfo = {};
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &m_TimelineSemaphore;
+        waitInfo.pValues = &ticket.Value;
+
+        VK_VERIFY(vkWaitSemaphores(m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice(), &waitInfo, std::numeric_limits<uint64_t>::max()));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Internal methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    bool VulkanUploadManager::TakeAcquireBarriers(uint64_t value, std::vector<VkBufferMemoryBarrier2>& bufferBarriers, std::vector<VkImageMemoryBarrier2>& imageBarriers) const
+    {
+        std::scoped_lock lock(m_AcquireMutex);
+
+        const size_t previousCount = bufferBarriers.size() + imageBarriers.size();
+        std::erase_if(m_PendingAcquireBuffers, [&](const std::pair<uint64_t, VkBufferMemoryBarrier2>& acquire)
+        {
+            if (acquire.first > value)
+                return false;
+
+            bufferBarriers.push_back(acquire.second);
+            return true;
+        });
+        std::erase_if(m_PendingAcquireImages, [&](const std::pair<uint64_t, VkImageMemoryBarrier2>& acquire)
+        {
+            if (acquire.first > value)
+                return false;
+
+            imageBarriers.push_back(acquire.second);
+            return true;
+        });
+
+        return ((bufferBarriers.size() + imageBarriers.size()) != previousCount);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    size_t VulkanUploadManager::AllocateStaging(size_t size, size_t alignment)
+    {
+        const size_t capacity = m_Specification.StagingSize;
+        OB_ASSERT((size <= capacity), "[VkUploadManager] Internal error: Staging allocation is bigger than the staging ring.");
+
+        while (true)
+        {
+            size_t position = m_StagingHead;
+            size_t offset = Nano::Memory::AlignOffset(position % capacity, alignment);
+
+            if (offset + size > capacity) // Note: Doesn't fit at the end, so we wrap around
+            {
+                position += capacity - (position % capacity);
+                offset = 0;
+            }
+            else
+            {
+                position += offset - (position % capacity);
+            }
+
+            if (position + size - m_StagingTail <= capacity)
+            {
+                m_StagingHead = position + size;
+                return offset;
+            }
+
+            // Note: The ring is full, we make room by waiting on the oldest batch (and submitting our own if nothing else is in flight)
+            if (m_InFlightBatches.empty())
+            {
+                if (!HasPendingUploads())
+                {
+                    m_StagingHead = 0;
+                    m_StagingTail = 0;
+                    continue;
+                }
+
+                FlushPending();
+            }
+
+            RetireBatches(true);
+        }
+    }
+
+    void VulkanUploadManager::RetireBatches(bool waitForOldest)
+    {
+        if (m_InFlightBatches.empty())
+            return;
+
+        VkDevice device = m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice();
+
+        if (waitForOldest)
+        {
+            OB_PROFILE("VulkanUploadManager::RetireBatches::Wait()");
+
+            VkSemaphoreWaitInfo waitInfo = {};
+            waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+            waitInfo.semaphoreCount = 1;
+            waitInfo.pSemaphores = &m_TimelineSemaphore;
+            waitInfo.pValues = &m_InFlightBatches.front().Value;
+
+            VK_VERIFY(vkWaitSemaphores(device, &waitInfo, std::numeric_limits<uint64_t>::max()));
+        }
+
+        uint64_t completedValue = 0;
+        VK_VERIFY(vkGetSemaphoreCounterValue(device, m_TimelineSemaphore, &completedValue));
+
+        while (!m_InFlightBatches.empty() && (m_InFlightBatches.front().Value <= completedValue))
+        {
+            m_StagingTail = m_InFlightBatches.front().StagingEnd;
+            m_FreeBatches.push_back(m_InFlightBatches.front());
+            m_InFlightBatches.pop_front();
+        }
+    }
+
+    bool VulkanUploadManager::HasPendingUploads() const
+    {
+        return (!m_PendingBufferCopies.empty() || !m_PendingImageCopies.empty());
+    }
+
+    UploadTicket VulkanUploadManager::PendingTicket() const
+    {
+        return UploadTicket{ api_cast<const UploadManager*>(this), m_SubmittedValue + s_ValuesPerBatch };
+    }
+
+    UploadTicket VulkanUploadManager::FlushPending()
+    {
+        if (!HasPendingUploads()) // Note: Everything has been submitted already, the last ticket covers it all
+            return UploadTicket{ api_cast<const UploadManager*>(this), m_SubmittedValue };
+
+        VkDevice device = m_Device.GetContext().GetVulkanLogicalDevice().GetVkDevice();
+
+        Batch batch = {};
+        if (!m_FreeBatches.empty())
+        {
+            batch = m_FreeBatches.back();
+            m_FreeBatches.pop_back();
+        }
+        else
+        {
+            batch.TransferCommandBuffer = AllocateCommandBuffer(device, m_TransferPool);
+            if (m_DedicatedTransfer)
+                batch.ReleaseCommandBuffer = AllocateCommandBuffer(device, m_GraphicsPool);
+        }
+
+        batch.Value = m_SubmittedValue + s_ValuesPerBatch;
+        batch.StagingEnd = m_StagingHead;
+
+        bool hasRelease = false;
+        std::array<uint64_t, static_cast<size_t>(CommandQueue::Count)> ownerWaitValues = { };
+        RecordBatch(batch, hasRelease, ownerWaitValues);
+
+        // Submissions // Note: Every submission waits on the previous one (or the previous batch), this keeps the timeline increasing in order
+        uint64_t waitValue = m_SubmittedValue;
+        auto submit = [&](VkQueue queue, VkCommandBuffer commandBuffer, uint64_t signalValue, bool waitOnOwners)
+        {
+            std::array<VkSemaphoreSubmitInfo, static_cast<size_t>(CommandQueue::Count) + 1> waitInfos = { };
+            uint32_t waitInfoCount = 0;
+
+            if (waitValue != 0)
+            {
+                VkSemaphoreSubmitInfo& waitInfo = waitInfos[waitInfoCount++];
+                waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+                waitInfo.semaphore = m_TimelineSemaphore;
+                waitInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+                waitInfo.value = waitValue;
+            }
+            for (size_t i = 0; (i < ownerWaitValues.size()) && waitOnOwners; i++) // Note: Work of other queues that still uses the resources
+            {
+                if (ownerWaitValues[i] == 0)
+                    continue;
+
+                VkSemaphoreSubmitInfo& waitInfo = waitInfos[waitInfoCount++];
+                waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+                waitInfo.semaphore = m_Device.GetVkTimelineSemaphore(static_cast<CommandQueue>(i));
+                waitInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+                waitInfo.value = ownerWaitValues[i];
+            }
+
+            VkCommandBufferSubmitInfo commandInfo = {};
+            commandInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+            commandInfo.commandBuffer = commandBuffer;
+
+            VkSemaphoreSubmitInfo signalInfo = {};
+            signalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            signalInfo.semaphore = m_TimelineSemaphore;
+            signalInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            signalInfo.value = signalValue;
+
+            VkSubmitInfo2 submitInfo = {};
+            submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+            submitInfo.waitSemaphoreInfoCount = waitInfoCount;
+            submitInfo.pWaitSemaphoreInfos = waitInfos.data();
+            submitInfo.commandBufferInfoCount = 1;
+            submitInfo.pCommandBufferInfos = &commandInfo;
+            submitInfo.signalSemaphoreInfoCount = 1;
+            submitInfo.pSignalSemaphoreInfos = &signalInfo;
+
+            m_Device.SubmitToQueue(queue, submitInfo);
+            waitValue = signalValue;
+        };
+
+        const VulkanLogicalDevice& logicalDevice = m_Device.GetContext().GetVulkanLogicalDevice();
+        if (hasRelease)
+            submit(logicalDevice.GetVkQueue(CommandQueue::Graphics), batch.ReleaseCommandBuffer, batch.Value - 1, true);
+
+        submit(logicalDevice.GetVkTransferQueue(), batch.TransferCommandBuffer, batch.Value, !hasRelease);
+
+        m_SubmittedValue.store(batch.Value, std::memory_order_release);
+
+        // Note: From the graphics queue's point of view the resources are now in their final state,
+        // the acquire barriers get recorded by the first submission that waits on this batch.
+        for (const auto& [buffer, upload] : m_PendingBuffers)
+        {
+            if (buffer->GetSpecification().HasPermanentState())
+                continue;
+
+            m_Device.GetTracker().SetBufferState(*buffer, upload.StateAfter);
+            m_Device.GetTracker().SetOwningQueue(*buffer, CommandQueue::Graphics);
+        }
+        for (const auto& [image, uploads] : m_PendingImages)
+        {
+            if (image->GetSpecification().HasPermanentState())
+                continue;
+
+            for (const ImageUpload& upload : uploads)
+                m_Device.GetTracker().SetImageState(*image, ImageSubresourceSpecification(upload.ImageMipLevel, 1, upload.ImageArraySlice, 1), upload.StateAfter);
+
+            m_Device.GetTracker().SetOwningQueue(*image, CommandQueue::Graphics);
+        }
+
+        m_PendingBuffers.clear();
+        m_PendingImages.clear();
+        m_PendingBufferCopies.clear();
+        m_PendingImageCopies.clear();
+
+        m_InFlightBatches.push_back(batch);
+        return UploadTicket{ api_cast<const UploadManager*>(this), batch.Value };
+    }
+
+    void VulkanUploadManager::RecordBatch(Batch& batch, bool& hasRelease, std::array<uint64_t, static_cast<size_t>(CommandQueue::Count)>& ownerWaitValues)
+    {
+        OB_PROFILE("VulkanUploadManager::RecordBatch()");
+
+        constexpr uint32_t ignored = VK_QUEUE_FAMILY_IGNORED;
+        const ResourceStateMapping& copy = ResourceStateToMapping(ResourceState::CopyDst);
+
+        const QueueFamilyIndices& indices = m_Device.GetContext().GetVulkanPhysicalDevice().GetQueueFamilyIndices();
+        const VulkanLogicalDevice& logicalDevice = m_Device.GetContext().GetVulkanLogicalDevice();
+
+        // Note: The first submission of the batch runs on the graphics queue (the release, or the transfer without a dedicated family).
+        // Resources last used on a different queue need that queue's work to be done first, even if it's the same family.
+        auto waitOnOwner = [&](CommandQueue owner)
+        {
+            if (owner == CommandQueue::Count)
+                return;
+
+            OB_ASSERT((indices.GetQueueFamily(owner) == m_GraphicsFamily), "[VkUploadManager] Uploading to a resource owned by another queue family is not supported, submit it on the graphics queue first.");
+            if (logicalDevice.GetVkQueue(owner) != logicalDevice.GetVkQueue(CommandQueue::Graphics))
+                ownerWaitValues[static_cast<size_t>(owner)] = m_Device.GetLastSubmittedValue(owner);
+        };
+
+        // Note: With a dedicated transfer family every resource goes through an ownership transfer:
+        // [graphics release -> transfer acquire] -> copy -> transfer release -> graphics acquire.
+        // Without one, everything is recorded as regular barriers on the transfer commandbuffer.
+        std::vector<VkBufferMemoryBarrier2> releaseBuffers, preBuffers, postBuffers, acquireBuffers;
+        std::vector<VkImageMemoryBarrier2> releaseImages, preImages, postImages, acquireImages;
+
+        // Note: Earlier batches that nobody has acquired yet still belong to the transfer family, 
+        // so they get acquired by our release submission (which runs after those batches) before anything is released again.
+        std::vector<VkBufferMemoryBarrier2> previousAcquireBuffers;
+        std::vector<VkImageMemoryBarrier2> previousAcquireImages;
+        if (m_DedicatedTransfer)
+            TakeAcquireBarriers(m_SubmittedValue, previousAcquireBuffers, previousAcquireImages);
+
+        for (const auto& [buffer, upload] : m_PendingBuffers)
+        {
+            const BufferSpecification& bufferSpec = buffer->GetSpecification();
+            const VkBuffer vkBuffer = api_cast<VulkanBuffer*>(buffer)->GetVkBuffer();
+
+            // Note: Read when flushing, so submissions between the upload and the flush are taken into account
+            const ResourceState stateBefore = (bufferSpec.HasPermanentState() ? bufferSpec.PermanentState : m_Device.GetTracker().GetResourceState(*buffer));
+            if (!bufferSpec.HasPermanentState())
+                waitOnOwner(m_Device.GetTracker().GetOwningQueue(*buffer));
+
+            const ResourceStateMapping& before = ResourceStateToMapping(stateBefore);
+            const ResourceStateMapping& after = ResourceStateToMapping(upload.StateAfter);
+
+            if (!m_DedicatedTransfer)
+            {
+                preBuffers.push_back(MakeBufferBarrier(vkBuffer, before.StageFlags, before.AccessMask, copy.StageFlags, copy.AccessMask, ignored, ignored));
+                postBuffers.push_back(MakeBufferBarrier(vkBuffer, copy.StageFlags, copy.AccessMask, after.StageFlags, after.AccessMask, ignored, ignored));
+                continue;
+            }
+
+            if (stateBefore != ResourceState::Unknown) // Note: A resource that has been used is owned by the graphics family
+            {
+                releaseBuffers.push_back(MakeBufferBarrier(vkBuffer, before.StageFlags, before.AccessMask, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, m_GraphicsFamily, m_TransferFamily));
+                preBuffers.push_back(MakeBufferBarrier(vkBuffer, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, copy.StageFlags, copy.AccessMask, m_GraphicsFamily, m_TransferFamily));
+            }
+            else
+            {
+                preBuffers.push_back(MakeBufferBarrier(vkBuffer, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, copy.StageFlags, copy.AccessMask, ignored, ignored));
+            }
+
+            postBuffers.push_back(MakeBufferBarrier(vkBuffer, copy.StageFlags, copy.AccessMask, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, m_TransferFamily, m_GraphicsFamily));
+            acquireBuffers.push_back(MakeBufferBarrier(vkBuffer, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, after.StageFlags, after.AccessMask, m_TransferFamily, m_GraphicsFamily));
+        }
+
+        for (const auto& [image, uploads] : m_PendingImages)
+        {
+            const ImageSpecification& imageSpec = image->GetSpecification();
+            const VkImage vkImage = api_cast<VulkanImage*>(image)->GetVkImage();
+            const VkImageAspectFlags aspect = VkFormatToImageAspect(FormatToVkFormat(imageSpec.ImageFormat));
+
+            if (!imageSpec.HasPermanentState())
+                waitOnOwner(m_Device.GetTracker().GetOwningQueue(*image));
+
+            for (const ImageUpload& upload : uploads)
+            {
+                const MipLevel mip = upload.ImageMipLevel;
+                const ArraySlice slice = upload.ImageArraySlice;
+
+                const ResourceState stateBefore = (imageSpec.HasPermanentState() ? imageSpec.PermanentState : m_Device.GetTracker().GetResourceState(*image, ImageSubresourceSpecification(mip, 1, slice, 1)));
+                const ResourceStateMapping& before = ResourceStateToMapping(stateBefore);
+                const ResourceStateMapping& after = ResourceStateToMapping(upload.StateAfter);
+                OB_ASSERT((after.ImageLayout != VK_IMAGE_LAYOUT_UNDEFINED), "[VkUploadManager] Can't transition to undefined layout.");
+
+                if (!m_DedicatedTransfer)
+                {
+                    preImages.push_back(MakeImageBarrier(vkImage, aspect, mip, slice, before.StageFlags, before.AccessMask, before.ImageLayout, copy.StageFlags, copy.AccessMask, copy.ImageLayout, ignored, ignored));
+                    postImages.push_back(MakeImageBarrier(vkImage, aspect, mip, slice, copy.StageFlags, copy.AccessMask, copy.ImageLayout, after.StageFlags, after.AccessMask, after.ImageLayout, ignored, ignored));
+                    continue;
+                }
+
+                if (stateBefore != ResourceState::Unknown)
+                {
+                    releaseImages.push_back(MakeImageBarrier(vkImage, aspect, mip, slice, before.StageFlags, before.AccessMask, before.ImageLayout, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, copy.ImageLayout, m_GraphicsFamily, m_TransferFamily));
+                    preImages.push_back(MakeImageBarrier(vkImage, aspect, mip, slice, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, before.ImageLayout, copy.StageFlags, copy.AccessMask, copy.ImageLayout, m_GraphicsFamily, m_TransferFamily));
+                }
+                else
+                {
+                    preImages.push_back(MakeImageBarrier(vkImage, aspect, mip, slice, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, VK_IMAGE_LAYOUT_UNDEFINED, copy.StageFlags, copy.AccessMask, copy.ImageLayout, ignored, ignored));
+                }
+
+                postImages.push_back(MakeImageBarrier(vkImage, aspect, mip, slice, copy.StageFlags, copy.AccessMask, copy.ImageLayout, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, after.ImageLayout, m_TransferFamily, m_GraphicsFamily));
+                acquireImages.push_back(MakeImageBarrier(vkImage, aspect, mip, slice, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, copy.ImageLayout, after.StageFlags, after.AccessMask, after.ImageLayout, m_TransferFamily, m_GraphicsFamily));
+            }
+        }
+
+        // Release // Note: Acquiring and releasing are separate barriers, since a resource can be in both
+        hasRelease = (!previousAcquireBuffers.empty() || !previousAcquireImages.empty() || !releaseBuffers.empty() || !releaseImages.empty());
+        if (hasRelease)
+        {
+            BeginCommandBuffer(batch.ReleaseCommandBuffer);
+            PipelineBarrier(batch.ReleaseCommandBuffer, previousAcquireBuffers, previousAcquireImages);
+            PipelineBarrier(batch.ReleaseCommandBuffer, releaseBuffers, releaseImages);
+            VK_VERIFY(vkEndCommandBuffer(batch.ReleaseCommandBuffer));
+        }
+
+        // Transfer
+        {
+            BeginCommandBuffer(batch.TransferCommandBuffer);
+            PipelineBarrier(batch.TransferCommandBuffer, preBuffers, preImages);
+
+            for (const auto& [dstBuffer, region] : m_PendingBufferCopies)
+            {
+                VkCopyBufferInfo2 copyInfo = {};
+                copyInfo.sType = VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2;
+                copyInfo.srcBuffer = m_StagingBuffer;
+                copyInfo.dstBuffer = dstBuffer;
+                copyInfo.regionCount = 1;
+                copyInfo.pRegions = &region;
+
+#if defined(OB_PLATFORM_APPLE)
+                VkExtension::g_vkCmdCopyBuffer2KHR(batch.TransferCommandBuffer, &copyInfo);
+#else
+                vkCmdCopyBuffer2(batch.TransferCommandBuffer, &copyInfo);
+#endif
+            }
+
+            for (const auto& [dstImage, region] : m_PendingImageCopies)
+            {
+                VkCopyBufferToImageInfo2 copyInfo = {};
+                copyInfo.sType = VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2;
+                copyInfo.srcBuffer = m_StagingBuffer;
+                copyInfo.dstImage = dstImage;
+                copyInfo.dstImageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                copyInfo.regionCount = 1;
+                copyInfo.pRegions = &region;
+
+#if defined(OB_PLATFORM_APPLE)
+                VkExtension::g_vkCmdCopyBufferToImage2KHR(batch.TransferCommandBuffer, &copyInfo);
+#else
+                vkCmdCopyBufferToImage2(batch.TransferCommandBuffer, &copyInfo);
+#endif
+            }
+
+            PipelineBarrier(batch.TransferCommandBuffer, postBuffers, postImages);
+            VK_VERIFY(vkEndCommandBuffer(batch.TransferCommandBuffer));
+        }
+
+        // Acquire // Note: Taken by the device when a submission waits on this batch
+        {
+            std::scoped_lock lock(m_AcquireMutex);
+            for (const VkBufferMemoryBarrier2& barrier : acquireBuffers)
+                m_PendingAcquireBuffers.emplace_back(batch.Value, barrier);
+            for (const VkImageMemoryBarrier2& barrier : acquireImages)
+                m_PendingAcquireImages.emplace_back(batch.Value, barrier);
+        }
+    }
+
+}
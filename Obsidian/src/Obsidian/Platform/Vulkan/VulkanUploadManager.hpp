@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/API.hpp"
+#include "Obsidian/Renderer/ImageSpec.hpp"
+#include "Obsidian/Renderer/ResourceSpec.hpp"
+#include "Obsidian/Renderer/CommandListSpec.hpp"
+#include "Obsidian/Renderer/UploadManagerSpec.hpp"
+
+#include "Obsidian/Platform/Vulkan/Vulkan.hpp"
+
+#include <Nano/Nano.hpp>
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <unordered_map>
+
+namespace Obsidian
+{
+    class Device;
+    class Image;
+    class Buffer;
+}
+
+namespace Obsidian::Internal
+{
+
+    class VulkanDevice;
+    class VulkanUploadManager;
+
+#if defined(OB_API_VULKAN)
+    ////////////////////////////////////////////////////////////////////////////////////
+    // VulkanUploadManager
+    ////////////////////////////////////////////////////////////////////////////////////
+    class VulkanUploadManager
+    {
+    public:
+        // Constructor & Destructor
+        VulkanUploadManager(const Device& device, const UploadManagerSpecification& specs);
+        ~VulkanUploadManager();
+
+        // Methods
+        UploadTicket UploadBuffer(Buffer& dst, const void* memory, size_t size, size_t dstOffset, ResourceState finalState);
+        UploadTicket UploadImage(Image& dst, const ImageSliceSpecification& slice, const void* memory, size_t size, ResourceState finalState);
+
+        UploadTicket Flush();
+
+        bool IsComplete(const UploadTicket& ticket) const;
+        void Wait(const UploadTicket& ticket) const;
+
+        // Getters
+        inline const UploadManagerSpecification& GetSpecification() const { return m_Specification; }
+
+        // Internal getters
+        inline VkSemaphore GetVkTimelineSemaphore() const { return m_TimelineSemaphore; }
+        inline uint64_t GetSubmittedValue() const { return m_SubmittedValue.load(std::memory_order_acquire); }
+        inline uint32_t GetGraphicsFamily() const { return m_GraphicsFamily; }
+
+        // Internal methods
+        bool TakeAcquireBarriers(uint64_t value, std::vector<VkBufferMemoryBarrier2>& bufferBarriers, std::vector<VkImageMemoryBarrier2>& imageBarriers) const; // Note: Appends the acquire barriers of all batches up to value, returns whether there were any
+
+    private:
+        // Note: Every batch reserves 2 timeline values, one per submission: [graphics release] -> transfer.
+        // The release is skipped when it isn't needed, but the transfer always signals the batch's value.
+        // The graphics acquire isn't submitted by us, it's recorded at the start of the first submission that waits on the batch's ticket.
+        inline constexpr static uint64_t s_ValuesPerBatch = 2;
+
+        struct BufferUpload
+        {
+        public:
+            ResourceState StateAfter = ResourceState::Unknown; // Note: The state before is read from the tracker when the batch gets flushed
+        };
+
+        struct ImageUpload
+        {
+        public:
+            MipLevel ImageMipLevel = 0;
+            ArraySlice ImageArraySlice = 0;
+
+            ResourceState StateAfter = ResourceState::Unknown;
+        };
+
+        struct Batch
+        {
+        public:
+            VkCommandBuffer ReleaseCommandBuffer = VK_NULL_HANDLE; // Note: Graphics family, hands resources that were in use over to the transfer family
+            VkCommandBuffer TransferCommandBuffer = VK_NULL_HANDLE;
+
+            uint64_t Value = 0;
+            size_t StagingEnd = 0; // Note: Ring position after the last staging allocation of this batch
+        };
+
+    private:
+        // Private methods
+        size_t AllocateStaging(size_t size, size_t alignment); // Note: Returns the offset into the staging buffer
+        void RetireBatches(bool waitForOldest);
+
+        bool HasPendingUploads() const;
+        UploadTicket PendingTicket() const;
+        UploadTicket FlushPending();
+
+        void RecordBatch(Batch& batch, bool& hasRelease, std::array<uint64_t, static_cast<size_t>(CommandQueue::Count)>& ownerWaitValues);
+
+    private:
+        const VulkanDevice& m_Device;
+        UploadManagerSpecification m_Specification;
+
+        mutable std::mutex m_Mutex = {};
+
+        bool m_DedicatedTransfer = false;
+        uint32_t m_GraphicsFamily = 0;
+        uint32_t m_TransferFamily = 0;
+
+        VkSemaphore m_TimelineSemaphore = VK_NULL_HANDLE;
+        std::atomic<uint64_t> m_SubmittedValue = 0; // Note: Atomic, since the device reads it under its submit lock, which we take while holding ours
+
+        VkCommandPool m_TransferPool = VK_NULL_HANDLE;
+        VkCommandPool m_GraphicsPool = VK_NULL_HANDLE; // Note: Only created with a dedicated transfer family
+
+        // Staging ring // Note: Head & Tail are ever increasing, the offset into the buffer is position % size
+        VkBuffer m_StagingBuffer = VK_NULL_HANDLE;
+        VmaAllocation m_StagingAllocation = VK_NULL_HANDLE;
+        uint8_t* m_StagingMemory = nullptr;
+        bool m_StagingCoherent = true;
+
+        size_t m_StagingHead = 0;
+        size_t m_StagingTail = 0;
+
+        std::deque<Batch> m_InFlightBatches = { };
+        std::vector<Batch> m_FreeBatches = { };
+
+        // Pending (recorded, not yet flushed) uploads
+        std::unordered_map<Buffer*, BufferUpload> m_PendingBuffers = { };
+        std::unordered_map<Image*, std::vector<ImageUpload>> m_PendingImages = { };
+
+        std::vector<std::pair<VkBuffer, VkBufferCopy2>> m_PendingBufferCopies = { };
+        std::vector<std::pair<VkImage, VkBufferImageCopy2>> m_PendingImageCopies = { };
+
+        // Flushed batches that haven't been acquired by the graphics family yet // Note: Has its own lock, since the device takes them while holding its submit lock
+        mutable std::mutex m_AcquireMutex = {};
+        mutable std::vector<std::pair<uint64_t, VkBufferMemoryBarrier2>> m_PendingAcquireBuffers = { };
+        mutable std::vector<std::pair<uint64_t, VkImageMemoryBarrier2>> m_PendingAcquireImages = { };
+
+        friend class VulkanDevice;
+    };
+#endif
+
+}
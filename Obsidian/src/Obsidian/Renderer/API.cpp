@@ -73,6 +73,24 @@ namespace Obsidian::Internal
         return ret;
     }
 
+    ImageBufferLayout ResolveImageBufferLayout(const ImageSliceSpecification& sliceSpec, const ImageSpecification& imageSpec)
+    {
+        ImageSliceSpecification slice = ResolveImageSlice(sliceSpec, imageSpec);
+        const FormatInfo& formatInfo = FormatToFormatInfo(imageSpec.ImageFormat);
+
+        const uint32_t blocksWide = (slice.Width + formatInfo.BlockSize - 1) / formatInfo.BlockSize;
+        const uint32_t blocksHigh = (slice.Height + formatInfo.BlockSize - 1) / formatInfo.BlockSize;
+
+        ImageBufferLayout ret;
+        ret.RowPitch = Nano::Memory::AlignOffset(static_cast<size_t>(blocksWide) * formatInfo.BytesPerBlock, ImageBufferLayout::RowPitchAlignment);
+        ret.RowCount = blocksHigh;
+        ret.DepthPitch = ret.RowPitch * blocksHigh;
+        ret.Depth = slice.Depth;
+        ret.Size = ret.DepthPitch * slice.Depth;
+
+        return ret;
+    }
+
     BufferRange ResolveBufferRange(const BufferRange& range, const BufferSpecification& specs)
     {
         BufferRange ret(range);
@@ -100,6 +100,7 @@ namespace Obsidian::Internal
     ////////////////////////////////////////////////////////////////////////////////////
     ImageSliceSpecification ResolveImageSlice(const ImageSliceSpecification& sliceSpec, const ImageSpecification& imageSpec);
     ImageSubresourceSpecification ResolveImageSubresource(const ImageSubresourceSpecification& subresourceSpec, const ImageSpecification& imageSpec, bool singleMip);
+    ImageBufferLayout ResolveImageBufferLayout(const ImageSliceSpecification& sliceSpec, const ImageSpecification& imageSpec);
 
     BufferRange ResolveBufferRange(const BufferRange& range, const BufferSpecification& specs);
 
@@ -76,6 +76,7 @@ namespace Obsidian
         inline void SetItem(uint32_t slot, Image& image, const ImageSubresourceSpecification& subresources = ImageSubresourceSpecification(), uint32_t arrayIndex = 0) { m_Impl->SetItem(slot, image, subresources, arrayIndex); }
         inline void SetItem(uint32_t slot, Sampler& sampler, uint32_t arrayIndex = 0) { m_Impl->SetItem(slot, sampler, arrayIndex); }
         inline void SetItem(uint32_t slot, Buffer& buffer, const BufferRange& range = BufferRange(), uint32_t arrayIndex = 0) { m_Impl->SetItem(slot, buffer, range, arrayIndex); }
+        inline void SetItems(std::span<const BindingSetItem> items) { m_Impl->SetItems(items); } // Note: Writes all items with a single update, prefer this over many SetItem calls
 
         // Getters
         inline const BindingSetSpecification& GetSpecification() const { return m_Impl->GetSpecification(); }
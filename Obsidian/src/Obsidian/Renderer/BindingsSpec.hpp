@@ -12,6 +12,7 @@
 
 #include <cstdint>
 #include <variant>
+#include <optional>
 #include <string>
 
 namespace Obsidian
@@ -73,6 +74,10 @@ namespace Obsidian
         
         uint16_t Size = 1; // Note: Either push constant size, descriptor array size/count or max amount of dynamic buffer elements
 
+        // Note: Only for ResourceType::Sampler, bakes the sampler into the layout (static sampler on dx12)
+        // so the slot never needs a descriptor write. Every array element gets the same sampler.
+        std::optional<SamplerSpecification> ImmutableSampler = std::nullopt;
+
         std::string DebugName = {};
 
     public:
@@ -81,19 +86,23 @@ namespace Obsidian
         inline constexpr BindingLayoutItem& SetSlot(uint32_t slot) { Slot = slot; return *this; }
         inline constexpr BindingLayoutItem& SetType(ResourceType type) { Type = type; return *this; }
         inline constexpr BindingLayoutItem& SetSize(uint16_t size) { Size = size; return *this; }
+        inline BindingLayoutItem& SetImmutableSampler(const SamplerSpecification& sampler) { Type = ResourceType::Sampler; ImmutableSampler = sampler; return *this; }
 
         inline BindingLayoutItem& SetDebugName(const std::string& name) { DebugName = name; return *this; }
 
         // Operators
-        inline constexpr bool operator == (const BindingLayoutItem& other) const { return ((Slot == other.Slot) && (Type == other.Type) && (Size == other.Size)); }
+        inline constexpr bool operator == (const BindingLayoutItem& other) const { return ((Slot == other.Slot) && (Type == other.Type) && (Size == other.Size) && (ImmutableSampler == other.ImmutableSampler)); }
         inline constexpr bool operator != (const BindingLayoutItem& other) const { return !(*this == other); }
 
         // Getters
         inline constexpr uint32_t GetArraySize() const { return (Type == ResourceType::PushConstants) ? 1 : Size; }
+        inline constexpr bool IsImmutableSampler() const { return ImmutableSampler.has_value(); }
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
-    // BindingLayoutSpecification
+    // BindingLayoutSpecification // Note: Dynamic buffer types (and with that dynamic offsets) can't be used
+    // when the device uses descriptor buffers (DeviceSpecification::DescriptorBuffers), descriptor buffers have
+    // no equivalent for offsets applied at bind time. Creating a layout with them on such a device asserts.
     ////////////////////////////////////////////////////////////////////////////////////
     struct BindingLayoutSpecification
     {
@@ -151,6 +160,30 @@ namespace Obsidian
         inline BindingSetSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // BindingSetItem
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct BindingSetItem // Note: A single descriptor write, used to update many items at once through BindingSet::SetItems
+    {
+    public:
+        uint32_t Slot = 0;
+        uint32_t ArrayIndex = 0;
+
+        std::variant<Image*, Sampler*, Buffer*> Resource = {};
+
+        ImageSubresourceSpecification Subresources = ImageSubresourceSpecification(); // Note: Only used for images
+        BufferRange Range = BufferRange(); // Note: Only used for buffers
+
+    public:
+        // Setters
+        inline constexpr BindingSetItem& SetSlot(uint32_t slot) { Slot = slot; return *this; }
+        inline constexpr BindingSetItem& SetArrayIndex(uint32_t index) { ArrayIndex = index; return *this; }
+
+        inline BindingSetItem& SetImage(Image& image, const ImageSubresourceSpecification& subresources = ImageSubresourceSpecification()) { Resource = &image; Subresources = subresources; return *this; }
+        inline BindingSetItem& SetSampler(Sampler& sampler) { Resource = &sampler; return *this; }
+        inline BindingSetItem& SetBuffer(Buffer& buffer, const BufferRange& range = BufferRange()) { Resource = &buffer; Range = range; return *this; }
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
     // BindingSetPoolSpecification
     ////////////////////////////////////////////////////////////////////////////////////
@@ -170,6 +203,43 @@ namespace Obsidian
         inline BindingSetPoolSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // BindlessTableSpecification
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct BindlessTableSpecification
+    {
+    public:
+        inline constexpr static uint32_t ImageSlot = 0;
+        inline constexpr static uint32_t StorageImageSlot = 1;
+        inline constexpr static uint32_t BufferSlot = 2;
+        inline constexpr static uint32_t StorageBufferSlot = 3;
+        inline constexpr static uint32_t SamplerSlot = 4;
+    public:
+        uint8_t RegisterSpace = 0; // Note: The set every shader declares its bindless arrays in
+        ShaderStage Visibility = (ShaderStage::AllGraphics | ShaderStage::Compute);
+
+        uint16_t MaxImages = 16384;
+        uint16_t MaxStorageImages = 4096;
+        uint16_t MaxBuffers = 16384;
+        uint16_t MaxStorageBuffers = 4096;
+        uint16_t MaxSamplers = 256;
+
+        std::string DebugName = {};
+
+    public:
+        // Setters
+        inline constexpr BindlessTableSpecification& SetRegisterSpace(uint8_t space) { RegisterSpace = space; return *this; }
+        inline constexpr BindlessTableSpecification& SetVisibility(ShaderStage visibility) { Visibility = visibility; return *this; }
+
+        inline constexpr BindlessTableSpecification& SetMaxImages(uint16_t count) { MaxImages = count; return *this; }
+        inline constexpr BindlessTableSpecification& SetMaxStorageImages(uint16_t count) { MaxStorageImages = count; return *this; }
+        inline constexpr BindlessTableSpecification& SetMaxBuffers(uint16_t count) { MaxBuffers = count; return *this; }
+        inline constexpr BindlessTableSpecification& SetMaxStorageBuffers(uint16_t count) { MaxStorageBuffers = count; return *this; }
+        inline constexpr BindlessTableSpecification& SetMaxSamplers(uint16_t count) { MaxSamplers = count; return *this; }
+
+        inline BindlessTableSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
+    };
+
     namespace Internal
     {
         ////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,220 @@
+#include "obpch.h"
+#include "BindlessTable.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+#include "Obsidian/Renderer/CommandList.hpp"
+
+#include <algorithm>
+
+namespace Obsidian
+{
+
+    namespace
+    {
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Helper methods
+        ////////////////////////////////////////////////////////////////////////////////////
+        BindlessLayoutSpecification GetLayoutSpecification(const BindlessTableSpecification& specs)
+        {
+            BindlessLayoutSpecification layoutSpecs = {};
+            layoutSpecs.SetRegisterSpace(specs.RegisterSpace);
+            layoutSpecs.SetDebugName(specs.DebugName.empty() ? std::string("BindlessTable Layout") : std::format("Layout for: {0}", specs.DebugName));
+
+            // Note: Kinds without capacity don't get a binding at all
+            auto addItem = [&](uint32_t slot, ResourceType type, uint16_t count, const char* name)
+            {
+                if (count > 0)
+                    layoutSpecs.AddItem(BindingLayoutItem().SetSlot(slot).SetVisibility(specs.Visibility).SetType(type).SetSize(count).SetDebugName(name));
+            };
+
+            addItem(BindlessTableSpecification::ImageSlot, ResourceType::Image, specs.MaxImages, "Images");
+            addItem(BindlessTableSpecification::StorageImageSlot, ResourceType::ImageUnordered, specs.MaxStorageImages, "StorageImages");
+            addItem(BindlessTableSpecification::BufferSlot, ResourceType::StorageBuffer, specs.MaxBuffers, "Buffers");
+            addItem(BindlessTableSpecification::StorageBufferSlot, ResourceType::StorageBufferUnordered, specs.MaxStorageBuffers, "StorageBuffers");
+            addItem(BindlessTableSpecification::SamplerSlot, ResourceType::Sampler, specs.MaxSamplers, "Samplers");
+
+            return layoutSpecs;
+        }
+
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    BindlessTable::BindlessTable(const Device& device, const BindlessTableSpecification& specs)
+        : m_Device(device), m_Specification(specs), m_Layout(device.CreateBindingLayout(GetLayoutSpecification(specs))),
+        m_Pool(device.AllocateBindingSetPool(BindingSetPoolSpecification()
+            .SetLayout(m_Layout)
+            .SetSetAmount(1)
+            .SetDebugName(specs.DebugName.empty() ? std::string("BindlessTable Pool") : std::format("Pool for: {0}", specs.DebugName))
+        )),
+        m_Set(m_Pool.CreateBindingSet(BindingSetSpecification().SetDebugName(specs.DebugName)))
+    {
+        m_Categories[BindlessTableSpecification::ImageSlot].Capacity = specs.MaxImages;
+        m_Categories[BindlessTableSpecification::StorageImageSlot].Capacity = specs.MaxStorageImages;
+        m_Categories[BindlessTableSpecification::BufferSlot].Capacity = specs.MaxBuffers;
+        m_Categories[BindlessTableSpecification::StorageBufferSlot].Capacity = specs.MaxStorageBuffers;
+        m_Categories[BindlessTableSpecification::SamplerSlot].Capacity = specs.MaxSamplers;
+    }
+
+    BindlessTable::~BindlessTable()
+    {
+        m_Device.FreeBindingSetPool(m_Pool);
+        m_Device.DestroyBindingLayout(m_Layout);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    uint32_t BindlessTable::AddImage(Image& image, const ImageSubresourceSpecification& subresources)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        uint32_t index = Allocate(BindlessTableSpecification::ImageSlot);
+        m_Pending.push_back(BindingSetItem().SetSlot(BindlessTableSpecification::ImageSlot).SetArrayIndex(index).SetImage(image, subresources));
+        return index;
+    }
+
+    uint32_t BindlessTable::AddStorageImage(Image& image, const ImageSubresourceSpecification& subresources)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        uint32_t index = Allocate(BindlessTableSpecification::StorageImageSlot);
+        m_Pending.push_back(BindingSetItem().SetSlot(BindlessTableSpecification::StorageImageSlot).SetArrayIndex(index).SetImage(image, subresources));
+        return index;
+    }
+
+    uint32_t BindlessTable::AddBuffer(Buffer& buffer, const BufferRange& range)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        uint32_t index = Allocate(BindlessTableSpecification::BufferSlot);
+        m_Pending.push_back(BindingSetItem().SetSlot(BindlessTableSpecification::BufferSlot).SetArrayIndex(index).SetBuffer(buffer, range));
+        return index;
+    }
+
+    uint32_t BindlessTable::AddStorageBuffer(Buffer& buffer, const BufferRange& range)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        uint32_t index = Allocate(BindlessTableSpecification::StorageBufferSlot);
+        m_Pending.push_back(BindingSetItem().SetSlot(BindlessTableSpecification::StorageBufferSlot).SetArrayIndex(index).SetBuffer(buffer, range));
+        return index;
+    }
+
+    uint32_t BindlessTable::AddSampler(Sampler& sampler)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        uint32_t index = Allocate(BindlessTableSpecification::SamplerSlot);
+        m_Pending.push_back(BindingSetItem().SetSlot(BindlessTableSpecification::SamplerSlot).SetArrayIndex(index).SetSampler(sampler));
+        return index;
+    }
+
+    void BindlessTable::RemoveImage(uint32_t index)
+    {
+        std::scoped_lock lock(m_Mutex);
+        Retire(BindlessTableSpecification::ImageSlot, index);
+    }
+
+    void BindlessTable::RemoveStorageImage(uint32_t index)
+    {
+        std::scoped_lock lock(m_Mutex);
+        Retire(BindlessTableSpecification::StorageImageSlot, index);
+    }
+
+    void BindlessTable::RemoveBuffer(uint32_t index)
+    {
+        std::scoped_lock lock(m_Mutex);
+        Retire(BindlessTableSpecification::BufferSlot, index);
+    }
+
+    void BindlessTable::RemoveStorageBuffer(uint32_t index)
+    {
+        std::scoped_lock lock(m_Mutex);
+        Retire(BindlessTableSpecification::StorageBufferSlot, index);
+    }
+
+    void BindlessTable::RemoveSampler(uint32_t index)
+    {
+        std::scoped_lock lock(m_Mutex);
+        Retire(BindlessTableSpecification::SamplerSlot, index);
+    }
+
+    void BindlessTable::Flush()
+    {
+        OB_PROFILE("BindlessTable::Flush()");
+
+        // Note: Read before the completed value, so a retired index is never tied to a value that already completed without it
+        const uint64_t submittedValue = m_Device.GetSubmittedValue();
+        const uint64_t completedValue = m_Device.GetCompletedValue();
+
+        std::scoped_lock lock(m_Mutex);
+
+        for (RetiredIndex& retired : m_Retired)
+        {
+            retired.Value = submittedValue;
+            m_InFlight.push_back(retired);
+        }
+        m_Retired.clear();
+
+        while (!m_InFlight.empty() && (m_InFlight.front().Value <= completedValue))
+        {
+            m_Categories[m_InFlight.front().Slot].Free.push_back(m_InFlight.front().Index);
+            m_InFlight.pop_front();
+        }
+
+        if (m_Pending.empty())
+            return;
+
+        m_Set.SetItems(m_Pending);
+        m_Pending.clear();
+    }
+
+    void BindlessTable::Bind(CommandList& list) const
+    {
+        list.BindBindingSet(m_Set);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    size_t BindlessTable::GetPendingCount() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_Pending.size();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    uint32_t BindlessTable::Allocate(uint32_t slot)
+    {
+        Category& category = m_Categories[slot];
+
+        if (!category.Free.empty())
+        {
+            uint32_t index = category.Free.back();
+            category.Free.pop_back();
+            return index;
+        }
+
+        OB_ASSERT((category.Next < category.Capacity), "[BindlessTable] No free indices left in slot {0}, the capacity is {1}.", slot, category.Capacity);
+        return category.Next++;
+    }
+
+    void BindlessTable::Retire(uint32_t slot, uint32_t index)
+    {
+        OB_ASSERT((index < m_Categories[slot].Next), "[BindlessTable] Removing index {0} from slot {1}, which was never handed out.", index, slot);
+
+        // Note: A descriptor that was never flushed must not be written anymore, its resource may be destroyed right after this
+        std::erase_if(m_Pending, [&](const BindingSetItem& item) { return ((item.Slot == slot) && (item.ArrayIndex == index)); });
+
+        m_Retired.emplace_back(slot, index, 0);
+    }
+
+}
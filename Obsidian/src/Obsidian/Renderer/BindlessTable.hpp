@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/Bindings.hpp"
+#include "Obsidian/Renderer/BindingsSpec.hpp"
+
+#include <cstdint>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace Obsidian
+{
+
+    class Device;
+    class Image;
+    class Sampler;
+    class Buffer;
+    class CommandList;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // BindlessTable // Note: A single global bindless set with one array per resource kind,
+    // hands out stable indices that shaders use to index those arrays. Removed indices are
+    // only reused once the GPU has finished every submission that could still read them.
+    ////////////////////////////////////////////////////////////////////////////////////
+    class BindlessTable
+    {
+    public:
+        // Constructor & Destructor
+        BindlessTable(const Device& device, const BindlessTableSpecification& specs = BindlessTableSpecification()); // Note: Errors on Vulkan devices that can't write descriptors while the set is in use
+        ~BindlessTable();
+
+        // Methods // Note: The descriptor gets written on the next Flush(). Thread safe.
+        uint32_t AddImage(Image& image, const ImageSubresourceSpecification& subresources = ImageSubresourceSpecification());
+        uint32_t AddStorageImage(Image& image, const ImageSubresourceSpecification& subresources = ImageSubresourceSpecification());
+        uint32_t AddBuffer(Buffer& buffer, const BufferRange& range = BufferRange());
+        uint32_t AddStorageBuffer(Buffer& buffer, const BufferRange& range = BufferRange());
+        uint32_t AddSampler(Sampler& sampler);
+
+        void RemoveImage(uint32_t index);
+        void RemoveStorageImage(uint32_t index);
+        void RemoveBuffer(uint32_t index);
+        void RemoveStorageBuffer(uint32_t index);
+        void RemoveSampler(uint32_t index);
+
+        // Note: Writes all pending descriptors at once & recycles completed indices, call once per frame before recording.
+        // Indices removed since the last Flush() are retired once everything submitted up to now has completed,
+        // so lists recorded before removing an index must be submitted before the next Flush().
+        void Flush();
+
+        // Note: Rebinding is skipped by the list while the table is still bound, which lasts across pipelines that share a pipeline layout
+        void Bind(CommandList& list) const;
+
+        // Getters
+        inline const BindlessTableSpecification& GetSpecification() const { return m_Specification; }
+
+        inline BindingLayout& GetLayout() { return m_Layout; } // Note: Add this to every pipeline that accesses the table
+        inline const BindingSet& GetBindingSet() const { return m_Set; }
+
+        size_t GetPendingCount() const; // Note: Descriptors waiting for the next Flush()
+
+    private:
+        struct Category
+        {
+        public:
+            uint32_t Capacity = 0;
+            uint32_t Next = 0; // Note: Indices below Next have been handed out at least once
+            std::vector<uint32_t> Free = { };
+        };
+
+        struct RetiredIndex
+        {
+        public:
+            uint32_t Slot = 0;
+            uint32_t Index = 0;
+            uint64_t Value = 0; // Note: Timeline value to reach before the index can be reused, assigned on Flush()
+        };
+
+    private:
+        // Private methods // Note: Must be called with m_Mutex locked
+        uint32_t Allocate(uint32_t slot);
+        void Retire(uint32_t slot, uint32_t index);
+
+    private:
+        const Device& m_Device;
+        BindlessTableSpecification m_Specification;
+
+        BindingLayout m_Layout;
+        BindingSetPool m_Pool;
+        BindingSet m_Set;
+
+        mutable std::mutex m_Mutex = {};
+        std::array<Category, BindlessTableSpecification::SamplerSlot + 1> m_Categories = { }; // Note: Indexed by slot
+
+        std::vector<BindingSetItem> m_Pending = { };
+        std::vector<RetiredIndex> m_Retired = { }; // Note: Removed since the last Flush()
+        std::deque<RetiredIndex> m_InFlight = { }; // Note: Ordered by Value, since the timeline only increases
+    };
+
+}
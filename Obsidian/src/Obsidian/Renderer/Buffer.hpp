@@ -32,6 +32,9 @@ namespace Obsidian
         // Destructor
         ~InputLayout() = default;
 
+        // Getters
+        inline size_t GetAttributesHash() const { return m_Impl->GetAttributesHash(); } // Note: Hash of the attributes, equal layouts created separately share it
+
     public: //private:
         // Constructor
         inline InputLayout(const Device& device, std::span<const VertexAttributeSpecification> attributes) { m_Impl.Construct(device, attributes); }
@@ -3,10 +3,16 @@
 #include "Obsidian/Renderer/ResourceSpec.hpp"
 #include "Obsidian/Renderer/ImageSpec.hpp"
 
+#include <Nano/Nano.hpp>
+
 #include <cstdint>
+#include <span>
 #include <numeric>
 #include <limits>
 #include <string>
+#include <utility>
+#include <functional>
+#include <type_traits>
 
 namespace Obsidian
 {
@@ -86,6 +92,7 @@ namespace Obsidian
         bool IsVertexBuffer : 1 = false;
         bool IsIndexBuffer : 1 = false;
         bool IsUniformBuffer : 1 = false;
+        bool IsIndirectArgument : 1 = false; // Note: Needed for DrawIndexedIndirect(Count)/DispatchIndirect argument & count buffers
         //bool IsAccelStructBuildInput = false;
         //bool IsAccelStructStorage = false;
 
@@ -96,6 +103,7 @@ namespace Obsidian
         ResourceState PermanentState = ResourceState::Unknown; // Note: Anything other than Unknown sets it to be permanent
 
         CpuAccessMode CpuAccess = CpuAccessMode::None;
+        bool IsPersistentlyMapped = false; // Note: Requires CpuAccessMode::Write, the buffer stays mapped for its whole lifetime so MapBuffer/WriteBuffer don't map/unmap every call
 
         std::string DebugName = {};
 
@@ -112,6 +120,7 @@ namespace Obsidian
         inline constexpr BufferSpecification& SetIsIndexBuffer(bool enabled) { IsIndexBuffer = enabled; return *this; }
         inline constexpr BufferSpecification& SetIsUniformBuffer(bool enabled) { IsUniformBuffer = enabled; return *this; }
         inline constexpr BufferSpecification& SetIsContantBuffer(bool enabled) { IsUniformBuffer = enabled; return *this; }
+        inline constexpr BufferSpecification& SetIsIndirectArgument(bool enabled) { IsIndirectArgument = enabled; return *this; }
 
         inline constexpr BufferSpecification& SetIsDynamic(bool enabled) { IsDynamic = enabled; return *this; }
         inline constexpr BufferSpecification& SetIsVolatile(bool enabled) { IsDynamic = enabled; return *this; }
@@ -122,9 +131,109 @@ namespace Obsidian
 
         inline constexpr BufferSpecification& SetPermanentState(ResourceState state) { PermanentState = state; return *this; }
         inline constexpr BufferSpecification& SetCPUAccess(CpuAccessMode access) { CpuAccess = access; return *this; }
+        inline constexpr BufferSpecification& SetIsPersistentlyMapped(bool enabled) { IsPersistentlyMapped = enabled; return *this; }
         inline BufferSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
 
         inline constexpr bool HasPermanentState() const { return (PermanentState != ResourceState::Unknown); }
+
+        // Operators
+        inline constexpr bool operator == (const BufferSpecification& other) const { return ((Size == other.Size) && (Stride == other.Stride) && (ElementCount == other.ElementCount) && (BufferFormat == other.BufferFormat) && (IsVertexBuffer == other.IsVertexBuffer) && (IsIndexBuffer == other.IsIndexBuffer) && (IsUniformBuffer == other.IsUniformBuffer) && (IsIndirectArgument == other.IsIndirectArgument) && (IsDynamic == other.IsDynamic) && (IsTexel == other.IsTexel) && (IsUnorderedAccessed == other.IsUnorderedAccessed) && (PermanentState == other.PermanentState) && (CpuAccess == other.CpuAccess) && (IsPersistentlyMapped == other.IsPersistentlyMapped)); }
+        inline constexpr bool operator != (const BufferSpecification& other) const { return !(*this == other); }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // TransientBufferAllocatorSpecification
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct TransientBufferAllocatorSpecification
+    {
+    public:
+        size_t FrameSize = 0; // Note: Amount of bytes that can be allocated per frame (in flight)
+        size_t MaxAllocationSize = BufferSpecification::DefaultUniformBufferAlignment; // Note: Size of the largest single allocation, this is the range a dynamic binding covers
+
+        bool IsUniformBuffer = true; // Note: For DynamicUniformBuffer/DynamicConstantBuffer bindings
+        bool IsStorageBuffer = false; // Note: For DynamicStorageBuffer/DynamicStructuredBuffer bindings
+
+        std::string DebugName = {};
+
+    public:
+        // Setters
+        inline constexpr TransientBufferAllocatorSpecification& SetFrameSize(size_t size) { FrameSize = size; return *this; }
+        inline constexpr TransientBufferAllocatorSpecification& SetMaxAllocationSize(size_t size) { MaxAllocationSize = size; return *this; }
+
+        inline constexpr TransientBufferAllocatorSpecification& SetIsUniformBuffer(bool enabled) { IsUniformBuffer = enabled; return *this; }
+        inline constexpr TransientBufferAllocatorSpecification& SetIsConstantBuffer(bool enabled) { IsUniformBuffer = enabled; return *this; }
+        inline constexpr TransientBufferAllocatorSpecification& SetIsStorageBuffer(bool enabled) { IsStorageBuffer = enabled; return *this; }
+        inline TransientBufferAllocatorSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // TransientAllocation
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct TransientAllocation
+    {
+    public:
+        void* Memory = nullptr; // Note: Mapped memory of the allocation, can be written to directly
+
+        BufferRange Range = {}; // Note: Range inside of the allocator's buffer
+        uint32_t DynamicOffset = 0; // Note: Pass into BindBindingSet(set, dynamicOffsets) when the buffer is bound as a dynamic buffer
+
+    public:
+        // Getters
+        inline constexpr bool IsValid() const { return (Range.Size != BufferRange::FullSize); } // Note: Invalid when the allocator ran out of memory for the frame
     };
 
-}
\ No newline at end of file
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ReadbackQueueSpecification
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct ReadbackQueueSpecification
+    {
+    public:
+        size_t MinBufferSize = 64ull * 1024ull; // Note: Readback buffers get recycled, new ones are at least this big so small reads can share sizes
+
+        std::string DebugName = {};
+
+    public:
+        // Setters
+        inline constexpr ReadbackQueueSpecification& SetMinBufferSize(size_t size) { MinBufferSize = size; return *this; }
+        inline ReadbackQueueSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ReadbackResult
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct ReadbackResult
+    {
+    public:
+        const void* Memory = nullptr; // Note: Mapped memory of the copy, only valid during the callback
+        size_t Size = 0;
+
+        ImageBufferLayout Layout = {}; // Note: Only filled in for image readbacks
+    };
+
+    using ReadbackCallback = std::function<void(const ReadbackResult& result)>;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Helper
+    ////////////////////////////////////////////////////////////////////////////////////
+    namespace Internal
+    {
+
+        inline size_t HashVertexAttributes(std::span<const VertexAttributeSpecification> attributes) // Note: The debug names are ignored
+        {
+            size_t hash = 0;
+            for (const VertexAttributeSpecification& attribute : attributes)
+            {
+                hash = Nano::Hash::Combine(hash, std::hash<uint32_t>{}(attribute.Location));
+                hash = Nano::Hash::Combine(hash, std::hash<uint32_t>{}(attribute.BufferIndex));
+                hash = Nano::Hash::Combine(hash, std::hash<std::underlying_type_t<Format>>{}(std::to_underlying(attribute.VertexFormat)));
+                hash = Nano::Hash::Combine(hash, std::hash<uint32_t>{}(attribute.Size));
+                hash = Nano::Hash::Combine(hash, std::hash<uint32_t>{}(attribute.Offset));
+                hash = Nano::Hash::Combine(hash, std::hash<uint32_t>{}(attribute.ArraySize));
+                hash = Nano::Hash::Combine(hash, std::hash<bool>{}(attribute.IsInstanced));
+            }
+            return hash;
+        }
+
+    }
+
+}
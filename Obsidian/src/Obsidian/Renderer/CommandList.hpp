@@ -16,9 +16,11 @@
 namespace Obsidian
 {
 
+    class Device;
     class Swapchain;
     class Image;
     class Buffer;
+    class QueryPool;
     class CommandListPool;
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -50,6 +52,7 @@ namespace Obsidian
         // Object methods
         inline void StartRenderpass(const RenderpassStartArgs& args) { m_Impl->StartRenderpass(args); }
         inline void EndRenderpass(const RenderpassEndArgs& args) { m_Impl->EndRenderpass(args); }
+        inline void EndRenderpass() { m_Impl->EndRenderpass(RenderpassEndArgs()); } // Note: For renderpasses started with dynamic rendering (no Renderpass)
 
         inline void BindPipeline(const GraphicsPipeline& pipeline) { m_Impl->BindPipeline(pipeline); }
         inline void BindPipeline(const ComputePipeline& pipeline) { m_Impl->BindPipeline(pipeline); }
@@ -65,24 +68,49 @@ namespace Obsidian
 
         inline void CopyImage(Image& dst, const ImageSliceSpecification& dstSlice, Image& src, const ImageSliceSpecification& srcSlice) { m_Impl->CopyImage(dst, dstSlice, src, srcSlice); }
         inline void CopyImage(Image& dst, const ImageSliceSpecification& dstSlice, StagingImage& src, const ImageSliceSpecification& srcSlice) { m_Impl->CopyImage(dst, dstSlice, src, srcSlice); }
+        inline void CopyImage(StagingImage& dst, const ImageSliceSpecification& dstSlice, Image& src, const ImageSliceSpecification& srcSlice) { m_Impl->CopyImage(dst, dstSlice, src, srcSlice); }
+        inline void CopyImage(Buffer& dst, size_t dstOffset, Image& src, const ImageSliceSpecification& srcSlice = ImageSliceSpecification()) { m_Impl->CopyImage(dst, dstOffset, src, srcSlice); } // Note: Rows are padded as described by ImageBufferLayout
         inline void CopyBuffer(Buffer& dst, Buffer& src, size_t size, size_t srcOffset = 0, size_t dstOffset = 0) { m_Impl->CopyBuffer(dst, src, size, srcOffset, dstOffset); }
 
+        // Note: Fills the mips of subresources after BaseMipLevel by linearly blitting every level from the previous one, the array slices are done together.
+        // The format must support linear blitting. D3D12 has no blit, on Dx12 (or for a single pass over UAV capable formats) use a MipGenerator instead.
+        inline void GenerateMips(Image& image, const ImageSubresourceSpecification& subresources = ImageSubresourceSpecification()) { m_Impl->GenerateMips(image, subresources); }
+
         inline void Dispatch(uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1) const { m_Impl->Dispatch(groupsX, groupsY, groupsZ); }
+        inline void DispatchIndirect(Buffer& argumentBuffer, size_t offset = 0) { m_Impl->DispatchIndirect(argumentBuffer, offset); } // Note: Reads a DispatchIndirectCommand at offset
+
+        // Query methods // Note: Queries must be reset (outside of a renderpass) before they are (re)used.
+        inline void ResetQueries(QueryPool& pool, uint32_t firstQuery, uint32_t queryCount) { m_Impl->ResetQueries(pool, firstQuery, queryCount); }
+        inline void BeginQuery(QueryPool& pool, uint32_t query) { m_Impl->BeginQuery(pool, query); } // Note: For Occlusion & PipelineStatistics pools
+        inline void EndQuery(QueryPool& pool, uint32_t query) { m_Impl->EndQuery(pool, query); }
+        inline void BeginTimerQuery(QueryPool& pool, uint32_t timer) { m_Impl->BeginTimerQuery(pool, timer); } // Note: For Timestamp pools, timer N uses queries 2N & 2N + 1
+        inline void EndTimerQuery(QueryPool& pool, uint32_t timer) { m_Impl->EndTimerQuery(pool, timer); }
 
         // State methods // Note: These methods should only be used in very special cases,
         // because internal methods change the state all the time based on needs. Make sure you know what you are doing.
         inline void RequireState(Image& image, const ImageSubresourceSpecification& subresources, ResourceState state) { m_Impl->RequireState(image, subresources, state); }
         inline void RequireState(Buffer& buffer, ResourceState state) { m_Impl->RequireState(buffer, state); }
 
+        // Note: Makes a placed image the active user of its heap memory and transitions it to state, the previous contents are undefined.
+        // Must be called (outside of a renderpass) before the first use of a placed image after another image used its memory, render targets should be cleared after.
+        inline void AliasImage(Image& image, ResourceState state) { m_Impl->AliasImage(image, state); }
+
         // Draw methods
         inline void DrawIndexed(const DrawArguments& args) const { m_Impl->DrawIndexed(args); }
 
+        // Note: The argument (and count) buffers get transitioned to ResourceState::IndirectArgument automatically, but barriers can't be placed
+        // inside a renderpass. So if the buffer was used in a different state by this list, call RequireState(buffer, ResourceState::IndirectArgument) before StartRenderpass.
+        inline void DrawIndexedIndirect(Buffer& argumentBuffer, size_t offset = 0, uint32_t drawCount = 1, uint32_t stride = sizeof(DrawIndexedIndirectCommand)) { m_Impl->DrawIndexedIndirect(argumentBuffer, offset, drawCount, stride); }
+        inline void DrawIndexedIndirectCount(Buffer& argumentBuffer, size_t offset, Buffer& countBuffer, size_t countOffset, uint32_t maxDrawCount, uint32_t stride = sizeof(DrawIndexedIndirectCommand)) { m_Impl->DrawIndexedIndirectCount(argumentBuffer, offset, countBuffer, countOffset, maxDrawCount, stride); } // Note: The count is a uint32_t read at countOffset, clamped to maxDrawCount
+
         // Other methods
         inline void PushConstants(const void* memory, size_t size, size_t srcOffset = 0, size_t dstOffset = 0) { m_Impl->PushConstants(memory, size, srcOffset, dstOffset); }
 
         // Getters
         inline const CommandListSpecification& GetSpecification() const { return m_Impl->GetSpecification(); }
 
+        inline uint64_t GetSignaledValue() const { return m_Impl->GetSignaledValue(); } // Note: Device timeline value signaled by the last submission of this list, 0 if it hasn't been submitted
+
     public: //private:
         // Constructor
         inline CommandList(CommandListPool& pool, const CommandListSpecification& specs = CommandListSpecification()) { m_Impl.Construct(pool, specs); }
@@ -123,11 +151,13 @@ namespace Obsidian
 
     public: //private:
         // Constructor
+        inline CommandListPool(const Device& device, const CommandListPoolSpecification& specs) { m_Impl.Construct(device, specs); } // Note: Lists from this pool can't interact with a swapchain (headless/offscreen work)
         inline CommandListPool(Swapchain& swapchain, const CommandListPoolSpecification& specs) { m_Impl.Construct(swapchain, specs); }
 
     private:
         Internal::APIObject<Type> m_Impl = {};
 
+        friend class Device;
         friend class Swapchain;
         friend class APICaster;
     };
@@ -7,6 +7,7 @@
 #include "Obsidian/Renderer/ResourceSpec.hpp"
 #include "Obsidian/Renderer/ImageSpec.hpp"
 #include "Obsidian/Renderer/RenderpassSpec.hpp"
+#include "Obsidian/Renderer/UploadManagerSpec.hpp"
 
 #include <Nano/Nano.hpp>
 
@@ -76,8 +77,11 @@ namespace Obsidian
     ////////////////////////////////////////////////////////////////////////////////////
     struct CommandListSubmitArgs
     {
+    public:
+        inline constexpr static size_t MaxUploadWaits = 8;
     public:
         std::variant<std::vector<const CommandList*>, std::span<const CommandList*>> WaitOnLists = {};
+        Nano::Memory::StaticVector<UploadTicket, MaxUploadWaits> WaitOnUploads = { }; // Note: The submission waits (on the GPU) till these uploads are done
         
         bool WaitForSwapchainImage = false;
         bool OnFinishMakeSwapchainPresentable = false;
@@ -88,6 +92,9 @@ namespace Obsidian
         inline CommandListSubmitArgs& SetWaitOnLists(const std::vector<const CommandList*>& ownedLists) { WaitOnLists = ownedLists; return *this; }
         inline CommandListSubmitArgs& SetWaitOnLists(std::initializer_list<const CommandList*> ownedLists) { WaitOnLists = ownedLists; return *this; }
         inline constexpr CommandListSubmitArgs& SetWaitOnLists(std::span<const CommandList*> viewedLists) { WaitOnLists = viewedLists; return *this; }
+        inline CommandListSubmitArgs& SetWaitOnUploads(std::span<const UploadTicket> tickets) { WaitOnUploads.clear(); for (const UploadTicket& ticket : tickets) AddWaitOnUpload(ticket); return *this; }
+        inline CommandListSubmitArgs& SetWaitOnUploads(std::initializer_list<UploadTicket> tickets) { return SetWaitOnUploads(std::span<const UploadTicket>(tickets.begin(), tickets.size())); }
+        inline CommandListSubmitArgs& AddWaitOnUpload(const UploadTicket& ticket) { OB_ASSERT((WaitOnUploads.size() < MaxUploadWaits), "[CommandListSubmitArgs] Can't wait on more than {0} uploads in a single submission.", MaxUploadWaits); WaitOnUploads.push_back(ticket); return *this; }
         inline constexpr CommandListSubmitArgs& SetWaitForSwapchainImage(bool enabled) { WaitForSwapchainImage = enabled; return *this; }
         inline constexpr CommandListSubmitArgs& SetOnFinishMakeSwapchainPresentable(bool enabled) { OnFinishMakeSwapchainPresentable = enabled; return *this; }
     };
@@ -112,15 +119,42 @@ namespace Obsidian
         inline constexpr DrawArguments& SetStartInstanceLocation(uint32_t location) { StartInstanceLocation = location; return *this; }
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // DrawIndexedIndirectCommand // Note: Layout of a single draw in an indirect argument buffer
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct DrawIndexedIndirectCommand
+    {
+    public:
+        uint32_t IndexCount = 0;
+        uint32_t InstanceCount = 1;
+        uint32_t StartIndexLocation = 0;
+        int32_t BaseVertexLocation = 0;
+        uint32_t StartInstanceLocation = 0;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // DispatchIndirectCommand // Note: Layout of a single dispatch in an indirect argument buffer
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct DispatchIndirectCommand
+    {
+    public:
+        uint32_t GroupsX = 1;
+        uint32_t GroupsY = 1;
+        uint32_t GroupsZ = 1;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
     // RenderpassStartArgs
     ////////////////////////////////////////////////////////////////////////////////////
     struct RenderpassStartArgs
     {
     public:
-        Renderpass* Pass = nullptr;
+        Renderpass* Pass = nullptr; // Note: When nullptr, dynamic rendering is used with the attachments below
         Framebuffer* Frame = nullptr; // Note: Can be nullptr, will get Framebuffer[AcquiredImage] from pass.
 
+        Nano::Memory::StaticVector<RenderingAttachment, Information::MaxColourAttachments> ColourAttachments = {};
+        RenderingAttachment DepthAttachment = {};
+
         Viewport ViewportState = {};
         ScissorRect Scissor = {};
 
@@ -131,6 +165,9 @@ namespace Obsidian
         // Setters
         inline constexpr RenderpassStartArgs& SetRenderpass(Renderpass& renderpass) { Pass = &renderpass; return *this; }
         inline constexpr RenderpassStartArgs& SetFramebuffer(Framebuffer& framebuffer) { Frame = &framebuffer; return *this; }
+
+        inline RenderpassStartArgs& AddColourAttachment(const RenderingAttachment& attachment) { ColourAttachments.push_back(attachment); return *this; }
+        inline constexpr RenderpassStartArgs& SetDepthAttachment(const RenderingAttachment& attachment) { DepthAttachment = attachment; return *this; }
     
         inline constexpr RenderpassStartArgs& SetViewport(const Viewport& viewport) { ViewportState = viewport; return *this; }
         inline constexpr RenderpassStartArgs& SetScissor(const ScissorRect& scissor) { Scissor = scissor; return *this; }
@@ -145,7 +182,7 @@ namespace Obsidian
     struct RenderpassEndArgs
     {
     public:
-        Renderpass* Pass = nullptr;
+        Renderpass* Pass = nullptr; // Note: Should be nullptr when the renderpass was started with dynamic rendering
         Framebuffer* Frame = nullptr; // Note: Can be nullptr, will get Framebuffer[AcquiredImage] from pass.
 
     public:
@@ -12,6 +12,8 @@
 #include "Obsidian/Renderer/Renderpass.hpp"
 #include "Obsidian/Renderer/Shader.hpp"
 #include "Obsidian/Renderer/Pipeline.hpp"
+#include "Obsidian/Renderer/QueryPool.hpp"
+#include "Obsidian/Renderer/UploadManager.hpp"
 
 #include "Obsidian/Platform/Vulkan/VulkanDevice.hpp"
 #include "Obsidian/Platform/Dx12/Dx12Device.hpp"
@@ -20,6 +22,7 @@
 #include <Nano/Nano.hpp>
 
 #include <span>
+#include <vector>
 
 namespace Obsidian
 {
@@ -44,6 +47,15 @@ namespace Obsidian
         // Methods 
         inline void Wait() const { m_Impl->Wait(); } // Note: Makes the CPU wait on the GPU to finish all operations // Note: Should not be used frequently
 
+        // Note: Submits all lists (in order) as a single batch to the queue of their pools, all lists must share the same queue.
+        // The batch waits for the swapchain image/WaitOnLists before starting and signals the presentable state once all lists are done.
+        inline void Submit(std::span<CommandList*> lists, const CommandListSubmitArgs& args = CommandListSubmitArgs()) const { m_Impl->Submit(lists, args); }
+
+        // Note: Every submission signals the next value on the device's timeline, these allow waiting on/polling that timeline without a CommandList.
+        inline uint64_t GetSubmittedValue() const { return m_Impl->GetSubmittedValue(); } // Note: The value signaled by the last submission
+        inline uint64_t GetCompletedValue() const { return m_Impl->GetCompletedValue(); } // Note: The value the GPU has currently reached
+        inline void WaitForValue(uint64_t value) const { m_Impl->WaitForValue(value); } // Note: Makes the CPU wait till the GPU has reached value
+
         inline void StartTracking(const Image& image, ImageSubresourceSpecification subresources = ImageSubresourceSpecification(), ResourceState currentState = ResourceState::Unknown) { m_Impl->StartTracking(image, subresources, currentState); }
         inline void StartTracking(const StagingImage& image, ResourceState currentState = ResourceState::Unknown) { m_Impl->StartTracking(image, currentState); }
         inline void StartTracking(const Buffer& buffer, ResourceState currentState = ResourceState::Unknown) { m_Impl->StartTracking(buffer, currentState); }
@@ -56,19 +68,34 @@ namespace Obsidian
 
         inline void MapBuffer(const Buffer& buffer, void*& memory) const { return m_Impl->MapBuffer(buffer, memory); }
         inline void UnmapBuffer(const Buffer& buffer) const { return m_Impl->UnmapBuffer(buffer); }
+        inline void FlushBuffer(const Buffer& buffer, const BufferRange& range = {}) const { m_Impl->FlushBuffer(buffer, range); } // Note: Makes CPU writes through a mapped pointer visible to the GPU, only does work on non-coherent memory
+        inline void InvalidateBuffer(const Buffer& buffer, const BufferRange& range = {}) const { m_Impl->InvalidateBuffer(buffer, range); } // Note: Makes GPU writes visible to CPU reads through a mapped pointer, only does work on non-coherent memory
 
         inline void WriteBuffer(const Buffer& buffer, const void* memory, size_t size, size_t srcOffset = 0, size_t dstOffset = 0) const { m_Impl->WriteBuffer(buffer, memory, size, srcOffset, dstOffset); }
         inline void WriteImage(const StagingImage& image, const ImageSliceSpecification& slice, const void* memory, size_t size) const { m_Impl->WriteImage(image, slice, memory, size); }
 
+        inline std::vector<uint8_t> GetPipelineCacheData() const { return m_Impl->GetPipelineCacheData(); } // Note: Can be stored on disk and passed into DeviceSpecification::PipelineCacheData on the next run
+
         // Creation/Destruction methods // Note: Copy elision (RVO/NRVO) ensures object is constructed directly in the caller's stack frame.
         inline Swapchain CreateSwapchain(const SwapchainSpecification& specs) const { return Swapchain(*this, specs); }
         inline void DestroySwapchain(Swapchain& swapchain) const { return m_Impl->DestroySwapchain(swapchain); }
 
+        inline CommandListPool AllocateCommandListPool(const CommandListPoolSpecification& specs) const { return CommandListPool(*this, specs); } // Note: For swapchain interaction allocate the pool from the Swapchain
+        inline void FreePool(CommandListPool& pool) const { m_Impl->FreePool(pool); }
+
         inline Image CreateImage(const ImageSpecification& specs) const { return Image(*this, specs); }
         inline void DestroyImage(Image& image) const { m_Impl->DestroyImage(image); }
+
+        // Note: Placed images live in (a part of) the heap's memory, multiple images can be placed at overlapping offsets (aliased)
+        // as long as only one of them is used at a time. Switching between them has to go through CommandList::AliasImage().
+        inline ImageMemoryRequirements GetImageMemoryRequirements(const ImageSpecification& specs) const { return m_Impl->GetImageMemoryRequirements(specs); }
+        inline ImageHeap CreateImageHeap(const ImageHeapSpecification& specs) const { return ImageHeap(*this, specs); }
+        inline void DestroyImageHeap(ImageHeap& heap) const { m_Impl->DestroyImageHeap(heap); } // Note: All images placed in the heap must be destroyed first
+        inline Image CreatePlacedImage(const ImageSpecification& specs, const ImageHeap& heap, size_t offset = 0) const { return Image(*this, specs, heap, offset); }
+
         inline StagingImage CreateStagingImage(const ImageSpecification& specs, CpuAccessMode cpuAccessMode = CpuAccessMode::None) const { return StagingImage(*this, specs, cpuAccessMode); }
         inline void DestroyStagingImage(StagingImage& image) const { m_Impl->DestroyStagingImage(image); }
-        inline Sampler CreateSampler(const SamplerSpecification& specs) const { return Sampler(*this, specs); }
+        inline Sampler CreateSampler(const SamplerSpecification& specs) const { return Sampler(*this, specs); } // Note: Identical specifications share one underlying sampler, every sampler must still be destroyed
         inline void DestroySampler(Sampler& sampler) const { m_Impl->DestroySampler(sampler); }
 
         inline Buffer CreateBuffer(const BufferSpecification& specs) const { return Buffer(*this, specs); }
@@ -96,6 +123,12 @@ namespace Obsidian
         inline ComputePipeline CreateComputePipeline(const ComputePipelineSpecification& specs) const { return ComputePipeline(*this, specs); }
         inline void DestroyComputePipeline(ComputePipeline& pipeline) const { m_Impl->DestroyComputePipeline(pipeline); }
 
+        inline QueryPool CreateQueryPool(const QueryPoolSpecification& specs) const { return QueryPool(*this, specs); }
+        inline void DestroyQueryPool(QueryPool& pool) const { m_Impl->DestroyQueryPool(pool); }
+
+        inline UploadManager CreateUploadManager(const UploadManagerSpecification& specs = {}) const { return UploadManager(*this, specs); }
+        inline void DestroyUploadManager(UploadManager& manager) const { m_Impl->DestroyUploadManager(manager); } // Note: Flushes and waits on all remaining uploads
+
     private:
         Internal::APIObject<Type> m_Impl = {};
 
@@ -20,19 +20,28 @@ namespace Obsidian
     struct DeviceSpecification
     {
     public:
-        void* NativeWindow = nullptr; // Note: Just creating a device with one window is fine, the device can be used across all created windows.
+        void* NativeWindow = nullptr; // Note: Just creating a device with one window is fine, the device can be used across all created windows, leaving this as nullptr creates a headless device (no swapchains, offscreen/compute only).
         
         DeviceMessageCallback MessageCallback = nullptr;
         DeviceDestroyCallback DestroyCallback = nullptr; // Note: Functions should be stored in a queue and executed at the end/begin of a frame to allow for finishing of resource usage.
 
         std::span<const char*> Extensions = {}; // Vulkan specific (SwapChain and MacOS related extensions included by default)
 
+        std::span<const uint8_t> PipelineCacheData = {}; // Note: Data previously retrieved with Device::GetPipelineCacheData(), gets discarded if it was created by a different device/driver.
+
+        bool DescriptorBuffers = false; // Vulkan specific, BindingSets get written straight into GPU memory when VK_EXT_descriptor_buffer is supported. // Note: Dynamic buffer types can't be used when it's active.
+
     public:
         // Setters
         inline constexpr DeviceSpecification& SetNativeWindow(void* nativeWindow) { NativeWindow = nativeWindow; return *this; }
         inline DeviceSpecification& SetMessageCallback(DeviceMessageCallback messageCallback) { MessageCallback = messageCallback; return *this; }
         inline DeviceSpecification& SetDestroyCallback(DeviceDestroyCallback destroyCallback) { DestroyCallback = destroyCallback; return *this; }
         inline constexpr DeviceSpecification& SetExtensions(std::span<const char*> extensions) { Extensions = extensions; return *this; }
+        inline constexpr DeviceSpecification& SetPipelineCacheData(std::span<const uint8_t> data) { PipelineCacheData = data; return *this; }
+        inline constexpr DeviceSpecification& SetDescriptorBuffers(bool enabled) { DescriptorBuffers = enabled; return *this; }
+
+        // Getters
+        inline constexpr bool IsHeadless() const { return (NativeWindow == nullptr); }
     };
 
 }
\ No newline at end of file
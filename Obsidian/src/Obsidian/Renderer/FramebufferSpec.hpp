@@ -1,7 +1,11 @@
 #pragma once
 
+#include "Obsidian/Core/Information.hpp"
+
 #include "Obsidian/Renderer/ImageSpec.hpp"
 
+#include <Nano/Nano.hpp>
+
 #include <cstdint>
 #include <string>
 
@@ -37,23 +41,35 @@ namespace Obsidian
     ////////////////////////////////////////////////////////////////////////////////////
     // FramebufferSpecification
     ////////////////////////////////////////////////////////////////////////////////////
-    class FramebufferSpecification // Note: We currently only support 1 colour attachment since that is most used, adding support for more is very simple though
+    class FramebufferSpecification
     {
     public:
-        FramebufferAttachment ColourAttachment = {};
+        Nano::Memory::StaticVector<FramebufferAttachment, Information::MaxColourAttachments> ColourAttachments = {};
+        Nano::Memory::StaticVector<FramebufferAttachment, Information::MaxColourAttachments> ResolveAttachments = {}; // Note: Matched by index to ColourAttachments, only required for attachments the renderpass resolves
         FramebufferAttachment DepthAttachment = {};
 
         std::string DebugName = {};
 
     public:
         // Setters
-        inline constexpr FramebufferSpecification& SetColourAttachment(Image& image) { ColourAttachment.ImagePtr = &image; return *this; }
-        inline constexpr FramebufferSpecification& SetColourAttachment(Image& image, const ImageSubresourceSpecification& specs) { ColourAttachment.ImagePtr = &image; ColourAttachment.Subresources = specs; return *this; }
-        inline constexpr FramebufferSpecification& SetColourAttachment(const FramebufferAttachment& attachment) { ColourAttachment = attachment; return *this; }
+        inline FramebufferSpecification& AddColourAttachment(const FramebufferAttachment& attachment) { ColourAttachments.push_back(attachment); return *this; }
+        inline FramebufferSpecification& SetResolveAttachment(uint32_t index, const FramebufferAttachment& attachment) { while (ResolveAttachments.size() <= index) ResolveAttachments.emplace_back(); ResolveAttachments[index] = attachment; return *this; }
+
+        // Note: The SetColourAttachment setters apply to the first colour attachment
+        inline FramebufferSpecification& SetColourAttachment(Image& image) { GetFirstColourAttachment().ImagePtr = &image; return *this; }
+        inline FramebufferSpecification& SetColourAttachment(Image& image, const ImageSubresourceSpecification& specs) { GetFirstColourAttachment().ImagePtr = &image; GetFirstColourAttachment().Subresources = specs; return *this; }
+        inline FramebufferSpecification& SetColourAttachment(const FramebufferAttachment& attachment) { GetFirstColourAttachment() = attachment; return *this; }
         inline constexpr FramebufferSpecification& SetDepthAttachment(Image& image) { DepthAttachment.ImagePtr = &image; return *this; }
         inline constexpr FramebufferSpecification& SetDepthAttachment(Image& image, const ImageSubresourceSpecification& specs) { DepthAttachment.ImagePtr = &image; DepthAttachment.Subresources = specs; return *this; }
         inline constexpr FramebufferSpecification& SetDepthAttachment(const FramebufferAttachment& attachment) { DepthAttachment = attachment; return *this; }
         inline FramebufferSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
+
+        // Getters
+        inline bool HasResolveAttachment(uint32_t index) const { return ((index < ResolveAttachments.size()) && ResolveAttachments[index].IsValid()); }
+
+    private:
+        // Private methods
+        inline FramebufferAttachment& GetFirstColourAttachment() { if (ColourAttachments.empty()) ColourAttachments.emplace_back(); return ColourAttachments[0]; }
     };
 
 }
\ No newline at end of file
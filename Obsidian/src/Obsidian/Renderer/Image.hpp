@@ -22,6 +22,36 @@ namespace Obsidian
 
     class Device;
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ImageHeap
+    ////////////////////////////////////////////////////////////////////////////////////
+    class ImageHeap
+    {
+    public:
+        using Type = Nano::Types::SelectorType<Information::RenderingAPI,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Vulkan, Internal::VulkanImageHeap>,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Dx12, Internal::Dx12ImageHeap>,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Metal, Internal::DummyImageHeap>,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Dummy, Internal::DummyImageHeap>
+        >;
+    public:
+        // Destructor
+        ~ImageHeap() = default;
+
+        // Getters
+        inline const ImageHeapSpecification& GetSpecification() const { return m_Impl->GetSpecification(); }
+
+    public: //private:
+        // Constructor 
+        inline ImageHeap(const Device& device, const ImageHeapSpecification& specs) { m_Impl.Construct(device, specs); }
+
+    private:
+        Internal::APIObject<Type> m_Impl = {};
+
+        friend class Device;
+        friend class APICaster;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Image
     ////////////////////////////////////////////////////////////////////////////////////
@@ -47,6 +77,7 @@ namespace Obsidian
     public: //private:
         // Constructor 
         inline Image(const Device& device, const ImageSpecification& specs) { m_Impl.Construct(device, specs); }
+        inline Image(const Device& device, const ImageSpecification& specs, const ImageHeap& heap, size_t offset) { m_Impl.Construct(device, specs, heap, offset); }
 
     private:
 #if defined(OB_API_VULKAN) || defined(OB_API_DX12)
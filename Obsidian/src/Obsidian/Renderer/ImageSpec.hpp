@@ -320,6 +320,58 @@ namespace Obsidian
         inline constexpr ImageSliceSpecification& SetArraySlice(ArraySlice slice) { ImageArraySlice = slice; return *this; }
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ImageMemoryRequirements
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct ImageMemoryRequirements
+    {
+    public:
+        size_t Size = 0;
+        size_t Alignment = 0;
+
+        uint32_t MemoryTypeBits = 0; // Note: Images can only share a heap when their bits overlap
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ImageBufferLayout // Note: How an image slice is laid out in a Buffer by CommandList::CopyImage(Buffer&, ...),
+    // rows are padded to RowPitchAlignment and the buffer offset must be a multiple of OffsetAlignment (D3D12's copy rules).
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct ImageBufferLayout
+    {
+    public:
+        inline constexpr static size_t RowPitchAlignment = 256ull;
+        inline constexpr static size_t OffsetAlignment = 512ull;
+    public:
+        size_t RowPitch = 0; // Note: Bytes between the start of 2 rows (of blocks for compressed formats)
+        uint32_t RowCount = 0;
+        size_t DepthPitch = 0; // Note: Bytes between the start of 2 depth slices
+        uint32_t Depth = 0;
+
+        size_t Size = 0; // Note: Bytes the copy occupies in the buffer
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ImageHeapSpecification // Note: A single block of device memory that images can be placed (and aliased) in.
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct ImageHeapSpecification
+    {
+    public:
+        size_t Size = 0;
+        size_t Alignment = 0;
+
+        uint32_t MemoryTypeBits = 0; // Note: The (combined) bits of the images that will be placed in the heap
+
+        std::string DebugName = {};
+
+    public:
+        // Setters
+        inline constexpr ImageHeapSpecification& SetSize(size_t size) { Size = size; return *this; }
+        inline constexpr ImageHeapSpecification& SetAlignment(size_t alignment) { Alignment = alignment; return *this; }
+        inline constexpr ImageHeapSpecification& SetMemoryTypeBits(uint32_t bits) { MemoryTypeBits = bits; return *this; }
+        inline constexpr ImageHeapSpecification& SetMemoryRequirements(const ImageMemoryRequirements& requirements) { Size = requirements.Size; Alignment = requirements.Alignment; MemoryTypeBits = requirements.MemoryTypeBits; return *this; }
+        inline ImageHeapSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
     // SamplerSpecification
     ////////////////////////////////////////////////////////////////////////////////////
@@ -362,6 +414,9 @@ namespace Obsidian
         inline constexpr SamplerSpecification& SetReductionType(SamplerReductionType type) { ReductionType = type; return *this; }
         inline SamplerSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
 
+        // Operators // Note: The debug name is ignored, samplers that only differ by name are shared
+        inline constexpr bool operator == (const SamplerSpecification& other) const { return ((BorderColour == other.BorderColour) && (MaxAnisotropy == other.MaxAnisotropy) && (MipBias == other.MipBias) && (MinFilter == other.MinFilter) && (MagFilter == other.MagFilter) && (MipFilter == other.MipFilter) && (AddressU == other.AddressU) && (AddressV == other.AddressV) && (AddressW == other.AddressW) && (ReductionType == other.ReductionType)); }
+        inline constexpr bool operator != (const SamplerSpecification& other) const { return !(*this == other); }
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,254 @@
+#include "obpch.h"
+#include "MipGenerator.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+#include "Obsidian/Renderer/Image.hpp"
+#include "Obsidian/Renderer/Shader.hpp"
+#include "Obsidian/Renderer/CommandList.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+namespace Obsidian
+{
+
+    namespace
+    {
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Shader
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Note: Every thread averages a 2x2 quad of the source into the first mip, the results stay in groupshared
+        // memory and every next level halves the active threads. IMAGE_FORMAT gets defined per format.
+        inline constexpr std::string_view s_DownsampleShader = R"(
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout(push_constant) uniform Settings // set = 0, binding = 0
+{
+    uint MipCount;
+} u_Settings;
+
+layout(set = 0, binding = 1, IMAGE_FORMAT) uniform readonly image2D u_Source;
+layout(set = 0, binding = 2, IMAGE_FORMAT) uniform writeonly image2D u_Mip1;
+layout(set = 0, binding = 3, IMAGE_FORMAT) uniform writeonly image2D u_Mip2;
+layout(set = 0, binding = 4, IMAGE_FORMAT) uniform writeonly image2D u_Mip3;
+layout(set = 0, binding = 5, IMAGE_FORMAT) uniform writeonly image2D u_Mip4;
+
+shared vec4 s_Tile[8][8];
+
+vec4 LoadSource(ivec2 coord)
+{
+    return imageLoad(u_Source, min(coord, imageSize(u_Source) - ivec2(1)));
+}
+
+void StoreMip(uint level, ivec2 coord, vec4 value)
+{
+    if (level == 0 && all(lessThan(coord, imageSize(u_Mip1)))) imageStore(u_Mip1, coord, value);
+    else if (level == 1 && all(lessThan(coord, imageSize(u_Mip2)))) imageStore(u_Mip2, coord, value);
+    else if (level == 2 && all(lessThan(coord, imageSize(u_Mip3)))) imageStore(u_Mip3, coord, value);
+    else if (level == 3 && all(lessThan(coord, imageSize(u_Mip4)))) imageStore(u_Mip4, coord, value);
+}
+
+void main()
+{
+    ivec2 local = ivec2(gl_LocalInvocationID.xy);
+    ivec2 group = ivec2(gl_WorkGroupID.xy);
+
+    ivec2 coord = group * 8 + local;
+    vec4 value = (LoadSource(coord * 2) + LoadSource(coord * 2 + ivec2(1, 0)) + LoadSource(coord * 2 + ivec2(0, 1)) + LoadSource(coord * 2 + ivec2(1, 1))) * 0.25;
+
+    StoreMip(0, coord, value);
+    s_Tile[local.y][local.x] = value;
+
+    for (uint level = 1; level < u_Settings.MipCount; level++)
+    {
+        int size = 8 >> level;
+        bool active = all(lessThan(local, ivec2(size)));
+
+        memoryBarrierShared();
+        barrier();
+
+        if (active)
+            value = (s_Tile[local.y * 2][local.x * 2] + s_Tile[local.y * 2][local.x * 2 + 1] + s_Tile[local.y * 2 + 1][local.x * 2] + s_Tile[local.y * 2 + 1][local.x * 2 + 1]) * 0.25;
+
+        memoryBarrierShared();
+        barrier();
+
+        if (active)
+        {
+            s_Tile[local.y][local.x] = value;
+            StoreMip(level, group * size + local, value);
+        }
+    }
+}
+)";
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Helper methods
+        ////////////////////////////////////////////////////////////////////////////////////
+        std::string_view FormatToGLSLImageFormat(Format format) // Note: Returns an empty string for formats that can't be used as a float storage image
+        {
+            switch (format)
+            {
+            case Format::R8Unorm:           return "r8";
+            case Format::R8Snorm:           return "r8_snorm";
+            case Format::RG8Unorm:          return "rg8";
+            case Format::RG8Snorm:          return "rg8_snorm";
+            case Format::R16Unorm:          return "r16";
+            case Format::R16Snorm:          return "r16_snorm";
+            case Format::R16Float:          return "r16f";
+            case Format::RGBA8Unorm:        return "rgba8";
+            case Format::RGBA8Snorm:        return "rgba8_snorm";
+            case Format::R10G10B10A2Unorm:  return "rgb10_a2";
+            case Format::R11G11B10Float:    return "r11f_g11f_b10f";
+            case Format::RG16Unorm:         return "rg16";
+            case Format::RG16Snorm:         return "rg16_snorm";
+            case Format::RG16Float:         return "rg16f";
+            case Format::R32Float:          return "r32f";
+            case Format::RGBA16Float:       return "rgba16f";
+            case Format::RGBA16Unorm:       return "rgba16";
+            case Format::RGBA16Snorm:       return "rgba16_snorm";
+            case Format::RG32Float:         return "rg32f";
+            case Format::RGBA32Float:       return "rgba32f";
+
+            default:
+                break;
+            }
+
+            return {};
+        }
+
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    MipGenerator::MipGenerator(const Device& device)
+        : m_Device(device), m_Layout(device.CreateBindingLayout(BindingLayoutSpecification()
+            .SetRegisterSpace(0)
+            .AddItem(BindingLayoutItem().SetSlot(0).SetVisibility(ShaderStage::Compute).SetType(ResourceType::PushConstants).SetSize(sizeof(uint32_t)).SetDebugName("u_Settings"))
+            .AddItem(BindingLayoutItem().SetSlot(1).SetVisibility(ShaderStage::Compute).SetType(ResourceType::ImageUnordered).SetDebugName("u_Source"))
+            .AddItem(BindingLayoutItem().SetSlot(2).SetVisibility(ShaderStage::Compute).SetType(ResourceType::ImageUnordered).SetDebugName("u_Mip1"))
+            .AddItem(BindingLayoutItem().SetSlot(3).SetVisibility(ShaderStage::Compute).SetType(ResourceType::ImageUnordered).SetDebugName("u_Mip2"))
+            .AddItem(BindingLayoutItem().SetSlot(4).SetVisibility(ShaderStage::Compute).SetType(ResourceType::ImageUnordered).SetDebugName("u_Mip3"))
+            .AddItem(BindingLayoutItem().SetSlot(5).SetVisibility(ShaderStage::Compute).SetType(ResourceType::ImageUnordered).SetDebugName("u_Mip4"))
+            .SetDebugName("MipGenerator Layout")
+        ))
+    {
+    }
+
+    MipGenerator::~MipGenerator()
+    {
+        for (FormatPipeline& pipeline : m_Pipelines)
+            m_Device.DestroyComputePipeline(pipeline.Pipeline);
+
+        m_Device.DestroyBindingLayout(m_Layout);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void MipGenerator::Generate(CommandList& list, Image& image, const ImageSubresourceSpecification& subresources)
+    {
+        OB_PROFILE("MipGenerator::Generate()");
+
+        const ImageSpecification& imageSpec = image.GetSpecification();
+        OB_ASSERT((imageSpec.Dimension == ImageDimension::Image2D), "[MipGenerator] Only Image2D's are supported.");
+        OB_ASSERT(imageSpec.IsUnorderedAccessed, "[MipGenerator] Image must be created with IsUnorderedAccessed.");
+        OB_ASSERT(IsFormatSupported(imageSpec.ImageFormat), "[MipGenerator] Image format {0} can't be used as a float storage image.", static_cast<uint32_t>(imageSpec.ImageFormat));
+
+        ImageSubresourceSpecification resSubresources = Internal::ResolveImageSubresource(subresources, imageSpec, false);
+        if (resSubresources.NumMipLevels <= 1)
+            return;
+
+        const uint32_t mipsToGenerate = resSubresources.NumMipLevels - 1;
+        const uint32_t dispatchCount = (mipsToGenerate + MaxMipsPerDispatch - 1) / MaxMipsPerDispatch;
+
+        ComputePipeline& pipeline = GetPipeline(imageSpec.ImageFormat);
+
+        // Note: The sets only live for this call, the pool gets freed through the device's destroy callback once the GPU is done
+        BindingSetPool pool = m_Device.AllocateBindingSetPool(BindingSetPoolSpecification()
+            .SetLayout(m_Layout)
+            .SetSetAmount(dispatchCount * resSubresources.NumArraySlices)
+            .SetDebugName("MipGenerator Pool")
+        );
+
+        list.BindPipeline(pipeline);
+
+        for (ArraySlice slice = resSubresources.BaseArraySlice; slice < resSubresources.BaseArraySlice + resSubresources.NumArraySlices; slice++)
+        {
+            for (MipLevel source = resSubresources.BaseMipLevel; source < resSubresources.BaseMipLevel + mipsToGenerate; source += MaxMipsPerDispatch)
+            {
+                const uint32_t mipCount = std::min(MaxMipsPerDispatch, (resSubresources.BaseMipLevel + mipsToGenerate) - source);
+
+                BindingSet set = pool.CreateBindingSet(BindingSetSpecification());
+                set.SetItem(1, image, ImageSubresourceSpecification(source, 1, slice, 1));
+                for (uint32_t i = 0; i < MaxMipsPerDispatch; i++) // Note: Unused slots point at the last generated mip, the shader doesn't write to them
+                    set.SetItem(2 + i, image, ImageSubresourceSpecification(source + 1 + std::min(i, mipCount - 1), 1, slice, 1));
+
+                // Note: The previous dispatch wrote the source, staying in UnorderedAccess places a UAV barrier
+                list.RequireState(image, ImageSubresourceSpecification(source, mipCount + 1, slice, 1), ResourceState::UnorderedAccess);
+                list.CommitBarriers();
+
+                list.BindBindingSet(set);
+                list.PushConstants(&mipCount, sizeof(uint32_t));
+
+                const uint32_t width = std::max(imageSpec.Width >> (source + 1), 1u);
+                const uint32_t height = std::max(imageSpec.Height >> (source + 1), 1u);
+                list.Dispatch((width + GroupSize - 1) / GroupSize, (height + GroupSize - 1) / GroupSize, 1);
+            }
+        }
+
+        m_Device.FreeBindingSetPool(pool);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    bool MipGenerator::IsFormatSupported(Format format)
+    {
+        return !FormatToGLSLImageFormat(format).empty();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    ComputePipeline& MipGenerator::GetPipeline(Format format)
+    {
+        std::scoped_lock lock(m_PipelinesMutex);
+
+        for (FormatPipeline& pipeline : m_Pipelines)
+        {
+            if (pipeline.ImageFormat == format)
+                return pipeline.Pipeline;
+        }
+
+        OB_PROFILE("MipGenerator::GetPipeline::Compile");
+
+        std::string code = "#version 460 core\n#define IMAGE_FORMAT " + std::string(FormatToGLSLImageFormat(format)) + "\n" + std::string(s_DownsampleShader);
+
+        ShaderCompiler compiler;
+        std::vector<uint32_t> spirv = compiler.CompileToSPIRV(ShaderStage::Compute, code, "main", ShadingLanguage::GLSL);
+
+        Shader shader = m_Device.CreateShader(ShaderSpecification()
+            .SetShaderStage(ShaderStage::Compute)
+            .SetMainName("main")
+            .SetSPIRV(spirv)
+            .SetPushConstantsInfo(0, 0, sizeof(uint32_t))
+            .SetDebugName("MipGenerator Shader")
+        );
+
+        FormatPipeline& pipeline = m_Pipelines.emplace_back(m_Device, format, ComputePipelineSpecification()
+            .SetComputeShader(shader)
+            .AddBindingLayout(m_Layout)
+            .SetDebugName("MipGenerator Pipeline")
+        );
+
+        m_Device.DestroyShader(shader);
+        return pipeline.Pipeline;
+    }
+
+}
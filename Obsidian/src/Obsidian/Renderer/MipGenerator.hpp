@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/API.hpp"
+#include "Obsidian/Renderer/ImageSpec.hpp"
+#include "Obsidian/Renderer/Bindings.hpp"
+#include "Obsidian/Renderer/Pipeline.hpp"
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+
+namespace Obsidian
+{
+
+    class Device;
+    class Image;
+    class CommandList;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // MipGenerator // Note: Compute downsampler, every dispatch box filters up to MaxMipsPerDispatch levels
+    // through groupshared memory, so a full chain of an NxN image only takes ceil(log2(N) / 4) dispatches.
+    // Works on Image2D's with a UAV capable (float/normalized) format, created with IsUnorderedAccessed.
+    ////////////////////////////////////////////////////////////////////////////////////
+    class MipGenerator
+    {
+    public:
+        inline constexpr static uint32_t MaxMipsPerDispatch = 4;
+        inline constexpr static uint32_t GroupSize = 8;
+    public:
+        // Constructor & Destructor
+        MipGenerator(const Device& device);
+        ~MipGenerator();
+
+        // Methods
+        // Note: Fills the mips of subresources after BaseMipLevel, the BaseMipLevel must already contain the image.
+        // The pipeline for a format gets compiled on first use, leaving the mips in ResourceState::UnorderedAccess.
+        void Generate(CommandList& list, Image& image, const ImageSubresourceSpecification& subresources = ImageSubresourceSpecification());
+
+        // Getters
+        static bool IsFormatSupported(Format format);
+
+    private:
+        struct FormatPipeline
+        {
+        public:
+            Format ImageFormat;
+            ComputePipeline Pipeline;
+
+        public:
+            inline FormatPipeline(const Device& device, Format format, const ComputePipelineSpecification& specs)
+                : ImageFormat(format), Pipeline(device, specs) {}
+        };
+
+    private:
+        // Private methods
+        ComputePipeline& GetPipeline(Format format);
+
+    private:
+        const Device& m_Device;
+
+        BindingLayout m_Layout;
+
+        std::mutex m_PipelinesMutex = {};
+        std::list<FormatPipeline> m_Pipelines = { }; // Note: std::list since pipelines can't be moved
+    };
+
+}
@@ -0,0 +1,163 @@
+#include "obpch.h"
+#include "PipelineCompiler.hpp"
+
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+
+#include <algorithm>
+
+namespace Obsidian
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    PipelineCompiler::PipelineCompiler(const Device& device, const PipelineCompilerSpecification& specs)
+        : m_Device(device), m_Specification(specs)
+    {
+        const uint32_t threadCount = ((m_Specification.ThreadCount != 0) ? m_Specification.ThreadCount : std::max(std::thread::hardware_concurrency() / 2, 1u));
+
+        m_Workers.reserve(threadCount);
+        for (uint32_t i = 0; i < threadCount; i++)
+            m_Workers.emplace_back([this]() { WorkerThread(); });
+    }
+
+    PipelineCompiler::~PipelineCompiler()
+    {
+        {
+            std::scoped_lock lock(m_Mutex);
+            m_Stopping = true;
+        }
+        m_QueueCondition.notify_all();
+
+        for (std::thread& worker : m_Workers)
+            worker.join();
+
+        for (AsyncGraphicsPipeline& pipeline : m_GraphicsPipelines)
+            m_Device.DestroyGraphicsPipeline(pipeline.m_Pipeline.value());
+        for (AsyncComputePipeline& pipeline : m_ComputePipelines)
+            m_Device.DestroyComputePipeline(pipeline.m_Pipeline.value());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    AsyncGraphicsPipeline& PipelineCompiler::CreateGraphicsPipelineAsync(const GraphicsPipelineSpecification& specs, GraphicsPipeline* fallback)
+    {
+        AsyncGraphicsPipeline* pipeline = nullptr;
+        {
+            std::scoped_lock lock(m_Mutex);
+            pipeline = &m_GraphicsPipelines.emplace_back(fallback, specs.DebugName);
+        }
+
+        Enqueue([this, pipeline, specs]()
+        {
+            OB_PROFILE("PipelineCompiler::CreateGraphicsPipeline");
+
+            pipeline->m_Pipeline.emplace(m_Device, specs);
+            pipeline->m_Ready.store(true, std::memory_order_release);
+            pipeline->m_Ready.notify_all();
+        });
+
+        return *pipeline;
+    }
+
+    AsyncComputePipeline& PipelineCompiler::CreateComputePipelineAsync(const ComputePipelineSpecification& specs, ComputePipeline* fallback)
+    {
+        AsyncComputePipeline* pipeline = nullptr;
+        {
+            std::scoped_lock lock(m_Mutex);
+            pipeline = &m_ComputePipelines.emplace_back(fallback, specs.DebugName);
+        }
+
+        Enqueue([this, pipeline, specs]()
+        {
+            OB_PROFILE("PipelineCompiler::CreateComputePipeline");
+
+            pipeline->m_Pipeline.emplace(m_Device, specs);
+            pipeline->m_Ready.store(true, std::memory_order_release);
+            pipeline->m_Ready.notify_all();
+        });
+
+        return *pipeline;
+    }
+
+    void PipelineCompiler::DestroyPipeline(AsyncGraphicsPipeline& pipeline)
+    {
+        pipeline.Wait();
+        m_Device.DestroyGraphicsPipeline(pipeline.m_Pipeline.value());
+
+        std::scoped_lock lock(m_Mutex);
+        m_GraphicsPipelines.remove_if([&](const AsyncGraphicsPipeline& current) { return (&current == &pipeline); });
+    }
+
+    void PipelineCompiler::DestroyPipeline(AsyncComputePipeline& pipeline)
+    {
+        pipeline.Wait();
+        m_Device.DestroyComputePipeline(pipeline.m_Pipeline.value());
+
+        std::scoped_lock lock(m_Mutex);
+        m_ComputePipelines.remove_if([&](const AsyncComputePipeline& current) { return (&current == &pipeline); });
+    }
+
+    void PipelineCompiler::WaitIdle()
+    {
+        OB_PROFILE("PipelineCompiler::WaitIdle()");
+
+        std::unique_lock lock(m_Mutex);
+        m_IdleCondition.wait(lock, [this]() { return (m_Pending == 0); });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    size_t PipelineCompiler::GetPendingCount() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_Pending;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void PipelineCompiler::Enqueue(std::function<void()> task)
+    {
+        {
+            std::scoped_lock lock(m_Mutex);
+            m_Queue.push_back(std::move(task));
+            m_Pending++;
+        }
+        m_QueueCondition.notify_one();
+    }
+
+    void PipelineCompiler::WorkerThread()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(m_Mutex);
+                m_QueueCondition.wait(lock, [this]() { return (m_Stopping || !m_Queue.empty()); });
+
+                if (m_Queue.empty()) // Note: Only empty when stopping, remaining pipelines still get created first
+                    return;
+
+                task = std::move(m_Queue.front());
+                m_Queue.pop_front();
+            }
+
+            task();
+
+            bool idle = false;
+            {
+                std::scoped_lock lock(m_Mutex);
+                idle = (--m_Pending == 0);
+            }
+
+            if (idle)
+                m_IdleCondition.notify_all();
+        }
+    }
+
+}
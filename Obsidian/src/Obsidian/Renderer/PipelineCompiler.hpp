@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+#include "Obsidian/Core/Logging.hpp"
+
+#include "Obsidian/Renderer/Pipeline.hpp"
+#include "Obsidian/Renderer/PipelineSpec.hpp"
+
+#include <cstdint>
+#include <list>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <optional>
+#include <functional>
+#include <condition_variable>
+
+namespace Obsidian
+{
+
+    class Device;
+    class PipelineCompiler;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // AsyncPipeline // Note: Handle to a pipeline that's being created on a background thread.
+    // Until it's ready Get() returns the fallback pipeline (if one was provided).
+    ////////////////////////////////////////////////////////////////////////////////////
+    template<typename TPipeline>
+    class AsyncPipeline
+    {
+    public:
+        // Getters
+        inline bool IsReady() const { return m_Ready.load(std::memory_order_acquire); }
+        inline bool HasFallback() const { return (m_Fallback != nullptr); }
+
+        inline TPipeline& Get() // Note: Returns the fallback while the pipeline isn't ready yet
+        {
+            if (IsReady())
+                return m_Pipeline.value();
+
+            OB_ASSERT(HasFallback(), "[AsyncPipeline] Pipeline {0} isn't ready yet and has no fallback, check IsReady() or call Wait().", m_DebugName);
+            return *m_Fallback;
+        }
+        inline TPipeline* TryGet() { return (IsReady() ? &m_Pipeline.value() : m_Fallback); } // Note: Returns nullptr when not ready without a fallback
+
+        inline void Wait() const { m_Ready.wait(false, std::memory_order_acquire); }
+
+    public: //private:
+        // Constructor
+        inline AsyncPipeline(TPipeline* fallback, const std::string& debugName)
+            : m_Fallback(fallback), m_DebugName(debugName) {}
+
+    private:
+        std::optional<TPipeline> m_Pipeline = std::nullopt; // Note: Only written by the worker before m_Ready is set
+        TPipeline* m_Fallback = nullptr;
+
+        std::atomic<bool> m_Ready = false;
+        std::string m_DebugName;
+
+        friend class PipelineCompiler;
+    };
+
+    using AsyncGraphicsPipeline = AsyncPipeline<GraphicsPipeline>;
+    using AsyncComputePipeline = AsyncPipeline<ComputePipeline>;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // PipelineCompiler // Note: Creates pipelines on a pool of worker threads, so the render
+    // thread never blocks on the driver's shader compilation. All backends share the device's
+    // internally synchronized pipeline cache.
+    ////////////////////////////////////////////////////////////////////////////////////
+    class PipelineCompiler
+    {
+    public:
+        // Constructor & Destructor
+        PipelineCompiler(const Device& device, const PipelineCompilerSpecification& specs = PipelineCompilerSpecification());
+        ~PipelineCompiler(); // Note: Finishes all queued pipelines and destroys every pipeline created through it
+
+        // Methods // Note: Everything referenced by specs (shaders, layouts, renderpass, fallback) must stay alive until the pipeline is ready. Thread safe.
+        AsyncGraphicsPipeline& CreateGraphicsPipelineAsync(const GraphicsPipelineSpecification& specs, GraphicsPipeline* fallback = nullptr);
+        AsyncComputePipeline& CreateComputePipelineAsync(const ComputePipelineSpecification& specs, ComputePipeline* fallback = nullptr);
+
+        void DestroyPipeline(AsyncGraphicsPipeline& pipeline); // Note: Waits for the pipeline to be ready
+        void DestroyPipeline(AsyncComputePipeline& pipeline); // Note: Waits for the pipeline to be ready
+
+        void WaitIdle(); // Note: Blocks until every queued pipeline has been created
+
+        // Getters
+        inline const PipelineCompilerSpecification& GetSpecification() const { return m_Specification; }
+
+        size_t GetPendingCount() const;
+
+    private:
+        // Private methods
+        void Enqueue(std::function<void()> task);
+        void WorkerThread();
+
+    private:
+        const Device& m_Device;
+        PipelineCompilerSpecification m_Specification;
+
+        std::vector<std::thread> m_Workers = { };
+
+        mutable std::mutex m_Mutex = {};
+        std::condition_variable m_QueueCondition = {};
+        std::condition_variable m_IdleCondition = {};
+        std::deque<std::function<void()>> m_Queue = { };
+        size_t m_Pending = 0; // Note: Queued + currently being created
+        bool m_Stopping = false;
+
+        std::list<AsyncGraphicsPipeline> m_GraphicsPipelines = { }; // Note: std::list since the handles can't be moved
+        std::list<AsyncComputePipeline> m_ComputePipelines = { };
+    };
+
+}
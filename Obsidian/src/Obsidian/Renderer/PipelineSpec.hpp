@@ -5,6 +5,7 @@
 #include <Nano/Nano.hpp>
 
 #include <cstdint>
+#include <array>
 #include <string>
 
 namespace Obsidian
@@ -140,15 +141,29 @@ namespace Obsidian
             inline constexpr RenderTarget& SetDstBlendAlpha(BlendFactor factor) { DstBlendAlpha = factor; return *this; }
             inline constexpr RenderTarget& SetBlendOpAlpha(BlendOperation operation) { BlendOpAlpha = operation; return *this; }
             inline constexpr RenderTarget& SetColourWriteMask(ColourMask mask) { ColourWriteMask = mask; return *this; }
+
+            // Operators
+            inline constexpr bool operator == (const RenderTarget& other) const { return ((BlendEnable == other.BlendEnable) && (SrcBlend == other.SrcBlend) && (DstBlend == other.DstBlend) && (BlendOp == other.BlendOp) && (SrcBlendAlpha == other.SrcBlendAlpha) && (DstBlendAlpha == other.DstBlendAlpha) && (BlendOpAlpha == other.BlendOpAlpha) && (ColourWriteMask == other.ColourWriteMask)); }
+            inline constexpr bool operator != (const RenderTarget& other) const { return !(*this == other); }
         };
     public:
-        RenderTarget Target; // Note: At this moment we only support 1 Rendertarget
+        std::array<RenderTarget, Information::MaxColourAttachments> Targets = {};
+        bool IndependentBlendEnable = false; // Note: When disabled, the first target is used for every colour attachment
         bool AlphaToCoverageEnable = false;
 
     public:
         // Setters
-        inline constexpr BlendState& SetRenderTarget(const RenderTarget& target) { Target = target; return *this; }
+        inline constexpr BlendState& SetRenderTarget(const RenderTarget& target) { Targets[0] = target; return *this; }
+        inline constexpr BlendState& SetRenderTarget(uint32_t index, const RenderTarget& target) { Targets[index] = target; IndependentBlendEnable = true; return *this; }
+        inline constexpr BlendState& SetIndependentBlendEnable(bool enabled) { IndependentBlendEnable = enabled; return *this; }
         inline constexpr BlendState& SetAlphaToCoverageEnable(bool enabled) { AlphaToCoverageEnable = enabled; return *this; }
+
+        // Operators
+        inline constexpr bool operator == (const BlendState& other) const { return ((Targets == other.Targets) && (IndependentBlendEnable == other.IndependentBlendEnable) && (AlphaToCoverageEnable == other.AlphaToCoverageEnable)); }
+        inline constexpr bool operator != (const BlendState& other) const { return !(*this == other); }
+
+        // Getters
+        inline constexpr const RenderTarget& GetRenderTarget(uint32_t index) const { return (IndependentBlendEnable ? Targets[index] : Targets[0]); }
     };
 
     struct RasterState
@@ -178,6 +193,10 @@ namespace Obsidian
         inline constexpr RasterState& SetDepthBias(int value) { DepthBias = value; return *this; }
         inline constexpr RasterState& SetDepthBiasClamp(float value) { DepthBiasClamp = value; return *this; }
         inline constexpr RasterState& SetSlopeScaleDepthBias(float value) { SlopeScaledDepthBias = value; return *this; }
+
+        // Operators
+        inline constexpr bool operator == (const RasterState& other) const { return ((FillMode == other.FillMode) && (CullingMode == other.CullingMode) && (FrontCounterClockwise == other.FrontCounterClockwise) && (DepthClipEnable == other.DepthClipEnable) && (ScissorEnable == other.ScissorEnable) && (MultisampleEnable == other.MultisampleEnable) && (AntialiasedLineEnable == other.AntialiasedLineEnable) && (DepthBias == other.DepthBias) && (DepthBiasClamp == other.DepthBiasClamp) && (SlopeScaledDepthBias == other.SlopeScaledDepthBias)); }
+        inline constexpr bool operator != (const RasterState& other) const { return !(*this == other); }
     };
 
     struct DepthStencilState
@@ -197,6 +216,10 @@ namespace Obsidian
             inline constexpr StencilOperationSpecification& SetDepthFailOp(StencilOperation operation) { DepthFailOp = operation; return *this; }
             inline constexpr StencilOperationSpecification& SetPassOp(StencilOperation operation) { PassOp = operation; return *this; }
             inline constexpr StencilOperationSpecification& SetStencilFunc(ComparisonFunc func) { StencilFunc = func; return *this; }
+
+            // Operators
+            inline constexpr bool operator == (const StencilOperationSpecification& other) const { return ((FailOp == other.FailOp) && (DepthFailOp == other.DepthFailOp) && (PassOp == other.PassOp) && (StencilFunc == other.StencilFunc)); }
+            inline constexpr bool operator != (const StencilOperationSpecification& other) const { return !(*this == other); }
         };
     public:
         bool DepthTestEnable = true;
@@ -222,6 +245,10 @@ namespace Obsidian
         inline constexpr DepthStencilState& SetFrontFaceStencil(const StencilOperationSpecification& specs) { FrontFaceStencil = specs; return *this; }
         inline constexpr DepthStencilState& SetBackFaceStencil(const StencilOperationSpecification& specs) { BackFaceStencil = specs; return *this; }
         inline constexpr DepthStencilState& SetDynamicStencilRef(bool enabled) { DynamicStencilRef = enabled; return *this; }
+
+        // Operators
+        inline constexpr bool operator == (const DepthStencilState& other) const { return ((DepthTestEnable == other.DepthTestEnable) && (DepthWriteEnable == other.DepthWriteEnable) && (DepthFunc == other.DepthFunc) && (StencilEnable == other.StencilEnable) && (StencilReadMask == other.StencilReadMask) && (StencilWriteMask == other.StencilWriteMask) && (StencilRefValue == other.StencilRefValue) && (DynamicStencilRef == other.DynamicStencilRef) && (FrontFaceStencil == other.FrontFaceStencil) && (BackFaceStencil == other.BackFaceStencil)); }
+        inline constexpr bool operator != (const DepthStencilState& other) const { return !(*this == other); }
     };
 
     struct RenderState
@@ -236,6 +263,10 @@ namespace Obsidian
         inline constexpr RenderState& SetBlendState(const BlendState& state) { Blend = state; return *this; }
         inline constexpr RenderState& SetDepthStencilState(const DepthStencilState& state) { DepthStencil = state; return *this; }
         inline constexpr RenderState& SetRasterState(const RasterState& state) { Raster = state; return *this; }
+
+        // Operators
+        inline constexpr bool operator == (const RenderState& other) const { return ((Blend == other.Blend) && (DepthStencil == other.DepthStencil) && (Raster == other.Raster)); }
+        inline constexpr bool operator != (const RenderState& other) const { return !(*this == other); }
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -260,6 +291,13 @@ namespace Obsidian
         RenderState RenderingState = {};
         Renderpass* Pass = nullptr;
 
+        // Note: Used for dynamic rendering (when no Renderpass is set), the pipeline
+        // can then be used with any attachments that match these formats & sample count.
+        Nano::Memory::StaticVector<Format, Information::MaxColourAttachments> ColourFormats = {};
+        Format DepthFormat = Format::Unknown;
+        uint32_t SampleCount = 1;
+        uint32_t SampleQuality = 0;
+
         Nano::Memory::StaticVector<BindingLayout*, MaxBindings> BindingLayouts = {};
 
         std::string DebugName = {};
@@ -283,6 +321,11 @@ namespace Obsidian
         inline constexpr GraphicsPipelineSpecification& SetRenderState(const RenderState& state) { RenderingState = state; return *this; }
         inline constexpr GraphicsPipelineSpecification& SetRenderpass(Renderpass& renderpass) { Pass = &renderpass; return *this; }
 
+        inline GraphicsPipelineSpecification& AddColourFormat(Format format) { ColourFormats.push_back(format); return *this; }
+        inline constexpr GraphicsPipelineSpecification& SetDepthFormat(Format format) { DepthFormat = format; return *this; }
+        inline constexpr GraphicsPipelineSpecification& SetSampleCount(uint32_t count) { SampleCount = count; return *this; }
+        inline constexpr GraphicsPipelineSpecification& SetSampleQuality(uint32_t quality) { SampleQuality = quality; return *this; }
+
         inline GraphicsPipelineSpecification& AddBindingLayout(BindingLayout& layout) { BindingLayouts.push_back(&layout); return *this; }
 
         inline GraphicsPipelineSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
@@ -296,13 +339,13 @@ namespace Obsidian
     public:
         inline constexpr static uint32_t MaxBindings = GraphicsPipelineSpecification::MaxBindings;
     public:
-        Shader* ComputeShader;
+        Shader* ComputeShader = nullptr;
 
         Nano::Memory::StaticVector<BindingLayout*, MaxBindings> BindingLayouts = {};
 
         std::string DebugName = {};
 
-    private:
+    public:
         // Setters
         inline constexpr ComputePipelineSpecification& SetComputeShader(Shader& shader) { ComputeShader = &shader; return *this; }
         
@@ -312,4 +355,21 @@ namespace Obsidian
 
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // PipelineCompilerSpecification
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct PipelineCompilerSpecification
+    {
+    public:
+        uint32_t ThreadCount = 0; // Note: 0 uses half of the hardware threads (at least 1)
+
+        std::string DebugName = {};
+
+    public:
+        // Setters
+        inline constexpr PipelineCompilerSpecification& SetThreadCount(uint32_t count) { ThreadCount = count; return *this; }
+
+        inline PipelineCompilerSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
+    };
+
 }
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include "obpch.h"
+#include "PipelineStateCache.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace Obsidian
+{
+
+    namespace
+    {
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Helper methods
+        ////////////////////////////////////////////////////////////////////////////////////
+        template<typename T>
+        inline size_t HashPointer(size_t hash, const T* pointer)
+        {
+            return Nano::Hash::Combine(hash, std::hash<const T*>{}(pointer));
+        }
+
+        inline size_t HashShader(const Shader* shader)
+        {
+            return ((shader) ? shader->GetCodeHash() : 0);
+        }
+
+        // Note: Shaders & the input layout are replaced by hashes of their contents, since the
+        // same addresses can be reused by different objects once the originals are destroyed.
+        // Only hashes the fields that usually differ, collisions get resolved by the full comparison.
+        template<typename TKey>
+        void MakeKey(TKey& key, const GraphicsPipelineSpecification& specs)
+        {
+            key.State = specs;
+            key.State.Input = nullptr;
+            key.State.VertexShader = nullptr;
+            key.State.TesselationControlShader = nullptr;
+            key.State.TesselationEvaluationShader = nullptr;
+            key.State.GeometryShader = nullptr;
+            key.State.FragmentShader = nullptr;
+            key.State.DebugName.clear();
+
+            key.ContentHashes = {
+                ((specs.Input) ? specs.Input->GetAttributesHash() : 0),
+                HashShader(specs.VertexShader),
+                HashShader(specs.TesselationControlShader),
+                HashShader(specs.TesselationEvaluationShader),
+                HashShader(specs.GeometryShader),
+                HashShader(specs.FragmentShader)
+            };
+
+            size_t hash = 0;
+            for (size_t contentHash : key.ContentHashes)
+                hash = Nano::Hash::Combine(hash, contentHash);
+            hash = HashPointer(hash, specs.Pass);
+            for (const BindingLayout* layout : specs.BindingLayouts)
+                hash = HashPointer(hash, layout);
+
+            hash = Nano::Hash::Combine(hash, std::hash<std::underlying_type_t<PrimitiveType>>{}(std::to_underlying(specs.Primitive)));
+            hash = Nano::Hash::Combine(hash, std::hash<std::underlying_type_t<RasterCullingMode>>{}(std::to_underlying(specs.RenderingState.Raster.CullingMode)));
+            hash = Nano::Hash::Combine(hash, std::hash<bool>{}(specs.RenderingState.Blend.Targets[0].BlendEnable));
+            hash = Nano::Hash::Combine(hash, std::hash<bool>{}(specs.RenderingState.DepthStencil.DepthWriteEnable));
+            key.Hash = hash;
+        }
+
+        template<typename TKey>
+        void MakeKey(TKey& key, const ComputePipelineSpecification& specs)
+        {
+            key.State = specs;
+            key.State.ComputeShader = nullptr;
+            key.State.DebugName.clear();
+
+            key.ContentHashes = { HashShader(specs.ComputeShader) };
+
+            size_t hash = key.ContentHashes[0];
+            for (const BindingLayout* layout : specs.BindingLayouts)
+                hash = HashPointer(hash, layout);
+
+            key.Hash = hash;
+        }
+
+        bool SameState(const GraphicsPipelineSpecification& a, const GraphicsPipelineSpecification& b) // Note: Only used on keys, so shaders, input & debug name are already cleared
+        {
+            return ((a.Primitive == b.Primitive) && (a.PatchPointCount == b.PatchPointCount) &&
+                (a.RenderingState == b.RenderingState) && (a.Pass == b.Pass) &&
+                std::ranges::equal(a.ColourFormats, b.ColourFormats) && (a.DepthFormat == b.DepthFormat) && (a.SampleCount == b.SampleCount) && (a.SampleQuality == b.SampleQuality) &&
+                std::ranges::equal(a.BindingLayouts, b.BindingLayouts));
+        }
+
+        bool SameState(const ComputePipelineSpecification& a, const ComputePipelineSpecification& b)
+        {
+            return std::ranges::equal(a.BindingLayouts, b.BindingLayouts);
+        }
+
+        template<typename TKey>
+        inline bool SameKey(const TKey& a, const TKey& b)
+        {
+            return ((a.Hash == b.Hash) && (a.ContentHashes == b.ContentHashes) && SameState(a.State, b.State));
+        }
+
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    PipelineStateCache::PipelineStateCache(const Device& device)
+        : m_Device(device)
+    {
+    }
+
+    PipelineStateCache::~PipelineStateCache()
+    {
+        for (CachedGraphicsPipeline& cached : m_GraphicsPipelines)
+            m_Device.DestroyGraphicsPipeline(cached.Pipeline);
+        for (CachedComputePipeline& cached : m_ComputePipelines)
+            m_Device.DestroyComputePipeline(cached.Pipeline);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    GraphicsPipeline& PipelineStateCache::Acquire(const GraphicsPipelineSpecification& specs)
+    {
+        PipelineKey<GraphicsPipelineSpecification> key = {};
+        MakeKey(key, specs);
+
+        std::scoped_lock lock(m_Mutex);
+
+        std::vector<CachedGraphicsPipeline*>& bucket = m_GraphicsLookup[key.Hash];
+        for (CachedGraphicsPipeline* cached : bucket)
+        {
+            if (SameKey(cached->Key, key))
+            {
+                cached->References++;
+                return cached->Pipeline;
+            }
+        }
+
+        OB_PROFILE("PipelineStateCache::Acquire::Create");
+
+        CachedGraphicsPipeline& cached = m_GraphicsPipelines.emplace_back(m_Device, specs, std::move(key));
+        bucket.push_back(&cached);
+        return cached.Pipeline;
+    }
+
+    ComputePipeline& PipelineStateCache::Acquire(const ComputePipelineSpecification& specs)
+    {
+        PipelineKey<ComputePipelineSpecification> key = {};
+        MakeKey(key, specs);
+
+        std::scoped_lock lock(m_Mutex);
+
+        std::vector<CachedComputePipeline*>& bucket = m_ComputeLookup[key.Hash];
+        for (CachedComputePipeline* cached : bucket)
+        {
+            if (SameKey(cached->Key, key))
+            {
+                cached->References++;
+                return cached->Pipeline;
+            }
+        }
+
+        OB_PROFILE("PipelineStateCache::Acquire::Create");
+
+        CachedComputePipeline& cached = m_ComputePipelines.emplace_back(m_Device, specs, std::move(key));
+        bucket.push_back(&cached);
+        return cached.Pipeline;
+    }
+
+    void PipelineStateCache::Release(GraphicsPipeline& pipeline)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        // Note: Found by address, the pipeline's own specification may point to destroyed shaders
+        auto owner = std::ranges::find_if(m_GraphicsPipelines, [&](const CachedGraphicsPipeline& cached) { return (&cached.Pipeline == &pipeline); });
+        OB_ASSERT((owner != m_GraphicsPipelines.end()), "[PipelineStateCache] Released a pipeline that isn't part of the cache.");
+        if (owner == m_GraphicsPipelines.end())
+            return;
+
+        if (--owner->References != 0)
+            return;
+
+        const size_t hash = owner->Key.Hash;
+        std::vector<CachedGraphicsPipeline*>& bucket = m_GraphicsLookup[hash];
+        std::erase(bucket, &(*owner));
+        if (bucket.empty())
+            m_GraphicsLookup.erase(hash);
+
+        m_Device.DestroyGraphicsPipeline(owner->Pipeline);
+        m_GraphicsPipelines.erase(owner);
+    }
+
+    void PipelineStateCache::Release(ComputePipeline& pipeline)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        // Note: Found by address, the pipeline's own specification may point to destroyed shaders
+        auto owner = std::ranges::find_if(m_ComputePipelines, [&](const CachedComputePipeline& cached) { return (&cached.Pipeline == &pipeline); });
+        OB_ASSERT((owner != m_ComputePipelines.end()), "[PipelineStateCache] Released a pipeline that isn't part of the cache.");
+        if (owner == m_ComputePipelines.end())
+            return;
+
+        if (--owner->References != 0)
+            return;
+
+        const size_t hash = owner->Key.Hash;
+        std::vector<CachedComputePipeline*>& bucket = m_ComputeLookup[hash];
+        std::erase(bucket, &(*owner));
+        if (bucket.empty())
+            m_ComputeLookup.erase(hash);
+
+        m_Device.DestroyComputePipeline(owner->Pipeline);
+        m_ComputePipelines.erase(owner);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    size_t PipelineStateCache::GetPipelineCount() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_GraphicsPipelines.size() + m_ComputePipelines.size();
+    }
+
+}
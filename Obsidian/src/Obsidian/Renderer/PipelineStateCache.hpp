@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/Pipeline.hpp"
+#include "Obsidian/Renderer/PipelineSpec.hpp"
+
+#include <cstdint>
+#include <array>
+#include <list>
+#include <mutex>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+
+namespace Obsidian
+{
+
+    class Device;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // PipelineStateCache // Note: Hands out one reference counted pipeline per unique
+    // specification, identical specifications (e.g. from different materials) share it.
+    // Shaders & input layouts are compared by their contents, so they may be destroyed after
+    // acquiring. Renderpasses & binding layouts are compared by identity and must outlive the pipeline.
+    ////////////////////////////////////////////////////////////////////////////////////
+    class PipelineStateCache
+    {
+    public:
+        // Constructor & Destructor
+        PipelineStateCache(const Device& device);
+        ~PipelineStateCache(); // Note: Destroys all pipelines that are still referenced
+
+        // Methods // Note: Every Acquire must be matched by a Release. Thread safe.
+        GraphicsPipeline& Acquire(const GraphicsPipelineSpecification& specs);
+        ComputePipeline& Acquire(const ComputePipelineSpecification& specs);
+
+        void Release(GraphicsPipeline& pipeline); // Note: Destroys the pipeline once the last reference is released
+        void Release(ComputePipeline& pipeline);
+
+        // Getters
+        size_t GetPipelineCount() const;
+
+    private:
+        template<typename TSpecification>
+        struct PipelineKey
+        {
+        public:
+            TSpecification State = {}; // Note: Without the shader & input pointers and the debug name, these never get dereferenced
+            std::array<size_t, 6> ContentHashes = { }; // Note: Input layout & shaders in specification order, 0 when unset
+            size_t Hash = 0;
+        };
+
+        template<typename TPipeline, typename TSpecification>
+        struct CachedPipeline
+        {
+        public:
+            TPipeline Pipeline;
+            PipelineKey<TSpecification> Key;
+            uint32_t References = 1;
+
+        public:
+            inline CachedPipeline(const Device& device, const TSpecification& specs, PipelineKey<TSpecification>&& key)
+                : Pipeline(device, specs), Key(std::move(key)) {}
+        };
+
+        using CachedGraphicsPipeline = CachedPipeline<GraphicsPipeline, GraphicsPipelineSpecification>;
+        using CachedComputePipeline = CachedPipeline<ComputePipeline, ComputePipelineSpecification>;
+
+    private:
+        const Device& m_Device;
+
+        mutable std::mutex m_Mutex = {};
+
+        // Note: std::list since pipelines can't be moved, the maps are keyed by the key's hash
+        std::list<CachedGraphicsPipeline> m_GraphicsPipelines = { };
+        std::list<CachedComputePipeline> m_ComputePipelines = { };
+        std::unordered_map<size_t, std::vector<CachedGraphicsPipeline*>> m_GraphicsLookup = { };
+        std::unordered_map<size_t, std::vector<CachedComputePipeline*>> m_ComputeLookup = { };
+    };
+
+}
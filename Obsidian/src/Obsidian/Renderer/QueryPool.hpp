@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/API.hpp"
+#include "Obsidian/Renderer/QueryPoolSpec.hpp"
+
+#include "Obsidian/Platform/Vulkan/VulkanQueryPool.hpp"
+#include "Obsidian/Platform/Dx12/Dx12QueryPool.hpp"
+#include "Obsidian/Platform/Dummy/DummyQueryPool.hpp"
+
+#include <Nano/Nano.hpp>
+
+#include <span>
+
+namespace Obsidian
+{
+
+    class Device;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // QueryPool
+    ////////////////////////////////////////////////////////////////////////////////////
+    class QueryPool
+    {
+    public:
+        using Type = Nano::Types::SelectorType<Information::RenderingAPI,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Vulkan, Internal::VulkanQueryPool>,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Dx12, Internal::Dx12QueryPool>,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Metal, Internal::DummyQueryPool>,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Dummy, Internal::DummyQueryPool>
+        >;
+    public:
+        // Destructor
+        ~QueryPool() = default;
+
+        // Methods // Note: These never wait on the GPU, they return false when (some of) the results aren't available yet.
+        // A Timestamp/Occlusion query produces 1 value, a PipelineStatistics query produces 7 values (see PipelineStatistics), so results must hold count * that.
+        inline bool GetResults(uint32_t firstQuery, uint32_t queryCount, std::span<uint64_t> results) const { return m_Impl->GetResults(firstQuery, queryCount, results); }
+
+        inline bool GetTimerResult(uint32_t timer, double& milliseconds) const { return m_Impl->GetTimerResult(timer, milliseconds); } // Note: Time between BeginTimerQuery & EndTimerQuery
+        inline bool GetPipelineStatistics(uint32_t query, PipelineStatistics& statistics) const { return m_Impl->GetPipelineStatistics(query, statistics); }
+
+        // Getters
+        inline const QueryPoolSpecification& GetSpecification() const { return m_Impl->GetSpecification(); }
+
+    public: //private:
+        // Constructor
+        inline QueryPool(const Device& device, const QueryPoolSpecification& specs) { m_Impl.Construct(device, specs); }
+
+    private:
+        Internal::APIObject<Type> m_Impl = {};
+
+        friend class Device;
+        friend class APICaster;
+    };
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Nano/Nano.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace Obsidian
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Flags
+    ////////////////////////////////////////////////////////////////////////////////////
+    enum class QueryType : uint8_t
+    {
+        Timestamp = 0,
+        PipelineStatistics,
+        Occlusion
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // PipelineStatistics // Note: Result layout of a single PipelineStatistics query
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct PipelineStatistics
+    {
+    public:
+        uint64_t InputAssemblyVertices = 0;
+        uint64_t InputAssemblyPrimitives = 0;
+        uint64_t VertexShaderInvocations = 0;
+        uint64_t ClippingInvocations = 0;
+        uint64_t ClippingPrimitives = 0;
+        uint64_t FragmentShaderInvocations = 0;
+        uint64_t ComputeShaderInvocations = 0;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // QueryPoolSpecification
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct QueryPoolSpecification
+    {
+    public:
+        QueryType Type = QueryType::Timestamp;
+        uint32_t Count = 0; // Note: For timestamps a timer query uses 2 queries (begin & end), so Count = 2 * amount of timers
+
+        std::string DebugName = {};
+
+    public:
+        // Setters
+        inline constexpr QueryPoolSpecification& SetType(QueryType type) { Type = type; return *this; }
+        inline constexpr QueryPoolSpecification& SetCount(uint32_t count) { Count = count; return *this; }
+        inline QueryPoolSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
+    };
+
+}
@@ -0,0 +1,189 @@
+#include "obpch.h"
+#include "ReadbackQueue.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+#include "Obsidian/Renderer/Image.hpp"
+#include "Obsidian/Renderer/CommandList.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace Obsidian
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    ReadbackQueue::ReadbackQueue(Device& device, const ReadbackQueueSpecification& specs)
+        : m_Device(device), m_Specification(specs)
+    {
+    }
+
+    ReadbackQueue::~ReadbackQueue()
+    {
+        for (ReadbackBuffer& buffer : m_Buffers)
+        {
+            m_Device.StopTracking(buffer.Resource);
+            m_Device.DestroyBuffer(buffer.Resource);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void ReadbackQueue::ReadBuffer(CommandList& list, Buffer& src, size_t size, size_t srcOffset, ReadbackCallback callback)
+    {
+        OB_PROFILE("ReadbackQueue::ReadBuffer()");
+        OB_ASSERT((size > 0), "[ReadbackQueue] Size must be more than 0.");
+        OB_ASSERT((srcOffset + size <= src.GetSpecification().Size), "[ReadbackQueue] Size + offset exceeds buffer size.");
+
+        ReadbackBuffer* buffer = nullptr;
+        {
+            std::scoped_lock lock(m_Mutex);
+            buffer = &AcquireBuffer(size);
+
+            Readback& readback = m_Recorded.emplace_back();
+            readback.BufferPtr = buffer;
+            readback.Size = size;
+            readback.Callback = std::move(callback);
+            readback.ListPtr = &list;
+        }
+
+        list.CopyBuffer(buffer->Resource, src, size, srcOffset, 0);
+        list.RequireState(buffer->Resource, ResourceState::HostRead); // Note: Makes the copy visible to the CPU
+        list.CommitBarriers();
+    }
+
+    void ReadbackQueue::ReadImage(CommandList& list, Image& src, const ImageSliceSpecification& slice, ReadbackCallback callback)
+    {
+        OB_PROFILE("ReadbackQueue::ReadImage()");
+
+        ImageBufferLayout layout = Internal::ResolveImageBufferLayout(slice, src.GetSpecification());
+
+        ReadbackBuffer* buffer = nullptr;
+        {
+            std::scoped_lock lock(m_Mutex);
+            buffer = &AcquireBuffer(layout.Size);
+
+            Readback& readback = m_Recorded.emplace_back();
+            readback.BufferPtr = buffer;
+            readback.Size = layout.Size;
+            readback.Layout = layout;
+            readback.Callback = std::move(callback);
+            readback.ListPtr = &list;
+        }
+
+        list.CopyImage(buffer->Resource, 0, src, slice);
+        list.RequireState(buffer->Resource, ResourceState::HostRead);
+        list.CommitBarriers();
+    }
+
+    void ReadbackQueue::Submitted(const CommandList& list)
+    {
+        OB_PROFILE("ReadbackQueue::Submitted()");
+
+        // Note: The list's own value, since other threads can submit between the list's submission and this call
+        const uint64_t value = list.GetSignaledValue();
+
+        std::scoped_lock lock(m_Mutex);
+        for (Readback& readback : m_Recorded)
+        {
+            if (readback.ListPtr != &list)
+                continue;
+
+            readback.Value = value;
+
+            auto position = std::upper_bound(m_InFlight.begin(), m_InFlight.end(), value, [](uint64_t lhs, const Readback& rhs) { return (lhs < rhs.Value); });
+            m_InFlight.insert(position, std::move(readback));
+        }
+
+        std::erase_if(m_Recorded, [&](const Readback& readback) { return (readback.ListPtr == &list); });
+    }
+
+    void ReadbackQueue::Poll()
+    {
+        OB_PROFILE("ReadbackQueue::Poll()");
+
+        std::vector<Readback> completed;
+        {
+            const uint64_t value = m_Device.GetCompletedValue();
+
+            std::scoped_lock lock(m_Mutex);
+            while (!m_InFlight.empty() && (m_InFlight.front().Value <= value))
+            {
+                completed.push_back(std::move(m_InFlight.front()));
+                m_InFlight.pop_front();
+            }
+        }
+
+        if (completed.empty())
+            return;
+
+        // Note: The callbacks run without the lock held, so they're free to record new readbacks
+        for (Readback& readback : completed)
+        {
+            void* memory = nullptr;
+            m_Device.MapBuffer(readback.BufferPtr->Resource, memory);
+            m_Device.InvalidateBuffer(readback.BufferPtr->Resource, BufferRange().SetOffset(0).SetSize(readback.Size));
+
+            ReadbackResult result = {};
+            result.Memory = memory;
+            result.Size = readback.Size;
+            result.Layout = readback.Layout;
+
+            if (readback.Callback)
+                readback.Callback(result);
+
+            m_Device.UnmapBuffer(readback.BufferPtr->Resource);
+        }
+
+        std::scoped_lock lock(m_Mutex);
+        for (Readback& readback : completed)
+            m_FreeBuffers.push_back(readback.BufferPtr);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    size_t ReadbackQueue::GetPendingCount() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_Recorded.size() + m_InFlight.size();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    ReadbackQueue::ReadbackBuffer& ReadbackQueue::AcquireBuffer(size_t size)
+    {
+        // Note: Takes the smallest free buffer that fits, so large buffers stay available for large reads
+        auto it = m_FreeBuffers.end();
+        for (auto current = m_FreeBuffers.begin(); current != m_FreeBuffers.end(); current++)
+        {
+            if (((*current)->Size >= size) && ((it == m_FreeBuffers.end()) || ((*current)->Size < (*it)->Size)))
+                it = current;
+        }
+
+        if (it != m_FreeBuffers.end())
+        {
+            ReadbackBuffer& buffer = **it;
+            m_FreeBuffers.erase(it);
+            return buffer;
+        }
+
+        OB_PROFILE("ReadbackQueue::AcquireBuffer::Create");
+
+        ReadbackBuffer& buffer = m_Buffers.emplace_back(m_Device, BufferSpecification()
+            .SetSize(std::max(size, m_Specification.MinBufferSize))
+            .SetCPUAccess(CpuAccessMode::Read)
+            .SetDebugName(m_Specification.DebugName)
+        );
+        m_Device.StartTracking(buffer.Resource, ResourceState::Unknown);
+
+        return buffer;
+    }
+
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/API.hpp"
+#include "Obsidian/Renderer/Buffer.hpp"
+#include "Obsidian/Renderer/BufferSpec.hpp"
+#include "Obsidian/Renderer/ImageSpec.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <vector>
+
+namespace Obsidian
+{
+
+    class Device;
+    class Image;
+    class CommandList;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ReadbackQueue // Note: Copies GPU data into recycled CPU readable buffers and hands the
+    // mapped memory to a callback once the device's timeline has passed the list's submission value,
+    // so reading back results never has to stall on Device::Wait().
+    ////////////////////////////////////////////////////////////////////////////////////
+    class ReadbackQueue
+    {
+    public:
+        // Constructor & Destructor
+        ReadbackQueue(Device& device, const ReadbackQueueSpecification& specs = ReadbackQueueSpecification());
+        ~ReadbackQueue(); // Note: Readbacks that haven't completed are dropped without invoking their callback
+
+        // Methods // Note: Records the copy into list, the callback gets invoked from Poll() once that submission has completed. Thread safe.
+        void ReadBuffer(CommandList& list, Buffer& src, size_t size, size_t srcOffset, ReadbackCallback callback);
+        void ReadImage(CommandList& list, Image& src, const ImageSliceSpecification& slice, ReadbackCallback callback); // Note: Rows are padded as described by ReadbackResult::Layout
+
+        void Submitted(const CommandList& list); // Note: Call after submitting list, ties the readbacks recorded into it to list.GetSignaledValue()
+        void Poll(); // Note: Invokes the callbacks of all completed readbacks on the calling thread, never blocks
+
+        // Getters
+        inline const ReadbackQueueSpecification& GetSpecification() const { return m_Specification; }
+
+        size_t GetPendingCount() const; // Note: Readbacks that are recorded or in flight
+
+    private:
+        struct ReadbackBuffer
+        {
+        public:
+            Buffer Resource;
+            size_t Size;
+
+        public:
+            inline ReadbackBuffer(const Device& device, const BufferSpecification& specs)
+                : Resource(device, specs), Size(specs.Size) {}
+        };
+
+        struct Readback
+        {
+        public:
+            ReadbackBuffer* BufferPtr = nullptr;
+            size_t Size = 0;
+            ImageBufferLayout Layout = {};
+
+            ReadbackCallback Callback = {};
+            const CommandList* ListPtr = nullptr; // Note: The list the copy was recorded into
+            uint64_t Value = 0; // Note: Timeline value to reach before the memory can be read
+        };
+
+    private:
+        // Private methods
+        ReadbackBuffer& AcquireBuffer(size_t size); // Note: Must be called with m_Mutex locked
+
+    private:
+        Device& m_Device;
+        ReadbackQueueSpecification m_Specification;
+
+        mutable std::mutex m_Mutex = {};
+        std::list<ReadbackBuffer> m_Buffers = { }; // Note: std::list since buffers can't be moved
+        std::vector<ReadbackBuffer*> m_FreeBuffers = { };
+
+        std::vector<Readback> m_Recorded = { }; // Note: Recorded, but not yet submitted
+        std::deque<Readback> m_InFlight = { }; // Note: Ordered by Value, lists can be handed to Submitted() in any order
+    };
+
+}
@@ -0,0 +1,709 @@
+#include "obpch.h"
+#include "RenderGraph.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+#include "Obsidian/Renderer/CommandList.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace Obsidian
+{
+
+    namespace
+    {
+
+        inline constexpr uint32_t s_InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Helper methods
+        ////////////////////////////////////////////////////////////////////////////////////
+        struct ResourceAccess
+        {
+        public:
+            uint32_t LastWriter = s_InvalidIndex;
+            std::vector<uint32_t> Readers = { }; // Note: Readers since the last write
+        };
+
+        void ResolveAccess(std::vector<uint32_t>& dependencies, uint32_t pass, const ResourceAccess& access, RenderGraphAccess type)
+        {
+            auto addDependency = [&](uint32_t dependency)
+            {
+                if ((dependency != s_InvalidIndex) && (dependency != pass) && (std::find(dependencies.begin(), dependencies.end(), dependency) == dependencies.end()))
+                    dependencies.push_back(dependency);
+            };
+
+            // Note: Reads wait on the last write (RAW), writes also wait on the last write (WAW) & the reads since (WAR).
+            addDependency(access.LastWriter);
+            if (static_cast<bool>(type & RenderGraphAccess::Write))
+            {
+                for (uint32_t reader : access.Readers)
+                    addDependency(reader);
+            }
+        }
+
+        void UpdateAccess(uint32_t pass, ResourceAccess& access, RenderGraphAccess type)
+        {
+            if (static_cast<bool>(type & RenderGraphAccess::Write))
+            {
+                access.LastWriter = pass;
+                access.Readers.clear();
+            }
+            else
+            {
+                access.Readers.push_back(pass);
+            }
+        }
+
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // RenderGraphPass
+    ////////////////////////////////////////////////////////////////////////////////////
+    RenderGraphPass::RenderGraphPass(const std::string& name, CommandQueue queue, ExecuteFn execute)
+        : m_Name(name), m_Queue(queue), m_Execute(std::move(execute))
+    {
+        OB_ASSERT((queue != CommandQueue::Count), "[RenderGraphPass] Invalid queue passed in.");
+    }
+
+    RenderGraphPass& RenderGraphPass::Read(RenderGraphImage image, ResourceState state, const ImageSubresourceSpecification& subresources)
+    {
+        OB_ASSERT(image.IsValid(), "[RenderGraphPass] Invalid image passed in.");
+        m_ImageUsages.push_back({ image, subresources, state, RenderGraphAccess::Read });
+        return *this;
+    }
+
+    RenderGraphPass& RenderGraphPass::Write(RenderGraphImage image, ResourceState state, const ImageSubresourceSpecification& subresources)
+    {
+        OB_ASSERT(image.IsValid(), "[RenderGraphPass] Invalid image passed in.");
+        m_ImageUsages.push_back({ image, subresources, state, RenderGraphAccess::Write });
+        return *this;
+    }
+
+    RenderGraphPass& RenderGraphPass::ReadWrite(RenderGraphImage image, ResourceState state, const ImageSubresourceSpecification& subresources)
+    {
+        OB_ASSERT(image.IsValid(), "[RenderGraphPass] Invalid image passed in.");
+        m_ImageUsages.push_back({ image, subresources, state, RenderGraphAccess::ReadWrite });
+        return *this;
+    }
+
+    RenderGraphPass& RenderGraphPass::Read(RenderGraphBuffer buffer, ResourceState state)
+    {
+        OB_ASSERT(buffer.IsValid(), "[RenderGraphPass] Invalid buffer passed in.");
+        m_BufferUsages.push_back({ buffer, state, RenderGraphAccess::Read });
+        return *this;
+    }
+
+    RenderGraphPass& RenderGraphPass::Write(RenderGraphBuffer buffer, ResourceState state)
+    {
+        OB_ASSERT(buffer.IsValid(), "[RenderGraphPass] Invalid buffer passed in.");
+        m_BufferUsages.push_back({ buffer, state, RenderGraphAccess::Write });
+        return *this;
+    }
+
+    RenderGraphPass& RenderGraphPass::ReadWrite(RenderGraphBuffer buffer, ResourceState state)
+    {
+        OB_ASSERT(buffer.IsValid(), "[RenderGraphPass] Invalid buffer passed in.");
+        m_BufferUsages.push_back({ buffer, state, RenderGraphAccess::ReadWrite });
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    RenderGraph::RenderGraph(Device& device, const RenderGraphSpecification& specs)
+        : m_Device(device), m_Specification(specs)
+    {
+    }
+
+    RenderGraph::~RenderGraph()
+    {
+        for (TransientImage& transient : m_TransientImages)
+        {
+            if (!transient.Specification.HasPermanentState())
+                m_Device.StopTracking(transient.Resource);
+            m_Device.DestroyImage(transient.Resource);
+        }
+        for (TransientBuffer& transient : m_TransientBuffers)
+        {
+            if (!transient.Specification.HasPermanentState())
+                m_Device.StopTracking(transient.Resource);
+            m_Device.DestroyBuffer(transient.Resource);
+        }
+
+        DestroyAliasedImages();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::Reset()
+    {
+        OB_PROFILE("RenderGraph::Reset()");
+
+        m_Frame++;
+        m_Compiled = false;
+
+        m_Passes.clear();
+        m_Images.clear();
+        m_Buffers.clear();
+
+        m_Batches.clear();
+        m_BatchFinalImages.clear();
+        m_BatchFinalBuffers.clear();
+
+        // Note: Transients that haven't been used for TransientLifetime frames get destroyed,
+        // the device defers the actual destruction till the GPU is done with them.
+        std::erase_if(m_TransientImages, [this](TransientImage& transient) -> bool
+        {
+            transient.InUse = false;
+            if (m_Frame - transient.LastUsedFrame <= m_Specification.TransientLifetime)
+                return false;
+
+            if (!transient.Specification.HasPermanentState())
+                m_Device.StopTracking(transient.Resource);
+            m_Device.DestroyImage(transient.Resource);
+            return true;
+        });
+        std::erase_if(m_TransientBuffers, [this](TransientBuffer& transient) -> bool
+        {
+            transient.InUse = false;
+            if (m_Frame - transient.LastUsedFrame <= m_Specification.TransientLifetime)
+                return false;
+
+            if (!transient.Specification.HasPermanentState())
+                m_Device.StopTracking(transient.Resource);
+            m_Device.DestroyBuffer(transient.Resource);
+            return true;
+        });
+    }
+
+    RenderGraphImage RenderGraph::ImportImage(Image& image, ResourceState finalState)
+    {
+        OB_ASSERT(!m_Compiled, "[RenderGraph] Can't add resources to a compiled graph, call Reset() first.");
+
+        ImageResource& resource = m_Images.emplace_back();
+        resource.ImagePtr = &image;
+        resource.Specification = image.GetSpecification();
+        resource.Imported = true;
+        resource.FinalState = finalState;
+
+        return RenderGraphImage{ static_cast<uint32_t>(m_Images.size() - 1) };
+    }
+
+    RenderGraphBuffer RenderGraph::ImportBuffer(Buffer& buffer, ResourceState finalState)
+    {
+        OB_ASSERT(!m_Compiled, "[RenderGraph] Can't add resources to a compiled graph, call Reset() first.");
+
+        BufferResource& resource = m_Buffers.emplace_back();
+        resource.BufferPtr = &buffer;
+        resource.Specification = buffer.GetSpecification();
+        resource.Imported = true;
+        resource.FinalState = finalState;
+
+        return RenderGraphBuffer{ static_cast<uint32_t>(m_Buffers.size() - 1) };
+    }
+
+    RenderGraphImage RenderGraph::CreateImage(const ImageSpecification& specs)
+    {
+        OB_ASSERT(!m_Compiled, "[RenderGraph] Can't add resources to a compiled graph, call Reset() first.");
+
+        ImageResource& resource = m_Images.emplace_back();
+        resource.Specification = specs;
+
+        return RenderGraphImage{ static_cast<uint32_t>(m_Images.size() - 1) };
+    }
+
+    RenderGraphBuffer RenderGraph::CreateBuffer(const BufferSpecification& specs)
+    {
+        OB_ASSERT(!m_Compiled, "[RenderGraph] Can't add resources to a compiled graph, call Reset() first.");
+
+        BufferResource& resource = m_Buffers.emplace_back();
+        resource.Specification = specs;
+
+        return RenderGraphBuffer{ static_cast<uint32_t>(m_Buffers.size() - 1) };
+    }
+
+    RenderGraphPass& RenderGraph::AddPass(const std::string& name, RenderGraphPass::ExecuteFn execute, CommandQueue queue)
+    {
+        OB_ASSERT(!m_Compiled, "[RenderGraph] Can't add passes to a compiled graph, call Reset() first.");
+        return m_Passes.emplace_back(name, queue, std::move(execute));
+    }
+
+    void RenderGraph::Compile()
+    {
+        OB_PROFILE("RenderGraph::Compile()");
+        OB_ASSERT(!m_Compiled, "[RenderGraph] Graph has already been compiled, call Reset() before rebuilding.");
+
+        if constexpr (Information::Validation)
+        {
+            for (const RenderGraphPass& pass : m_Passes)
+            {
+                for (const RenderGraphImageUsage& usage : pass.m_ImageUsages)
+                    OB_ASSERT((usage.Handle.Index < m_Images.size()), "[RenderGraph] Pass '{0}' uses an image that doesn't belong to this graph.", pass.m_Name);
+                for (const RenderGraphBufferUsage& usage : pass.m_BufferUsages)
+                    OB_ASSERT((usage.Handle.Index < m_Buffers.size()), "[RenderGraph] Pass '{0}' uses a buffer that doesn't belong to this graph.", pass.m_Name);
+            }
+        }
+
+        CullPasses();
+        ResolveDependencies();
+
+        std::vector<uint32_t> schedule = SchedulePasses();
+        CreateBatches(schedule);
+        AcquireTransients(schedule);
+
+        m_Compiled = true;
+    }
+
+    void RenderGraph::Execute(CommandList& list)
+    {
+        OB_PROFILE("RenderGraph::Execute()");
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_Batches.size()); i++)
+        {
+            OB_ASSERT((m_Batches[i].Queue == m_Batches[0].Queue), "[RenderGraph] Execute() can only be used when all passes run on the same queue, use ExecuteBatch() instead.");
+            ExecuteBatch(i, list);
+        }
+    }
+
+    void RenderGraph::ExecuteBatch(uint32_t batch, CommandList& list)
+    {
+        OB_PROFILE("RenderGraph::ExecuteBatch()");
+        OB_ASSERT(m_Compiled, "[RenderGraph] Graph must be compiled before executing.");
+        OB_ASSERT((batch < m_Batches.size()), "[RenderGraph] Batch index exceeds the amount of batches.");
+
+        for (uint32_t passIndex : m_Batches[batch].Passes)
+        {
+            RenderGraphPass& pass = m_Passes[passIndex];
+
+            // Note: All transitions at a pass boundary get committed as a single batch of barriers
+            for (const RenderGraphImageUsage& usage : pass.m_ImageUsages)
+            {
+                ImageResource& resource = m_Images[usage.Handle.Index];
+                Image& image = *resource.ImagePtr;
+
+                if (resource.AliasOnFirstUse) // Note: Takes the memory over from the previous aliased image
+                {
+                    list.AliasImage(image, usage.State);
+                    resource.AliasOnFirstUse = false;
+                }
+                else if (!image.GetSpecification().HasPermanentState())
+                {
+                    list.RequireState(image, usage.Subresources, usage.State);
+                }
+            }
+            for (const RenderGraphBufferUsage& usage : pass.m_BufferUsages)
+            {
+                Buffer& buffer = *m_Buffers[usage.Handle.Index].BufferPtr;
+                if (!buffer.GetSpecification().HasPermanentState())
+                    list.RequireState(buffer, usage.State);
+            }
+            list.CommitBarriers();
+
+            if (pass.m_Execute)
+                pass.m_Execute(list, *this);
+        }
+
+        // Final states
+        if (m_BatchFinalImages[batch].empty() && m_BatchFinalBuffers[batch].empty())
+            return;
+
+        for (uint32_t image : m_BatchFinalImages[batch])
+            list.RequireState(*m_Images[image].ImagePtr, ImageSubresourceSpecification(), m_Images[image].FinalState);
+        for (uint32_t buffer : m_BatchFinalBuffers[batch])
+            list.RequireState(*m_Buffers[buffer].BufferPtr, m_Buffers[buffer].FinalState);
+        list.CommitBarriers();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    Image& RenderGraph::GetImage(RenderGraphImage image) const
+    {
+        OB_ASSERT((image.Index < m_Images.size()), "[RenderGraph] Invalid image passed in.");
+        OB_ASSERT(m_Images[image.Index].ImagePtr, "[RenderGraph] Transient image hasn't been created, it's either culled or the graph isn't compiled.");
+        return *m_Images[image.Index].ImagePtr;
+    }
+
+    Buffer& RenderGraph::GetBuffer(RenderGraphBuffer buffer) const
+    {
+        OB_ASSERT((buffer.Index < m_Buffers.size()), "[RenderGraph] Invalid buffer passed in.");
+        OB_ASSERT(m_Buffers[buffer.Index].BufferPtr, "[RenderGraph] Transient buffer hasn't been created, it's either culled or the graph isn't compiled.");
+        return *m_Buffers[buffer.Index].BufferPtr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::CullPasses()
+    {
+        OB_PROFILE("RenderGraph::CullPasses()");
+
+        // Note: Walks the passes backwards, a pass survives when it has side effects or writes
+        // to an imported resource or to a resource that a surviving (later) pass reads.
+        std::vector<bool> neededImages(m_Images.size(), false);
+        std::vector<bool> neededBuffers(m_Buffers.size(), false);
+
+        for (uint32_t i = static_cast<uint32_t>(m_Passes.size()); i-- > 0;)
+        {
+            RenderGraphPass& pass = m_Passes[i];
+
+            bool alive = pass.m_HasSideEffects;
+            for (const RenderGraphImageUsage& usage : pass.m_ImageUsages)
+            {
+                if (static_cast<bool>(usage.Access & RenderGraphAccess::Write) && (m_Images[usage.Handle.Index].Imported || neededImages[usage.Handle.Index]))
+                    alive = true;
+            }
+            for (const RenderGraphBufferUsage& usage : pass.m_BufferUsages)
+            {
+                if (static_cast<bool>(usage.Access & RenderGraphAccess::Write) && (m_Buffers[usage.Handle.Index].Imported || neededBuffers[usage.Handle.Index]))
+                    alive = true;
+            }
+
+            pass.m_Culled = !alive;
+            if (!alive)
+                continue;
+
+            for (const RenderGraphImageUsage& usage : pass.m_ImageUsages)
+            {
+                if (static_cast<bool>(usage.Access & RenderGraphAccess::Read))
+                    neededImages[usage.Handle.Index] = true;
+            }
+            for (const RenderGraphBufferUsage& usage : pass.m_BufferUsages)
+            {
+                if (static_cast<bool>(usage.Access & RenderGraphAccess::Read))
+                    neededBuffers[usage.Handle.Index] = true;
+            }
+        }
+    }
+
+    void RenderGraph::ResolveDependencies()
+    {
+        OB_PROFILE("RenderGraph::ResolveDependencies()");
+
+        std::vector<ResourceAccess> images(m_Images.size());
+        std::vector<ResourceAccess> buffers(m_Buffers.size());
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_Passes.size()); i++)
+        {
+            RenderGraphPass& pass = m_Passes[i];
+            pass.m_Dependencies.clear();
+
+            if (pass.m_Culled)
+                continue;
+
+            for (const RenderGraphImageUsage& usage : pass.m_ImageUsages)
+                ResolveAccess(pass.m_Dependencies, i, images[usage.Handle.Index], usage.Access);
+            for (const RenderGraphBufferUsage& usage : pass.m_BufferUsages)
+                ResolveAccess(pass.m_Dependencies, i, buffers[usage.Handle.Index], usage.Access);
+
+            // Note: Updated after resolving, so multiple usages of one resource by a pass don't depend on each other
+            for (const RenderGraphImageUsage& usage : pass.m_ImageUsages)
+                UpdateAccess(i, images[usage.Handle.Index], usage.Access);
+            for (const RenderGraphBufferUsage& usage : pass.m_BufferUsages)
+                UpdateAccess(i, buffers[usage.Handle.Index], usage.Access);
+        }
+    }
+
+    std::vector<uint32_t> RenderGraph::SchedulePasses() const
+    {
+        OB_PROFILE("RenderGraph::SchedulePasses()");
+
+        std::vector<uint32_t> remaining(m_Passes.size(), 0);
+        std::vector<std::vector<uint32_t>> dependents(m_Passes.size());
+        std::vector<uint32_t> ready;
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_Passes.size()); i++)
+        {
+            if (m_Passes[i].m_Culled)
+                continue;
+
+            remaining[i] = static_cast<uint32_t>(m_Passes[i].m_Dependencies.size());
+            for (uint32_t dependency : m_Passes[i].m_Dependencies)
+                dependents[dependency].push_back(i);
+
+            if (remaining[i] == 0)
+                ready.push_back(i);
+        }
+
+        // Note: Kahn's algorithm, ready passes on the queue of the previously scheduled pass are preferred
+        // so work on one queue stays together (fewer batches), ties are broken by declaration order.
+        std::vector<uint32_t> schedule;
+        schedule.reserve(m_Passes.size());
+
+        CommandQueue currentQueue = CommandQueue::Count;
+        while (!ready.empty())
+        {
+            auto it = std::min_element(ready.begin(), ready.end(), [&](uint32_t a, uint32_t b)
+            {
+                const bool aSameQueue = (m_Passes[a].m_Queue == currentQueue);
+                const bool bSameQueue = (m_Passes[b].m_Queue == currentQueue);
+                if (aSameQueue != bSameQueue)
+                    return aSameQueue;
+
+                return (a < b);
+            });
+
+            const uint32_t pass = *it;
+            ready.erase(it);
+
+            schedule.push_back(pass);
+            currentQueue = m_Passes[pass].m_Queue;
+
+            for (uint32_t dependent : dependents[pass])
+            {
+                if (--remaining[dependent] == 0)
+                    ready.push_back(dependent);
+            }
+        }
+
+        return schedule;
+    }
+
+    void RenderGraph::CreateBatches(const std::vector<uint32_t>& schedule)
+    {
+        OB_PROFILE("RenderGraph::CreateBatches()");
+
+        std::vector<uint32_t> passBatches(m_Passes.size(), s_InvalidIndex);
+
+        for (uint32_t pass : schedule)
+        {
+            if (m_Batches.empty() || (m_Batches.back().Queue != m_Passes[pass].m_Queue))
+                m_Batches.emplace_back().Queue = m_Passes[pass].m_Queue;
+
+            m_Batches.back().Passes.push_back(pass);
+            passBatches[pass] = static_cast<uint32_t>(m_Batches.size() - 1);
+        }
+
+        // Note: Batches on the same queue are ordered by submission, only cross queue dependencies need a wait.
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_Batches.size()); i++)
+        {
+            RenderGraphBatch& batch = m_Batches[i];
+            for (uint32_t pass : batch.Passes)
+            {
+                for (uint32_t dependency : m_Passes[pass].m_Dependencies)
+                {
+                    const uint32_t dependencyBatch = passBatches[dependency];
+                    if ((m_Batches[dependencyBatch].Queue != batch.Queue) && (std::find(batch.WaitOnBatches.begin(), batch.WaitOnBatches.end(), dependencyBatch) == batch.WaitOnBatches.end()))
+                        batch.WaitOnBatches.push_back(dependencyBatch);
+                }
+            }
+        }
+
+        // Note: Imported resources with a final state get transitioned after their last use
+        std::vector<uint32_t> lastImageBatches(m_Images.size(), s_InvalidIndex);
+        std::vector<uint32_t> lastBufferBatches(m_Buffers.size(), s_InvalidIndex);
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_Batches.size()); i++)
+        {
+            for (uint32_t pass : m_Batches[i].Passes)
+            {
+                for (const RenderGraphImageUsage& usage : m_Passes[pass].m_ImageUsages)
+                    lastImageBatches[usage.Handle.Index] = i;
+                for (const RenderGraphBufferUsage& usage : m_Passes[pass].m_BufferUsages)
+                    lastBufferBatches[usage.Handle.Index] = i;
+            }
+        }
+
+        m_BatchFinalImages.resize(m_Batches.size());
+        m_BatchFinalBuffers.resize(m_Batches.size());
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_Images.size()); i++)
+        {
+            const ImageResource& resource = m_Images[i];
+            if (resource.Imported && (resource.FinalState != ResourceState::Unknown) && !resource.Specification.HasPermanentState() && (lastImageBatches[i] != s_InvalidIndex))
+                m_BatchFinalImages[lastImageBatches[i]].push_back(i);
+        }
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_Buffers.size()); i++)
+        {
+            const BufferResource& resource = m_Buffers[i];
+            if (resource.Imported && (resource.FinalState != ResourceState::Unknown) && !resource.Specification.HasPermanentState() && (lastBufferBatches[i] != s_InvalidIndex))
+                m_BatchFinalBuffers[lastBufferBatches[i]].push_back(i);
+        }
+    }
+
+    void RenderGraph::AcquireTransients(const std::vector<uint32_t>& schedule)
+    {
+        OB_PROFILE("RenderGraph::AcquireTransients()");
+
+        std::vector<uint32_t> firstImageUses(m_Images.size(), s_InvalidIndex);
+        std::vector<uint32_t> lastImageUses(m_Images.size(), s_InvalidIndex);
+        std::vector<bool> aliasable(m_Images.size(), m_Specification.AliasTransientImages);
+        std::vector<bool> usedBuffers(m_Buffers.size(), false);
+
+        for (uint32_t position = 0; position < static_cast<uint32_t>(schedule.size()); position++)
+        {
+            const RenderGraphPass& pass = m_Passes[schedule[position]];
+            for (const RenderGraphImageUsage& usage : pass.m_ImageUsages)
+            {
+                if (firstImageUses[usage.Handle.Index] == s_InvalidIndex)
+                    firstImageUses[usage.Handle.Index] = position;
+                lastImageUses[usage.Handle.Index] = position;
+
+                // Note: Other queues aren't ordered with the graphics queue, so the memory could still be in use
+                if (pass.m_Queue != CommandQueue::Graphics)
+                    aliasable[usage.Handle.Index] = false;
+            }
+            for (const RenderGraphBufferUsage& usage : pass.m_BufferUsages)
+                usedBuffers[usage.Handle.Index] = true;
+        }
+
+        std::vector<uint32_t> aliasedImages;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_Images.size()); i++)
+        {
+            ImageResource& resource = m_Images[i];
+            if (resource.Imported || (firstImageUses[i] == s_InvalidIndex))
+                continue;
+
+            if (aliasable[i] && !resource.Specification.HasPermanentState())
+                aliasedImages.push_back(i);
+            else
+                resource.ImagePtr = &AcquireTransientImage(resource.Specification);
+        }
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_Buffers.size()); i++)
+        {
+            BufferResource& resource = m_Buffers[i];
+            if (!resource.Imported && usedBuffers[i])
+                resource.BufferPtr = &AcquireTransientBuffer(resource.Specification);
+        }
+
+        AcquireAliasedImages(aliasedImages, firstImageUses, lastImageUses);
+    }
+
+    Image& RenderGraph::AcquireTransientImage(const ImageSpecification& specs)
+    {
+        auto it = std::find_if(m_TransientImages.begin(), m_TransientImages.end(), [&](const TransientImage& transient) { return (!transient.InUse && (transient.Specification == specs)); });
+        if (it == m_TransientImages.end())
+        {
+            TransientImage& transient = m_TransientImages.emplace_back(m_Device, specs);
+            if (!specs.HasPermanentState())
+                m_Device.StartTracking(transient.Resource, ImageSubresourceSpecification(), ResourceState::Unknown);
+
+            it = std::prev(m_TransientImages.end());
+        }
+
+        it->InUse = true;
+        it->LastUsedFrame = m_Frame;
+        return it->Resource;
+    }
+
+    Buffer& RenderGraph::AcquireTransientBuffer(const BufferSpecification& specs)
+    {
+        auto it = std::find_if(m_TransientBuffers.begin(), m_TransientBuffers.end(), [&](const TransientBuffer& transient) { return (!transient.InUse && (transient.Specification == specs)); });
+        if (it == m_TransientBuffers.end())
+        {
+            TransientBuffer& transient = m_TransientBuffers.emplace_back(m_Device, specs);
+            if (!specs.HasPermanentState())
+                m_Device.StartTracking(transient.Resource, ResourceState::Unknown);
+
+            it = std::prev(m_TransientBuffers.end());
+        }
+
+        it->InUse = true;
+        it->LastUsedFrame = m_Frame;
+        return it->Resource;
+    }
+
+    void RenderGraph::AcquireAliasedImages(const std::vector<uint32_t>& images, const std::vector<uint32_t>& firstUses, const std::vector<uint32_t>& lastUses)
+    {
+        OB_PROFILE("RenderGraph::AcquireAliasedImages()");
+
+        bool layoutChanged = (images.size() != m_AliasedImages.size());
+        for (size_t i = 0; (i < images.size()) && !layoutChanged; i++)
+        {
+            const AliasedImage& aliased = m_AliasedImages[i];
+            layoutChanged = ((aliased.Specification != m_Images[images[i]].Specification) || (aliased.FirstUse != firstUses[images[i]]) || (aliased.LastUse != lastUses[images[i]]));
+        }
+
+        if (layoutChanged)
+        {
+            DestroyAliasedImages();
+
+            struct Heap
+            {
+            public:
+                ImageMemoryRequirements Requirements = {};
+                std::vector<uint32_t> Members = { }; // Note: Indices into images
+            };
+
+            std::vector<ImageMemoryRequirements> requirements(images.size());
+            for (size_t i = 0; i < images.size(); i++)
+                requirements[i] = m_Device.GetImageMemoryRequirements(m_Images[images[i]].Specification);
+
+            auto overlaps = [&](uint32_t a, uint32_t b) -> bool
+            {
+                return ((firstUses[images[a]] <= lastUses[images[b]]) && (firstUses[images[b]] <= lastUses[images[a]]));
+            };
+
+            // Note: Greedy, the largest images get placed first and every image goes into the first heap
+            // of a compatible memory type whose members are all dead by the time the image is first used.
+            std::vector<uint32_t> order(images.size());
+            std::iota(order.begin(), order.end(), 0u);
+            std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return (requirements[a].Size > requirements[b].Size); });
+
+            std::vector<Heap> heaps;
+            std::vector<uint32_t> imageHeaps(images.size(), s_InvalidIndex);
+            for (uint32_t image : order)
+            {
+                const ImageMemoryRequirements& imageRequirements = requirements[image];
+                auto it = std::find_if(heaps.begin(), heaps.end(), [&](const Heap& heap) -> bool
+                {
+                    if ((heap.Requirements.MemoryTypeBits & imageRequirements.MemoryTypeBits) == 0)
+                        return false;
+
+                    return std::none_of(heap.Members.begin(), heap.Members.end(), [&](uint32_t member) { return overlaps(image, member); });
+                });
+
+                if (it == heaps.end())
+                {
+                    it = heaps.emplace(heaps.end());
+                    it->Requirements = imageRequirements;
+                }
+                else
+                {
+                    it->Requirements.Size = std::max(it->Requirements.Size, imageRequirements.Size);
+                    it->Requirements.Alignment = std::max(it->Requirements.Alignment, imageRequirements.Alignment);
+                    it->Requirements.MemoryTypeBits &= imageRequirements.MemoryTypeBits;
+                }
+
+                it->Members.push_back(image);
+                imageHeaps[image] = static_cast<uint32_t>(std::distance(heaps.begin(), it));
+            }
+
+            for (size_t i = 0; i < heaps.size(); i++)
+                m_AliasHeaps.emplace_back(m_Device, ImageHeapSpecification().SetMemoryRequirements(heaps[i].Requirements).SetDebugName(std::format("Aliased heap {0} for: {1}", i, m_Specification.DebugName)));
+
+            for (size_t i = 0; i < images.size(); i++)
+            {
+                AliasedImage& aliased = m_AliasedImages.emplace_back(m_Device, m_Images[images[i]].Specification, m_AliasHeaps[imageHeaps[i]], firstUses[images[i]], lastUses[images[i]]);
+                m_Device.StartTracking(aliased.Resource, ImageSubresourceSpecification(), ResourceState::Unknown);
+            }
+        }
+
+        for (size_t i = 0; i < images.size(); i++)
+        {
+            ImageResource& resource = m_Images[images[i]];
+            resource.ImagePtr = &m_AliasedImages[i].Resource;
+            resource.AliasOnFirstUse = true;
+        }
+    }
+
+    void RenderGraph::DestroyAliasedImages()
+    {
+        // Note: The device defers the destruction, images get destroyed before the heaps they are placed in
+        for (AliasedImage& aliased : m_AliasedImages)
+        {
+            m_Device.StopTracking(aliased.Resource);
+            m_Device.DestroyImage(aliased.Resource);
+        }
+        for (ImageHeap& heap : m_AliasHeaps)
+            m_Device.DestroyImageHeap(heap);
+
+        m_AliasedImages.clear();
+        m_AliasHeaps.clear();
+    }
+
+}
@@ -0,0 +1,219 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/API.hpp"
+#include "Obsidian/Renderer/Image.hpp"
+#include "Obsidian/Renderer/Buffer.hpp"
+#include "Obsidian/Renderer/ImageSpec.hpp"
+#include "Obsidian/Renderer/BufferSpec.hpp"
+#include "Obsidian/Renderer/CommandListSpec.hpp"
+#include "Obsidian/Renderer/RenderGraphSpec.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace Obsidian
+{
+
+    class Device;
+    class CommandList;
+    class RenderGraph;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // RenderGraphPass
+    ////////////////////////////////////////////////////////////////////////////////////
+    class RenderGraphPass
+    {
+    public:
+        using ExecuteFn = std::function<void(CommandList& list, const RenderGraph& graph)>;
+    public:
+        // Constructor & Destructor
+        RenderGraphPass(const std::string& name, CommandQueue queue, ExecuteFn execute);
+        ~RenderGraphPass() = default;
+
+        // Setup methods // Note: Every resource the pass touches must be declared, the graph transitions them before the pass executes.
+        // Renderpasses used inside of a pass should have their start states set to the declared (or Unknown) states.
+        RenderGraphPass& Read(RenderGraphImage image, ResourceState state, const ImageSubresourceSpecification& subresources = ImageSubresourceSpecification());
+        RenderGraphPass& Write(RenderGraphImage image, ResourceState state, const ImageSubresourceSpecification& subresources = ImageSubresourceSpecification());
+        RenderGraphPass& ReadWrite(RenderGraphImage image, ResourceState state, const ImageSubresourceSpecification& subresources = ImageSubresourceSpecification());
+
+        RenderGraphPass& Read(RenderGraphBuffer buffer, ResourceState state);
+        RenderGraphPass& Write(RenderGraphBuffer buffer, ResourceState state);
+        RenderGraphPass& ReadWrite(RenderGraphBuffer buffer, ResourceState state);
+
+        inline RenderGraphPass& SetHasSideEffects(bool enabled) { m_HasSideEffects = enabled; return *this; } // Note: Passes with side effects are never culled
+
+        // Getters
+        inline const std::string& GetName() const { return m_Name; }
+        inline CommandQueue GetQueue() const { return m_Queue; }
+
+        inline bool HasSideEffects() const { return m_HasSideEffects; }
+        inline bool IsCulled() const { return m_Culled; } // Note: Only valid after RenderGraph::Compile()
+
+        inline const std::vector<RenderGraphImageUsage>& GetImageUsages() const { return m_ImageUsages; }
+        inline const std::vector<RenderGraphBufferUsage>& GetBufferUsages() const { return m_BufferUsages; }
+
+    private:
+        std::string m_Name;
+        CommandQueue m_Queue;
+        ExecuteFn m_Execute;
+
+        bool m_HasSideEffects = false;
+        bool m_Culled = false;
+
+        std::vector<RenderGraphImageUsage> m_ImageUsages = { };
+        std::vector<RenderGraphBufferUsage> m_BufferUsages = { };
+
+        std::vector<uint32_t> m_Dependencies = { }; // Note: Passes that have to execute before this one
+
+        friend class RenderGraph;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // RenderGraph // Note: Passes declare the resources they read & write, Compile() culls passes that don't
+    // contribute to an imported resource (or have side effects), orders the rest topologically, creates the used
+    // transient resources and splits the schedule into per queue batches. Rebuild the graph every frame with Reset().
+    ////////////////////////////////////////////////////////////////////////////////////
+    class RenderGraph
+    {
+    public:
+        // Constructor & Destructor
+        RenderGraph(Device& device, const RenderGraphSpecification& specs = RenderGraphSpecification());
+        ~RenderGraph();
+
+        // Methods
+        void Reset(); // Note: Clears all passes & resources, transient resources stay pooled for the next frames
+
+        // Note: Imported resources are owned by the caller and must be tracked. With a finalState other than Unknown
+        // the resource gets transitioned to that state at the end of the batch that uses it last.
+        RenderGraphImage ImportImage(Image& image, ResourceState finalState = ResourceState::Unknown);
+        RenderGraphBuffer ImportBuffer(Buffer& buffer, ResourceState finalState = ResourceState::Unknown);
+
+        RenderGraphImage CreateImage(const ImageSpecification& specs); // Note: Transient, only gets created when a pass that isn't culled uses it
+        RenderGraphBuffer CreateBuffer(const BufferSpecification& specs);
+
+        RenderGraphPass& AddPass(const std::string& name, RenderGraphPass::ExecuteFn execute, CommandQueue queue = CommandQueue::Graphics);
+
+        void Compile();
+
+        void Execute(CommandList& list); // Note: Records every batch into list, only valid when all passes run on the same queue
+        void ExecuteBatch(uint32_t batch, CommandList& list);
+
+        // Getters
+        inline const RenderGraphSpecification& GetSpecification() const { return m_Specification; }
+
+        Image& GetImage(RenderGraphImage image) const; // Note: Transient resources are only available after Compile()
+        Buffer& GetBuffer(RenderGraphBuffer buffer) const;
+
+        inline const std::deque<RenderGraphPass>& GetPasses() const { return m_Passes; }
+        inline const std::vector<RenderGraphBatch>& GetBatches() const { return m_Batches; } // Note: Only valid after Compile()
+
+    private:
+        struct TransientImage
+        {
+        public:
+            ImageSpecification Specification;
+            Image Resource;
+
+            uint64_t LastUsedFrame = 0;
+            bool InUse = false;
+
+        public:
+            inline TransientImage(const Device& device, const ImageSpecification& specs)
+                : Specification(specs), Resource(device, specs) {}
+        };
+
+        struct AliasedImage
+        {
+        public:
+            ImageSpecification Specification;
+            uint32_t FirstUse; // Note: Positions in the schedule
+            uint32_t LastUse;
+
+            Image Resource;
+
+        public:
+            inline AliasedImage(const Device& device, const ImageSpecification& specs, const ImageHeap& heap, uint32_t firstUse, uint32_t lastUse)
+                : Specification(specs), FirstUse(firstUse), LastUse(lastUse), Resource(device, specs, heap, 0) {}
+        };
+
+        struct TransientBuffer
+        {
+        public:
+            BufferSpecification Specification;
+            Buffer Resource;
+
+            uint64_t LastUsedFrame = 0;
+            bool InUse = false;
+
+        public:
+            inline TransientBuffer(const Device& device, const BufferSpecification& specs)
+                : Specification(specs), Resource(device, specs) {}
+        };
+
+        struct ImageResource
+        {
+        public:
+            Image* ImagePtr = nullptr; // Note: Set on import or (for transients) during Compile()
+            ImageSpecification Specification = {};
+
+            bool Imported = false;
+            ResourceState FinalState = ResourceState::Unknown;
+
+            bool AliasOnFirstUse = false; // Note: Placed in memory shared with other transients
+        };
+
+        struct BufferResource
+        {
+        public:
+            Buffer* BufferPtr = nullptr;
+            BufferSpecification Specification = {};
+
+            bool Imported = false;
+            ResourceState FinalState = ResourceState::Unknown;
+        };
+
+    private:
+        // Private methods
+        void CullPasses();
+        void ResolveDependencies();
+        std::vector<uint32_t> SchedulePasses() const;
+        void CreateBatches(const std::vector<uint32_t>& schedule);
+        void AcquireTransients(const std::vector<uint32_t>& schedule);
+
+        Image& AcquireTransientImage(const ImageSpecification& specs);
+        Buffer& AcquireTransientBuffer(const BufferSpecification& specs);
+
+        void AcquireAliasedImages(const std::vector<uint32_t>& images, const std::vector<uint32_t>& firstUses, const std::vector<uint32_t>& lastUses);
+        void DestroyAliasedImages();
+
+    private:
+        Device& m_Device;
+        RenderGraphSpecification m_Specification;
+
+        uint64_t m_Frame = 0;
+        bool m_Compiled = false;
+
+        std::deque<RenderGraphPass> m_Passes = { }; // Note: std::deque so references returned by AddPass() stay valid
+        std::vector<ImageResource> m_Images = { };
+        std::vector<BufferResource> m_Buffers = { };
+
+        std::vector<RenderGraphBatch> m_Batches = { };
+        std::vector<std::vector<uint32_t>> m_BatchFinalImages = { }; // Note: Imported images that get their final state at the end of the batch
+        std::vector<std::vector<uint32_t>> m_BatchFinalBuffers = { };
+
+        // Note: std::list since images & buffers can't be moved, entries get reused across frames by specification
+        std::list<TransientImage> m_TransientImages = { };
+        std::list<TransientBuffer> m_TransientBuffers = { };
+
+        // Note: Aliased images share heaps, the layout is kept as long as the aliased images & their lifetimes stay the same
+        std::deque<ImageHeap> m_AliasHeaps = { };
+        std::deque<AliasedImage> m_AliasedImages = { };
+    };
+
+}
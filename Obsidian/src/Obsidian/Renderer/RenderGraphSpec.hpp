@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Obsidian/Renderer/ResourceSpec.hpp"
+#include "Obsidian/Renderer/ImageSpec.hpp"
+#include "Obsidian/Renderer/CommandListSpec.hpp"
+
+#include <Nano/Nano.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace Obsidian
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Flags
+    ////////////////////////////////////////////////////////////////////////////////////
+    enum class RenderGraphAccess : uint8_t
+    {
+        None = 0,
+
+        Read = 1 << 0,
+        Write = 1 << 1,
+        ReadWrite = Read | Write, // Note: For passes that keep (load) the previous contents
+    };
+
+    NANO_DEFINE_BITWISE(RenderGraphAccess)
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Handles // Note: Only valid for the RenderGraph (and frame) that created them
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct RenderGraphImage
+    {
+    public:
+        inline constexpr static uint32_t Invalid = std::numeric_limits<uint32_t>::max();
+    public:
+        uint32_t Index = Invalid;
+
+    public:
+        // Getters
+        inline constexpr bool IsValid() const { return (Index != Invalid); }
+
+        // Operators
+        inline constexpr bool operator == (const RenderGraphImage& other) const { return (Index == other.Index); }
+        inline constexpr bool operator != (const RenderGraphImage& other) const { return !(*this == other); }
+    };
+
+    struct RenderGraphBuffer
+    {
+    public:
+        inline constexpr static uint32_t Invalid = std::numeric_limits<uint32_t>::max();
+    public:
+        uint32_t Index = Invalid;
+
+    public:
+        // Getters
+        inline constexpr bool IsValid() const { return (Index != Invalid); }
+
+        // Operators
+        inline constexpr bool operator == (const RenderGraphBuffer& other) const { return (Index == other.Index); }
+        inline constexpr bool operator != (const RenderGraphBuffer& other) const { return !(*this == other); }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Usages
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct RenderGraphImageUsage
+    {
+    public:
+        RenderGraphImage Handle = {};
+        ImageSubresourceSpecification Subresources = {};
+
+        ResourceState State = ResourceState::Unknown;
+        RenderGraphAccess Access = RenderGraphAccess::None;
+    };
+
+    struct RenderGraphBufferUsage
+    {
+    public:
+        RenderGraphBuffer Handle = {};
+
+        ResourceState State = ResourceState::Unknown;
+        RenderGraphAccess Access = RenderGraphAccess::None;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // RenderGraphBatch // Note: A run of scheduled passes on the same queue, recorded into a single CommandList.
+    // Batches must be submitted in order, every batch has to wait (through WaitOnLists) on the lists of its WaitOnBatches.
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct RenderGraphBatch
+    {
+    public:
+        CommandQueue Queue = CommandQueue::Graphics;
+
+        std::vector<uint32_t> Passes = { }; // Note: Indices into the graph's passes, in execution order
+        std::vector<uint32_t> WaitOnBatches = { }; // Note: Earlier batches on other queues this batch depends on
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // RenderGraphSpecification
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct RenderGraphSpecification
+    {
+    public:
+        uint32_t TransientLifetime = 3; // Note: Amount of frames (Reset calls) an unused transient resource stays alive for reuse
+
+        // Note: Transient images that are only used on the graphics queue and whose lifetimes (in the schedule)
+        // don't overlap get placed in the same memory, the graph inserts the aliasing barriers on their first use.
+        bool AliasTransientImages = true;
+
+        std::string DebugName = {};
+
+    public:
+        // Setters
+        inline constexpr RenderGraphSpecification& SetTransientLifetime(uint32_t frames) { TransientLifetime = frames; return *this; }
+        inline constexpr RenderGraphSpecification& SetAliasTransientImages(bool enabled) { AliasTransientImages = enabled; return *this; }
+        inline RenderGraphSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
+    };
+
+}
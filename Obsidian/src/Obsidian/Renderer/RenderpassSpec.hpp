@@ -1,10 +1,14 @@
 #pragma once
 
+#include "Obsidian/Core/Information.hpp"
+
 #include "Obsidian/Maths/Structs.hpp"
 
 #include "Obsidian/Renderer/ResourceSpec.hpp"
 #include "Obsidian/Renderer/ImageSpec.hpp"
 
+#include <Nano/Nano.hpp>
+
 #include <cstdint>
 #include <cmath>
 #include <string>
@@ -12,6 +16,8 @@
 namespace Obsidian
 {
 
+    class Image;
+
     ////////////////////////////////////////////////////////////////////////////////////
     // Flags
     ////////////////////////////////////////////////////////////////////////////////////
@@ -93,6 +99,41 @@ namespace Obsidian
         inline constexpr int GetHeight() const { return MaxY - MinY; }
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////
+    // RenderpassAttachmentSpecification
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct RenderpassAttachmentSpecification
+    {
+    public:
+        ImageSpecification Specification = {}; // Note: Every attachment has its own format & sample count
+        LoadOperation Load = LoadOperation::Clear;
+        StoreOperation Store = StoreOperation::Store;
+        ResourceState StartState = ResourceState::Present;
+        ResourceState RenderingState = ResourceState::RenderTarget;
+        ResourceState EndState = ResourceState::Present;
+
+        // Note: Only for multisampled colour attachments, the attachment gets resolved into
+        // the framebuffer's resolve attachment at the end of the renderpass when this is set.
+        ImageSpecification ResolveSpecification = {};
+        ResourceState ResolveEndState = ResourceState::ShaderResource;
+
+    public:
+        // Setters
+        inline constexpr RenderpassAttachmentSpecification& SetImageSpecification(const ImageSpecification& specs) { Specification = specs; return *this; }
+        inline constexpr RenderpassAttachmentSpecification& SetLoadOperation(LoadOperation operation) { Load = operation; return *this; }
+        inline constexpr RenderpassAttachmentSpecification& SetStoreOperation(StoreOperation operation) { Store = operation; return *this; }
+        inline constexpr RenderpassAttachmentSpecification& SetStartState(ResourceState state) { StartState = state; return *this; }
+        inline constexpr RenderpassAttachmentSpecification& SetRenderingState(ResourceState state) { RenderingState = state; return *this; }
+        inline constexpr RenderpassAttachmentSpecification& SetEndState(ResourceState state) { EndState = state; return *this; }
+
+        inline constexpr RenderpassAttachmentSpecification& SetResolveImageSpecification(const ImageSpecification& specs) { ResolveSpecification = specs; return *this; }
+        inline constexpr RenderpassAttachmentSpecification& SetResolveEndState(ResourceState state) { ResolveEndState = state; return *this; }
+
+        // Methods
+        inline constexpr bool IsValid() const { return ((Specification.Width != 0) || (Specification.Height != 0)); }
+        inline constexpr bool HasResolve() const { return ((ResolveSpecification.Width != 0) || (ResolveSpecification.Height != 0)); }
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
     // RenderpassSpecification
     ////////////////////////////////////////////////////////////////////////////////////
@@ -101,41 +142,83 @@ namespace Obsidian
     public:
         PipelineBindpoint Bindpoint = PipelineBindpoint::Graphics;
 
-        ImageSpecification ColourSpecification = {};
-        LoadOperation ColourLoadOperation = LoadOperation::Clear;
-        StoreOperation ColourStoreOperation = StoreOperation::Store;
-        ResourceState ColourImageStartState = ResourceState::Present;
-        ResourceState ColourImageRenderingState = ResourceState::RenderTarget;
-        ResourceState ColourImageEndState = ResourceState::Present;
-
-        ImageSpecification DepthSpecification = {};
-        LoadOperation DepthLoadOperation = LoadOperation::Clear;
-        StoreOperation DepthStoreOperation = StoreOperation::Store;
-        ResourceState DepthImageStartState = ResourceState::DepthWrite;
-        ResourceState DepthImageRenderingState = ResourceState::DepthWrite;
-        ResourceState DepthImageEndState = ResourceState::DepthWrite;
+        Nano::Memory::StaticVector<RenderpassAttachmentSpecification, Information::MaxColourAttachments> ColourAttachments = {};
+        RenderpassAttachmentSpecification DepthAttachment = RenderpassAttachmentSpecification().SetStartState(ResourceState::DepthWrite).SetRenderingState(ResourceState::DepthWrite).SetEndState(ResourceState::DepthWrite);
 
         std::string DebugName = {};
 
     public:
         // Setters
         inline constexpr RenderpassSpecification& SetBindpoint(PipelineBindpoint point) { Bindpoint = point; return *this; }
-        
-        inline constexpr RenderpassSpecification& SetColourImageSpecification(const ImageSpecification& specs) { ColourSpecification = specs; return *this; }
-        inline constexpr RenderpassSpecification& SetColourLoadOperation(LoadOperation operation) { ColourLoadOperation = operation; return *this; }
-        inline constexpr RenderpassSpecification& SetColourStoreOperation(StoreOperation operation) { ColourStoreOperation = operation; return *this; }
-        inline constexpr RenderpassSpecification& SetColourStartState(ResourceState state) { ColourImageStartState = state; return *this; }
-        inline constexpr RenderpassSpecification& SetColourRenderingState(ResourceState state) { ColourImageRenderingState = state; return *this; }
-        inline constexpr RenderpassSpecification& SetColourEndState(ResourceState state) { ColourImageEndState = state; return *this; }
-
-        inline constexpr RenderpassSpecification& SetDepthImageSpecification(const ImageSpecification& specs) { DepthSpecification = specs; return *this; }
-        inline constexpr RenderpassSpecification& SetDepthLoadOperation(LoadOperation operation) { DepthLoadOperation = operation; return *this; }
-        inline constexpr RenderpassSpecification& SetDepthStoreOperation(StoreOperation operation) { DepthStoreOperation = operation; return *this; }
-        inline constexpr RenderpassSpecification& SetDepthStartState(ResourceState state) { DepthImageStartState = state; return *this; }
-        inline constexpr RenderpassSpecification& SetDepthRenderingState(ResourceState state) { DepthImageRenderingState = state; return *this; }
-        inline constexpr RenderpassSpecification& SetDepthEndState(ResourceState state) { DepthImageEndState = state; return *this; }
+
+        inline RenderpassSpecification& AddColourAttachment(const RenderpassAttachmentSpecification& attachment) { ColourAttachments.push_back(attachment); return *this; }
+        inline constexpr RenderpassSpecification& SetDepthAttachment(const RenderpassAttachmentSpecification& attachment) { DepthAttachment = attachment; return *this; }
+
+        // Note: The Colour setters below apply to the first colour attachment
+        inline RenderpassSpecification& SetColourImageSpecification(const ImageSpecification& specs) { GetFirstColourAttachment().Specification = specs; return *this; }
+        inline RenderpassSpecification& SetColourLoadOperation(LoadOperation operation) { GetFirstColourAttachment().Load = operation; return *this; }
+        inline RenderpassSpecification& SetColourStoreOperation(StoreOperation operation) { GetFirstColourAttachment().Store = operation; return *this; }
+        inline RenderpassSpecification& SetColourStartState(ResourceState state) { GetFirstColourAttachment().StartState = state; return *this; }
+        inline RenderpassSpecification& SetColourRenderingState(ResourceState state) { GetFirstColourAttachment().RenderingState = state; return *this; }
+        inline RenderpassSpecification& SetColourEndState(ResourceState state) { GetFirstColourAttachment().EndState = state; return *this; }
+
+        inline constexpr RenderpassSpecification& SetDepthImageSpecification(const ImageSpecification& specs) { DepthAttachment.Specification = specs; return *this; }
+        inline constexpr RenderpassSpecification& SetDepthLoadOperation(LoadOperation operation) { DepthAttachment.Load = operation; return *this; }
+        inline constexpr RenderpassSpecification& SetDepthStoreOperation(StoreOperation operation) { DepthAttachment.Store = operation; return *this; }
+        inline constexpr RenderpassSpecification& SetDepthStartState(ResourceState state) { DepthAttachment.StartState = state; return *this; }
+        inline constexpr RenderpassSpecification& SetDepthRenderingState(ResourceState state) { DepthAttachment.RenderingState = state; return *this; }
+        inline constexpr RenderpassSpecification& SetDepthEndState(ResourceState state) { DepthAttachment.EndState = state; return *this; }
 
         inline RenderpassSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
+
+    private:
+        // Private methods
+        inline RenderpassAttachmentSpecification& GetFirstColourAttachment() { if (ColourAttachments.empty()) ColourAttachments.emplace_back(); return ColourAttachments[0]; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // RenderingAttachment // Note: Used for dynamic rendering, where StartRenderpass takes the attachments
+    // directly instead of a Renderpass & Framebuffer. The attachment gets transitioned to its RenderingState
+    // before rendering and (if EndState isn't Unknown) to its EndState after rendering.
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct RenderingAttachment
+    {
+    public:
+        Image* ImagePtr = nullptr;
+        ImageSubresourceSpecification Subresources = ImageSubresourceSpecification(0, 1, 0, ImageSubresourceSpecification::AllArraySlices);
+
+        LoadOperation Load = LoadOperation::Clear;
+        StoreOperation Store = StoreOperation::Store;
+
+        ResourceState RenderingState = ResourceState::Unknown; // Note: Unknown selects RenderTarget for colour & DepthWrite for depth attachments
+        ResourceState EndState = ResourceState::Unknown;
+
+        // Note: Only for multisampled colour attachments, gets resolved into at the end of rendering
+        Image* ResolveImagePtr = nullptr;
+        ImageSubresourceSpecification ResolveSubresources = ImageSubresourceSpecification(0, 1, 0, ImageSubresourceSpecification::AllArraySlices);
+        ResourceState ResolveEndState = ResourceState::Unknown;
+
+    public:
+        // Setters
+        inline constexpr RenderingAttachment& SetImage(Image& image) { ImagePtr = &image; return *this; }
+        inline constexpr RenderingAttachment& SetSubresources(const ImageSubresourceSpecification& subresources) { Subresources = subresources; return *this; }
+        inline constexpr RenderingAttachment& SetArraySlice(ArraySlice index) { Subresources.BaseArraySlice = index; Subresources.NumArraySlices = 1; return *this; }
+        inline constexpr RenderingAttachment& SetArraySliceRange(ArraySlice index, ArraySlice count) { Subresources.BaseArraySlice = index; Subresources.NumArraySlices = count; return *this; }
+        inline constexpr RenderingAttachment& SetMipLevel(MipLevel level) { Subresources.BaseMipLevel = level; Subresources.NumMipLevels = 1; return *this; }
+
+        inline constexpr RenderingAttachment& SetLoadOperation(LoadOperation operation) { Load = operation; return *this; }
+        inline constexpr RenderingAttachment& SetStoreOperation(StoreOperation operation) { Store = operation; return *this; }
+
+        inline constexpr RenderingAttachment& SetRenderingState(ResourceState state) { RenderingState = state; return *this; }
+        inline constexpr RenderingAttachment& SetEndState(ResourceState state) { EndState = state; return *this; }
+
+        inline constexpr RenderingAttachment& SetResolveImage(Image& image) { ResolveImagePtr = &image; return *this; }
+        inline constexpr RenderingAttachment& SetResolveSubresources(const ImageSubresourceSpecification& subresources) { ResolveSubresources = subresources; return *this; }
+        inline constexpr RenderingAttachment& SetResolveEndState(ResourceState state) { ResolveEndState = state; return *this; }
+
+        // Methods
+        inline constexpr bool IsValid() const { return (ImagePtr != nullptr); }
+        inline constexpr bool HasResolve() const { return (ResolveImagePtr != nullptr); }
     };
 
 }
\ No newline at end of file
@@ -10,7 +10,7 @@ namespace Obsidian
     ////////////////////////////////////////////////////////////////////////////////////
     // Flags
     ////////////////////////////////////////////////////////////////////////////////////
-    enum class ResourceState : uint16_t
+    enum class ResourceState : uint32_t
     {
         Unknown = 0,
         Common = Unknown,
@@ -30,10 +30,13 @@ namespace Obsidian
         CopyDst = 1 << 9,
         CopySrc = 1 << 10,
         Present = 1 << 11,
-        //AccelStructRead = 1 << 12,
-        //AccelStructWrite = 1 << 13,
-        //AccelStructBuildInput = 1 << 14,
-        //AccelStructBuildBlas = 1 << 15,
+        ResolveSrc = 1 << 12,
+        ResolveDst = 1 << 13,
+        HostRead = 1 << 14, // Note: Makes copied data visible to the CPU, used for readbacks
+        //AccelStructRead = 1 << 15,
+        //AccelStructWrite = 1 << 16,
+        //AccelStructBuildInput = 1 << 17,
+        //AccelStructBuildBlas = 1 << 18,
     };
 
     NANO_DEFINE_BITWISE(ResourceState)
@@ -78,6 +81,12 @@ namespace Obsidian
             str += (str.empty() ? "" : " | ") + std::string("CopySrc");
         if (static_cast<bool>(state & ResourceState::Present))
             str += (str.empty() ? "" : " | ") + std::string("Present");
+        if (static_cast<bool>(state & ResourceState::ResolveSrc))
+            str += (str.empty() ? "" : " | ") + std::string("ResolveSrc");
+        if (static_cast<bool>(state & ResourceState::ResolveDst))
+            str += (str.empty() ? "" : " | ") + std::string("ResolveDst");
+        if (static_cast<bool>(state & ResourceState::HostRead))
+            str += (str.empty() ? "" : " | ") + std::string("HostRead");
 
         return (str.empty() ? "Unknown" : str);
     }
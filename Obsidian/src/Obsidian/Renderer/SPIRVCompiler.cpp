@@ -0,0 +1,356 @@
+#include "obpch.h"
+#include "SPIRVCompiler.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include <bit>
+#include <array>
+#include <format>
+#include <fstream>
+#include <utility>
+#include <algorithm>
+#include <string_view>
+
+namespace Obsidian::Internal
+{
+
+    namespace
+    {
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // ShaderStageMapping
+        ////////////////////////////////////////////////////////////////////////////////////
+        struct ShaderStageMapping
+        {
+        public:
+            ShaderStage Stage;
+
+            shaderc_shader_kind ShaderCShaderKind;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // ShaderStageMapping array
+        ////////////////////////////////////////////////////////////////////////////////////
+        constexpr static auto g_ShaderStageMapping = std::to_array<ShaderStageMapping>({
+            // Stage                                ShaderCShaderKind
+            { ShaderStage::None,                    shaderc_glsl_vertex_shader }, // Default
+            { ShaderStage::Vertex,                  shaderc_glsl_vertex_shader },
+            { ShaderStage::Fragment,                shaderc_glsl_fragment_shader },
+            { ShaderStage::Compute,                 shaderc_glsl_compute_shader },
+            { ShaderStage::Geometry,                shaderc_glsl_geometry_shader },
+            { ShaderStage::TesselationControl,      shaderc_glsl_tess_control_shader },
+            { ShaderStage::TesselationEvaluation,   shaderc_glsl_tess_evaluation_shader },
+            { ShaderStage::Task,                    shaderc_glsl_task_shader },
+            { ShaderStage::Mesh,                    shaderc_glsl_mesh_shader },
+            { ShaderStage::AllGraphics,             shaderc_glsl_vertex_shader }, // Default
+            { ShaderStage::RayGeneration,           shaderc_glsl_raygen_shader },
+            { ShaderStage::AnyHit,                  shaderc_glsl_anyhit_shader },
+            { ShaderStage::ClosestHit,              shaderc_glsl_closesthit_shader },
+            { ShaderStage::Miss,                    shaderc_glsl_miss_shader },
+            { ShaderStage::Intersection,            shaderc_glsl_intersection_shader },
+            { ShaderStage::Callable,                shaderc_glsl_callable_shader }
+        });
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Helper methods
+        ////////////////////////////////////////////////////////////////////////////////////
+        constexpr static shaderc_shader_kind ShaderStageToShaderCKind(ShaderStage stage)
+        {
+            return g_ShaderStageMapping[(std::to_underlying(stage) ? (std::countr_zero(std::to_underlying(stage)) + 1) : 0)].ShaderCShaderKind;
+        }
+
+        constexpr static shaderc_optimization_level ShaderOptimizationToShaderCOptimizationLevel(ShaderOptimization optimization)
+        {
+            switch (optimization)
+            {
+            case ShaderOptimization::None:          return shaderc_optimization_level_zero;
+            case ShaderOptimization::Size:          return shaderc_optimization_level_size;
+            case ShaderOptimization::Performance:   return shaderc_optimization_level_performance;
+
+            default:
+                break;
+            }
+
+            return shaderc_optimization_level_zero;
+        }
+
+        // Note: FNV-1a, the key must stay the same across runs & platforms, which std::hash doesn't guarantee
+        class StableHasher
+        {
+        public:
+            inline void Add(const void* data, size_t size)
+            {
+                const uint8_t* bytes = static_cast<const uint8_t*>(data);
+                for (size_t i = 0; i < size; i++)
+                {
+                    m_Hash ^= bytes[i];
+                    m_Hash *= 1099511628211ull;
+                }
+            }
+
+            template<typename T>
+            inline void Add(const T& value) requires(std::is_trivially_copyable_v<T>) { Add(&value, sizeof(T)); }
+
+            inline void Add(std::string_view str) { Add(static_cast<uint64_t>(str.size())); Add(str.data(), str.size()); } // Note: The size prevents ("ab", "c") and ("a", "bc") from colliding
+
+            inline uint64_t Get() const { return m_Hash; }
+
+        private:
+            uint64_t m_Hash = 14695981039346656037ull;
+        };
+
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    SPIRVCompiler::SPIRVCompiler(const ShaderCompilerSpecification& specs)
+        : m_Specification(specs)
+    {
+        // Note: shaderc has no build identifier, so we compile a fixed shader per language with our options and hash the results.
+        // The SPIRV header contains the generator's version and any codegen change alters the binary.
+        if (!m_Specification.CacheDirectory.empty())
+        {
+            OB_PROFILE("SPIRVCompiler::SPIRVCompiler::ProbeCompiler");
+
+            constexpr std::string_view glslProbe = "#version 450\nlayout(location = 0) out vec4 o_Colour;\nvoid main() { o_Colour = vec4(1.0); }\n";
+            constexpr std::string_view hlslProbe = "cbuffer Probe : register(b0, space0) { float4 Colour; };\nfloat4 main() : SV_Target { return Colour; }\n";
+
+            StableHasher hasher;
+            m_UseCache = true;
+
+            for (const auto& [language, probe] : std::to_array<std::pair<ShadingLanguage, std::string_view>>({ { ShadingLanguage::GLSL, glslProbe }, { ShadingLanguage::HLSL, hlslProbe } }))
+            {
+                shaderc::SpvCompilationResult module = m_Compiler.CompileGlslToSpv(probe.data(), probe.size(), shaderc_glsl_fragment_shader, "probe", "main", CreateOptions(language));
+                if (module.GetCompilationStatus() != shaderc_compilation_status_success) // Note: A failed probe can't identify the compiler, so nothing may be cached
+                {
+                    OB_LOG_WARN("[SPIRVCompiler] Failed to compile the compiler probe, disabling the shader cache: {0}", module.GetErrorMessage());
+                    m_UseCache = false;
+                    break;
+                }
+
+                for (auto it = module.cbegin(); it != module.cend(); it++)
+                    hasher.Add(*it);
+            }
+
+            m_CompilerBuildID = hasher.Get();
+        }
+    }
+
+    SPIRVCompiler::~SPIRVCompiler()
+    {
+        {
+            std::scoped_lock lock(m_QueueMutex);
+            m_Stopping = true;
+        }
+        m_QueueCondition.notify_all();
+
+        for (std::thread& worker : m_Workers)
+            worker.join();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    std::vector<uint32_t> SPIRVCompiler::Compile(const ShaderCompileArgs& args)
+    {
+        return Compile(m_Compiler, args);
+    }
+
+    std::future<std::vector<uint32_t>> SPIRVCompiler::CompileAsync(const ShaderCompileArgs& args)
+    {
+        std::call_once(m_WorkersStarted, [this]() { StartWorkers(); });
+
+        std::packaged_task<std::vector<uint32_t>(shaderc::Compiler&)> task([this, args](shaderc::Compiler& compiler) { return Compile(compiler, args); });
+        std::future<std::vector<uint32_t>> future = task.get_future();
+
+        {
+            std::scoped_lock lock(m_QueueMutex);
+            m_Queue.emplace_back(std::move(task));
+        }
+        m_QueueCondition.notify_one();
+
+        return future;
+    }
+
+    std::vector<std::vector<uint32_t>> SPIRVCompiler::CompileBatch(std::span<const ShaderCompileArgs> args)
+    {
+        OB_PROFILE("SPIRVCompiler::CompileBatch()");
+
+        std::vector<std::future<std::vector<uint32_t>>> futures;
+        futures.reserve(args.size());
+
+        for (const ShaderCompileArgs& arg : args)
+            futures.push_back(CompileAsync(arg));
+
+        std::vector<std::vector<uint32_t>> results;
+        results.reserve(futures.size());
+
+        for (std::future<std::vector<uint32_t>>& future : futures)
+            results.push_back(future.get());
+
+        return results;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    std::vector<uint32_t> SPIRVCompiler::Compile(shaderc::Compiler& compiler, const ShaderCompileArgs& args) const
+    {
+        OB_PROFILE("SPIRVCompiler::Compile()");
+        OB_ASSERT((!args.Code.empty()), "[SPIRVCompiler] Empty string passed in as shader code.");
+
+        const bool useCache = m_UseCache;
+        const uint64_t key = (useCache ? GetCacheKey(args) : 0);
+
+        std::vector<uint32_t> spirv;
+        if (useCache && LoadFromCache(key, spirv))
+            return spirv;
+
+        shaderc::CompileOptions options = CreateOptions(args.Language);
+        for (const auto& [name, value] : args.Macros)
+            options.AddMacroDefinition(name, value);
+
+        shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(args.Code, ShaderStageToShaderCKind(args.Stage), "", args.EntryPoint.c_str(), options);
+
+        OB_ASSERT((module.GetCompilationStatus() == shaderc_compilation_status_success), "[SPIRVCompiler] Error compiling shader: {0}", module.GetErrorMessage());
+        if (module.GetCompilationStatus() != shaderc_compilation_status_success)
+            return {};
+
+        spirv.assign(module.cbegin(), module.cend());
+
+        if (useCache)
+            StoreInCache(key, spirv);
+
+        return spirv;
+    }
+
+    shaderc::CompileOptions SPIRVCompiler::CreateOptions(ShadingLanguage language) const
+    {
+        // Set language
+        shaderc::CompileOptions options = {};
+        options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_3);
+        options.SetOptimizationLevel(ShaderOptimizationToShaderCOptimizationLevel(m_Specification.Optimization));
+
+        // Note: Forces the shaders to manually set all registers/sets/bindings
+        options.SetAutoBindUniforms(false);
+
+        if (language == ShadingLanguage::GLSL)
+            options.SetSourceLanguage(shaderc_source_language_glsl);
+        else if (language == ShadingLanguage::HLSL)
+        {
+            options.SetSourceLanguage(shaderc_source_language_hlsl);
+            options.SetTargetSpirv(shaderc_spirv_version_1_6);
+
+            options.AddMacroDefinition("HLSL");
+            options.SetHlslIoMapping(true); // Note: Needed for `register(b0, space0)` layout
+        }
+
+        return options;
+    }
+
+    uint64_t SPIRVCompiler::GetCacheKey(const ShaderCompileArgs& args) const
+    {
+        StableHasher hasher;
+        hasher.Add(CacheVersion);
+        hasher.Add(m_CompilerBuildID);
+        hasher.Add(std::string_view(m_Specification.CacheSalt));
+        hasher.Add(std::to_underlying(m_Specification.Optimization));
+
+        hasher.Add(std::to_underlying(args.Stage));
+        hasher.Add(std::to_underlying(args.Language));
+        hasher.Add(std::string_view(args.EntryPoint));
+        hasher.Add(std::string_view(args.Code));
+
+        hasher.Add(static_cast<uint64_t>(args.Macros.size()));
+        for (const auto& [name, value] : args.Macros)
+        {
+            hasher.Add(std::string_view(name));
+            hasher.Add(std::string_view(value));
+        }
+
+        return hasher.Get();
+    }
+
+    bool SPIRVCompiler::LoadFromCache(uint64_t key, std::vector<uint32_t>& spirv) const
+    {
+        OB_PROFILE("SPIRVCompiler::LoadFromCache()");
+
+        std::ifstream file(m_Specification.CacheDirectory / std::format("{0:016x}.spv", key), std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+            return false;
+
+        const std::streamsize size = file.tellg();
+        if ((size <= 0) || ((size % sizeof(uint32_t)) != 0))
+            return false;
+
+        spirv.resize(static_cast<size_t>(size) / sizeof(uint32_t));
+
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(spirv.data()), size))
+        {
+            spirv.clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    void SPIRVCompiler::StoreInCache(uint64_t key, std::span<const uint32_t> spirv) const
+    {
+        OB_PROFILE("SPIRVCompiler::StoreInCache()");
+
+        std::error_code error;
+        std::filesystem::create_directories(m_Specification.CacheDirectory, error);
+
+        // Note: Written to a unique temporary file first, so other threads/processes never read a partially written entry
+        const std::filesystem::path path = m_Specification.CacheDirectory / std::format("{0:016x}.spv", key);
+        const std::filesystem::path temporaryPath = m_Specification.CacheDirectory / std::format("{0:016x}.{1}.tmp", key, std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open() || !file.write(reinterpret_cast<const char*>(spirv.data()), static_cast<std::streamsize>(spirv.size_bytes())))
+            {
+                OB_LOG_WARN("[SPIRVCompiler] Failed to write shader cache entry to {0}.", temporaryPath.string());
+                return;
+            }
+        }
+
+        std::filesystem::rename(temporaryPath, path, error);
+        if (error)
+            std::filesystem::remove(temporaryPath, error);
+    }
+
+    void SPIRVCompiler::StartWorkers()
+    {
+        const uint32_t threadCount = ((m_Specification.ThreadCount != 0) ? m_Specification.ThreadCount : std::max(std::thread::hardware_concurrency(), 1u));
+
+        m_Workers.reserve(threadCount);
+        for (uint32_t i = 0; i < threadCount; i++)
+            m_Workers.emplace_back([this]() { WorkerThread(); });
+    }
+
+    void SPIRVCompiler::WorkerThread()
+    {
+        shaderc::Compiler compiler = {}; // Note: Every worker has its own compiler instance
+
+        while (true)
+        {
+            std::move_only_function<void(shaderc::Compiler&)> task;
+            {
+                std::unique_lock lock(m_QueueMutex);
+                m_QueueCondition.wait(lock, [this]() { return (m_Stopping || !m_Queue.empty()); });
+
+                if (m_Queue.empty()) // Note: Only empty when stopping, remaining tasks still get finished first
+                    return;
+
+                task = std::move(m_Queue.front());
+                m_Queue.pop_front();
+            }
+
+            task(compiler);
+        }
+    }
+
+}
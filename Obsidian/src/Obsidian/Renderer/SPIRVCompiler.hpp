@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Obsidian/Renderer/ShaderSpec.hpp"
+
+#include <shaderc/shaderc.hpp>
+
+#include <cstdint>
+#include <span>
+#include <deque>
+#include <mutex>
+#include <vector>
+#include <future>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+namespace Obsidian::Internal
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // SPIRVCompiler // Note: The shaderc frontend shared by the Vulkan & Dx12 ShaderCompilers. Results go
+    // through an on-disk cache keyed by a hash of everything that influences the output, asynchronous
+    // compiles run on a pool of worker threads which each own a separate shaderc::Compiler.
+    ////////////////////////////////////////////////////////////////////////////////////
+    class SPIRVCompiler
+    {
+    public:
+        inline constexpr static uint32_t CacheVersion = 1; // Note: Bump when the compile options change, invalidates all cached SPIRV
+    public:
+        // Constructor & Destructor
+        SPIRVCompiler(const ShaderCompilerSpecification& specs);
+        ~SPIRVCompiler();
+
+        // Methods
+        std::vector<uint32_t> Compile(const ShaderCompileArgs& args); // Note: Compiles on the calling thread
+        std::future<std::vector<uint32_t>> CompileAsync(const ShaderCompileArgs& args);
+        std::vector<std::vector<uint32_t>> CompileBatch(std::span<const ShaderCompileArgs> args); // Note: Returns the results in the order of args
+
+        // Getters
+        inline const ShaderCompilerSpecification& GetSpecification() const { return m_Specification; }
+
+    private:
+        // Private methods
+        std::vector<uint32_t> Compile(shaderc::Compiler& compiler, const ShaderCompileArgs& args) const;
+        shaderc::CompileOptions CreateOptions(ShadingLanguage language) const; // Note: Shared by the probe & actual compiles, so the build ID covers every option
+
+        uint64_t GetCacheKey(const ShaderCompileArgs& args) const;
+        bool LoadFromCache(uint64_t key, std::vector<uint32_t>& spirv) const;
+        void StoreInCache(uint64_t key, std::span<const uint32_t> spirv) const;
+
+        void StartWorkers(); // Note: Workers are only started on the first asynchronous compile
+        void WorkerThread();
+
+    private:
+        ShaderCompilerSpecification m_Specification;
+
+        shaderc::Compiler m_Compiler = {};
+        uint64_t m_CompilerBuildID = 0; // Note: Hash of the probe shaders compiled at construction, changes with the shaderc build that produced it
+        bool m_UseCache = false; // Note: Only when a CacheDirectory is set and the probes compiled
+
+        std::once_flag m_WorkersStarted = {};
+        std::vector<std::thread> m_Workers = { };
+
+        std::mutex m_QueueMutex = {};
+        std::condition_variable m_QueueCondition = {};
+        std::deque<std::move_only_function<void(shaderc::Compiler&)>> m_Queue = { };
+        bool m_Stopping = false;
+    };
+
+}
@@ -11,7 +11,9 @@
 
 #include <Nano/Nano.hpp>
 
+#include <span>
 #include <vector>
+#include <future>
 
 namespace Obsidian
 {
@@ -36,6 +38,7 @@ namespace Obsidian
 
         // Getters
         inline const ShaderSpecification& GetSpecification() const { return m_Impl->GetSpecification(); }
+        inline size_t GetCodeHash() const { return m_Impl->GetCodeHash(); } // Note: Hash of the code, entry point & stage, equal shaders created separately share it
 
     public: //private:
         // Constructor
@@ -62,12 +65,18 @@ namespace Obsidian
         >;
     public:
         // Constructor & Destructor
-        inline ShaderCompiler() { m_Impl.Construct(); }
+        inline ShaderCompiler(const ShaderCompilerSpecification& specs = ShaderCompilerSpecification()) { m_Impl.Construct(specs); }
         ~ShaderCompiler() = default;
 
         // Methods
         // Note: SPIRV is the format that the underlying API can use for all backends.
         inline std::vector<uint32_t> CompileToSPIRV(ShaderStage stage, const std::string& code, const std::string& entryPoint = "main", ShadingLanguage language = ShadingLanguage::GLSL) { return m_Impl->CompileToSPIRV(stage, code, entryPoint, language); }
+        inline std::vector<uint32_t> CompileToSPIRV(const ShaderCompileArgs& args) { return m_Impl->CompileToSPIRV(args); }
+
+        // Note: Compiles on a pool of worker threads (started on first use), every worker owns a separate compiler instance.
+        // With a CacheDirectory set, unchanged shaders are loaded from disk instead of being compiled again.
+        inline std::future<std::vector<uint32_t>> CompileAsync(const ShaderCompileArgs& args) { return m_Impl->CompileAsync(args); }
+        inline std::vector<std::vector<uint32_t>> CompileBatch(std::span<const ShaderCompileArgs> args) { return m_Impl->CompileBatch(args); } // Note: Compiles all args concurrently, returns the results in the same order
 
 #if defined(OB_API_VULKAN)
         // Note: This API should not be use unless you explicitly know what you are doing.
@@ -0,0 +1,332 @@
+#include "obpch.h"
+#include "ShaderReflection.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+#include "Obsidian/Renderer/Bindings.hpp"
+
+#include <spirv_cross.hpp>
+
+#include <tuple>
+#include <limits>
+#include <algorithm>
+
+namespace Obsidian
+{
+
+    namespace
+    {
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Helper methods
+        ////////////////////////////////////////////////////////////////////////////////////
+        uint16_t GetArraySize(const spirv_cross::SPIRType& type) // Note: Returns 0 for runtime sized arrays
+        {
+            uint32_t size = 1;
+            for (size_t i = 0; i < type.array.size(); i++)
+            {
+                OB_ASSERT(type.array_size_literal[i], "[ShaderReflection] Arrays sized by specialization constants are not supported.");
+
+                if (type.array[i] == 0)
+                    return 0;
+
+                size *= type.array[i];
+            }
+
+            OB_ASSERT((size <= std::numeric_limits<uint16_t>::max()), "[ShaderReflection] Array size {0} exceeds the maximum of {1}.", size, std::numeric_limits<uint16_t>::max());
+            return static_cast<uint16_t>(size);
+        }
+
+        std::string GetResourceName(const spirv_cross::Compiler& compiler, const spirv_cross::Resource& resource) // Note: Prefers the instance name over the block name
+        {
+            const std::string& name = compiler.get_name(resource.id);
+            return (name.empty() ? resource.name : name);
+        }
+
+        bool SameItems(std::span<const BindingLayoutItem> a, std::span<const BindingLayoutItem> b) // Note: Unlike BindingLayoutItem::operator==, visibility matters for the layout
+        {
+            return std::ranges::equal(a, b, [](const BindingLayoutItem& lhs, const BindingLayoutItem& rhs) { return ((lhs == rhs) && (lhs.Visibility == rhs.Visibility)); });
+        }
+
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    ShaderReflection::ShaderReflection(ShaderStage stage, std::span<const uint32_t> spirv, const std::string& entryPoint)
+        : m_Stages(stage)
+    {
+        OB_PROFILE("ShaderReflection::ShaderReflection()");
+        OB_ASSERT((!spirv.empty()), "[ShaderReflection] Empty SPIRV passed in.");
+
+        spirv_cross::Compiler compiler(spirv.data(), spirv.size());
+
+        // Note: Modules may contain multiple entry points, only resources used by the selected one are reflected
+        for (const spirv_cross::EntryPoint& entry : compiler.get_entry_points_and_stages())
+        {
+            if (entry.name == entryPoint)
+            {
+                compiler.set_entry_point(entry.name, entry.execution_model);
+                break;
+            }
+        }
+
+        spirv_cross::ShaderResources resources = compiler.get_shader_resources(compiler.get_active_interface_variables());
+
+        auto addBinding = [&](const spirv_cross::Resource& resource, ResourceType type)
+        {
+            ShaderReflectionBinding& binding = m_Bindings.emplace_back();
+            binding.RegisterSpace = static_cast<uint8_t>(compiler.get_decoration(resource.id, spv::DecorationDescriptorSet));
+            binding.Slot = compiler.get_decoration(resource.id, spv::DecorationBinding);
+            binding.Type = type;
+            binding.ArraySize = GetArraySize(compiler.get_type(resource.type_id));
+            binding.Visibility = stage;
+            binding.Name = GetResourceName(compiler, resource);
+        };
+
+        for (const spirv_cross::Resource& resource : resources.uniform_buffers)
+            addBinding(resource, ResourceType::UniformBuffer);
+
+        for (const spirv_cross::Resource& resource : resources.storage_buffers)
+        {
+            const bool readOnly = compiler.get_buffer_block_flags(resource.id).get(spv::DecorationNonWritable);
+            addBinding(resource, (readOnly ? ResourceType::StorageBuffer : ResourceType::StorageBufferUnordered));
+        }
+
+        // Note: Texel buffers show up as images with a buffer dimension
+        for (const spirv_cross::Resource& resource : resources.separate_images)
+            addBinding(resource, ((compiler.get_type(resource.type_id).image.dim == spv::DimBuffer) ? ResourceType::StorageBuffer : ResourceType::Image));
+        for (const spirv_cross::Resource& resource : resources.storage_images)
+            addBinding(resource, ((compiler.get_type(resource.type_id).image.dim == spv::DimBuffer) ? ResourceType::StorageBufferUnordered : ResourceType::ImageUnordered));
+
+        for (const spirv_cross::Resource& resource : resources.separate_samplers)
+            addBinding(resource, ResourceType::Sampler);
+
+        OB_ASSERT(resources.sampled_images.empty(), "[ShaderReflection] Combined image samplers are not supported, use separate images & samplers.");
+        OB_ASSERT(resources.acceleration_structures.empty(), "[ShaderReflection] Acceleration structures are not supported.");
+
+        if (!resources.push_constant_buffers.empty())
+        {
+            const size_t size = compiler.get_declared_struct_size(compiler.get_type(resources.push_constant_buffers[0].base_type_id));
+            OB_ASSERT((size <= BindingLayoutItem::MaxPushConstantSize), "[ShaderReflection] Push constants size {0} exceeds the maximum of {1}.", size, BindingLayoutItem::MaxPushConstantSize);
+
+            m_PushConstantsSize = static_cast<uint16_t>(size);
+            m_PushConstantsVisibility = stage;
+        }
+
+        if (compiler.get_execution_mode_bitset().get(spv::ExecutionModeLocalSize))
+        {
+            for (uint32_t i = 0; i < 3; i++)
+                m_WorkgroupSize[i] = compiler.get_execution_mode_argument(spv::ExecutionModeLocalSize, i);
+        }
+
+        std::ranges::sort(m_Bindings, [](const ShaderReflectionBinding& a, const ShaderReflectionBinding& b) { return std::tie(a.RegisterSpace, a.Slot) < std::tie(b.RegisterSpace, b.Slot); });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    ShaderReflection& ShaderReflection::Merge(const ShaderReflection& other)
+    {
+        m_Stages = m_Stages | other.m_Stages;
+
+        for (const ShaderReflectionBinding& binding : other.m_Bindings)
+        {
+            auto it = std::ranges::find_if(m_Bindings, [&](const ShaderReflectionBinding& existing) { return ((existing.RegisterSpace == binding.RegisterSpace) && (existing.Slot == binding.Slot)); });
+            if (it == m_Bindings.end())
+            {
+                m_Bindings.push_back(binding);
+                continue;
+            }
+
+            OB_ASSERT(((it->Type == binding.Type) && (it->ArraySize == binding.ArraySize)), "[ShaderReflection] Binding (space {0}, slot {1}) is declared differently across stages.", binding.RegisterSpace, binding.Slot);
+            it->Visibility = it->Visibility | binding.Visibility;
+        }
+
+        if (other.m_PushConstantsSize != 0)
+        {
+            m_PushConstantsSize = std::max(m_PushConstantsSize, other.m_PushConstantsSize);
+            m_PushConstantsVisibility = m_PushConstantsVisibility | other.m_PushConstantsVisibility;
+        }
+
+        if (other.m_WorkgroupSize[0] != 0)
+            m_WorkgroupSize = other.m_WorkgroupSize;
+
+        std::ranges::sort(m_Bindings, [](const ShaderReflectionBinding& a, const ShaderReflectionBinding& b) { return std::tie(a.RegisterSpace, a.Slot) < std::tie(b.RegisterSpace, b.Slot); });
+        return *this;
+    }
+
+    ShaderReflection& ShaderReflection::SetType(uint8_t registerSpace, uint32_t slot, ResourceType type, uint16_t maxElements)
+    {
+        auto it = std::ranges::find_if(m_Bindings, [&](const ShaderReflectionBinding& binding) { return ((binding.RegisterSpace == registerSpace) && (binding.Slot == slot)); });
+        OB_ASSERT((it != m_Bindings.end()), "[ShaderReflection] No binding found at (space {0}, slot {1}).", registerSpace, slot);
+        if (it == m_Bindings.end())
+            return *this;
+
+        it->Type = type;
+        if ((type == ResourceType::DynamicUniformBuffer) || (type == ResourceType::DynamicStorageBuffer) || (type == ResourceType::DynamicStorageBufferUnordered))
+            it->ArraySize = maxElements;
+
+        return *this;
+    }
+
+    ShaderReflection& ShaderReflection::SetPushConstantsSlot(uint8_t registerSpace, uint32_t slot)
+    {
+        m_PushConstantsSpace = registerSpace;
+        m_PushConstantsSlot = slot;
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    std::vector<uint8_t> ShaderReflection::GetRegisterSpaces() const
+    {
+        std::vector<uint8_t> spaces;
+        for (const ShaderReflectionBinding& binding : m_Bindings)
+            spaces.push_back(binding.RegisterSpace);
+
+        if (m_PushConstantsSize != 0)
+            spaces.push_back(m_PushConstantsSpace);
+
+        std::ranges::sort(spaces);
+        spaces.erase(std::unique(spaces.begin(), spaces.end()), spaces.end());
+        return spaces;
+    }
+
+    bool ShaderReflection::IsBindless(uint8_t registerSpace) const
+    {
+        return std::ranges::any_of(m_Bindings, [&](const ShaderReflectionBinding& binding) { return ((binding.RegisterSpace == registerSpace) && (binding.ArraySize == 0)); });
+    }
+
+    BindingLayoutSpecification ShaderReflection::GetLayoutSpecification(uint8_t registerSpace) const
+    {
+        OB_ASSERT((!IsBindless(registerSpace)), "[ShaderReflection] Register space {0} contains runtime sized arrays, use GetBindlessLayoutSpecification.", registerSpace);
+
+        BindingLayoutSpecification specs = {};
+        specs.SetRegisterSpace(registerSpace);
+
+        if ((m_PushConstantsSize != 0) && (m_PushConstantsSpace == registerSpace))
+            specs.AddItem(BindingLayoutItem().SetSlot(m_PushConstantsSlot).SetVisibility(m_PushConstantsVisibility).SetType(ResourceType::PushConstants).SetSize(m_PushConstantsSize).SetDebugName("PushConstants"));
+
+        for (const ShaderReflectionBinding& binding : m_Bindings)
+        {
+            if (binding.RegisterSpace != registerSpace)
+                continue;
+
+            OB_ASSERT(((m_PushConstantsSize == 0) || (m_PushConstantsSpace != registerSpace) || (m_PushConstantsSlot != binding.Slot)), "[ShaderReflection] Push constants slot {0} collides with {1}, move it with SetPushConstantsSlot.", binding.Slot, binding.Name);
+            specs.AddItem(BindingLayoutItem().SetSlot(binding.Slot).SetVisibility(binding.Visibility).SetType(binding.Type).SetSize(binding.ArraySize).SetDebugName(binding.Name));
+        }
+
+        return specs;
+    }
+
+    BindlessLayoutSpecification ShaderReflection::GetBindlessLayoutSpecification(uint8_t registerSpace, uint16_t maxElements) const
+    {
+        OB_ASSERT(((m_PushConstantsSize == 0) || (m_PushConstantsSpace != registerSpace)), "[ShaderReflection] Push constants can't be placed in bindless register space {0}.", registerSpace);
+
+        BindlessLayoutSpecification specs = {};
+        specs.SetRegisterSpace(registerSpace);
+
+        for (const ShaderReflectionBinding& binding : m_Bindings)
+        {
+            if (binding.RegisterSpace != registerSpace)
+                continue;
+
+            specs.AddItem(BindingLayoutItem().SetSlot(binding.Slot).SetVisibility(binding.Visibility).SetType(binding.Type).SetSize((binding.ArraySize == 0) ? maxElements : binding.ArraySize).SetDebugName(binding.Name));
+        }
+
+        return specs;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    BindingLayoutCache::CachedLayout::CachedLayout(const Device& device, const BindingLayoutSpecification& specs)
+        : Bindless(false), RegisterSpace(specs.RegisterSpace), Items(specs.Bindings.begin(), specs.Bindings.end()), Layout(device, specs)
+    {
+    }
+
+    BindingLayoutCache::CachedLayout::CachedLayout(const Device& device, const BindlessLayoutSpecification& specs)
+        : Bindless(true), RegisterSpace(specs.RegisterSpace), Items(specs.Bindings.begin(), specs.Bindings.end()), Layout(device, specs)
+    {
+    }
+
+    BindingLayoutCache::BindingLayoutCache(const Device& device)
+        : m_Device(device)
+    {
+    }
+
+    BindingLayoutCache::~BindingLayoutCache()
+    {
+        for (CachedLayout& layout : m_Layouts)
+            m_Device.DestroyBindingLayout(layout.Layout);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    BindingLayout& BindingLayoutCache::GetLayout(const BindingLayoutSpecification& specs)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        if (CachedLayout* layout = Find(false, specs.RegisterSpace, specs.Bindings))
+            return layout->Layout;
+
+        OB_PROFILE("BindingLayoutCache::GetLayout::Create");
+        return m_Layouts.emplace_back(m_Device, specs).Layout;
+    }
+
+    BindingLayout& BindingLayoutCache::GetLayout(const BindlessLayoutSpecification& specs)
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        if (CachedLayout* layout = Find(true, specs.RegisterSpace, specs.Bindings))
+            return layout->Layout;
+
+        OB_PROFILE("BindingLayoutCache::GetLayout::Create");
+        return m_Layouts.emplace_back(m_Device, specs).Layout;
+    }
+
+    std::vector<BindingLayout*> BindingLayoutCache::GetLayouts(const ShaderReflection& reflection, uint16_t maxBindlessElements)
+    {
+        OB_PROFILE("BindingLayoutCache::GetLayouts()");
+
+        std::vector<BindingLayout*> layouts;
+        for (uint8_t space : reflection.GetRegisterSpaces())
+        {
+            if (reflection.IsBindless(space))
+                layouts.push_back(&GetLayout(reflection.GetBindlessLayoutSpecification(space, maxBindlessElements)));
+            else
+                layouts.push_back(&GetLayout(reflection.GetLayoutSpecification(space)));
+        }
+
+        return layouts;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    size_t BindingLayoutCache::GetLayoutCount() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_Layouts.size();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Private methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    BindingLayoutCache::CachedLayout* BindingLayoutCache::Find(bool bindless, uint8_t registerSpace, std::span<const BindingLayoutItem> items)
+    {
+        for (CachedLayout& layout : m_Layouts)
+        {
+            if ((layout.Bindless == bindless) && (layout.RegisterSpace == registerSpace) && SameItems(layout.Items, items))
+                return &layout;
+        }
+
+        return nullptr;
+    }
+
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/ShaderSpec.hpp"
+#include "Obsidian/Renderer/BindingsSpec.hpp"
+
+#include <cstdint>
+#include <span>
+#include <list>
+#include <array>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Obsidian
+{
+
+    class Device;
+    class BindingLayout;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ShaderReflectionBinding
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct ShaderReflectionBinding
+    {
+    public:
+        uint8_t RegisterSpace = 0;
+        uint32_t Slot = 0;
+        ResourceType Type = ResourceType::None;
+
+        uint16_t ArraySize = 1; // Note: 0 for runtime sized arrays, these make the register space bindless
+        ShaderStage Visibility = ShaderStage::None;
+
+        std::string Name = {};
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ShaderReflection // Note: Extracts the descriptor bindings, push constant block & workgroup
+    // size from SPIRV through SPIRV-Cross. Stages of the same pipeline get merged together.
+    ////////////////////////////////////////////////////////////////////////////////////
+    class ShaderReflection
+    {
+    public:
+        // Constructor & Destructor
+        ShaderReflection() = default;
+        ShaderReflection(ShaderStage stage, std::span<const uint32_t> spirv, const std::string& entryPoint = "main");
+        ~ShaderReflection() = default;
+
+        // Methods
+        ShaderReflection& Merge(const ShaderReflection& other); // Note: Matching bindings get their visibility combined, mismatching types assert
+
+        // Note: Uniform & storage buffers can't be told apart from their dynamic variants in SPIRV, this overrides the reflected type
+        ShaderReflection& SetType(uint8_t registerSpace, uint32_t slot, ResourceType type, uint16_t maxElements = 1);
+        ShaderReflection& SetPushConstantsSlot(uint8_t registerSpace, uint32_t slot); // Note: Push constants have no binding in SPIRV, defaults to space 0, slot 0
+
+        // Getters
+        inline ShaderStage GetStages() const { return m_Stages; }
+        inline const std::vector<ShaderReflectionBinding>& GetBindings() const { return m_Bindings; }
+
+        inline uint16_t GetPushConstantsSize() const { return m_PushConstantsSize; }
+        inline ShaderStage GetPushConstantsVisibility() const { return m_PushConstantsVisibility; }
+        inline uint8_t GetPushConstantsRegisterSpace() const { return m_PushConstantsSpace; }
+        inline uint32_t GetPushConstantsSlot() const { return m_PushConstantsSlot; }
+
+        inline const std::array<uint32_t, 3>& GetWorkgroupSize() const { return m_WorkgroupSize; } // Note: Only set for compute, task & mesh stages
+
+        std::vector<uint8_t> GetRegisterSpaces() const; // Note: Sorted, includes the push constants' space
+        bool IsBindless(uint8_t registerSpace) const;
+
+        BindingLayoutSpecification GetLayoutSpecification(uint8_t registerSpace) const;
+        BindlessLayoutSpecification GetBindlessLayoutSpecification(uint8_t registerSpace, uint16_t maxElements) const; // Note: maxElements is used for runtime sized arrays
+
+    private:
+        ShaderStage m_Stages = ShaderStage::None;
+        std::vector<ShaderReflectionBinding> m_Bindings = { };
+
+        uint16_t m_PushConstantsSize = 0;
+        ShaderStage m_PushConstantsVisibility = ShaderStage::None;
+        uint8_t m_PushConstantsSpace = 0;
+        uint32_t m_PushConstantsSlot = 0;
+
+        std::array<uint32_t, 3> m_WorkgroupSize = { 0, 0, 0 };
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // BindingLayoutCache // Note: Hands out one BindingLayout per unique specification, so
+    // pipelines built from the same (or overlapping) shaders share their set layouts.
+    ////////////////////////////////////////////////////////////////////////////////////
+    class BindingLayoutCache
+    {
+    public:
+        // Constructor & Destructor
+        BindingLayoutCache(const Device& device);
+        ~BindingLayoutCache(); // Note: Destroys all layouts, pipelines using them must be destroyed first
+
+        // Methods // Note: Thread safe
+        BindingLayout& GetLayout(const BindingLayoutSpecification& specs);
+        BindingLayout& GetLayout(const BindlessLayoutSpecification& specs);
+
+        // Note: One layout per register space, sorted by space. Can be passed straight to Add*BindingLayout of a pipeline specification
+        std::vector<BindingLayout*> GetLayouts(const ShaderReflection& reflection, uint16_t maxBindlessElements = 1024);
+
+        // Getters
+        size_t GetLayoutCount() const;
+
+    private:
+        struct CachedLayout
+        {
+        public:
+            bool Bindless;
+            uint8_t RegisterSpace;
+            std::vector<BindingLayoutItem> Items;
+
+            BindingLayout Layout;
+
+        public:
+            CachedLayout(const Device& device, const BindingLayoutSpecification& specs);
+            CachedLayout(const Device& device, const BindlessLayoutSpecification& specs);
+        };
+
+    private:
+        // Private methods
+        CachedLayout* Find(bool bindless, uint8_t registerSpace, std::span<const BindingLayoutItem> items); // Note: Must be called with m_Mutex locked
+
+    private:
+        const Device& m_Device;
+
+        mutable std::mutex m_Mutex = {};
+        std::list<CachedLayout> m_Layouts = { }; // Note: std::list since layouts can't be moved
+    };
+
+}
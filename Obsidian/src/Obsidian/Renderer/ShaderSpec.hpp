@@ -7,6 +7,11 @@
 #include <vector>
 #include <variant>
 #include <string>
+#include <string_view>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <filesystem>
 
 namespace Obsidian
 {
@@ -49,6 +54,13 @@ namespace Obsidian
 
     NANO_DEFINE_BITWISE(ShaderStage)
 
+    enum class ShaderOptimization : uint8_t
+    {
+        None = 0,
+        Size,
+        Performance
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////
     // ShaderSpecification
     ////////////////////////////////////////////////////////////////////////////////////
@@ -107,4 +119,73 @@ namespace Obsidian
         inline ShaderSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
     };
 
-}
\ No newline at end of file
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ShaderCompileArgs
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct ShaderCompileArgs
+    {
+    public:
+        ShaderStage Stage = ShaderStage::None;
+        std::string Code = {};
+        std::string EntryPoint = "main";
+        ShadingLanguage Language = ShadingLanguage::GLSL;
+
+        std::vector<std::pair<std::string, std::string>> Macros = { }; // Note: Name, value (may be empty)
+
+    public:
+        // Setters
+        inline constexpr ShaderCompileArgs& SetShaderStage(ShaderStage stage) { Stage = stage; return *this; }
+        inline ShaderCompileArgs& SetCode(const std::string& code) { Code = code; return *this; }
+        inline ShaderCompileArgs& SetEntryPoint(const std::string& entryPoint) { EntryPoint = entryPoint; return *this; }
+        inline constexpr ShaderCompileArgs& SetShadingLanguage(ShadingLanguage language) { Language = language; return *this; }
+        inline ShaderCompileArgs& AddMacro(const std::string& name, const std::string& value = {}) { Macros.emplace_back(name, value); return *this; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // ShaderCompilerSpecification
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct ShaderCompilerSpecification
+    {
+    public:
+        ShaderOptimization Optimization = ShaderOptimization::Performance;
+
+        std::filesystem::path CacheDirectory = {}; // Note: Compiled SPIRV gets stored here keyed by a hash of the source & options, empty disables the cache
+        std::string CacheSalt = {}; // Note: Mixed into the cache key, change it to invalidate the cache (e.g. when updating the shaderc/SDK version)
+        uint32_t ThreadCount = 0; // Note: Threads used by CompileAsync/CompileBatch, 0 uses std::thread::hardware_concurrency()
+
+    public:
+        // Setters
+        inline constexpr ShaderCompilerSpecification& SetOptimization(ShaderOptimization optimization) { Optimization = optimization; return *this; }
+        inline ShaderCompilerSpecification& SetCacheDirectory(const std::filesystem::path& directory) { CacheDirectory = directory; return *this; }
+        inline ShaderCompilerSpecification& SetCacheSalt(const std::string& salt) { CacheSalt = salt; return *this; }
+        inline constexpr ShaderCompilerSpecification& SetThreadCount(uint32_t count) { ThreadCount = count; return *this; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Helper
+    ////////////////////////////////////////////////////////////////////////////////////
+    namespace Internal
+    {
+
+        // Note: Hashes the contents of the code (not the address) together with the entry point & stage,
+        // so the result stays valid after a viewed code span goes out of scope.
+        inline size_t HashShaderCode(const ShaderSpecification& specs)
+        {
+            size_t hash = 0;
+            std::visit([&](const auto& variant)
+            {
+                std::visit([&](const auto& code)
+                {
+                    std::span<const std::byte> bytes = std::as_bytes(std::span(code));
+                    hash = std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()));
+                }, variant);
+            }, specs.Code);
+
+            hash = Nano::Hash::Combine(hash, std::hash<std::string_view>{}(specs.MainName));
+            hash = Nano::Hash::Combine(hash, std::hash<std::underlying_type_t<ShaderStage>>{}(std::to_underlying(specs.Stage)));
+            return hash;
+        }
+
+    }
+
+}
@@ -9,6 +9,55 @@
 #include "Obsidian/Renderer/Image.hpp"
 #include "Obsidian/Renderer/Buffer.hpp"
 
+#include <span>
+#include <algorithm>
+
+namespace
+{
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Helper methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    static void ApplyImageState(Obsidian::Internal::ImageState& currentState, const Obsidian::ImageSpecification& imageSpec, const Obsidian::ImageSubresourceSpecification& subresources, Obsidian::ResourceState state)
+    {
+        using namespace Obsidian;
+
+        ImageSubresourceSpecification resSubresources = Internal::ResolveImageSubresource(subresources, imageSpec, false);
+
+        if (resSubresources.IsEntireTexture(imageSpec))
+        {
+            currentState.SubresourceStates.clear();
+            currentState.State = state;
+        }
+        else
+        {
+            if (currentState.SubresourceStates.empty())
+            {
+                currentState.SubresourceStates.resize(static_cast<size_t>(imageSpec.MipLevels) * imageSpec.ArraySize, currentState.State);
+                currentState.State = ResourceState::Unknown;
+            }
+
+            for (MipLevel mipLevel = resSubresources.BaseMipLevel; mipLevel < resSubresources.BaseMipLevel + resSubresources.NumMipLevels; mipLevel++)
+            {
+                for (ArraySlice arraySlice = resSubresources.BaseArraySlice; arraySlice < resSubresources.BaseArraySlice + resSubresources.NumArraySlices; arraySlice++)
+                    currentState.SubresourceStates[ImageSubresourceSpecification::SubresourceIndex(mipLevel, arraySlice, imageSpec)] = state;
+            }
+        }
+    }
+
+    static const Obsidian::Internal::ImageBarrier* FindPendingBarrier(std::span<const Obsidian::Internal::ImageBarrier> pendingBarriers, const Obsidian::Image* image, Obsidian::MipLevel mipLevel, Obsidian::ArraySlice arraySlice)
+    {
+        for (const Obsidian::Internal::ImageBarrier& pending : pendingBarriers)
+        {
+            if ((pending.ImagePtr == image) && (pending.EntireTexture || ((pending.ImageMipLevel == mipLevel) && (pending.ImageArraySlice == arraySlice))))
+                return &pending;
+        }
+
+        return nullptr;
+    }
+
+}
+
 namespace Obsidian::Internal
 {
 
@@ -31,41 +80,397 @@ namespace Obsidian::Internal
     {
         OB_ASSERT((!Contains(image)), "[StateTracker] Started tracking an object that's already being tracked.");
 
-        m_ImageStates.emplace();
-        SetImageState(image, subresources, currentState);
+        std::unique_lock lock(m_Mutex);
+        ApplyImageState(m_ImageStates[&image], image.GetSpecification(), subresources, currentState);
     }
 
     void StateTracker::StartTracking(const Buffer& buffer, ResourceState currentState) const
     {
         OB_ASSERT((!Contains(buffer)), "[StateTracker] Started tracking an object that's already being tracked.");
 
-        m_BufferStates.emplace();
-        SetBufferState(buffer, currentState);
+        std::unique_lock lock(m_Mutex);
+        m_BufferStates[&buffer].State = currentState;
     }
 
     void StateTracker::StopTracking(const Image& image)
     {
-        if (Contains(image))
-            m_ImageStates.erase(&image);
+        std::unique_lock lock(m_Mutex);
+        m_ImageStates.erase(&image);
     }
 
     void StateTracker::StopTracking(const Buffer& buffer)
     {
-        if (Contains(buffer))
-            m_BufferStates.erase(&buffer);
+        std::unique_lock lock(m_Mutex);
+        m_BufferStates.erase(&buffer);
     }
 
-    void StateTracker::RequireImageState(const CommandList& list, Image& image, const ImageSubresourceSpecification& subresources, ResourceState state) const
+    void StateTracker::ResolveSubmission(const CommandListStateTracker& tracker, CommandQueue queue, std::vector<ImageBarrier>& imageBarriers, std::vector<BufferBarrier>& bufferBarriers) const
     {
-        OB_ASSERT(Contains(image), "[StateTracker] Using an untracked image is not allowed, call StartTracking() on image.");
+        OB_PROFILE("StateTracker::ResolveSubmission()");
+
+        imageBarriers.clear();
+        bufferBarriers.clear();
+
+        std::unique_lock lock(m_Mutex);
+
+        // Resolve first use transitions
+        for (const ImageBarrier& pending : tracker.GetPendingImageBarriers())
+        {
+            auto it = m_ImageStates.find(pending.ImagePtr);
+            OB_ASSERT((it != m_ImageStates.end()), "[StateTracker] Image was untracked before the commandlist using it got submitted.");
+
+            const ImageState& globalState = it->second;
+            const ImageSpecification& imageSpec = pending.ImagePtr->GetSpecification();
+
+            // Note: Ownership is tracked per resource, so a transfer always moves the entire image.
+            // The first pending barrier of the image transfers every subresource, the ones this list doesn't use keep their state.
+            const bool ownershipNecessary = (globalState.OwningQueue != CommandQueue::Count) && (globalState.OwningQueue != queue);
+            if (ownershipNecessary && (&*std::find_if(tracker.GetPendingImageBarriers().begin(), tracker.GetPendingImageBarriers().end(), [&](const ImageBarrier& other) { return (other.ImagePtr == pending.ImagePtr); }) != &pending))
+                continue;
+
+            auto resolve = [&](const ImageBarrier& source, MipLevel mipLevel, ArraySlice arraySlice, bool entireTexture, ResourceState stateBefore)
+            {
+                bool transitionNecessary = (stateBefore != source.StateAfter);
+                bool uavNecessary = (static_cast<bool>((source.StateAfter & ResourceState::UnorderedAccess)) != false) && globalState.EnableUavBarriers;
+                bool transferNecessary = ownershipNecessary && (stateBefore != ResourceState::Unknown) && !source.Aliasing; // Note: Contents of an unknown state or an aliased image don't need to be preserved
+
+                if (transitionNecessary || uavNecessary || transferNecessary || source.Aliasing)
+                {
+                    ImageBarrier& barrier = imageBarriers.emplace_back(source);
+                    barrier.ImageMipLevel = mipLevel;
+                    barrier.ImageArraySlice = arraySlice;
+                    barrier.EntireTexture = entireTexture;
+                    barrier.StateBefore = stateBefore;
+
+                    if (transferNecessary)
+                    {
+                        barrier.QueueBefore = globalState.OwningQueue;
+                        barrier.QueueAfter = queue;
+                    }
+                }
+            };
+
+            if (globalState.SubresourceStates.empty() && pending.EntireTexture)
+            {
+                resolve(pending, pending.ImageMipLevel, pending.ImageArraySlice, true, globalState.State);
+            }
+            else if (ownershipNecessary)
+            {
+                for (ArraySlice arraySlice = 0; arraySlice < imageSpec.ArraySize; arraySlice++)
+                {
+                    for (MipLevel mipLevel = 0; mipLevel < imageSpec.MipLevels; mipLevel++)
+                    {
+                        const ResourceState stateBefore = (globalState.SubresourceStates.empty() ? globalState.State : globalState.SubresourceStates[ImageSubresourceSpecification::SubresourceIndex(mipLevel, arraySlice, imageSpec)]);
+                        const ImageBarrier* used = FindPendingBarrier(tracker.GetPendingImageBarriers(), pending.ImagePtr, mipLevel, arraySlice);
+
+                        if (used)
+                        {
+                            resolve(*used, mipLevel, arraySlice, false, stateBefore);
+                        }
+                        else if (stateBefore != ResourceState::Unknown) // Note: Only moves to the new queue
+                        {
+                            ImageBarrier& barrier = imageBarriers.emplace_back();
+                            barrier.ImagePtr = pending.ImagePtr;
+                            barrier.ImageMipLevel = mipLevel;
+                            barrier.ImageArraySlice = arraySlice;
+                            barrier.StateBefore = stateBefore;
+                            barrier.StateAfter = stateBefore;
+                            barrier.QueueBefore = globalState.OwningQueue;
+                            barrier.QueueAfter = queue;
+                        }
+                    }
+                }
+            }
+            else if (globalState.SubresourceStates.empty())
+            {
+                resolve(pending, pending.ImageMipLevel, pending.ImageArraySlice, false, globalState.State);
+            }
+            else if (pending.EntireTexture) // Note: The global state is split, so every subresource needs its own transition
+            {
+                for (ArraySlice arraySlice = 0; arraySlice < imageSpec.ArraySize; arraySlice++)
+                {
+                    for (MipLevel mipLevel = 0; mipLevel < imageSpec.MipLevels; mipLevel++)
+                        resolve(pending, mipLevel, arraySlice, false, globalState.SubresourceStates[ImageSubresourceSpecification::SubresourceIndex(mipLevel, arraySlice, imageSpec)]);
+                }
+            }
+            else
+            {
+                resolve(pending, pending.ImageMipLevel, pending.ImageArraySlice, false, globalState.SubresourceStates[ImageSubresourceSpecification::SubresourceIndex(pending.ImageMipLevel, pending.ImageArraySlice, imageSpec)]);
+            }
+        }
+
+        for (const BufferBarrier& pending : tracker.GetPendingBufferBarriers())
+        {
+            auto it = m_BufferStates.find(pending.BufferPtr);
+            OB_ASSERT((it != m_BufferStates.end()), "[StateTracker] Buffer was untracked before the commandlist using it got submitted.");
+
+            const BufferState& globalState = it->second;
+
+            bool transitionNecessary = (globalState.State != pending.StateAfter);
+            bool uavNecessary = (static_cast<bool>((pending.StateAfter & ResourceState::UnorderedAccess)) != false) && globalState.EnableUavBarriers;
+            bool ownershipNecessary = (globalState.OwningQueue != CommandQueue::Count) && (globalState.OwningQueue != queue) && (globalState.State != ResourceState::Unknown);
+
+            if (transitionNecessary || uavNecessary || ownershipNecessary)
+            {
+                BufferBarrier& barrier = bufferBarriers.emplace_back(pending);
+                barrier.StateBefore = globalState.State;
+
+                if (ownershipNecessary)
+                {
+                    barrier.QueueBefore = globalState.OwningQueue;
+                    barrier.QueueAfter = queue;
+                }
+            }
+        }
+
+        // Note: Resources only touched through SetImageState/SetBufferState have no pending barrier, but still move to this queue.
+        // Their contents have to be preserved, so they get an ownership transfer that keeps their current state.
+        for (const auto& [image, localState] : tracker.GetImageStates())
+        {
+            if (std::any_of(tracker.GetPendingImageBarriers().begin(), tracker.GetPendingImageBarriers().end(), [&](const ImageBarrier& pending) { return (pending.ImagePtr == image); }))
+                continue;
+
+            auto it = m_ImageStates.find(image);
+            if ((it == m_ImageStates.end()) || (it->second.OwningQueue == CommandQueue::Count) || (it->second.OwningQueue == queue))
+                continue;
+
+            const ImageState& globalState = it->second;
+            const ImageSpecification& imageSpec = image->GetSpecification();
+
+            auto transfer = [&](MipLevel mipLevel, ArraySlice arraySlice, bool entireTexture, ResourceState state)
+            {
+                if (state == ResourceState::Unknown) // Note: Contents of an unknown state don't need to be preserved
+                    return;
+
+                ImageBarrier& barrier = imageBarriers.emplace_back();
+                barrier.ImagePtr = const_cast<Image*>(image);
+                barrier.ImageMipLevel = mipLevel;
+                barrier.ImageArraySlice = arraySlice;
+                barrier.EntireTexture = entireTexture;
+                barrier.StateBefore = state;
+                barrier.StateAfter = state;
+                barrier.QueueBefore = globalState.OwningQueue;
+                barrier.QueueAfter = queue;
+            };
+
+            if (globalState.SubresourceStates.empty())
+            {
+                transfer(0, 0, true, globalState.State);
+            }
+            else
+            {
+                for (ArraySlice arraySlice = 0; arraySlice < imageSpec.ArraySize; arraySlice++)
+                {
+                    for (MipLevel mipLevel = 0; mipLevel < imageSpec.MipLevels; mipLevel++)
+                        transfer(mipLevel, arraySlice, false, globalState.SubresourceStates[ImageSubresourceSpecification::SubresourceIndex(mipLevel, arraySlice, imageSpec)]);
+                }
+            }
+        }
+
+        for (const auto& [buffer, localState] : tracker.GetBufferStates())
+        {
+            if (std::any_of(tracker.GetPendingBufferBarriers().begin(), tracker.GetPendingBufferBarriers().end(), [&](const BufferBarrier& pending) { return (pending.BufferPtr == buffer); }))
+                continue;
+
+            auto it = m_BufferStates.find(buffer);
+            if ((it == m_BufferStates.end()) || (it->second.OwningQueue == CommandQueue::Count) || (it->second.OwningQueue == queue) || (it->second.State == ResourceState::Unknown))
+                continue;
+
+            BufferBarrier& barrier = bufferBarriers.emplace_back();
+            barrier.BufferPtr = const_cast<Buffer*>(buffer);
+            barrier.StateBefore = it->second.State;
+            barrier.StateAfter = it->second.State;
+            barrier.QueueBefore = it->second.OwningQueue;
+            barrier.QueueAfter = queue;
+        }
+
+        // Apply the final states of the commandlist
+        for (const auto& [image, localState] : tracker.GetImageStates())
+        {
+            auto it = m_ImageStates.find(image);
+            if (it == m_ImageStates.end()) [[unlikely]]
+                continue;
+
+            ImageState& globalState = it->second;
+            globalState.OwningQueue = queue; // Note: Ownership is tracked per resource, the resolve above transferred every subresource
+
+            if (localState.SubresourceStates.empty())
+            {
+                if (localState.State == ResourceState::Unknown)
+                    continue;
+
+                globalState.SubresourceStates.clear();
+                globalState.State = localState.State;
+            }
+            else
+            {
+                if (globalState.SubresourceStates.empty())
+                {
+                    globalState.SubresourceStates.resize(localState.SubresourceStates.size(), globalState.State);
+                    globalState.State = ResourceState::Unknown;
+                }
+
+                for (size_t i = 0; i < localState.SubresourceStates.size(); i++)
+                {
+                    if (localState.SubresourceStates[i] != ResourceState::Unknown)
+                        globalState.SubresourceStates[i] = localState.SubresourceStates[i];
+                }
+            }
+
+            globalState.FirstUavBarrierPlaced |= localState.FirstUavBarrierPlaced;
+        }
+
+        for (const auto& [buffer, localState] : tracker.GetBufferStates())
+        {
+            auto it = m_BufferStates.find(buffer);
+            if (it == m_BufferStates.end()) [[unlikely]]
+                continue;
+
+            it->second.OwningQueue = queue;
+            if (localState.State == ResourceState::Unknown) [[unlikely]]
+                continue;
+
+            it->second.State = localState.State;
+            it->second.FirstUavBarrierPlaced |= localState.FirstUavBarrierPlaced;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    ////////////////////////////////////////////////////////////////////////////////////
+    bool StateTracker::Contains(const Image& image) const
+    {
+        std::shared_lock lock(m_Mutex);
+        return m_ImageStates.contains(&image);
+    }
+
+    bool StateTracker::Contains(const Buffer& buffer) const
+    {
+        std::shared_lock lock(m_Mutex);
+        return m_BufferStates.contains(&buffer);
+    }
+
+    ResourceState StateTracker::GetResourceState(const Image& image, const ImageSubresourceSpecification& subresource) const
+    {
+        OB_ASSERT((Contains(image)), "[StateTracker] Cannot get resourcestate for an untracked object.");
+
+        const ImageSpecification& imageSpec = image.GetSpecification();
+        ImageSubresourceSpecification resSubresources = ResolveImageSubresource(subresource, imageSpec, false);
+
+        OB_ASSERT(((resSubresources.NumMipLevels == 1) && (resSubresources.NumArraySlices == 1)), "[StateTracker] Cannot get a single ResourceState from multiple subresources.");
+
+        std::shared_lock lock(m_Mutex);
+        const ImageState& state = m_ImageStates.at(&image);
+        if (state.SubresourceStates.empty())
+            return state.State;
+
+        return state.SubresourceStates[ImageSubresourceSpecification::SubresourceIndex(resSubresources.BaseMipLevel, resSubresources.BaseArraySlice, imageSpec)];
+    }
+
+    ResourceState StateTracker::GetResourceState(const Buffer& buffer) const
+    {
+        OB_ASSERT((Contains(buffer)), "[StateTracker] Cannot get resourcestate for an untracked object.");
+
+        std::shared_lock lock(m_Mutex);
+        return m_BufferStates.at(&buffer).State;
+    }
+
+    CommandQueue StateTracker::GetOwningQueue(const Image& image) const
+    {
+        OB_ASSERT((Contains(image)), "[StateTracker] Cannot get owning queue for an untracked object.");
+
+        std::shared_lock lock(m_Mutex);
+        return m_ImageStates.at(&image).OwningQueue;
+    }
+
+    CommandQueue StateTracker::GetOwningQueue(const Buffer& buffer) const
+    {
+        OB_ASSERT((Contains(buffer)), "[StateTracker] Cannot get owning queue for an untracked object.");
+
+        std::shared_lock lock(m_Mutex);
+        return m_BufferStates.at(&buffer).OwningQueue;
+    }
+
+    bool StateTracker::GetEnableUavBarriers(const Image& image) const
+    {
+        std::shared_lock lock(m_Mutex);
+        auto it = m_ImageStates.find(&image);
+        return ((it != m_ImageStates.end()) ? it->second.EnableUavBarriers : true);
+    }
+
+    bool StateTracker::GetEnableUavBarriers(const Buffer& buffer) const
+    {
+        std::shared_lock lock(m_Mutex);
+        auto it = m_BufferStates.find(&buffer);
+        return ((it != m_BufferStates.end()) ? it->second.EnableUavBarriers : true);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Setters
+    ////////////////////////////////////////////////////////////////////////////////////
+    void StateTracker::SetImageState(const Image& image, const ImageSubresourceSpecification& subresources, ResourceState state) const
+    {
+        std::unique_lock lock(m_Mutex);
+        ApplyImageState(m_ImageStates[&image], image.GetSpecification(), subresources, state);
+    }
+
+    void StateTracker::SetBufferState(const Buffer& buffer, ResourceState state) const
+    {
+        std::unique_lock lock(m_Mutex);
+        m_BufferStates[&buffer].State = state;
+    }
+
+    void StateTracker::SetOwningQueue(const Image& image, CommandQueue queue) const
+    {
+        std::unique_lock lock(m_Mutex);
+        m_ImageStates[&image].OwningQueue = queue;
+    }
+
+    void StateTracker::SetOwningQueue(const Buffer& buffer, CommandQueue queue) const
+    {
+        std::unique_lock lock(m_Mutex);
+        m_BufferStates[&buffer].OwningQueue = queue;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    CommandListStateTracker::CommandListStateTracker(const StateTracker& tracker)
+        : m_Tracker(tracker)
+    {
+    }
+
+    CommandListStateTracker::~CommandListStateTracker()
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void CommandListStateTracker::RequireImageState(Image& image, const ImageSubresourceSpecification& subresources, ResourceState state)
+    {
+        OB_ASSERT(m_Tracker.Contains(image), "[StateTracker] Using an untracked image is not allowed, call StartTracking() on image.");
+        OB_ASSERT((state != ResourceState::Unknown), "[StateTracker] Requiring ResourceState::Unknown is not allowed.");
 
         const ImageSpecification& imageSpec = image.GetSpecification();
         ImageSubresourceSpecification resSubresources = ResolveImageSubresource(subresources, imageSpec, false);
 
-        ImageState& currentState = m_ImageStates[&image];
+        ImageState& currentState = GetLocalState(image);
 
-        if (resSubresources.IsEntireTexture(image.GetSpecification())) // Entire texture
+        if (resSubresources.IsEntireTexture(imageSpec) && currentState.SubresourceStates.empty()) // Entire texture
         {
+            if (currentState.State == ResourceState::Unknown) // First use
+            {
+                ImageBarrier barrier = {};
+                barrier.ImagePtr = &image;
+                barrier.EntireTexture = true;
+                barrier.StateAfter = state;
+
+                m_PendingImageBarriers.push_back(barrier);
+                currentState.State = state;
+                return;
+            }
+
             bool transitionNecessary = (currentState.State != state);
             bool uavNecessary = (static_cast<bool>((state & ResourceState::UnorderedAccess)) != false) && (currentState.EnableUavBarriers || !currentState.FirstUavBarrierPlaced);
 
@@ -77,7 +482,7 @@ namespace Obsidian::Internal
                 barrier.StateBefore = currentState.State;
                 barrier.StateAfter = state;
 
-                m_ImageBarriers[&list].push_back(barrier);
+                m_ImageBarriers.push_back(barrier);
             }
 
             currentState.State = state;
@@ -87,19 +492,10 @@ namespace Obsidian::Internal
         }
         else // Convert all subresources
         {
-            bool stateExpanded = false;
-            if (currentState.SubresourceStates.empty()) // If we don't have any knowledge of previous subresource states
+            if (currentState.SubresourceStates.empty()) // Note: Expand the (possibly unknown) entire state into subresources
             {
-                if constexpr (Information::Validation)
-                {
-                    if (currentState.State == ResourceState::Unknown)
-                        OB_LOG_ERROR("[StateTracker] No previous subresource state was set and currenstate is Unknown. This is not allowed.");
-                        //m_Device.GetContext().Error("[StateTracker] No previous subresource state was set and currenstate is Unknown. This is not allowed.");
-                }
-
                 currentState.SubresourceStates.resize(static_cast<size_t>(imageSpec.MipLevels) * imageSpec.ArraySize, currentState.State);
                 currentState.State = ResourceState::Unknown;
-                stateExpanded = true;
             }
 
             bool anyUavBarrier = false;
@@ -110,30 +506,27 @@ namespace Obsidian::Internal
                     size_t subresourceIndex = ImageSubresourceSpecification::SubresourceIndex(mipLevel, arraySlice, imageSpec);
                     auto priorState = currentState.SubresourceStates[subresourceIndex];
 
-                    if constexpr (Information::Validation)
+                    ImageBarrier barrier = {};
+                    barrier.ImagePtr = &image;
+                    barrier.EntireTexture = false;
+                    barrier.ImageMipLevel = mipLevel;
+                    barrier.ImageArraySlice = arraySlice;
+                    barrier.StateBefore = priorState;
+                    barrier.StateAfter = state;
+
+                    currentState.SubresourceStates[subresourceIndex] = state;
+
+                    if (priorState == ResourceState::Unknown) // First use
                     {
-                        if (priorState == ResourceState::Unknown && !stateExpanded)
-                            OB_LOG_ERROR("[StateTracker] Subresource state was set to Unknown. This is not allowed.");
-                            //m_Device.GetContext().Error("[StateTracker] Subresource state was set to Unknown. This is not allowed.");
+                        m_PendingImageBarriers.push_back(barrier);
+                        continue;
                     }
 
                     bool transitionNecessary = (priorState != state);
                     bool uavNecessary = (static_cast<bool>((state & ResourceState::UnorderedAccess)) != false) && !anyUavBarrier && (currentState.EnableUavBarriers || !currentState.FirstUavBarrierPlaced);
 
                     if (transitionNecessary || uavNecessary)
-                    {
-                        ImageBarrier barrier;
-                        barrier.ImagePtr = &image;
-                        barrier.EntireTexture = false;
-                        barrier.ImageMipLevel = mipLevel;
-                        barrier.ImageArraySlice = arraySlice;
-                        barrier.StateBefore = priorState;
-                        barrier.StateAfter = state;
-
-                        m_ImageBarriers[&list].push_back(barrier);
-                    }
-
-                    currentState.SubresourceStates[subresourceIndex] = state;
+                        m_ImageBarriers.push_back(barrier);
 
                     if (uavNecessary && !transitionNecessary)
                     {
@@ -145,18 +538,83 @@ namespace Obsidian::Internal
         }
     }
 
-    void StateTracker::RequireBufferState(const CommandList& list, Buffer& buffer, ResourceState state) const
+    void CommandListStateTracker::AliasImage(Image& image, ResourceState state)
     {
-        OB_ASSERT(Contains(buffer), "[StateTracker] Using an untracked buffer is not allowed, call StartTracking() on buffer.");
+        OB_ASSERT(m_Tracker.Contains(image), "[StateTracker] Using an untracked image is not allowed, call StartTracking() on image.");
+        OB_ASSERT((state != ResourceState::Unknown), "[StateTracker] Aliasing to ResourceState::Unknown is not allowed.");
+        OB_ASSERT(!image.GetSpecification().HasPermanentState(), "[StateTracker] Aliasing an image with a permanent state is not allowed.");
 
-        BufferState& currentState = m_BufferStates[&buffer];
+        const ImageSpecification& imageSpec = image.GetSpecification();
+        ImageState& currentState = GetLocalState(image);
+
+        // Note: The contents get discarded, but backends that need the prior state (Dx12) still need it to be correct.
+        // Subresources this list hasn't used yet get resolved at submission like any other first use barrier.
+        if (currentState.SubresourceStates.empty())
+        {
+            ImageBarrier barrier = {};
+            barrier.ImagePtr = &image;
+            barrier.EntireTexture = true;
+            barrier.StateBefore = currentState.State;
+            barrier.StateAfter = state;
+            barrier.Aliasing = true;
+
+            if (currentState.State == ResourceState::Unknown) // First use
+                m_PendingImageBarriers.push_back(barrier);
+            else
+                m_ImageBarriers.push_back(barrier);
+        }
+        else
+        {
+            for (ArraySlice arraySlice = 0; arraySlice < imageSpec.ArraySize; arraySlice++)
+            {
+                for (MipLevel mipLevel = 0; mipLevel < imageSpec.MipLevels; mipLevel++)
+                {
+                    ImageBarrier barrier = {};
+                    barrier.ImagePtr = &image;
+                    barrier.EntireTexture = false;
+                    barrier.ImageMipLevel = mipLevel;
+                    barrier.ImageArraySlice = arraySlice;
+                    barrier.StateBefore = currentState.SubresourceStates[ImageSubresourceSpecification::SubresourceIndex(mipLevel, arraySlice, imageSpec)];
+                    barrier.StateAfter = state;
+                    barrier.Aliasing = true;
+
+                    if (barrier.StateBefore == ResourceState::Unknown) // First use
+                        m_PendingImageBarriers.push_back(barrier);
+                    else
+                        m_ImageBarriers.push_back(barrier);
+                }
+            }
+        }
+
+        currentState.SubresourceStates.clear();
+        currentState.State = state;
+        currentState.FirstUavBarrierPlaced = false;
+    }
+
+    void CommandListStateTracker::RequireBufferState(Buffer& buffer, ResourceState state)
+    {
+        OB_ASSERT(m_Tracker.Contains(buffer), "[StateTracker] Using an untracked buffer is not allowed, call StartTracking() on buffer.");
+        OB_ASSERT((state != ResourceState::Unknown), "[StateTracker] Requiring ResourceState::Unknown is not allowed.");
+
+        BufferState& currentState = GetLocalState(buffer);
+
+        if (currentState.State == ResourceState::Unknown) // First use
+        {
+            BufferBarrier barrier = {};
+            barrier.BufferPtr = &buffer;
+            barrier.StateAfter = state;
+
+            m_PendingBufferBarriers.push_back(barrier);
+            currentState.State = state;
+            return;
+        }
 
         bool transitionNecessary = (currentState.State != state);
         bool uavNecessary = (static_cast<bool>((state & ResourceState::UnorderedAccess)) != false) && (currentState.EnableUavBarriers || !currentState.FirstUavBarrierPlaced);
 
         if (transitionNecessary)
         {
-            for (BufferBarrier& barrier : m_BufferBarriers[&list]) // Check if the buffer isn't already begin transitioned and add the flag to the after state.
+            for (BufferBarrier& barrier : m_BufferBarriers) // Check if the buffer isn't already begin transitioned and add the flag to the after state.
             {
                 if (barrier.BufferPtr == &buffer)
                 {
@@ -173,7 +631,7 @@ namespace Obsidian::Internal
             barrier.BufferPtr = &buffer;
             barrier.StateBefore = currentState.State;
             barrier.StateAfter = state;
-            m_BufferBarriers[&list].push_back(barrier);
+            m_BufferBarriers.push_back(barrier);
         }
 
         if (uavNecessary && !transitionNecessary)
@@ -182,88 +640,83 @@ namespace Obsidian::Internal
         currentState.State = state;
     }
 
-    void StateTracker::ResolvePermanentState(const CommandList& list, Image& image, const ImageSubresourceSpecification& subresource) const
+    void CommandListStateTracker::ResolvePermanentState(Image& image, const ImageSubresourceSpecification& subresource)
     {
-        OB_ASSERT((Contains(image)), "[StateTracker] Cannot get resourcestate for an untracked object.");
         OB_ASSERT(((subresource.NumMipLevels == 1) && (subresource.NumArraySlices == 1)), "[StateTracker] Cannot get a single ResourceState from multiple subresources.");
 
         if (!image.GetSpecification().HasPermanentState())
             return;
 
         ResourceState state = image.GetSpecification().PermanentState;
-        ResourceState currentState = GetResourceState(image, subresource);
+        ResourceState currentState = ResourceState::Unknown;
+        if (auto it = m_ImageStates.find(&image); it != m_ImageStates.end())
+        {
+            const ImageSpecification& imageSpec = image.GetSpecification();
+            currentState = (it->second.SubresourceStates.empty() ? it->second.State : it->second.SubresourceStates[ImageSubresourceSpecification::SubresourceIndex(subresource.BaseMipLevel, subresource.BaseArraySlice, imageSpec)]);
+        }
 
-        if (state != currentState)
-            RequireImageState(list, image, subresource, state);
+        if (state != currentState) // Note: Unknown (not used yet by this list) gets resolved at submission
+            RequireImageState(image, subresource, state);
     }
 
-    void StateTracker::ResolvePermanentState(const CommandList& list, Buffer& buffer) const
+    void CommandListStateTracker::ResolvePermanentState(Buffer& buffer)
     {
-        OB_ASSERT((Contains(buffer)), "[StateTracker] Cannot get resourcestate for an untracked object.");
         if (!buffer.GetSpecification().HasPermanentState())
             return;
 
         ResourceState state = buffer.GetSpecification().PermanentState;
-        ResourceState currentState = GetResourceState(buffer);
+        ResourceState currentState = ResourceState::Unknown;
+        if (auto it = m_BufferStates.find(&buffer); it != m_BufferStates.end())
+            currentState = it->second.State;
 
-        if (state != currentState)
-            RequireBufferState(list, buffer, state);
+        if (state != currentState) // Note: Unknown (not used yet by this list) gets resolved at submission
+            RequireBufferState(buffer, state);
     }
 
-    ////////////////////////////////////////////////////////////////////////////////////
-    // Getters
-    ////////////////////////////////////////////////////////////////////////////////////
-    ResourceState StateTracker::GetResourceState(const Image& image, const ImageSubresourceSpecification& subresource) const
+    void CommandListStateTracker::Reset()
     {
-        OB_ASSERT((Contains(image)), "[StateTracker] Cannot get resourcestate for an untracked object.");
-        
-        const ImageSpecification& imageSpec = image.GetSpecification();
-        ImageSubresourceSpecification resSubresources = ResolveImageSubresource(subresource, imageSpec, false);
-        
-        OB_ASSERT(((resSubresources.NumMipLevels == 1) && (resSubresources.NumArraySlices == 1)), "[StateTracker] Cannot get a single ResourceState from multiple subresources.");
+        m_ImageStates.clear();
+        m_BufferStates.clear();
 
-        if (subresource.IsEntireTexture(imageSpec))
-            return m_ImageStates.at(&image).State;
+        m_ImageBarriers.clear();
+        m_BufferBarriers.clear();
 
-        return m_ImageStates.at(&image).SubresourceStates[ImageSubresourceSpecification::SubresourceIndex(subresource.BaseMipLevel, subresource.BaseArraySlice, imageSpec)];
+        m_PendingImageBarriers.clear();
+        m_PendingBufferBarriers.clear();
     }
 
-    ResourceState StateTracker::GetResourceState(const Buffer& buffer) const
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Setters
+    ////////////////////////////////////////////////////////////////////////////////////
+    void CommandListStateTracker::SetImageState(const Image& image, const ImageSubresourceSpecification& subresources, ResourceState state)
     {
-        OB_ASSERT((Contains(buffer)), "[StateTracker] Cannot get resourcestate for an untracked object.");
-        return m_BufferStates.at(&buffer).State;
+        ApplyImageState(GetLocalState(image), image.GetSpecification(), subresources, state);
+    }
+
+    void CommandListStateTracker::SetBufferState(const Buffer& buffer, ResourceState state)
+    {
+        GetLocalState(buffer).State = state;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////
-    // Setters
+    // Private methods
     ////////////////////////////////////////////////////////////////////////////////////
-    void StateTracker::SetImageState(const Image& image, const ImageSubresourceSpecification& subresources, ResourceState state) const
+    ImageState& CommandListStateTracker::GetLocalState(const Image& image)
     {
-        ImageState& currentState = m_ImageStates[&image];
-        const ImageSpecification& imageSpec = image.GetSpecification();
-        ImageSubresourceSpecification resSubresources = ResolveImageSubresource(subresources, imageSpec, false);
+        auto [it, inserted] = m_ImageStates.try_emplace(&image);
+        if (inserted) // Note: The flag is fixed once the resource is tracked, so reading it while recording doesn't race with submissions
+            it->second.EnableUavBarriers = m_Tracker.GetEnableUavBarriers(image);
 
-        if (resSubresources.IsEntireTexture(imageSpec))
-        {
-            currentState.State = state;
-        }
-        else
-        {
-            currentState.SubresourceStates.resize(static_cast<size_t>(imageSpec.MipLevels) * imageSpec.ArraySize, currentState.State);
-            currentState.State = ResourceState::Unknown;
-
-            for (MipLevel mipLevel = resSubresources.BaseMipLevel; mipLevel < resSubresources.BaseMipLevel + resSubresources.NumMipLevels; mipLevel++)
-            {
-                for (ArraySlice arraySlice = resSubresources.BaseArraySlice; arraySlice < resSubresources.BaseArraySlice + resSubresources.NumArraySlices; arraySlice++)
-                    currentState.SubresourceStates[ImageSubresourceSpecification::SubresourceIndex(mipLevel, arraySlice, imageSpec)] = state;
-            }
-        }
+        return it->second;
     }
 
-    void StateTracker::SetBufferState(const Buffer& buffer, ResourceState state) const
+    BufferState& CommandListStateTracker::GetLocalState(const Buffer& buffer)
     {
-        BufferState& currentState = m_BufferStates[&buffer];
-        currentState.State = state;
+        auto [it, inserted] = m_BufferStates.try_emplace(&buffer);
+        if (inserted)
+            it->second.EnableUavBarriers = m_Tracker.GetEnableUavBarriers(buffer);
+
+        return it->second;
     }
 
-}
\ No newline at end of file
+}
@@ -4,6 +4,11 @@
 
 #include "Obsidian/Renderer/ImageSpec.hpp"
 #include "Obsidian/Renderer/BufferSpec.hpp"
+#include "Obsidian/Renderer/CommandListSpec.hpp"
+
+#include <vector>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace Obsidian
 {
@@ -30,6 +35,12 @@ namespace Obsidian::Internal
 
         ResourceState StateBefore = ResourceState::Unknown;
         ResourceState StateAfter = ResourceState::Unknown;
+
+        // Note: Only set when the resource moves to another queue (ownership transfer), CommandQueue::Count otherwise
+        CommandQueue QueueBefore = CommandQueue::Count;
+        CommandQueue QueueAfter = CommandQueue::Count;
+
+        bool Aliasing = false; // Note: The image takes over (placed) memory from another image, previous contents are discarded
     };
 
     struct BufferBarrier
@@ -39,6 +50,10 @@ namespace Obsidian::Internal
 
         ResourceState StateBefore = ResourceState::Unknown;
         ResourceState StateAfter = ResourceState::Unknown;
+
+        // Note: Only set when the resource moves to another queue (ownership transfer), CommandQueue::Count otherwise
+        CommandQueue QueueBefore = CommandQueue::Count;
+        CommandQueue QueueAfter = CommandQueue::Count;
     };
 
     ////////////////////////////////////////////////////////////////////////////////////
@@ -53,6 +68,8 @@ namespace Obsidian::Internal
         bool EnableUavBarriers = true; // Note: Just to keep track of the fact that the specification specified it
         bool FirstUavBarrierPlaced = false;
         bool PermanentTransition = false;
+
+        CommandQueue OwningQueue = CommandQueue::Count; // Note: Last queue that used the resource, CommandQueue::Count if it hasn't been used yet
     };
 
     struct BufferState
@@ -63,12 +80,16 @@ namespace Obsidian::Internal
         bool EnableUavBarriers = true; // Note: Just to keep track of the fact that the specification specified it
         bool FirstUavBarrierPlaced = false;
         bool PermanentTransition = false;
+
+        CommandQueue OwningQueue = CommandQueue::Count; // Note: Last queue that used the resource, CommandQueue::Count if it hasn't been used yet
     };
 
+    class CommandListStateTracker;
+
     ////////////////////////////////////////////////////////////////////////////////////
     // StateTracker
     ////////////////////////////////////////////////////////////////////////////////////
-    class StateTracker
+    class StateTracker // Note: Holds the device-wide (global) states, commandlists only touch these at submission
     {
     public:
         // Constructor & Destructor
@@ -81,24 +102,23 @@ namespace Obsidian::Internal
         void StopTracking(const Image& image);
         void StopTracking(const Buffer& buffer);
 
-        void RequireImageState(const CommandList& list, Image& image, const ImageSubresourceSpecification& subresources, ResourceState state) const;
-        void RequireBufferState(const CommandList& list, Buffer& buffer, ResourceState state) const;
-
-        void ResolvePermanentState(const CommandList& list, Image& image, const ImageSubresourceSpecification& subresource) const;
-        void ResolvePermanentState(const CommandList& list, Buffer& buffer) const;
+        // Note: Resolves the pending (first use) barriers of a commandlist against the global states
+        // and applies the commandlist's final states. Must be called in submission order.
+        // When a resource was last used on a different queue the barrier gets QueueBefore & QueueAfter set, so the backend can transfer ownership.
+        void ResolveSubmission(const CommandListStateTracker& tracker, CommandQueue queue, std::vector<ImageBarrier>& imageBarriers, std::vector<BufferBarrier>& bufferBarriers) const;
 
         // Getters
-        inline bool Contains(const Image& image) const { return m_ImageStates.contains(&image); }
-        inline bool Contains(const Buffer& buffer) const { return m_BufferStates.contains(&buffer); }
-
-        inline ImageState& GetImageState(const Image& image) const { return m_ImageStates[&image]; }
-        inline BufferState& GetBufferState(const Buffer& buffer) const { return m_BufferStates[&buffer]; }
+        bool Contains(const Image& image) const;
+        bool Contains(const Buffer& buffer) const;
 
         ResourceState GetResourceState(const Image& image, const ImageSubresourceSpecification& subresource) const;
         ResourceState GetResourceState(const Buffer& buffer) const;
 
-        inline std::vector<ImageBarrier>& GetImageBarriers(const CommandList& list) const { return m_ImageBarriers[&list]; }
-        inline std::vector<BufferBarrier>& GetBufferBarriers(const CommandList& list) const { return m_BufferBarriers[&list]; }
+        CommandQueue GetOwningQueue(const Image& image) const;
+        CommandQueue GetOwningQueue(const Buffer& buffer) const;
+
+        bool GetEnableUavBarriers(const Image& image) const;
+        bool GetEnableUavBarriers(const Buffer& buffer) const;
 
         // Setters
         // Note: Under special circumstances the outside modifies the state
@@ -106,14 +126,77 @@ namespace Obsidian::Internal
         void SetImageState(const Image& image, const ImageSubresourceSpecification& subresources, ResourceState state) const;
         void SetBufferState(const Buffer& buffer, ResourceState state) const;
 
+        void SetOwningQueue(const Image& image, CommandQueue queue) const;
+        void SetOwningQueue(const Buffer& buffer, CommandQueue queue) const;
+
     private:
         const Device& m_Device;
 
+        mutable std::shared_mutex m_Mutex = {};
+
         mutable std::unordered_map<const Image*, ImageState> m_ImageStates = { };
         mutable std::unordered_map<const Buffer*, BufferState> m_BufferStates = { };
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // CommandListStateTracker
+    ////////////////////////////////////////////////////////////////////////////////////
+    class CommandListStateTracker // Note: Owned by a single commandlist, so recording on multiple threads never touches shared state
+    {
+    public:
+        // Constructor & Destructor
+        CommandListStateTracker(const StateTracker& tracker);
+        ~CommandListStateTracker();
+
+        // Methods
+        void RequireImageState(Image& image, const ImageSubresourceSpecification& subresources, ResourceState state);
+        void RequireBufferState(Buffer& buffer, ResourceState state);
+
+        // Note: Makes a placed image the active user of its (aliased) memory and transitions the entire image to state, discarding its contents.
+        // Placed images that share memory must go through this on their first use after another image used the memory.
+        void AliasImage(Image& image, ResourceState state);
+
+        void ResolvePermanentState(Image& image, const ImageSubresourceSpecification& subresource);
+        void ResolvePermanentState(Buffer& buffer);
+
+        void Reset(); // Note: Clears all local states and barriers, should be called when the commandlist gets (re)opened
+
+        // Getters
+        inline const StateTracker& GetTracker() const { return m_Tracker; }
+
+        inline std::vector<ImageBarrier>& GetImageBarriers() { return m_ImageBarriers; }
+        inline std::vector<BufferBarrier>& GetBufferBarriers() { return m_BufferBarriers; }
+
+        inline const std::vector<ImageBarrier>& GetPendingImageBarriers() const { return m_PendingImageBarriers; }
+        inline const std::vector<BufferBarrier>& GetPendingBufferBarriers() const { return m_PendingBufferBarriers; }
+
+        inline const std::unordered_map<const Image*, ImageState>& GetImageStates() const { return m_ImageStates; }
+        inline const std::unordered_map<const Buffer*, BufferState>& GetBufferStates() const { return m_BufferStates; }
+
+        // Setters
+        // Note: Under special circumstances the commandlist modifies the state (renderpass end states)
+        // We need to reflect that here
+        void SetImageState(const Image& image, const ImageSubresourceSpecification& subresources, ResourceState state);
+        void SetBufferState(const Buffer& buffer, ResourceState state);
+
+    private:
+        // Private methods
+        ImageState& GetLocalState(const Image& image); // Note: Creates the local state on first use, with the global EnableUavBarriers
+        BufferState& GetLocalState(const Buffer& buffer);
+
+    private:
+        const StateTracker& m_Tracker;
+
+        // Note: ResourceState::Unknown means the (sub)resource hasn't been used by this commandlist (yet)
+        std::unordered_map<const Image*, ImageState> m_ImageStates = { };
+        std::unordered_map<const Buffer*, BufferState> m_BufferStates = { };
+
+        std::vector<ImageBarrier> m_ImageBarriers = { };
+        std::vector<BufferBarrier> m_BufferBarriers = { };
 
-        mutable std::unordered_map<const CommandList*, std::vector<ImageBarrier>> m_ImageBarriers = { };
-        mutable std::unordered_map<const CommandList*, std::vector<BufferBarrier>> m_BufferBarriers = { };
+        // Note: First use transitions, the StateBefore gets resolved against the global state at submission
+        std::vector<ImageBarrier> m_PendingImageBarriers = { };
+        std::vector<BufferBarrier> m_PendingBufferBarriers = { };
     };
 
 }
\ No newline at end of file
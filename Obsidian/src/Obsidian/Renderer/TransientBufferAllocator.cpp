@@ -0,0 +1,129 @@
+#include "obpch.h"
+#include "TransientBufferAllocator.hpp"
+
+#include "Obsidian/Core/Logging.hpp"
+#include "Obsidian/Utils/Profiler.hpp"
+
+#include "Obsidian/Renderer/Device.hpp"
+
+#include <Nano/Nano.hpp>
+
+#include <cstring>
+#include <algorithm>
+#include <limits>
+
+namespace Obsidian
+{
+
+    namespace
+    {
+
+        ////////////////////////////////////////////////////////////////////////////////////
+        // Helper methods
+        ////////////////////////////////////////////////////////////////////////////////////
+        BufferSpecification TransientBufferSpecification(const TransientBufferAllocatorSpecification& specs)
+        {
+            OB_ASSERT((specs.FrameSize > 0), "[TransientBufferAllocator] FrameSize must be more than 0.");
+            OB_ASSERT((specs.MaxAllocationSize > 0) && (specs.MaxAllocationSize <= specs.FrameSize), "[TransientBufferAllocator] MaxAllocationSize must be more than 0 and less or equal to FrameSize.");
+            OB_ASSERT((specs.IsUniformBuffer || specs.IsStorageBuffer), "[TransientBufferAllocator] Allocator must be usable as a uniform and/or storage buffer.");
+
+            // Note: The buffer is split up in Stride sized elements, so the frame size gets rounded up to a multiple of MaxAllocationSize.
+            const uint32_t elementsPerFrame = static_cast<uint32_t>((specs.FrameSize + specs.MaxAllocationSize - 1) / specs.MaxAllocationSize);
+
+            return BufferSpecification()
+                .SetStride(specs.MaxAllocationSize)
+                .SetElementCount(elementsPerFrame * Information::FramesInFlight)
+                .SetIsUniformBuffer(specs.IsUniformBuffer)
+                .SetIsUnorderedAccessed(specs.IsStorageBuffer)
+                .SetIsDynamic(true)
+                .SetCPUAccess(CpuAccessMode::Write)
+                .SetIsPersistentlyMapped(true)
+                .SetDebugName(specs.DebugName);
+        }
+
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Constructor & Destructor
+    ////////////////////////////////////////////////////////////////////////////////////
+    TransientBufferAllocator::TransientBufferAllocator(const Device& device, const TransientBufferAllocatorSpecification& specs)
+        : m_Device(device), m_Specification(specs), m_Buffer(device.CreateBuffer(TransientBufferSpecification(specs)))
+    {
+        m_Alignment = m_Buffer.GetAlignment();
+        m_WindowSize = Nano::Memory::AlignOffset(m_Specification.MaxAllocationSize, m_Alignment);
+        m_FrameSize = m_Buffer.GetSpecification().Size / Information::FramesInFlight;
+
+        OB_ASSERT((m_Buffer.GetSpecification().Size <= std::numeric_limits<uint32_t>::max()), "[TransientBufferAllocator] Total size exceeds the range of a dynamic offset.");
+
+        void* memory = nullptr;
+        m_Device.MapBuffer(m_Buffer, memory); // Note: Returns the persistently mapped pointer
+        m_Memory = static_cast<uint8_t*>(memory);
+    }
+
+    TransientBufferAllocator::~TransientBufferAllocator()
+    {
+        m_Device.DestroyBuffer(m_Buffer);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // Methods
+    ////////////////////////////////////////////////////////////////////////////////////
+    void TransientBufferAllocator::NextFrame()
+    {
+        OB_PROFILE("TransientBufferAllocator::NextFrame()");
+
+        // Note: Everything that could have read from the current region has been submitted by now.
+        m_FrameValues[m_CurrentFrame] = m_Device.GetSubmittedValue();
+        m_CurrentFrame = static_cast<uint8_t>((m_CurrentFrame + 1) % Information::FramesInFlight);
+
+        // Note: Normally the swapchain already throttles the CPU, so this wait rarely blocks.
+        const uint64_t value = m_FrameValues[m_CurrentFrame];
+        if ((value != 0) && (m_Device.GetCompletedValue() < value))
+            m_Device.WaitForValue(value);
+
+        m_Offset.store(0, std::memory_order_relaxed);
+    }
+
+    void TransientBufferAllocator::Flush() const
+    {
+        OB_PROFILE("TransientBufferAllocator::Flush()");
+
+        const size_t usedSize = std::min(m_Offset.load(std::memory_order_relaxed), m_FrameSize);
+        if (usedSize == 0)
+            return;
+
+        m_Device.FlushBuffer(m_Buffer, BufferRange().SetOffset(static_cast<size_t>(m_CurrentFrame) * m_FrameSize).SetSize(usedSize));
+    }
+
+    TransientAllocation TransientBufferAllocator::Allocate(size_t size)
+    {
+        OB_ASSERT((size > 0) && (size <= m_Specification.MaxAllocationSize), "[TransientBufferAllocator] Allocation size must be more than 0 and less or equal to MaxAllocationSize.");
+
+        // Note: Every allocation is rounded up to the alignment, so every offset stays aligned without a lock.
+        const size_t offset = m_Offset.fetch_add(Nano::Memory::AlignOffset(size, m_Alignment), std::memory_order_relaxed);
+        if (offset + m_WindowSize > m_FrameSize) // Note: Checked in every build, handing out the memory would overwrite regions that are still in flight
+        {
+            m_Overflowed.store(true, std::memory_order_relaxed);
+            OB_LOG_ERROR("[TransientBufferAllocator] Out of memory for this frame, increase FrameSize. Returning an invalid allocation.");
+            return {};
+        }
+
+        const size_t bufferOffset = (static_cast<size_t>(m_CurrentFrame) * m_FrameSize) + offset;
+
+        TransientAllocation allocation = {};
+        allocation.Memory = ((m_Memory) ? (m_Memory + bufferOffset) : nullptr);
+        allocation.Range = BufferRange().SetOffset(bufferOffset).SetSize(size);
+        allocation.DynamicOffset = static_cast<uint32_t>(bufferOffset);
+        return allocation;
+    }
+
+    TransientAllocation TransientBufferAllocator::Upload(const void* memory, size_t size)
+    {
+        TransientAllocation allocation = Allocate(size);
+        if (allocation.IsValid() && allocation.Memory)
+            std::memcpy(allocation.Memory, memory, size);
+
+        return allocation;
+    }
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/API.hpp"
+#include "Obsidian/Renderer/Buffer.hpp"
+#include "Obsidian/Renderer/BufferSpec.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
+namespace Obsidian
+{
+
+    class Device;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // TransientBufferAllocator // Note: A persistently mapped ring of Information::FramesInFlight regions in a 
+    // single dynamic buffer. Per frame constants get bump allocated from the current region, a region gets 
+    // reused once the device's timeline has passed the value that was submitted while it was current.
+    // Relies on dynamic offsets, so it can't be used on a device with DeviceSpecification::DescriptorBuffers.
+    ////////////////////////////////////////////////////////////////////////////////////
+    class TransientBufferAllocator
+    {
+    public:
+        // Constructor & Destructor
+        TransientBufferAllocator(const Device& device, const TransientBufferAllocatorSpecification& specs);
+        ~TransientBufferAllocator();
+
+        // Methods
+        void NextFrame(); // Note: Call once per frame, after the previous frame's lists have been submitted and before allocating
+
+        TransientAllocation Allocate(size_t size); // Note: Thread safe, returns an invalid allocation when the frame is out of memory
+        TransientAllocation Upload(const void* memory, size_t size); // Note: Allocates and copies memory into the allocation
+
+        void Flush() const; // Note: Call before submitting the lists that use this frame's allocations, only does work on non-coherent memory
+
+        // Getters
+        inline const TransientBufferAllocatorSpecification& GetSpecification() const { return m_Specification; }
+
+        inline Buffer& GetBuffer() { return m_Buffer; } // Note: Bind with a BufferRange of FullSize as a dynamic buffer
+        inline const Buffer& GetBuffer() const { return m_Buffer; }
+
+        inline size_t GetFrameSize() const { return m_FrameSize; }
+        inline size_t GetUsedSize() const { return std::min(m_Offset.load(std::memory_order_relaxed), m_FrameSize); } // Note: Bytes allocated in the current frame
+        inline bool HasOverflowed() const { return m_Overflowed.load(std::memory_order_relaxed); } // Note: Whether an allocation failed since the allocator was created, FrameSize should be increased
+
+    private:
+        const Device& m_Device;
+        TransientBufferAllocatorSpecification m_Specification;
+
+        Buffer m_Buffer;
+        uint8_t* m_Memory = nullptr;
+
+        size_t m_Alignment = 0;
+        size_t m_WindowSize = 0; // Note: Aligned MaxAllocationSize, the range the dynamic descriptor covers
+        size_t m_FrameSize = 0;
+
+        uint8_t m_CurrentFrame = 0;
+        std::atomic<size_t> m_Offset = 0;
+        std::atomic<bool> m_Overflowed = false;
+        std::array<uint64_t, Information::FramesInFlight> m_FrameValues = { }; // Note: Timeline value to wait on before a region can be reused
+    };
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Obsidian/Core/Information.hpp"
+
+#include "Obsidian/Renderer/API.hpp"
+#include "Obsidian/Renderer/ImageSpec.hpp"
+#include "Obsidian/Renderer/ResourceSpec.hpp"
+#include "Obsidian/Renderer/UploadManagerSpec.hpp"
+
+#include "Obsidian/Platform/Vulkan/VulkanUploadManager.hpp"
+#include "Obsidian/Platform/Dx12/Dx12UploadManager.hpp"
+#include "Obsidian/Platform/Dummy/DummyUploadManager.hpp"
+
+#include <Nano/Nano.hpp>
+
+namespace Obsidian
+{
+
+    class Device;
+    class Image;
+    class Buffer;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // UploadManager // Note: Streams data into GPU resources through a staging ring on
+    // a dedicated transfer queue (if available), so uploads don't stall the graphics queue.
+    ////////////////////////////////////////////////////////////////////////////////////
+    class UploadManager
+    {
+    public:
+        using Type = Nano::Types::SelectorType<Information::RenderingAPI,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Vulkan, Internal::VulkanUploadManager>,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Dx12, Internal::Dx12UploadManager>,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Metal, Internal::DummyUploadManager>,
+            Nano::Types::EnumToType<Information::Structs::RenderingAPI::Dummy, Internal::DummyUploadManager>
+        >;
+    public:
+        // Destructor
+        ~UploadManager() = default;
+
+        // Methods // Note: Uploads are recorded into a batch, which gets submitted by Flush(). The returned ticket belongs to that batch.
+        // The resources must be tracked and must not be in use by the GPU while the upload is in flight.
+        // finalState is the state the resource is left in, ResourceState::Unknown uses the permanent state or CopyDst.
+        inline UploadTicket UploadBuffer(Buffer& dst, const void* memory, size_t size, size_t dstOffset = 0, ResourceState finalState = ResourceState::Unknown) { return m_Impl->UploadBuffer(dst, memory, size, dstOffset, finalState); }
+        inline UploadTicket UploadImage(Image& dst, const ImageSliceSpecification& slice, const void* memory, size_t size, ResourceState finalState = ResourceState::Unknown) { return m_Impl->UploadImage(dst, slice, memory, size, finalState); } // Note: Memory must be tightly packed
+
+        inline UploadTicket Flush() { return m_Impl->Flush(); } // Note: Submits all recorded uploads, must be called before waiting on their ticket
+
+        inline bool IsComplete(const UploadTicket& ticket) const { return m_Impl->IsComplete(ticket); }
+        inline void Wait(const UploadTicket& ticket) const { m_Impl->Wait(ticket); } // Note: Makes the CPU wait till the upload has completed, submissions using the resources must still pass the ticket in WaitOnUploads
+
+        // Getters
+        inline const UploadManagerSpecification& GetSpecification() const { return m_Impl->GetSpecification(); }
+
+    public: //private:
+        // Constructor
+        inline UploadManager(const Device& device, const UploadManagerSpecification& specs) { m_Impl.Construct(device, specs); }
+
+    private:
+        Internal::APIObject<Type> m_Impl = {};
+
+        friend class Device;
+        friend class APICaster;
+    };
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Nano/Nano.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace Obsidian
+{
+
+    class UploadManager;
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // UploadManagerSpecification
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct UploadManagerSpecification
+    {
+    public:
+        size_t StagingSize = 64ull * 1024ull * 1024ull; // Note: Size of the staging ring in bytes, a single image upload must fit inside (buffer uploads get split up)
+
+        std::string DebugName = {};
+
+    public:
+        // Setters
+        inline constexpr UploadManagerSpecification& SetStagingSize(size_t size) { StagingSize = size; return *this; }
+        inline UploadManagerSpecification& SetDebugName(const std::string& name) { DebugName = name; return *this; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // UploadTicket // Note: Can be waited on by a submission through CommandListSubmitArgs::WaitOnUploads
+    ////////////////////////////////////////////////////////////////////////////////////
+    struct UploadTicket
+    {
+    public:
+        const UploadManager* Manager = nullptr;
+        uint64_t Value = 0; // Note: Value on the manager's timeline, signaled once the upload is done and available to the graphics queue
+
+    public:
+        // Getters
+        inline constexpr bool IsValid() const { return ((Manager != nullptr) && (Value != 0)); }
+    };
+
+}
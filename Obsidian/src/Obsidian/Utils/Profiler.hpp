@@ -15,6 +15,7 @@ namespace Obsidian::Internal
 	// Settings
 	#define OB_ENABLE_PROFILING 0
 	#define OB_MEM_PROFILING 0
+	#define OB_GPU_PROFILING 0 // Note: Only supported on Vulkan
 
 	// Profiling macros
 	#if !defined(OB_CONFIG_DIST) && OB_ENABLE_PROFILING
@@ -33,4 +34,23 @@ namespace Obsidian::Internal
 		#define OB_PROFILE(name)
 	#endif
 
-}
\ No newline at end of file
+	// GPU profiling macros
+	#if !defined(OB_CONFIG_DIST) && OB_ENABLE_PROFILING && OB_GPU_PROFILING && defined(OB_API_VULKAN)
+		#define OB_GPU_PROFILING_ENABLED 1
+
+		#define OB_PROFILE_GPU(context, commandBuffer, name) TracyVkZone(context, commandBuffer, name)
+		#define OB_PROFILE_GPU_COLLECT(context, commandBuffer) TracyVkCollect(context, commandBuffer)
+	#else
+		#define OB_GPU_PROFILING_ENABLED 0
+
+		#define OB_PROFILE_GPU(context, commandBuffer, name)
+		#define OB_PROFILE_GPU_COLLECT(context, commandBuffer)
+	#endif
+
+}
+
+#if OB_GPU_PROFILING_ENABLED
+	#include "Obsidian/Platform/Vulkan/Vulkan.hpp"
+
+	#include <tracy/TracyVulkan.hpp>
+#endif
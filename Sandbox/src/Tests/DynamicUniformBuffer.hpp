@@ -2,6 +2,7 @@
 #include "Common/Camera2D.hpp"
 
 #include <Obsidian/Maths/Functions.hpp>
+#include <Obsidian/Renderer/TransientBufferAllocator.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////////
 // Shaders
@@ -255,7 +256,7 @@ public:
 			// Buffers
 			// StagingBuffer
 			Buffer stagingBuffer = m_Device->CreateBuffer(BufferSpecification()
-				.SetSize(sizeof(g_VertexData) + sizeof(g_IndexData) + (Nano::Memory::AlignOffset(sizeof(ModelData), BufferSpecification::DefaultUniformBufferAlignment) * 3))
+				.SetSize(sizeof(g_VertexData) + sizeof(g_IndexData))
 				.SetCPUAccess(CpuAccessMode::Write)
 			);
 			m_Device->StartTracking(stagingBuffer, ResourceState::Unknown);
@@ -282,26 +283,18 @@ public:
 			if (bufferMemory) std::memcpy(static_cast<uint8_t*>(bufferMemory) + sizeof(g_VertexData), g_IndexData.data(), sizeof(g_IndexData));
 			initCommand.CopyBuffer(m_IndexBuffer.Get(), stagingBuffer, sizeof(g_IndexData), sizeof(g_VertexData));
 
-			m_UniformBuffer.Construct(m_Device.Get(), BufferSpecification()
-				.SetSize(0)
-				.SetStride(sizeof(ModelData))
-				.SetElementCount(3)
+			// Note: The model matrices get uploaded every frame into the current region of the allocator
+			m_ModelAllocator.Construct(m_Device.Get(), TransientBufferAllocatorSpecification()
+				.SetFrameSize(Nano::Memory::AlignOffset(sizeof(ModelData), BufferSpecification::DefaultUniformBufferAlignment) * m_Models.size())
+				.SetMaxAllocationSize(sizeof(ModelData))
 				.SetIsUniformBuffer(true)
-				.SetIsDynamic(true)
-				.SetDebugName("DynamicUniform")
+				.SetDebugName("ModelAllocator")
 			);
-			m_Device->StartTracking(m_UniformBuffer.Get(), ResourceState::Unknown);
+			m_Device->StartTracking(m_ModelAllocator->GetBuffer(), ResourceState::Unknown);
 
-			Maths::Mat4<float> matrix = Maths::Mat4<float>(1.0f);
-			m_Device->WriteBuffer(stagingBuffer, &matrix, sizeof(ModelData), 0, sizeof(g_VertexData) + sizeof(g_IndexData));
-
-			matrix = Maths::Translate(matrix, { 1.0f, 0.0f, 0.0f });
-			m_Device->WriteBuffer(stagingBuffer, &matrix, sizeof(ModelData), 0, sizeof(g_VertexData) + sizeof(g_IndexData) + Nano::Memory::AlignOffset(sizeof(ModelData), m_UniformBuffer->GetAlignment()));
-			
-			matrix = Maths::Translate(matrix, { -2.0f, -1.0f, 0.0f });
-			m_Device->WriteBuffer(stagingBuffer, &matrix, sizeof(ModelData), 0, sizeof(g_VertexData) + sizeof(g_IndexData) + (Nano::Memory::AlignOffset(sizeof(ModelData), m_UniformBuffer->GetAlignment() * 2)));
-				
-			initCommand.CopyBuffer(m_UniformBuffer.Get(), stagingBuffer, (Nano::Memory::AlignOffset(sizeof(ModelData), m_UniformBuffer->GetAlignment()) * 3), sizeof(g_VertexData) + sizeof(g_IndexData));
+			m_Models[0].Matrix = Maths::Mat4<float>(1.0f);
+			m_Models[1].Matrix = Maths::Translate(m_Models[0].Matrix, { 1.0f, 0.0f, 0.0f });
+			m_Models[2].Matrix = Maths::Translate(m_Models[1].Matrix, { -2.0f, -1.0f, 0.0f });
 
 			m_Camera2D.Construct(m_Window.Get());
 
@@ -314,7 +307,7 @@ public:
 			// Set items
 			for (size_t i = 0; i < m_Set0s.size(); i++)
 			{
-				m_Set0s[i]->SetItem(1, m_UniformBuffer.Get(), BufferRange());
+				m_Set0s[i]->SetItem(1, m_ModelAllocator->GetBuffer(), BufferRange());
 			}
 
 			initCommand.WaitTillComplete();
@@ -325,7 +318,8 @@ public:
 
 	~DynamicUniformBuffer()
 	{
-		m_Device->DestroyBuffer(m_UniformBuffer.Get());
+		m_ModelAllocator.Destroy();
+
 		m_Device->DestroyBuffer(m_IndexBuffer.Get());
 		m_Device->DestroyBuffer(m_VertexBuffer.Get());
 
@@ -366,6 +360,8 @@ public:
 					m_CommandPools[m_Swapchain->GetCurrentFrame()]->Reset();
 					auto& list = m_CommandLists[m_Swapchain->GetCurrentFrame()];
 
+					m_ModelAllocator->NextFrame();
+
 					list->Open();
 
 					list->StartRenderpass(RenderpassStartArgs()
@@ -382,35 +378,29 @@ public:
 					list->BindVertexBuffer(m_VertexBuffer.Get());
 					list->BindIndexBuffer(m_IndexBuffer.Get());
 
-					std::array<uint32_t, 1> offset = { 0 };
-					list->BindBindingSet(m_Set0s[m_Swapchain->GetCurrentFrame()], offset);
-
 					list->PushConstants(&m_Camera2D->GetCamera2D(), sizeof(Camera2DData));
 
-					list->DrawIndexed(DrawArguments()
-						.SetVertexCount((sizeof(g_IndexData) / sizeof(g_IndexData[0])))
-						.SetInstanceCount(1)
-					);
+					for (const ModelData& model : m_Models)
+					{
+						TransientAllocation allocation = m_ModelAllocator->Upload(&model, sizeof(ModelData));
+						OB_ASSERT(allocation.IsValid(), "ModelAllocator ran out of memory.");
 
-					offset[0] = static_cast<uint32_t>(Nano::Memory::AlignOffset(offset[0] + sizeof(ModelData), m_UniformBuffer->GetAlignment()));
-					list->BindBindingSet(m_Set0s[m_Swapchain->GetCurrentFrame()], offset);
-					list->DrawIndexed(DrawArguments()
-						.SetVertexCount((sizeof(g_IndexData) / sizeof(g_IndexData[0])))
-						.SetInstanceCount(1)
-					);
+						std::array<uint32_t, 1> offset = { allocation.DynamicOffset };
+						list->BindBindingSet(m_Set0s[m_Swapchain->GetCurrentFrame()], offset);
 
-					offset[0] = static_cast<uint32_t>(Nano::Memory::AlignOffset(offset[0] + sizeof(ModelData), m_UniformBuffer->GetAlignment()));
-					list->BindBindingSet(m_Set0s[m_Swapchain->GetCurrentFrame()], offset);
-					list->DrawIndexed(DrawArguments()
-						.SetVertexCount((sizeof(g_IndexData) / sizeof(g_IndexData[0])))
-						.SetInstanceCount(1)
-					);
+						list->DrawIndexed(DrawArguments()
+							.SetVertexCount((sizeof(g_IndexData) / sizeof(g_IndexData[0])))
+							.SetInstanceCount(1)
+						);
+					}
 
 					list->EndRenderpass(RenderpassEndArgs()
 						.SetRenderpass(m_Renderpass.Get())
 					);
 
 					list->Close();
+
+					m_ModelAllocator->Flush();
 					list->Submit(CommandListSubmitArgs()
 						.SetWaitForSwapchainImage(true)
 						.SetOnFinishMakeSwapchainPresentable(true)
@@ -476,7 +466,9 @@ private:
 
 	Nano::Memory::DeferredConstruct<Buffer> m_VertexBuffer = {};
 	Nano::Memory::DeferredConstruct<Buffer> m_IndexBuffer = {};
-	Nano::Memory::DeferredConstruct<Buffer> m_UniformBuffer = {};
+
+	std::array<ModelData, 3> m_Models = { };
+	Nano::Memory::DeferredConstruct<TransientBufferAllocator, true> m_ModelAllocator = {};
 
 	Nano::Memory::DeferredConstruct<Camera2D> m_Camera2D = {};
 
@@ -1,6 +1,10 @@
 #include "Tests/TestBase.hpp"
 #include "Common/Camera3D.hpp"
 
+#include <Obsidian/Renderer/RenderGraph.hpp>
+#include <Obsidian/Renderer/PipelineCompiler.hpp>
+#include <Obsidian/Renderer/ShaderReflection.hpp>
+
 #define TINYOBJLOADER_IMPLEMENTATION
 //#define TINYOBJLOADER_USE_MAPBOX_EARCUT
 #include <tinyobj/tinyobjloader.h>
@@ -110,6 +114,8 @@ float4 main(PSInput input) : SV_TARGET
 
 #endif
 
+inline constexpr Format g_DepthFormat = Format::D32;
+
 ////////////////////////////////////////////////////////////////////////////////////
 // Vertex data
 ////////////////////////////////////////////////////////////////////////////////////
@@ -162,31 +168,11 @@ public:
 			);
 		}
 
-		// Renderpass
-		m_Renderpass.Construct(m_Device.Get(), RenderpassSpecification()
-			.SetBindpoint(PipelineBindpoint::Graphics)
-
-			.SetColourImageSpecification(m_Swapchain->GetImage(0).GetSpecification())
-			.SetColourLoadOperation(LoadOperation::Clear)
-			.SetColourStoreOperation(StoreOperation::Store)
-			.SetColourStartState(ResourceState::Present)
-			.SetColourRenderingState(ResourceState::RenderTarget)
-			.SetColourEndState(ResourceState::Present)
-
-			.SetDebugName("Renderpass")
+		// RenderGraph // Note: Renders without a renderpass, the graph handles the transitions & the transient depth image
+		m_RenderGraph.Construct(m_Device.Get(), RenderGraphSpecification()
+			.SetDebugName("RenderGraph")
 		);
 
-		for (size_t i = 0; i < m_Swapchain->GetImageCount(); i++)
-		{
-			std::string debugName = std::format("Framebuffer({0}) for: {1}", i, m_Renderpass->GetSpecification().DebugName);
-			(void)m_Renderpass->CreateFramebuffer(FramebufferSpecification()
-				.SetColourAttachment(FramebufferAttachment()
-					.SetImage(m_Swapchain->GetImage(static_cast<uint8_t>(i)))
-				)
-				.SetDebugName(debugName)
-			);
-		}
-
 		// ShaderCompiler & Shader
 		ShaderCompiler compiler;
 		std::vector<uint32_t> vertexSPIRV = compiler.CompileToSPIRV(ShaderStage::Vertex, std::string(g_VertexShader), "main", g_ShadingLanguage);
@@ -230,37 +216,18 @@ public:
 				.SetDebugName("a_TexCoord")
 		});
 
-		m_BindingLayoutSet0.Construct(m_Device.Get(), BindingLayoutSpecification()
-			.SetRegisterSpace(0)
+		// Note: The binding layouts get reflected from the shaders
+		ShaderReflection reflection = ShaderReflection(ShaderStage::Vertex, vertexSPIRV, "main")
+			.Merge(ShaderReflection(ShaderStage::Fragment, fragmentSPIRV, "main"));
 
-			// Vertex
-			.AddItem(BindingLayoutItem()
-				.SetSlot(0)
-				.SetVisibility(ShaderStage::Vertex)
-				.SetType(ResourceType::UniformBuffer)
-				.SetDebugName("u_Camera3D")
-			)
-
-			// Fragment
-			.AddItem(BindingLayoutItem()
-				.SetSlot(1)
-				.SetVisibility(ShaderStage::Fragment)
-				.SetType(ResourceType::Image)
-				.SetDebugName("u_Texture")
-			)
-			.AddItem(BindingLayoutItem()
-				.SetSlot(2)
-				.SetVisibility(ShaderStage::Fragment)
-				.SetType(ResourceType::Sampler)
-				.SetDebugName("u_Sampler")
-			)
-
-			.SetDebugName("Layout for: Set0")
-		);
+		m_LayoutCache.Construct(m_Device.Get());
+		std::vector<BindingLayout*> layouts = m_LayoutCache->GetLayouts(reflection);
+		OB_ASSERT((layouts.size() == 1), "Shaders should only use register space 0.");
+		m_BindingLayoutSet0 = layouts[0];
 
 		// BindingPool & Sets
 		m_BindingSetPool0.Construct(m_Device.Get(), BindingSetPoolSpecification()
-			.SetLayout(m_BindingLayoutSet0.Get())
+			.SetLayout(*m_BindingLayoutSet0)
 			.SetSetAmount(Information::FramesInFlight)
 			.SetDebugName("BindingSetPool0")
 		);
@@ -269,8 +236,9 @@ public:
 			m_Set0s[i].Construct(m_BindingSetPool0.Get(), BindingSetSpecification());
 		}
 
-		// Pipeline
-		m_Pipeline.Construct(m_Device.Get(), GraphicsPipelineSpecification()
+		// Pipeline // Note: Gets created on a worker thread while the model is loading
+		m_PipelineCompiler.Construct(m_Device.Get());
+		m_Pipeline = &m_PipelineCompiler->CreateGraphicsPipelineAsync(GraphicsPipelineSpecification()
 			.SetPrimitiveType(PrimitiveType::TriangleList)
 			.SetInputLayout(m_InputLayout.Get())
 			.SetVertexShader(vertexShader)
@@ -298,22 +266,19 @@ public:
 					.SetAlphaToCoverageEnable(false)
 				)
 				.SetDepthStencilState(DepthStencilState()
-					.SetDepthTestEnable(false)	// Note: Enable for depth
-					.SetDepthWriteEnable(false)	// Note: Enable for depth
+					.SetDepthTestEnable(true)
+					.SetDepthWriteEnable(true)
 					.SetDepthFunc(ComparisonFunc::Less)
 					.SetStencilEnable(false)
 				)
 			)
 
-			.SetRenderpass(m_Renderpass.Get())
-			.AddBindingLayout(m_BindingLayoutSet0.Get())
+			.AddColourFormat(m_Swapchain->GetImage(0).GetSpecification().ImageFormat)
+			.SetDepthFormat(g_DepthFormat)
+			.AddBindingLayout(*m_BindingLayoutSet0)
 			.SetDebugName("GraphicsPipeline")
 		);
 
-		// Destroy shaders
-		m_Device->DestroyShader(vertexShader);
-		m_Device->DestroyShader(fragmentShader);
-
 		// Loading
 		std::unordered_map<Vertex, uint32_t> uniqueVertices;
 		std::vector<Vertex> vertices;
@@ -476,6 +441,11 @@ public:
 			m_Device->DestroyBuffer(stagingBuffer);
 			m_Device->DestroyStagingImage(stagingImage);
 		}
+
+		// Destroy shaders // Note: They have to stay alive until the pipeline has been created
+		m_Pipeline->Wait();
+		m_Device->DestroyShader(vertexShader);
+		m_Device->DestroyShader(fragmentShader);
 	}
 
 	~Object()
@@ -490,14 +460,14 @@ public:
 		m_Device->DestroyBuffer(m_IndexBuffer.Get());
 		m_Device->DestroyBuffer(m_VertexBuffer.Get());
 
-		m_Device->DestroyGraphicsPipeline(m_Pipeline.Get());
+		m_PipelineCompiler.Destroy();
 
 		m_Device->FreeBindingSetPool(m_BindingSetPool0.Get());
 
-		m_Device->DestroyBindingLayout(m_BindingLayoutSet0.Get());
+		m_LayoutCache.Destroy();
 		m_Device->DestroyInputLayout(m_InputLayout.Get());
 
-		m_Device->DestroyRenderpass(m_Renderpass.Get());
+		m_RenderGraph.Destroy();
 
 		for (size_t i = 0; i < m_CommandPools.size(); i++)
 		{
@@ -530,33 +500,10 @@ public:
 					m_CommandPools[m_Swapchain->GetCurrentFrame()]->Reset();
 					auto& list = m_CommandLists[m_Swapchain->GetCurrentFrame()];
 
-					list->Open();
-
-					list->StartRenderpass(RenderpassStartArgs()
-						.SetRenderpass(m_Renderpass.Get())
-
-						.SetViewport(Viewport(static_cast<float>(m_Window->GetSize().x), static_cast<float>(m_Window->GetSize().y)))
-						.SetScissor(ScissorRect(Viewport(static_cast<float>(m_Window->GetSize().x), static_cast<float>(m_Window->GetSize().y))))
-
-						.SetColourClear({ 0.0f, 0.0f, 0.0f, 1.0f })
-					);
-
-					list->BindPipeline(m_Pipeline.Get());
-
-					list->BindVertexBuffer(m_VertexBuffer.Get());
-					list->BindIndexBuffer(m_IndexBuffer.Get());
-
-					list->BindBindingSet(m_Set0s[m_Swapchain->GetCurrentFrame()]);
-
-					list->DrawIndexed(DrawArguments()
-						.SetVertexCount(static_cast<uint32_t>(m_IndexBuffer->GetSpecification().Size / sizeof(uint32_t)))
-						.SetInstanceCount(1)
-					);
-
-					list->EndRenderpass(RenderpassEndArgs()
-						.SetRenderpass(m_Renderpass.Get())
-					);
+					BuildGraph();
 
+					list->Open();
+					m_RenderGraph->Execute(list.Get());
 					list->Close();
 					list->Submit(CommandListSubmitArgs()
 						.SetWaitForSwapchainImage(true)
@@ -577,7 +524,6 @@ private:
 		handler.Handle<WindowResizeEvent>([&](WindowResizeEvent& wre) mutable
 		{
 			m_Swapchain->Resize(wre.GetWidth(), wre.GetHeight());
-			m_Renderpass->ResizeFramebuffers();
 		});
 
 		m_Camera3D->OnEvent(e);
@@ -608,6 +554,59 @@ private:
 		}
 	}
 
+	void BuildGraph()
+	{
+		m_RenderGraph->Reset();
+
+		RenderGraphImage backbuffer = m_RenderGraph->ImportImage(m_Swapchain->GetImage(m_Swapchain->GetAcquiredImage()), ResourceState::Present);
+		RenderGraphImage depth = m_RenderGraph->CreateImage(ImageSpecification()
+			.SetImageFormat(g_DepthFormat)
+			.SetImageDimension(ImageDimension::Image2D)
+			.SetIsRenderTarget(true)
+			.SetWidthAndHeight(m_Window->GetSize().x, m_Window->GetSize().y)
+			.SetDebugName("Depth image")
+		);
+
+		m_RenderGraph->AddPass("Object", [this, backbuffer, depth](CommandList& list, const RenderGraph& graph)
+		{
+			list.StartRenderpass(RenderpassStartArgs()
+				.AddColourAttachment(RenderingAttachment()
+					.SetImage(graph.GetImage(backbuffer))
+					.SetLoadOperation(LoadOperation::Clear)
+				)
+				.SetDepthAttachment(RenderingAttachment()
+					.SetImage(graph.GetImage(depth))
+					.SetLoadOperation(LoadOperation::Clear)
+					.SetStoreOperation(StoreOperation::DontCare)
+				)
+
+				.SetViewport(Viewport(static_cast<float>(m_Window->GetSize().x), static_cast<float>(m_Window->GetSize().y)))
+				.SetScissor(ScissorRect(Viewport(static_cast<float>(m_Window->GetSize().x), static_cast<float>(m_Window->GetSize().y))))
+
+				.SetColourClear({ 0.0f, 0.0f, 0.0f, 1.0f })
+				.SetDepthClear(1.0f)
+			);
+
+			list.BindPipeline(m_Pipeline->Get());
+
+			list.BindVertexBuffer(m_VertexBuffer.Get());
+			list.BindIndexBuffer(m_IndexBuffer.Get());
+
+			list.BindBindingSet(m_Set0s[m_Swapchain->GetCurrentFrame()]);
+
+			list.DrawIndexed(DrawArguments()
+				.SetVertexCount(static_cast<uint32_t>(m_IndexBuffer->GetSpecification().Size / sizeof(uint32_t)))
+				.SetInstanceCount(1)
+			);
+
+			list.EndRenderpass(RenderpassEndArgs());
+		})
+			.Write(backbuffer, ResourceState::RenderTarget)
+			.Write(depth, ResourceState::DepthWrite);
+
+		m_RenderGraph->Compile();
+	}
+
 	void Update(float deltaTime)
 	{
 		m_Camera3D->OnUpdate(deltaTime);
@@ -620,14 +619,17 @@ private:
 	std::array<Nano::Memory::DeferredConstruct<CommandListPool>, Information::FramesInFlight> m_CommandPools = { };
 	std::array<Nano::Memory::DeferredConstruct<CommandList>, Information::FramesInFlight> m_CommandLists = { };
 
-	Nano::Memory::DeferredConstruct<Renderpass> m_Renderpass = {};
+	Nano::Memory::DeferredConstruct<RenderGraph, true> m_RenderGraph = {};
 
 	Nano::Memory::DeferredConstruct<InputLayout> m_InputLayout = {};
-	Nano::Memory::DeferredConstruct<BindingLayout> m_BindingLayoutSet0 = {};
+	Nano::Memory::DeferredConstruct<BindingLayoutCache, true> m_LayoutCache = {};
+	BindingLayout* m_BindingLayoutSet0 = nullptr;
 
 	Nano::Memory::DeferredConstruct<BindingSetPool> m_BindingSetPool0 = {};
 	std::array<Nano::Memory::DeferredConstruct<BindingSet>, Information::FramesInFlight> m_Set0s = {};
-	Nano::Memory::DeferredConstruct<GraphicsPipeline> m_Pipeline = {};
+
+	Nano::Memory::DeferredConstruct<PipelineCompiler, true> m_PipelineCompiler = {};
+	AsyncGraphicsPipeline* m_Pipeline = nullptr;
 
 	Nano::Memory::DeferredConstruct<Buffer> m_VertexBuffer = {};
 	Nano::Memory::DeferredConstruct<Buffer> m_IndexBuffer = {};
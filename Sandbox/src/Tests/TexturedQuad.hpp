@@ -1,6 +1,10 @@
 #include "Tests/TestBase.hpp"
 #include "Common/Camera2D.hpp"
 
+#include <Obsidian/Renderer/BindlessTable.hpp>
+#include <Obsidian/Renderer/PipelineStateCache.hpp>
+#include <Obsidian/Renderer/ReadbackQueue.hpp>
+
 ////////////////////////////////////////////////////////////////////////////////////
 // Shaders
 ////////////////////////////////////////////////////////////////////////////////////
@@ -34,19 +38,27 @@ void main()
 
 inline constexpr std::string_view g_FragmentShader = R"(
 #version 460 core
+#extension GL_EXT_nonuniform_qualifier : require
 
 layout(location = 0) out vec4 o_Colour;
 
 layout(location = 0) in vec3 v_Position;
 layout(location = 1) in vec2 v_TexCoord;
 
-layout (set = 0, binding = 1) uniform sampler u_Sampler;
-layout (set = 0, binding = 2) uniform texture2D u_Texture;
+layout(push_constant) uniform BindlessIndices // set = 0, binding = 1
+{
+    uint Texture;
+    uint Sampler;
+} u_Indices;
+
+// Bindless table
+layout (set = 1, binding = 0) uniform texture2D u_Textures[];
+layout (set = 1, binding = 4) uniform sampler u_Samplers[];
 
 void main()
 {
 	// Combine texture and sampler
-    o_Colour = texture(sampler2D(u_Texture, u_Sampler), v_TexCoord);
+    o_Colour = texture(sampler2D(u_Textures[u_Indices.Texture], u_Samplers[u_Indices.Sampler]), v_TexCoord);
 	//o_Colour = vec4(v_TexCoord.x, v_TexCoord.y, 0.0, 1.0);
 }
 )";
@@ -92,13 +104,20 @@ struct PSInput
     float2 v_TexCoord : TEXCOORD0;
 };
 
-SamplerState u_Sampler : register(s1, space0);
-Texture2D u_Texture : register(t2, space0);
+cbuffer u_Indices : register(b1, space0)
+{
+    uint TextureIndex;
+    uint SamplerIndex;
+};
+
+// Bindless table
+Texture2D u_Textures[] : register(t0, space1);
+SamplerState u_Samplers[] : register(s4, space1);
 
 float4 main(PSInput input) : SV_TARGET 
 {
     //return float4(input.v_TexCoord.x, input.v_TexCoord.y, 0.0, 1.0);
-    return u_Texture.Sample(u_Sampler, input.v_TexCoord);
+    return u_Textures[TextureIndex].Sample(u_Samplers[SamplerIndex], input.v_TexCoord);
 }
 )";
 
@@ -161,6 +180,16 @@ inline constexpr uint8_t g_PixelArray[g_Width * g_Height * 4] = {
 	255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255, 255, 255, 0, 255
 };
 
+////////////////////////////////////////////////////////////////////////////////////
+// BindlessIndices
+////////////////////////////////////////////////////////////////////////////////////
+struct BindlessIndices
+{
+public:
+	uint32_t Texture = 0;
+	uint32_t Sampler = 0;
+};
+
 ////////////////////////////////////////////////////////////////////////////////////
 // Test
 ////////////////////////////////////////////////////////////////////////////////////
@@ -225,6 +254,7 @@ public:
 			.SetShaderStage(ShaderStage::Fragment)
 			.SetMainName("main")
 			.SetSPIRV(fragmentSPIRV)
+			.SetPushConstantsInfo(0, 1, sizeof(BindlessIndices))
 			.SetDebugName("Fragment Shader")
 		);
 
@@ -258,17 +288,12 @@ public:
 			)
 
 			// Fragment
-			.AddItem(BindingLayoutItem()
-				.SetSlot(2)
-				.SetVisibility(ShaderStage::Fragment)
-				.SetType(ResourceType::Image)
-				.SetDebugName("u_Texture")
-			)
 			.AddItem(BindingLayoutItem()
 				.SetSlot(1)
 				.SetVisibility(ShaderStage::Fragment)
-				.SetType(ResourceType::Sampler)
-				.SetDebugName("u_Sampler")
+				.SetType(ResourceType::PushConstants)
+				.SetSize(sizeof(BindlessIndices))
+				.SetDebugName("u_Indices")
 			)
 
 			.SetDebugName("Layout for: Set0")
@@ -285,8 +310,18 @@ public:
 			m_Set0s[i].Construct(m_BindingSetPool0.Get(), BindingSetSpecification());
 		}
 
+		// Bindless table // Note: The texture & sampler get indexed from register space 1
+		m_BindlessTable.Construct(m_Device.Get(), BindlessTableSpecification()
+			.SetRegisterSpace(1)
+			.SetVisibility(ShaderStage::Fragment)
+			.SetMaxImages(16)
+			.SetMaxSamplers(4)
+			.SetDebugName("BindlessTable")
+		);
+
 		// Pipeline
-		m_Pipeline.Construct(m_Device.Get(), GraphicsPipelineSpecification()
+		m_PipelineCache.Construct(m_Device.Get());
+		m_Pipeline = &m_PipelineCache->Acquire(GraphicsPipelineSpecification()
 			.SetPrimitiveType(PrimitiveType::TriangleList)
 			.SetInputLayout(m_InputLayout.Get())
 			.SetVertexShader(vertexShader)
@@ -323,10 +358,11 @@ public:
 
 			.SetRenderpass(m_Renderpass.Get())
 			.AddBindingLayout(m_BindingLayoutSet0.Get())
+			.AddBindingLayout(m_BindlessTable->GetLayout())
 			.SetDebugName("GraphicsPipeline")
 		);
 
-		// Destroy shaders
+		// Destroy shaders // Note: The cache compares shaders by their contents, so they don't have to outlive the pipeline
 		m_Device->DestroyShader(vertexShader);
 		m_Device->DestroyShader(fragmentShader);
 
@@ -392,6 +428,14 @@ public:
 
 			initCommand.CopyImage(m_Image.Get(), ImageSliceSpecification(), stagingImage, ImageSliceSpecification());
 
+			// Note: Reads the uploaded image back to verify the copy
+			ReadbackQueue readbackQueue(m_Device.Get());
+			readbackQueue.ReadImage(initCommand, m_Image.Get(), ImageSliceSpecification(), [](const ReadbackResult& result)
+			{
+				const uint8_t* texel = static_cast<const uint8_t*>(result.Memory);
+				OB_LOG_TRACE("First texel of the uploaded image: ({0}, {1}, {2}, {3})", static_cast<uint32_t>(texel[0]), static_cast<uint32_t>(texel[1]), static_cast<uint32_t>(texel[2]), static_cast<uint32_t>(texel[3]));
+			});
+
 			m_Sampler.Construct(m_Device.Get(), SamplerSpecification().SetDebugName(std::format("Sampler for: {0}", m_Image->GetSpecification().DebugName)));
 
 			// Uniformbuffer
@@ -415,16 +459,18 @@ public:
 
 			initCommand.Close();
 			initCommand.Submit(CommandListSubmitArgs());
+			readbackQueue.Submitted(initCommand);
 
 			// Upload to bindinsets
 			for (auto& set : m_Set0s)
-			{
 				set->SetItem(0, m_UniformBuffer.Get(), BufferRange());
-				set->SetItem(2, m_Image.Get(), ImageSubresourceSpecification());
-				set->SetItem(1, m_Sampler.Get());
-			}
+
+			// Note: Written into the table on the first Flush()
+			m_Indices.Texture = m_BindlessTable->AddImage(m_Image.Get());
+			m_Indices.Sampler = m_BindlessTable->AddSampler(m_Sampler.Get());
 
 			initCommand.WaitTillComplete();
+			readbackQueue.Poll();
 
 			m_Device->DestroyBuffer(stagingBuffer);
 			m_Device->DestroyStagingImage(stagingImage);
@@ -437,14 +483,17 @@ public:
 
 		m_Device->DestroyBuffer(m_UniformBuffer.Get());
 
+		m_PipelineCache->Release(*m_Pipeline);
+		m_PipelineCache.Destroy();
+
+		m_BindlessTable.Destroy();
+
 		m_Device->DestroySampler(m_Sampler.Get());
 		m_Device->DestroyImage(m_Image.Get());
 
 		m_Device->DestroyBuffer(m_IndexBuffer.Get());
 		m_Device->DestroyBuffer(m_VertexBuffer.Get());
 
-		m_Device->DestroyGraphicsPipeline(m_Pipeline.Get());
-
 		m_Device->FreeBindingSetPool(m_BindingSetPool0.Get());
 
 		m_Device->DestroyBindingLayout(m_BindingLayoutSet0.Get());
@@ -483,6 +532,8 @@ public:
 					m_CommandPools[m_Swapchain->GetCurrentFrame()]->Reset();
 					auto& list = m_CommandLists[m_Swapchain->GetCurrentFrame()];
 
+					m_BindlessTable->Flush();
+
 					list->Open();
 
 					list->StartRenderpass(RenderpassStartArgs()
@@ -494,12 +545,15 @@ public:
 						.SetColourClear({ 1.0f, 0.0f, 0.0f, 1.0f })
 					);
 
-					list->BindPipeline(m_Pipeline.Get());
+					list->BindPipeline(*m_Pipeline);
 
 					list->BindVertexBuffer(m_VertexBuffer.Get());
 					list->BindIndexBuffer(m_IndexBuffer.Get());
 
 					list->BindBindingSet(m_Set0s[m_Swapchain->GetCurrentFrame()]);
+					m_BindlessTable->Bind(list.Get());
+
+					list->PushConstants(&m_Indices, sizeof(BindlessIndices));
 
 					list->DrawIndexed(DrawArguments()
 						.SetVertexCount((sizeof(g_IndexData) / sizeof(g_IndexData[0])))
@@ -572,13 +626,17 @@ private:
 
 	Nano::Memory::DeferredConstruct<BindingSetPool> m_BindingSetPool0 = {};
 	std::array<Nano::Memory::DeferredConstruct<BindingSet>, Information::FramesInFlight> m_Set0s = {};
-	Nano::Memory::DeferredConstruct<GraphicsPipeline> m_Pipeline = {};
+	Nano::Memory::DeferredConstruct<BindlessTable, true> m_BindlessTable = {};
+
+	Nano::Memory::DeferredConstruct<PipelineStateCache, true> m_PipelineCache = {};
+	GraphicsPipeline* m_Pipeline = nullptr;
 
 	Nano::Memory::DeferredConstruct<Buffer> m_VertexBuffer = {};
 	Nano::Memory::DeferredConstruct<Buffer> m_IndexBuffer = {};
 
 	Nano::Memory::DeferredConstruct<Image> m_Image = {};
 	Nano::Memory::DeferredConstruct<Sampler> m_Sampler = {};
+	BindlessIndices m_Indices = {};
 
 	void* m_UniformMemory;
 	Nano::Memory::DeferredConstruct<Buffer> m_UniformBuffer = {};